@@ -0,0 +1,8445 @@
+// generated by tools/mkmanifest.c from goldsrc-manifest.lst, do not edit
+#define MANIFEST_COUNT 8302
+#define MANIFEST_BUCKETS 2076
+
+static const uint32_t manifest_seeds[MANIFEST_BUCKETS] = {
+	5, 11, 162, 32, 1, 46, 3, 28, 0, 10, 32, 11, 72, 67, 86, 247,
+	74, 73, 2, 11, 53, 5, 14, 7, 26, 8, 1, 16, 125, 35, 6, 0,
+	2, 17, 258, 5, 109, 41, 2, 10, 7, 116, 1, 2, 103, 44, 18, 3,
+	47, 1, 36, 2, 2, 10, 8, 18, 267, 2, 6, 129, 430, 5, 37, 137,
+	1, 14, 22, 1, 15, 149, 2, 1, 48, 350, 1, 25, 54, 3, 3, 5,
+	3, 1, 18, 47, 107, 2, 67, 73, 47, 1, 8, 7, 19, 5, 13, 57,
+	1, 10, 1, 19, 4, 39, 123, 7, 39, 5, 3, 8, 1, 4, 0, 89,
+	1, 8, 56, 8, 46, 41, 11, 45, 4, 122, 38, 323, 120, 17, 1, 281,
+	6, 74, 43, 11, 12, 244, 43, 12, 59, 1, 50, 18, 3, 107, 19, 281,
+	2, 1, 42, 42, 8, 2, 79, 117, 12, 25, 1, 2, 3, 1, 20, 7,
+	36, 26, 25, 1, 2, 3, 8, 111, 28, 55, 40, 68, 41, 2, 21, 2,
+	1, 37, 45, 19, 13, 71, 2, 275, 66, 286, 1, 6, 27, 182, 164, 31,
+	2, 50, 71, 13, 2, 36, 6, 2, 13, 113, 2, 16, 5, 11, 163, 1,
+	1, 1, 82, 4, 211, 622, 293, 20, 27, 14, 314, 150, 202, 32, 301, 150,
+	24, 4, 2, 2, 180, 15, 2, 5, 40, 3, 2, 187, 132, 37, 2, 14,
+	38, 8, 15, 0, 68, 1, 114, 22, 11, 8, 344, 72, 2, 5, 0, 5,
+	22, 1, 0, 91, 94, 2, 44, 39, 18, 5, 3, 1, 252, 1, 107, 1,
+	1, 1, 3, 32, 8, 3, 38, 3, 1, 1, 1, 15, 9, 3, 2, 491,
+	2, 38, 52, 29, 15, 5, 197, 14, 62, 1, 60, 4, 7, 2, 7, 4,
+	171, 127, 7, 27, 3, 219, 39, 22, 5, 111, 75, 344, 28, 94, 149, 11,
+	45, 69, 20, 14, 62, 1, 3, 19, 2, 1, 0, 154, 65, 21, 1, 23,
+	6, 60, 342, 16, 61, 89, 23, 258, 2, 3, 5, 2, 9, 1, 6, 3,
+	52, 54, 103, 2, 16, 121, 56, 20, 20, 6, 15, 6, 8, 1, 2, 166,
+	55, 3, 4, 159, 6, 40, 436, 33, 5, 5, 3, 11, 30, 36, 13, 3,
+	60, 5, 6, 4, 56, 415, 17, 42, 0, 2, 83, 39, 13, 6, 377, 11,
+	2, 5, 6, 7, 32, 2, 72, 4, 0, 2, 1, 18, 296, 4, 55, 4,
+	22, 15, 194, 6, 228, 8, 137, 7, 85, 21, 2, 175, 1, 38, 355, 24,
+	10, 28, 37, 57, 35, 50, 22, 2, 12, 5, 318, 20, 164, 80, 102, 380,
+	65, 35, 34, 4, 306, 88, 61, 163, 8, 19, 3, 5, 1, 0, 33, 99,
+	43, 317, 23, 3, 15, 9, 2, 14, 5, 159, 10, 36, 3, 70, 10, 3,
+	16, 16, 147, 6, 42, 7, 120, 1, 26, 218, 4, 3, 17, 78, 222, 17,
+	92, 29, 73, 144, 110, 15, 33, 1, 35, 76, 19, 43, 9, 69, 1, 87,
+	318, 365, 6, 379, 165, 1, 18, 182, 51, 10, 62, 167, 8, 5, 0, 1,
+	277, 96, 42, 2, 165, 216, 8, 4, 48, 50, 70, 188, 13, 15, 3, 6,
+	33, 31, 16, 3, 691, 287, 88, 20, 1, 35, 31, 13, 119, 22, 3, 15,
+	3, 3, 38, 482, 1, 5, 15, 16, 236, 210, 145, 1, 333, 2, 51, 7,
+	3, 559, 28, 182, 2, 4, 2, 1, 13, 591, 106, 242, 131, 17, 40, 82,
+	11, 9, 1, 7, 61, 103, 2, 1, 8, 104, 26, 156, 22, 2, 28, 92,
+	7, 1, 17, 7, 170, 18, 89, 15, 159, 46, 552, 235, 246, 1, 74, 241,
+	3, 10, 225, 6, 1, 3, 204, 244, 88, 217, 20, 64, 7, 1, 19, 96,
+	11, 150, 10, 8, 6, 1, 78, 9, 353, 10, 15, 55, 75, 2, 216, 168,
+	45, 7, 182, 136, 2, 240, 24, 4, 2, 372, 154, 83, 6, 1, 2, 2,
+	6, 5, 105, 88, 86, 12, 3, 27, 68, 287, 2, 6, 1, 128, 161, 26,
+	1, 2, 24, 25, 40, 109, 1, 24, 145, 99, 122, 80, 6, 297, 1, 51,
+	2, 8, 67, 1, 22, 5, 136, 253, 54, 12, 206, 17, 0, 54, 21, 1,
+	305, 45, 152, 132, 91, 34, 348, 108, 149, 1, 63, 53, 407, 2, 364, 61,
+	276, 2, 8, 77, 4, 1, 29, 9, 5, 8, 70, 6, 1, 10, 8, 43,
+	4, 9, 207, 98, 17, 202, 0, 36, 1, 9, 3, 26, 182, 11, 55, 10,
+	9, 56, 324, 158, 8, 9, 27, 3, 180, 12, 1, 639, 30, 266, 4, 323,
+	133, 290, 1, 850, 40, 30, 60, 36, 149, 73, 86, 1, 172, 32, 10, 261,
+	217, 29, 41, 25, 2, 16, 48, 150, 694, 1, 1, 77, 60, 42, 181, 187,
+	5, 5, 2, 39, 30, 29, 41, 3, 93, 142, 13, 191, 3, 11, 85, 2,
+	4, 141, 34, 8, 3, 179, 3, 1, 43, 230, 1114, 35, 122, 35, 15, 90,
+	560, 46, 6, 11, 17, 0, 32, 9, 61, 121, 0, 19, 85, 5, 91, 183,
+	511, 3, 2, 367, 0, 59, 15, 17, 126, 26, 2, 5, 318, 300, 63, 36,
+	1, 371, 1, 1, 4, 88, 74, 49, 143, 2, 44, 254, 10, 13, 7, 4,
+	4, 6, 77, 96, 119, 585, 56, 134, 24, 137, 12, 44, 6, 277, 1, 45,
+	44, 18, 18, 17, 18, 26, 18, 3, 3, 267, 5, 942, 649, 69, 47, 53,
+	118, 417, 148, 50, 3, 314, 1, 4, 3, 30, 421, 23, 8, 69, 6, 110,
+	13, 242, 3, 1, 340, 23, 82, 129, 629, 4, 301, 459, 4, 344, 109, 847,
+	95, 7, 122, 1, 449, 2, 113, 112, 13, 392, 3, 1, 2, 249, 142, 297,
+	232, 93, 21, 15, 108, 202, 106, 228, 13, 2, 3, 2, 51, 186, 1, 17,
+	517, 1, 335, 6, 606, 8, 16, 1, 274, 7, 628, 22, 40, 10, 10, 3,
+	1, 1, 72, 531, 20, 3, 183, 98, 27, 9, 3, 574, 31, 261, 101, 84,
+	232, 75, 420, 480, 1, 0, 3, 294, 83, 29, 119, 81, 4, 191, 0, 451,
+	53, 101, 468, 3, 13, 367, 160, 59, 2, 1, 237, 2, 189, 173, 9, 11,
+	26, 74, 1, 4, 1, 5, 1, 29, 411, 96, 150, 21, 5, 3, 218, 25,
+	1, 126, 109, 1, 207, 0, 29, 384, 536, 48, 13, 680, 21, 39, 58, 50,
+	130, 3, 188, 68, 711, 20, 8, 55, 287, 33, 229, 29, 3, 53, 279, 14,
+	43, 0, 27, 7, 19, 2, 642, 106, 277, 8, 381, 46, 442, 4, 169, 38,
+	598, 698, 42, 14, 60, 1, 765, 201, 33, 2, 1, 2, 45, 492, 6, 110,
+	17, 158, 1, 268, 672, 3, 31, 80, 33, 558, 150, 49, 15, 393, 2, 39,
+	24, 61, 1, 19, 607, 144, 136, 14, 8, 17, 268, 6, 122, 431, 442, 59,
+	0, 6, 15, 87, 152, 2, 3, 173, 30, 92, 48, 300, 700, 31, 468, 307,
+	71, 103, 185, 522, 147, 748, 42, 285, 1144, 41, 67, 18, 62, 54, 211, 5,
+	1, 28, 3, 4, 24, 44, 40, 53, 355, 10, 120, 403, 43, 63, 233, 192,
+	10, 631, 434, 376, 300, 8, 27, 2, 677, 1, 16, 40, 1, 206, 37, 19,
+	2, 41, 1, 2, 859, 44, 4, 7, 90, 31, 371, 1, 7, 197, 216, 102,
+	161, 21, 6, 18, 4, 22, 3, 303, 45, 157, 2, 0, 7, 2, 80, 1,
+	2, 292, 4, 1364, 3, 3, 3, 149, 202, 95, 27, 35, 1, 80, 17, 521,
+	1, 1, 231, 4, 288, 338, 87, 968, 1, 3, 3, 173, 0, 7, 9, 72,
+	94, 444, 3, 51, 54, 32, 4, 121, 379, 27, 2, 545, 488, 114, 252, 372,
+	2, 202, 69, 244, 1, 16, 12, 4, 161, 373, 127, 140, 14, 108, 14, 53,
+	187, 558, 83, 9, 443, 1, 2, 191, 60, 174, 26, 370, 307, 2, 10, 436,
+	523, 2, 43, 118, 35, 50, 126, 500, 82, 4, 1197, 130, 5, 1049, 807, 9,
+	3, 19, 1872, 1, 3, 35, 19, 162, 2773, 9, 698, 178, 78, 225, 78, 31,
+	31, 331, 55, 0, 25, 5, 415, 4, 11, 267, 3, 163, 1, 2, 6, 2,
+	1, 45, 1259, 63, 104, 0, 21, 189, 577, 9, 117, 347, 3, 181, 430, 1,
+	104, 3, 17, 2, 28, 132, 35, 563, 1, 35, 577, 19, 593, 15, 12, 4,
+	9, 272, 756, 1, 49, 2, 32, 249, 2, 47, 6, 69, 210, 52, 375, 253,
+	125, 117, 47, 608, 470, 213, 656, 35, 3, 73, 4, 12, 41, 45, 219, 93,
+	55, 1022, 0, 104, 404, 189, 22, 246, 203, 0, 10, 591, 55, 4, 50, 173,
+	43, 313, 1, 50, 103, 10, 251, 2, 94, 82, 12, 37, 453, 8, 12, 421,
+	18, 8, 2, 62, 7, 1, 30, 0, 0, 1962, 3, 8, 4, 30, 926, 3,
+	18, 3, 2, 21, 73, 420, 29, 337, 195, 22, 432, 641, 27, 556, 481, 136,
+	0, 467, 1131, 951, 0, 611, 85, 85, 89, 104, 365, 19, 12, 5, 1383, 69,
+	24, 58, 319, 92, 172, 1, 170, 11, 83, 12, 61, 1093, 6, 1, 266, 148,
+	503, 1, 1233, 4, 1167, 14, 285, 424, 22, 2969, 30, 2, 1040, 3262, 38, 46,
+	2, 101, 280, 1167, 39, 44, 329, 56, 221, 13, 69, 3, 10, 265, 513, 578,
+	229, 658, 55, 1418, 9, 381, 21, 464, 778, 4, 15, 659, 1396, 163, 1, 1,
+	464, 27, 68, 969, 23, 1, 58, 95, 15, 411, 25, 33, 26, 4, 59, 1,
+	2, 2068, 32, 94, 2, 2, 11, 1, 28, 25, 70, 469, 2042, 2, 521, 258,
+	2764, 54, 166, 144, 2, 7, 416, 4, 227, 480, 61, 454, 1, 7, 2, 4,
+	156, 204, 2, 8, 76, 30, 1101, 798, 198, 1, 62, 10, 89, 350, 2275, 0,
+	1137, 1, 1, 1903, 12, 3, 149, 624, 320, 42, 21, 292, 724, 521, 194, 1,
+	41, 6, 542, 2084, 3, 387, 459, 1168, 616, 49, 6, 27, 127, 417, 1, 4,
+	1785, 5, 327, 18, 12, 85, 408, 98, 240, 4336, 486, 5, 2, 252, 5, 87,
+	515, 664, 441, 285, 470, 393, 68, 2078, 4, 1429, 32, 21, 221, 1035, 356, 24,
+	11, 2397, 21, 30, 448, 847, 863, 479, 477, 81, 202, 70, 417, 287, 9, 2,
+	2, 1, 86, 11, 4, 5, 11, 1, 39, 1056, 1535, 2761, 5180, 8, 361, 836,
+	203, 621, 77, 140, 42, 322, 34, 63, 5, 2, 333, 59, 4, 513, 279, 3266,
+	32, 42, 1, 106, 2, 19, 1, 144, 6, 1, 4, 988, 2, 325, 7, 31,
+	65, 706, 103, 994, 6, 11, 2, 459, 40, 2, 10, 51, 3, 1, 0, 13,
+	6, 440, 3468, 3206, 122, 91, 2604, 196, 26, 308, 290, 1095, 12, 781, 262, 17,
+	76, 31, 156, 12, 1429, 383, 82, 3038, 887, 920, 29, 2343, 376, 1, 1, 300,
+	2, 301, 1120, 3, 1201, 145, 22, 211, 32, 51, 85, 86, 204, 4, 96, 775,
+	12, 762, 582, 1536, 87, 15, 963, 102, 172, 247, 3, 6, 155, 438, 154, 170,
+	1, 1229, 1, 697, 184, 329, 152, 3, 218, 291, 1159, 3, 21, 421, 1593, 56,
+	372, 776, 303, 8, 13, 212, 608, 362, 3846, 676, 2501, 924, 19, 11, 1, 218,
+	491, 3, 53, 796, 3002, 4, 44, 866, 1, 408, 342, 4, 15, 40, 2304, 658,
+	540, 220, 27, 3, 12678, 3, 1625, 1209, 29, 33, 1196, 37, 381, 57, 9, 34,
+	61, 21, 27, 53, 666, 209, 79, 671, 3091, 4977, 22, 2, 1807, 3, 59, 939,
+	940, 4, 274, 1461, 690, 35, 745, 2, 5580, 180, 560, 13, 82, 328, 1811, 21,
+	32, 37, 91, 0, 2102, 359, 8, 265, 4, 544, 6134, 1, 468, 255, 85, 356,
+	5373, 306, 7, 962, 117, 4448, 1, 133, 11, 18, 17, 460, 1, 226, 1751, 29,
+	109, 3, 55, 33, 4, 61, 10, 5995, 183, 152, 3494, 1579, 87, 1613, 3, 501,
+	71, 1, 39, 424, 659, 685, 3293, 604, 2, 3337, 8, 1, 2, 455, 680, 21,
+	10, 479, 403, 0, 49, 18, 314, 5249, 660, 57, 1034, 191, 5, 18, 67, 6643,
+	1, 1, 16, 22, 695, 346, 3463, 4817, 102, 108, 545, 1963, 0, 0, 1129, 24,
+	18, 248, 0, 1112, 15, 35, 382, 1, 0, 114, 186, 2,
+};
+
+static const manifest_slot manifest_slots[MANIFEST_COUNT] = {
+	{ 0xBB01361F, 0, "models/baby_voltigore.mdl" },
+	{ 0xA68BF136, 0, "sound/ambience/dodambience3.wav" },
+	{ 0x545E3F2C, 0, "gfx/env/cliffbk.tga" },
+	{ 0xF4F552F9, 0, "sound/vox/alpha.wav" },
+	{ 0x62EACCBB, 0, "sound/scientist/theoretically.wav" },
+	{ 0x1E268908, 0, "gfx/env/greenrt.tga" },
+	{ 0x7D35C59F, 0, "sound/sentences.txt" },
+	{ 0xA349E0F9, 0, "models/ngrenade.mdl" },
+	{ 0x2E2D8906, 0, "sound/vox/track.wav" },
+	{ 0xD74EBD08, 0, "sound/scientist/c1a4_sci_trust.wav" },
+	{ 0x8426C764, 0, "overviews/dod_northbound.bmp" },
+	{ 0xC93092A0, 0, "sprites/comp_c02.spr" },
+	{ 0xA18FDC78, 0, "sprites/mapmarkers/arrow_nw.spr" },
+	{ 0x0FF56AE9, 0, "sound/boid/boid_idle2.wav" },
+	{ 0x4258B525, 0, "sound/player/usgrenade.wav" },
+	{ 0x636DCF70, 0, "models/shrapnel.mdl" },
+	{ 0x88AC57AC, 0, "gfx/env/neb7rt.bmp" },
+	{ 0x73E91D3D, 0, "sprites/weapon_shockrifle.txt" },
+	{ 0x98255FD4, 0, "sound/otis/no.wav" },
+	{ 0x73983ADB, 0, "sound/rosenberg/ro_tele_xen02.wav" },
+	{ 0x59B2DB41, 0, "resource/valve_spanish.txt" },
+	{ 0x13A21ECE, 0, "models/gonome.mdl" },
+	{ 0xF166627D, 0, "sound/ba_holo/tr_holo_hevnouse.wav" },
+	{ 0xDC12B811, 0, "sound/ambience/sheep.wav" },
+	{ 0x25E136FC, 0, "sound/vox/vent.wav" },
+	{ 0x02AA8919, 0, "sound/agrunt/ag_die5.wav" },
+	{ 0x2942ED4F, 0, "models/mechgibs.mdl" },
+	{ 0xD582FF0F, 0, "sprites/mapmarker.spr" },
+	{ 0xE45A7F7D, 0, "sound/scientist/c1a0_sci_disa.wav" },
+	{ 0x82F97A01, 0, "sound/fans/fan1off.wav" },
+	{ 0xA636C51C, 0, "sound/vox/white.wav" },
+	{ 0x0E4F4EB0, 0, "models/player/recruit/recruit.bmp" },
+	{ 0xB5933007, 0, "models/zombiet.mdl" },
+	{ 0x1F98AC32, 0, "sound/sentences/c2a1_0.wav" },
+	{ 0x3ACE8BE0, 0, "sound/scientist/sci_pain4.wav" },
+	{ 0x78AFBF61, 0, "sound/scientist/peculiarmarks.wav" },
+	{ 0x67E7DA88, 0, "models/w_wflag.mdl" },
+	{ 0x950FE603, 0, "sprites/tfchud04.spr" },
+	{ 0xF6F8276C, 0, "maps/dod_zalec_detail.txt" },
+	{ 0x3AE4C04C, 0, "models/p_scopedfg42bu.mdl" },
+	{ 0xBBC5C03E, 0, "sprites/hud6.spr" },
+	{ 0x6D6B9F33, 0, "sprites/icon_truck_allies.spr" },
+	{ 0xD240F09C, 0, "sound/weapons/xbow_hit1.wav" },
+	{ 0xAC21013C, 0, "sprites/spec_camera.spr" },
+	{ 0x01E7A190, 0, "models/player/shephard/shephard.bmp" },
+	{ 0x4536160E, 0, "gfx/env/spaceup.tga" },
+	{ 0x6C2D921C, 0, "sound/sentences/dc3.wav" },
+	{ 0xF2894F2C, 0, "sound/headcrab/hc_idle2.wav" },
+	{ 0x9E9F2E6F, 0, "gfx/vgui/640_otis.tga" },
+	{ 0x2AF2C0B0, 0, "sound/bullchicken/bc_bite2.wav" },
+	{ 0xDAECDC7F, 0, "models/v_mortar.mdl" },
+	{ 0x5FF9104D, 0, "sound/fvox/warning.wav" },
+	{ 0x2FD73050, 0, "servers/icon_secure_deny.tga" },
+	{ 0x207800B6, 0, "sound/hgrunt/objective!.wav" },
+	{ 0x2DFC6025, 0, "gfx/env/morningdewlf.tga" },
+	{ 0x12DF8D96, 0, "sound/sentences/hev_med2.wav" },
+	{ 0x4D8C83C4, 0, "sound/rosenberg/ro_tele_xen07.wav" },
+	{ 0x9006BDEB, 0, "sound/ambience/nebwerf.wav" },
+	{ 0x0FD30086, 0, "sound/weapons/pwach.wav" },
+	{ 0xBFC0D9D5, 0, "sound/weapons/knife_stab.wav" },
+	{ 0xB75FDC67, 0, "gfx/vgui/m249.tga" },
+	{ 0x049ACAB0, 0, "sound/sentences/c1a0_4.wav" },
+	{ 0x1DBF6F5F, 0, "sprites/glow_org.spr" },
+	{ 0x0144A51E, 0, "sound/aslave/slv_word2.wav" },
+	{ 0xBD17E2AA, 0, "sound/sentences/hev_fire.wav" },
+	{ 0xAA9836EF, 0, "resource/cstrike_tchinese.txt" },
+	{ 0x05FB2946, 0, "sound/gman/gman_mumble5.wav" },
+	{ 0x63A66241, 0, "sound/garg/gar_idle5.wav" },
+	{ 0xCD9819B5, 0, "sprites/xfireball3.spr" },
+	{ 0x65BCEA4A, 0, "sound/hgrunt/lets.wav" },
+	{ 0x5950163A, 0, "sound/ba_holo/tr_holo_commencing.wav" },
+	{ 0x3B172454, 0, "sound/hgrunt/target!.wav" },
+	{ 0xA82E34BA, 0, "sound/misc/tele_open_short.wav" },
+	{ 0xCB9090E8, 0, "servers/serverbrowser_french.txt" },
+	{ 0xD21DDE61, 0, "sound/fgrunt/bogies.wav" },
+	{ 0x6FCB0BB3, 0, "sound/ambience/littlemachine2.wav" },
+	{ 0xFA322F51, 0, "sound/barney/killme.wav" },
+	{ 0x34A0EA40, 0, "models/player/gman/gman.bmp" },
+	{ 0x20A0874C, 0, "sound/barney/ba_pissme.wav" },
+	{ 0xC5BE5776, 0, "sound/items/suitchargeok1.wav" },
+	{ 0x0AD0FAA2, 0, "sound/scientist/startle7.wav" },
+	{ 0x6ECBDF41, 0, "sound/vox/fast.wav" },
+	{ 0xD97148B5, 0, "sprites/obj_icons/dod_zalec/icon_obj_custom2_brit.spr" },
+	{ 0x5F2FE211, 0, "sound/hgrunt/over!.wav" },
+	{ 0x6D34F914, 0, "sprites/bhit.spr" },
+	{ 0x2DC1A7CC, 0, "models/w_bren.mdl" },
+	{ 0x1BD5152D, 0, "models/v_p90.mdl" },
+	{ 0x68597869, 0, "sound/hgrunt/secure.wav" },
+	{ 0xCB73F03B, 0, "sprites/640hud16.spr" },
+	{ 0xAD252467, 0, "models/gib_b_gib.mdl" },
+	{ 0x7DB3786E, 0, "sprites/weapon_xm1014.txt" },
+	{ 0x4EF57834, 0, "sound/sentences/hev_v0.wav" },
+	{ 0xEDF77D0F, 0, "gfx/env/dusklf.bmp" },
+	{ 0x1C5EEF58, 0, "sound/pitdrone/pit_drone_melee_attack1.wav" },
+	{ 0x12354A99, 0, "sound/vox/sierra.wav" },
+	{ 0x0938C533, 0, "sound/drill/firstroom01.wav" },
+	{ 0x5F1C2131, 0, "sound/otis/ot_intro_hello1.wav" },
+	{ 0xDA0C5E58, 0, "sound/vox/seconds.wav" },
+	{ 0xC41B89DF, 0, "sound/weapons/scout_bolt.wav" },
+	{ 0xE113AD95, 0, "models/agibs.mdl" },
+	{ 0x15243700, 0, "sprites/shot_smoke3.spr" },
+	{ 0xEA6B2344, 0, "sprites/tree1.spr" },
+	{ 0x851340A9, 0, "sound/plats/heavystop2.wav" },
+	{ 0x54D96F6E, 0, "sprites/icon_88_allies_destroyed.spr" },
+	{ 0x7FD9D558, 0, "sound/misc/teleporter_off.wav" },
+	{ 0x2CE59A46, 0, "sound/gman/gman_choose2.wav" },
+	{ 0x056200B0, 0, "models/dummyguerilla.mdl" },
+	{ 0x5EBB3751, 0, "sound/scientist/startle2.wav" },
+	{ 0x8601FA9B, 0, "sound/vox/warn.wav" },
+	{ 0x90E81140, 0, "sound/sentences/hev_egonpower.wav" },
+	{ 0x87BEF233, 0, "sprites/weapon_famas.txt" },
+	{ 0xE8B40AF1, 0, "sound/otis/live.wav" },
+	{ 0xB31B2505, 0, "dod_kraftstoff.wad" },
+	{ 0x6848F961, 0, "sprites/weapon_mac10.txt" },
+	{ 0x823F2360, 0, "sound/sentences/hg_check0.wav" },
+	{ 0x34888B47, 0, "sound/x/x_recharge1.wav" },
+	{ 0xBA08CB56, 0, "sound/radio/com_reportin.wav" },
+	{ 0xF965F9AD, 0, "sound/sentences/hg_cover0.wav" },
+	{ 0x260B54FF, 0, "resource/icon_friend_indicator_scoreboard.tga" },
+	{ 0x3279A3C3, 0, "sound/player/pl_jumpland2.wav" },
+	{ 0x3A8A2422, 0, "sound/barney/stop1.wav" },
+	{ 0x673A0E6D, 0, "sound/player/bhit_flesh-1.wav" },
+	{ 0xD94483DA, 0, "sound/ambience/crickets.wav" },
+	{ 0x106D9042, 0, "sound/gonarch/gon_step1.wav" },
+	{ 0xC2793325, 0, "models/p_ak47.mdl" },
+	{ 0x4575653E, 0, "models/recruit_push.mdl" },
+	{ 0x356E6CAD, 0, "sound/fgrunt/intro_fg12.wav" },
+	{ 0xB25C8097, 0, "overviews/cs_assault.bmp" },
+	{ 0x8CC16885, 0, "sound/weapons/ump45_clipout.wav" },
+	{ 0x98377BC6, 0, "sound/player/damage6.wav" },
+	{ 0x1E997AC0, 0, "sound/vox/agent.wav" },
+	{ 0xB4E004F4, 0, "sound/barney/ba_security1_door1.wav" },
+	{ 0x087D733E, 0, "sprites/rifle_smoke3.spr" },
+	{ 0xC4BE9C76, 0, "sound/ambience/drips.wav" },
+	{ 0x2C4FC3E6, 0, "sound/zombie/zo_pain2.wav" },
+	{ 0xA9BB3186, 0, "sound/holo/tr_sci_use.wav" },
+	{ 0x5109ED3F, 0, "sound/ambience/freezer_fan.wav" },
+	{ 0xB1018C6E, 0, "sprites/640hudof05.spr" },
+	{ 0xC4A17D82, 0, "overviews/boot_camp.tga" },
+	{ 0x37656607, 0, "sound/squeek/sqk_hunt2.wav" },
+	{ 0xB5A9CEB2, 0, "sound/hgrunt/hostiles!.wav" },
+	{ 0xB2C83765, 0, "models/scientist11.mdl" },
+	{ 0x847FD42D, 0, "sound/holo/tr_holo_jduck.wav" },
+	{ 0xE1F14AE9, 0, "sound/vox/please.wav" },
+	{ 0x327FED0A, 0, "sound/vox/shoot.wav" },
+	{ 0x28C7F787, 0, "gfx/detail/dt_metal2.tga" },
+	{ 0x8323AEDF, 0, "sound/fgrunt/clear.wav" },
+	{ 0x3EA308B4, 0, "sound/controller/con_alert3.wav" },
+	{ 0x2AB39473, 0, "sound/barney/thinking.wav" },
+	{ 0x47911414, 0, "sound/gonarch/gon_childdie1.wav" },
+	{ 0x3D93F8AD, 0, "sound/sentences/c1a0_7.wav" },
+	{ 0xB56027C7, 0, "servers/serverbrowser_koreana.txt" },
+	{ 0xE3A16B23, 0, "sound/otis/donthurtem.wav" },
+	{ 0x381FBBBC, 0, "gfx/env/xen8dn.tga" },
+	{ 0x055052E6, 0, "sound/fvox/power_below.wav" },
+	{ 0xFD05B1B6, 0, "sprites/smoke_blk.spr" },
+	{ 0x0920A135, 0, "sound/sentences/c1a1_6.wav" },
+	{ 0x4C778EB3, 0, "models/helmet_us.mdl" },
+	{ 0xB6A4EC4A, 0, "models/p_k43.mdl" },
+	{ 0xA03FF51E, 0, "sound/player/britsticktogether.wav" },
+	{ 0xD4FB29B3, 0, "sprites/rjet1.spr" },
+	{ 0x107AED7C, 0, "models/player/drill/drill.mdl" },
+	{ 0xCA8207A3, 0, "sound/x/x_ballattack1.wav" },
+	{ 0x01661EC7, 0, "sound/weapons/whizz17.wav" },
+	{ 0xCCA64A5E, 0, "overviews/dod_chemille.bmp" },
+	{ 0xCF80D20E, 0, "sound/vox/arrest.wav" },
+	{ 0x1A55C00C, 0, "sound/holo/holostn10.wav" },
+	{ 0xADC4DDA1, 0, "sprites/weapon_9mmar.txt" },
+	{ 0xFF8E291F, 0, "models/allied_grunt.mdl" },
+	{ 0x57F45009, 0, "sprites/playerflameloop.spr" },
+	{ 0x2B255BBA, 0, "models/hat_axis.mdl" },
+	{ 0xAE62C940, 0, "sound/scientist/of1a5_sc01.wav" },
+	{ 0x93ECF839, 0, "sprites/explode01.spr" },
+	{ 0xAC2E45A2, 0, "sound/plats/freightmove2.wav" },
+	{ 0xC0F4B15B, 0, "sound/fgrunt/siryessir.wav" },
+	{ 0xADF4405D, 0, "sound/ambience/alien_builder.wav" },
+	{ 0x2652B10B, 0, "sound/tride/c0a0_tr_arrive.wav" },
+	{ 0x328E9AFD, 0, "sound/ambience/opera.wav" },
+	{ 0x40E70794, 0, "sound/player/jumplanding.wav" },
+	{ 0x0FAF45EA, 0, "sound/sentences/hev_c1t.wav" },
+	{ 0x62CDE7AD, 0, "gfx/env/avantirt.bmp" },
+	{ 0x10DBED94, 0, "gfx/env/neb6ft.tga" },
+	{ 0xEAD20C9B, 0, "sound/vox/five.wav" },
+	{ 0x63AB2C70, 0, "sound/rosenberg/ro_tele_final28.wav" },
+	{ 0x0E5DC717, 0, "sprites/bmp/1medic01.bmp" },
+	{ 0x1CD5BBB5, 0, "gfx/vgui/round_corner_ne.tga" },
+	{ 0xBCBE3710, 0, "sound/fgrunt/onepiece.wav" },
+	{ 0xFEC3F748, 0, "sound/vox/leak.wav" },
+	{ 0x72FABEFC, 0, "models/wire_copper24.mdl" },
+	{ 0x09D5D440, 0, "sound/scientist/iwoundedbad.wav" },
+	{ 0x3244022C, 0, "sprites/weapon_disc.txt" },
+	{ 0x210623A8, 0, "gfx/env/duskup.bmp" },
+	{ 0xA56C9843, 0, "sound/vox/we.wav" },
+	{ 0xADF0FD84, 0, "sound/vox/hit.wav" },
+	{ 0x8DD1120E, 0, "sound/hgrunt/hg_got_barney.wav" },
+	{ 0x4E400822, 0, "sprites/muz3.spr" },
+	{ 0xFA452061, 0, "sound/scientist/hellofromlab.wav" },
+	{ 0x9FDA0239, 0, "gfx/env/sky_blu_up.bmp" },
+	{ 0x9B0B0400, 0, "overviews/de_cbble.txt" },
+	{ 0xFFB8CD65, 0, "sound/weapons/whizz4.wav" },
+	{ 0x1E89DBCF, 0, "sound/headcrab/hc_idle3.wav" },
+	{ 0x49523629, 0, "sprites/weapon_m249.txt" },
+	{ 0x2EE8697B, 0, "sound/scientist/sci_1thou.wav" },
+	{ 0xA36F9785, 0, "gfx/env/cliffup.bmp" },
+	{ 0xA88D5927, 0, "de_airstrip.wad" },
+	{ 0xF1D07FB3, 0, "sound/sentences/nf3.wav" },
+	{ 0x9271EB67, 0, "models/scientist04.mdl" },
+	{ 0xBAC7BDAB, 0, "sound/rosenberg/ro_yard_rose4.wav" },
+	{ 0x1665120D, 0, "sound/hgrunt/bag!.wav" },
+	{ 0x970EFB99, 0, "sound/player/pl_gravel2.wav" },
+	{ 0xFDC79FFE, 0, "gfx/env/neb2blf.tga" },
+	{ 0x30F98811, 0, "overviews/p_se_3.tga" },
+	{ 0x86363E1B, 0, "sound/scientist/c3a2_sci_notyet.wav" },
+	{ 0x8476716F, 0, "sound/hgrunt/damn!.wav" },
+	{ 0x1EA972E3, 0, "sound/weapons/bazookareload.wav" },
+	{ 0x8F1CB509, 0, "sound/common/launch_deny2.wav" },
+	{ 0x3137B5B1, 0, "sprites/d-tele1.spr" },
+	{ 0x83B3482F, 0, "gfx/vgui/1280_arrowleft.tga" },
+	{ 0x49B3F959, 0, "sound/fgrunt/medical.wav" },
+	{ 0xBCDDB682, 0, "sound/vox/lima.wav" },
+	{ 0x37B2CDC8, 0, "sprites/shockwave.spr" },
+	{ 0xFEE038D9, 0, "overviews/de_dust.bmp" },
+	{ 0x8B2B27DF, 0, "sound/vox/energy.wav" },
+	{ 0x878BC677, 0, "sound/rosenberg/ro_tele_final25.wav" },
+	{ 0xE0EF013D, 0, "sound/sentences/c3a2_3.wav" },
+	{ 0x810E31F6, 0, "models/v_shot2.mdl" },
+	{ 0x39A84E09, 0, "sound/rosenberg/ro_mortal1.wav" },
+	{ 0xA63A5E5A, 0, "overviews/hunted.tga" },
+	{ 0xAA0B6736, 0, "sound/drill/secondroom02.wav" },
+	{ 0xC6B83F3A, 0, "sound/buttons/button1.wav" },
+	{ 0xCF46E80C, 0, "sound/hgrunt/c2a3_ambush_vox.wav" },
+	{ 0x502A0FB3, 0, "sound/scientist/sc_pok0.wav" },
+	{ 0x42843E86, 0, "gfx/vgui/kevlar.tga" },
+	{ 0xDFEF4987, 0, "models/w_rpgammo_bigt.mdl" },
+	{ 0x706E4D6E, 0, "sound/fvox/twenty.wav" },
+	{ 0xD5124A46, 0, "sound/ctf/bm_flagtaken.wav" },
+	{ 0x142CC9AB, 0, "sound/hgrunt/recon.wav" },
+	{ 0x18636D47, 0, "sound/ba_holo/tr_holo_target.wav" },
+	{ 0x9C799924, 0, "sound/weapons/sniper_bolt2.wav" },
+	{ 0xE1FF692B, 0, "sound/doors/doormove3.wav" },
+	{ 0xBA2C9CDA, 0, "sound/sentences/c1a2_8.wav" },
+	{ 0x8731AFFA, 0, "sound/vox/superconducting.wav" },
+	{ 0x4DF5814D, 0, "gfx/env/city1dn.tga" },
+	{ 0xFBE9FB99, 0, "sound/fvox/hev_shutdown.wav" },
+	{ 0xC2EB0A1F, 0, "sound/weapons/elite_clipout.wav" },
+	{ 0xE5AEDCD0, 0, "overviews/dod_charlie.txt" },
+	{ 0x434756F4, 0, "sound/vox/degrees.wav" },
+	{ 0x80FAC2A8, 0, "models/scigun.mdl" },
+	{ 0xD5EF1D28, 0, "sound/barney/c2a4_ba_arg1a.wav" },
+	{ 0x72E2F19C, 0, "sound/sentences/hev_med0.wav" },
+	{ 0x75274ED1, 0, "sound/scientist/c1a0_sci_dis8a.wav" },
+	{ 0xD5126889, 0, "sound/debris/pushbox3.wav" },
+	{ 0x09845A6E, 0, "sound/ambience/fan1.wav" },
+	{ 0x80B8E263, 0, "sound/hgrunt/fire!.wav" },
+	{ 0xF84A2429, 0, "gfx/vgui/640_scoutred.tga" },
+	{ 0x16117B52, 0, "sound/agrunt/ag_fire2.wav" },
+	{ 0x54D2734C, 0, "sound/scientist/c1a3_sci_rescued.wav" },
+	{ 0x27E43142, 0, "models/w_p90.mdl" },
+	{ 0xEEAD24FE, 0, "gfx/vgui/1600_timer.tga" },
+	{ 0x2FF1ED98, 0, "sprites/bmp/tffire03.bmp" },
+	{ 0x7648FA0D, 0, "sound/hgrunt/gr_pain5.wav" },
+	{ 0x0E026281, 0, "sound/scientist/scream20.wav" },
+	{ 0x43CAE831, 0, "models/w_9mmhandgunt.mdl" },
+	{ 0x069FD4CA, 0, "models/rope16.mdl" },
+	{ 0x70DCC00C, 0, "models/mapmodels/hk_satchel.mdl" },
+	{ 0xB578735A, 0, "sound/fvox/north.wav" },
+	{ 0x3C010D39, 0, "sound/vox/blocked.wav" },
+	{ 0xCE12B3F9, 0, "sound/drill/livefire08.wav" },
+	{ 0x9186EF43, 0, "sound/leech/leech_bite2.wav" },
+	{ 0x578310DD, 0, "gfx/env/grnplsntlf.tga" },
+	{ 0x9D5302EE, 0, "sound/sentences/c1a0_19.wav" },
+	{ 0x88B9B06A, 0, "sound/vox/leave.wav" },
+	{ 0x0BC8EE3C, 0, "sound/fvox/blood_plasma.wav" },
+	{ 0xA11E831D, 0, "maps/dod_charlie.txt" },
+	{ 0x371A48C3, 0, "sound/holo/tr_holo_lightoff.wav" },
+	{ 0xB5116E45, 0, "sprites/640_falling.spr" },
+	{ 0x2CF67050, 0, "sound/ambience/alien_creeper.wav" },
+	{ 0x9FF560BF, 0, "models/w_crowbart.mdl" },
+	{ 0x1693B646, 0, "sound/holo/tr_holo_steam.wav" },
+	{ 0x75FBAE28, 0, "sound/sentences/c2a2_5.wav" },
+	{ 0x69427C31, 0, "sound/otis/bully.wav" },
+	{ 0x72A65D0A, 0, "sound/hgrunt/ok.wav" },
+	{ 0xBFB89488, 0, "sound/nihilanth/nil_now_die.wav" },
+	{ 0x6D78DBB2, 0, "models/p_9mmhandgun2.mdl" },
+	{ 0xEC5BDAB6, 0, "sound/vox/resistance.wav" },
+	{ 0x4B8D6100, 0, "sound/sentences/hev_11p.wav" },
+	{ 0x694F6B2E, 0, "sprites/ofch1.spr" },
+	{ 0xBE56B081, 0, "sound/drill/dr2_add08.wav" },
+	{ 0x8E138E36, 0, "sound/drill/dr2_add01.wav" },
+	{ 0xAD142FE9, 0, "models/hgrunt_torch01.mdl" },
+	{ 0x0BD96E0B, 0, "gfx/env/de_stormft.bmp" },
+	{ 0x27109ADA, 0, "sound/weapons/knifeswing.wav" },
+	{ 0xC56FF230, 0, "classes/short_squadleader.txt" },
+	{ 0x4462ED68, 0, "sound/scientist/c1a0_sci_ctrl4a.wav" },
+	{ 0xEF789EE1, 0, "overviews/dod_sturm.txt" },
+	{ 0x7B81CA39, 0, "sound/misc/r_tele2.wav" },
+	{ 0x41F6EA50, 0, "sound/hgrunt/control!.wav" },
+	{ 0x6BA4E491, 0, "sound/sentences/hg_taunt3.wav" },
+	{ 0x8CF1C877, 0, "sound/scientist/nooo.wav" },
+	{ 0xFBC23CAA, 0, "sprites/obj_icons/dod_saints/icon_obj_custom2_axis.spr" },
+	{ 0xFAA41CB4, 0, "sound/radio/bombdef.wav" },
+	{ 0xF3CFD2A6, 0, "sound/hgrunt/signs.wav" },
+	{ 0x587DD41B, 0, "sound/otis/closet.wav" },
+	{ 0x5BE147A2, 0, "sound/barney/imhit.wav" },
+	{ 0x04E2399C, 0, "models/w_m40a1clip.mdl" },
+	{ 0x92EE3CFC, 0, "sound/apache/ap_rotor2.wav" },
+	{ 0x9BF0ECC3, 0, "resource/menu_hl_with_icon.tga" },
+	{ 0x1FDAA5BC, 0, "sound/player/pl_swim2.wav" },
+	{ 0x83109DAD, 0, "sound/voltigore/voltigore_pain2.wav" },
+	{ 0xF348765D, 0, "sound/holo/holostn6.wav" },
+	{ 0xCE7539EE, 0, "sprites/effects/adrian/water_big.spr" },
+	{ 0x592D63F9, 0, "sound/houndeye/he_hunt3.wav" },
+	{ 0xB1075ADB, 0, "gfx/vgui/1024_arrowup.tga" },
+	{ 0x0BE0DB36, 0, "models/agrunt.mdl" },
+	{ 0x2E29EEF5, 0, "sound/vox/evacuate.wav" },
+	{ 0xA77648F0, 0, "sound/sentences/echem0.wav" },
+	{ 0xCD3C6261, 0, "sound/radio/stormfront.wav" },
+	{ 0x5C952718, 0, "sound/otis/hell.wav" },
+	{ 0x08CF68A5, 0, "sound/hgrunt/here!.wav" },
+	{ 0x7B4D2578, 0, "sound/barney/ba_shot3.wav" },
+	{ 0x4D0C15A6, 0, "sound/hgrunt/delta.wav" },
+	{ 0x04FC6123, 0, "sound/rosenberg/ro_wait1.wav" },
+	{ 0xF93041B3, 0, "gfx/env/desertlf.bmp" },
+	{ 0xEAFAA278, 0, "gfx/vgui/640_pyroblue.tga" },
+	{ 0x0E91F042, 0, "sound/ambience/rifle2.wav" },
+	{ 0x80EFBADB, 0, "sound/ba_holo/tr_holo_pipeduck.wav" },
+	{ 0x95778EBE, 0, "sound/ba_holo/tr_holo_jumpgap.wav" },
+	{ 0x240AA5D7, 0, "sound/sentences/c2a4_2.wav" },
+	{ 0xF912B486, 0, "sound/tentacle/te_sing1.wav" },
+	{ 0x8561FF66, 0, "sound/events/task_complete.wav" },
+	{ 0x274AB109, 0, "sound/ba_holo/tr_holo_radiation.wav" },
+	{ 0x7B42AD6B, 0, "sound/hgrunt/uhh.wav" },
+	{ 0x23F74A47, 0, "sound/vox/collider.wav" },
+	{ 0xEA9A0F8B, 0, "models/w_flare.mdl" },
+	{ 0x0E87216F, 0, "models/mapmodels/elec_box.mdl" },
+	{ 0xB73B9967, 0, "gfx/env/duskup.tga" },
+	{ 0x35FF0BF1, 0, "sound/scientist/sci_fear1.wav" },
+	{ 0x4999AB80, 0, "maps/de_storm.txt" },
+	{ 0x1FA86A12, 0, "sound/houndeye/he_die3.wav" },
+	{ 0x4BA36282, 0, "sound/vox/perimeter.wav" },
+	{ 0xED877BF4, 0, "models/mapmodels/grandfather_clock1.mdl" },
+	{ 0xC5D6F1DB, 0, "models/p_p90.mdl" },
+	{ 0x3202A8E6, 0, "sound/items/equip_nvg.wav" },
+	{ 0x0BC69B53, 0, "sound/sentences/hev_c2.wav" },
+	{ 0x92735E2C, 0, "sound/common/launch_upmenu1.wav" },
+	{ 0xF61257A4, 0, "sound/plats/talkmove1.wav" },
+	{ 0xE0E03AF9, 0, "sprites/muz2.spr" },
+	{ 0x9459D70A, 0, "overviews/cs_militia.txt" },
+	{ 0xBB5629BD, 0, "sound/fvox/eighty.wav" },
+	{ 0xFCB18D32, 0, "sprites/obj_icons/dod_forest/icon_obj_custom1_axis.spr" },
+	{ 0x5A006457, 0, "sound/ambience/windy.wav" },
+	{ 0xDE0624F9, 0, "models/aflock.mdl" },
+	{ 0x8BF85FD7, 0, "sprites/hint_ushead.spr" },
+	{ 0xD89C2183, 0, "models/p_smallshotgun.mdl" },
+	{ 0x98B48ABE, 0, "sound/scientist/sc_accident2.wav" },
+	{ 0xE971785F, 0, "sound/player/pl_dirt2.wav" },
+	{ 0x35B64806, 0, "sound/ambience/flyby.wav" },
+	{ 0x94D61100, 0, "sound/weapons/electro5.wav" },
+	{ 0x0BA9C775, 0, "sound/vox/device.wav" },
+	{ 0xC6EC9DB0, 0, "sprites/hudsngammo.spr" },
+	{ 0xA274C781, 0, "sound/barney/ba_gotone.wav" },
+	{ 0xBE549D7F, 0, "models/big_rock.mdl" },
+	{ 0xE1DB8FD6, 0, "sound/scientist/c1a2_sci_lounge.wav" },
+	{ 0x1752140D, 0, "models/axis_ammo.mdl" },
+	{ 0x641BF16D, 0, "sound/vox/bloop.wav" },
+	{ 0xE5801F01, 0, "sound/nihilanth/nil_man_notman.wav" },
+	{ 0x3C4B263C, 0, "sound/player/pl_pain2.wav" },
+	{ 0xA1A27DAE, 0, "servers/serverbrowser_thai.txt" },
+	{ 0x8638B6AE, 0, "sprites/obj_icons/dod_falaise/icon_obj_custom4_allies.spr" },
+	{ 0xA073ABEF, 0, "models/ba_holo.mdl" },
+	{ 0x8B39B21E, 0, "sound/sentences/hg_alert0.wav" },
+	{ 0xDB6EBD64, 0, "maps/de_piranesi.txt" },
+	{ 0x7A10A9E4, 0, "models/pi_twig.mdl" },
+	{ 0x08DAD4B1, 0, "sound/vox/light.wav" },
+	{ 0x2367169E, 0, "sound/weapons/lhit.wav" },
+	{ 0xA88EC36D, 0, "models/metalgibs.mdl" },
+	{ 0xD2B10602, 0, "sound/debris/flesh1.wav" },
+	{ 0x495AC718, 0, "sound/sentences/hev_dmg6.wav" },
+	{ 0xD46B338A, 0, "gfx/env/snowrt.tga" },
+	{ 0x32C40701, 0, "gfx/vgui/1152_arrowleft.tga" },
+	{ 0xD71C91BB, 0, "sound/vox/acknowledged.wav" },
+	{ 0x0007ECAD, 0, "models/holo.mdl" },
+	{ 0x57ECF78C, 0, "sound/ambience/lv4.wav" },
+	{ 0xAE47B3C7, 0, "sound/rosenberg/ro_fear2.wav" },
+	{ 0xBBBC0393, 0, "models/allied_ammo.mdl" },
+	{ 0x92797FCB, 0, "models/p_egon2.mdl" },
+	{ 0xCD0C3E03, 0, "sound/barney/c1a2_ba_4zomb.wav" },
+	{ 0x82BF2944, 0, "sprites/obj_icons/dod_escape/icon_obj_custom1_axis.spr" },
+	{ 0xDC420B0C, 0, "sound/barney/ireckon.wav" },
+	{ 0x0291AD5E, 0, "sound/de_torn/torn_bomb1.wav" },
+	{ 0x2A9175D3, 0, "maps/dod_flash_detail.txt" },
+	{ 0x594D7349, 0, "sound/fvox/blood_loss.wav" },
+	{ 0x63615FC2, 0, "maps/de_torn.txt" },
+	{ 0xB9808B7A, 0, "sound/fgrunt/intro_fg13.wav" },
+	{ 0x04F0AC11, 0, "sound/barney/howyoudoing.wav" },
+	{ 0x5BF896FF, 0, "sound/ba_holo/tr_holo_duck.wav" },
+	{ 0xD377C9F1, 0, "sound/vox/remaining.wav" },
+	{ 0xE4A323F7, 0, "sound/drill/add07.wav" },
+	{ 0x5FCCDADF, 0, "sound/scientist/ipredictedthis.wav" },
+	{ 0xC659A63F, 0, "sound/player/germanright.wav" },
+	{ 0xA5BE92A9, 0, "sound/ops/of2a5_bo02.wav" },
+	{ 0x693C7033, 0, "sound/sentences/hev_a8.wav" },
+	{ 0x82A85AD0, 0, "maps/dod_forest.txt" },
+	{ 0x84871498, 0, "models/bonegibs.mdl" },
+	{ 0x5FC5F954, 0, "sound/weapons/357_shot1.wav" },
+	{ 0x6AF5B076, 0, "sound/holo/holostn3.wav" },
+	{ 0x4BC50245, 0, "sound/vox/aligned.wav" },
+	{ 0x599AEFA7, 0, "sprites/bmp/1expl06.bmp" },
+	{ 0xB7932486, 0, "sound/vox/lieutenant.wav" },
+	{ 0x2790DABF, 0, "models/shell_large.mdl" },
+	{ 0xE2332FF2, 0, "sound/vox/apprehend.wav" },
+	{ 0xBA92958F, 0, "sound/rosenberg/ro_tele_final14.wav" },
+	{ 0x58C762FC, 0, "resource/valve_russian.txt" },
+	{ 0xEF60C6E7, 0, "models/p_spade.mdl" },
+	{ 0x047F069F, 0, "sound/radio/regroup.wav" },
+	{ 0x2B5D6E01, 0, "sound/vox/security.wav" },
+	{ 0xF01127F0, 0, "sound/sentences/ctr1.wav" },
+	{ 0xFE8A66D6, 0, "sprites/iplayerc4.spr" },
+	{ 0xA051C78C, 0, "sprites/obj_icons/dod_charlie/icon_obj_custom1_allies.spr" },
+	{ 0x15C49BD2, 0, "sprites/muzzleflash.spr" },
+	{ 0x13E20768, 0, "sound/scientist/idontthinkso.wav" },
+	{ 0x1535A34D, 0, "overviews/dod_switch.bmp" },
+	{ 0x80C43B2A, 0, "sound/sentences/hg_throw2.wav" },
+	{ 0x48B7CC68, 0, "models/p_grenade.mdl" },
+	{ 0x5022708B, 0, "sound/weapons/ric6.wav" },
+	{ 0x7EA79B84, 0, "models/sprite.mdl" },
+	{ 0x9F507D2A, 0, "sound/weapons/colt_reload_clipout.wav" },
+	{ 0xBBAA67D8, 0, "sound/radio/matedown.wav" },
+	{ 0xC1DDF915, 0, "sound/vox/nominal.wav" },
+	{ 0x1423FFE5, 0, "sound/sentences/ctr13.wav" },
+	{ 0x167287E5, 0, "sound/garg/gar_pain3.wav" },
+	{ 0xFCB44DAC, 0, "resource/tfc_french.txt" },
+	{ 0x636A6E85, 0, "sound/weapons/knife_slash1.wav" },
+	{ 0xC9965E2A, 0, "tswad.wad" },
+	{ 0x1A72EED2, 0, "sound/sentences/hg_alert4.wav" },
+	{ 0xDE4485A9, 0, "sound/bullchicken/bc_idle5.wav" },
+	{ 0x2BBDDD76, 0, "gfx/vgui/clsimages/cls_panzerschreck.tga" },
+	{ 0xB2022937, 0, "gfx/vgui/clsimages/cls_k98.tga" },
+	{ 0xC87E5BA5, 0, "overviews/cs_estate.txt" },
+	{ 0x7F59ECF1, 0, "sound/garg/gar_flameon1.wav" },
+	{ 0xE56F4330, 0, "sound/holo/holointro.wav" },
+	{ 0xF819A282, 0, "gfx/vgui/icon_!.tga" },
+	{ 0x9D0EA29D, 0, "sound/player/usbehindus.wav" },
+	{ 0xDE5E66FE, 0, "sound/drill/barracks02.wav" },
+	{ 0x3F46ABC0, 0, "sprites/bmp/2fire07.bmp" },
+	{ 0xEB51E915, 0, "gfx/vgui/map_1flag.tga" },
+	{ 0x97F2A1FA, 0, "sound/vox/objective.wav" },
+	{ 0x556071B7, 0, "sound/misc/spark2.wav" },
+	{ 0x1C1E3EB1, 0, "sound/scientist/letyouin.wav" },
+	{ 0xE63B0A02, 0, "models/player/female/female.bmp" },
+	{ 0x0E861C37, 0, "sound/holo/tr_holo_fallshort.wav" },
+	{ 0x34A5E3EB, 0, "sound/sentences/na2.wav" },
+	{ 0x67439EAE, 0, "sound/tram/ba_tram6.wav" },
+	{ 0xBBB3DB32, 0, "overviews/well.txt" },
+	{ 0x1A70E646, 0, "sound/vox/time.wav" },
+	{ 0xBAE499E2, 0, "sound/misc/spark5.wav" },
+	{ 0xE6D3C25D, 0, "sound/weapons/usp2.wav" },
+	{ 0xD6CAC935, 0, "models/v_tfc_spanner.mdl" },
+	{ 0xA44E479F, 0, "models/cleansuit_scientist01.mdl" },
+	{ 0xE04AEA79, 0, "sound/plats/ttrain3.wav" },
+	{ 0xC77D0374, 0, "models/gasbag.mdl" },
+	{ 0x63E48A9E, 0, "sound/sentences/hev_gr1.wav" },
+	{ 0xE1DBAEDA, 0, "models/v_satchel.mdl" },
+	{ 0xF1BC585D, 0, "models/w_sg552.mdl" },
+	{ 0x0BE3FA71, 0, "sprites/billow_02.spr" },
+	{ 0xA28B4539, 0, "sound/ambience/bigrumble.wav" },
+	{ 0x911BE48E, 0, "sound/fgrunt/babysitting.wav" },
+	{ 0xB2170589, 0, "models/w_penguinnest.mdl" },
+	{ 0x76F0A1A3, 0, "sprites/muzzleflash1.spr" },
+	{ 0xFACE3B19, 0, "sound/scientist/c1a1_sci_3scan.wav" },
+	{ 0xCE595108, 0, "gfx/env/blackrt.tga" },
+	{ 0x40DB32FD, 0, "gfx/vgui/marker_arrow_ne.tga" },
+	{ 0x57D4A8FF, 0, "resource/gameui_spanish.txt" },
+	{ 0x2FED8A86, 0, "sound/barney/of6a4_ba03.wav" },
+	{ 0x053B006A, 0, "models/w_suit.mdl" },
+	{ 0x0B8320F0, 0, "sound/intro/g3_copy.wav" },
+	{ 0x53C5B376, 0, "models/stealth.mdl" },
+	{ 0xA39FFFE1, 0, "sound/hgrunt/hole!.wav" },
+	{ 0xD249AA73, 0, "sound/barney/soldier.wav" },
+	{ 0x4C693B08, 0, "sound/scientist/right.wav" },
+	{ 0xDB94CB01, 0, "sprites/mapmarkers/arrow_n.spr" },
+	{ 0x6C0C7CC0, 0, "sound/sentences/hev_heal4.wav" },
+	{ 0x183AFF09, 0, "sound/bullchicken/bc_acid2.wav" },
+	{ 0x946B1A90, 0, "models/hgrunt01.mdl" },
+	{ 0x0DE36A81, 0, "sound/sentences/hev_14p.wav" },
+	{ 0x4699D62C, 0, "sound/weapons/usp_sliderelease.wav" },
+	{ 0xFFD1C0A7, 0, "gfx/env/hackrt.bmp" },
+	{ 0xC37474DB, 0, "sound/player/britsniper.wav" },
+	{ 0xE8240069, 0, "gfx/env/hackbk.tga" },
+	{ 0xA970DD76, 0, "models/skeleton.mdl" },
+	{ 0x1991A3F1, 0, "sound/tride/c0a0_tr_gmorn.wav" },
+	{ 0xF7FBD578, 0, "sound/fgrunt/zone.wav" },
+	{ 0x74CE95A6, 0, "sound/sentences/hev_8p.wav" },
+	{ 0x6712B8D7, 0, "sound/weapons/building.wav" },
+	{ 0xF59515E4, 0, "sprites/logo640.spr" },
+	{ 0x4888788F, 0, "sound/otis/soldier.wav" },
+	{ 0x8F73DBE1, 0, "sound/hgrunt/gr_idle3.wav" },
+	{ 0xA9578BA8, 0, "sound/ambience/forest_amb.wav" },
+	{ 0xD27AE2EB, 0, "sound/vox/bag.wav" },
+	{ 0x2D61F1D7, 0, "sprites/bmp/medic02.bmp" },
+	{ 0x0B7F9472, 0, "sound/weapons/dryfire_pistol.wav" },
+	{ 0x3DCE6558, 0, "gfx/env/alien3bk.tga" },
+	{ 0xC6B94006, 0, "sprites/mapsprites/beep.spr" },
+	{ 0x72E82417, 0, "models/helmet_allie_para.mdl" },
+	{ 0xC0A4A97F, 0, "sound/fvox/get_assaultgren.wav" },
+	{ 0xE6BE0849, 0, "sound/barney/whatsgoingon.wav" },
+	{ 0xE34A0A73, 0, "logos/kilroy.bmp" },
+	{ 0xEDD633E0, 0, "sound/ambience/dog4.wav" },
+	{ 0xA84C7C83, 0, "sprites/allies_camera.spr" },
+	{ 0xED9CA90D, 0, "sound/ichy/ichy_die2.wav" },
+	{ 0xFB06869D, 0, "overviews/de_prodigy.bmp" },
+	{ 0x87189A4E, 0, "sound/scientist/stopattacking.wav" },
+	{ 0x9062B99E, 0, "sound/fgrunt/hearsome.wav" },
+	{ 0x9A84A6B2, 0, "sound/garg/gar_pain2.wav" },
+	{ 0x38E155A0, 0, "sound/player/germanyessir.wav" },
+	{ 0x30B24D01, 0, "sprites/explosion1.spr" },
+	{ 0x30AB800C, 0, "sound/weapons/ak47-1.wav" },
+	{ 0x202AA02D, 0, "sound/drill/dr2_add17.wav" },
+	{ 0xBE3A795E, 0, "resource/game_menu_mouseover.tga" },
+	{ 0x89EE5B32, 0, "sound/vox/center.wav" },
+	{ 0xE03DB631, 0, "models/hvr.mdl" },
+	{ 0x0D704AE7, 0, "sound/sentences/hev_gr17.wav" },
+	{ 0xB5978162, 0, "models/v_chub.mdl" },
+	{ 0xCBAF960B, 0, "sound/hgrunt/four!.wav" },
+	{ 0x6C063EF9, 0, "sound/ba_holo/tr_holo_jduck.wav" },
+	{ 0xA84AE00C, 0, "models/mapmodels/cot.mdl" },
+	{ 0xABCDCAE3, 0, "sound/vox/surrender.wav" },
+	{ 0x34334CBE, 0, "sound/barney/c2a4_ba_longnite.wav" },
+	{ 0x5E8DB7F5, 0, "sprites/tnt.spr" },
+	{ 0x439F7E05, 0, "sprites/640hudof04.spr" },
+	{ 0x7C6C8247, 0, "sound/drill/oc106c.wav" },
+	{ 0x1FC09625, 0, "models/osprey_bodygibs.mdl" },
+	{ 0x3FE6B2C1, 0, "sound/buttons/latchlocked2.wav" },
+	{ 0xD093C9AA, 0, "sound/vox/a.wav" },
+	{ 0x20391251, 0, "sprites/obj_icons/dod_flugplatz/icon_obj_custom2_axis.spr" },
+	{ 0x070EDCC9, 0, "overviews/de_inferno.txt" },
+	{ 0xD0EF8EAE, 0, "sound/holo/tr_holo_button.wav" },
+	{ 0x26508FDA, 0, "gfx/vgui/marker_arrow_sw.tga" },
+	{ 0x19399ACA, 0, "models/v_tfc_12gauge.mdl" },
+	{ 0x8A1E42EC, 0, "sound/voltigore/voltigore_die1.wav" },
+	{ 0xC9090F0C, 0, "sprites/scope_k43.spr" },
+	{ 0xF7498CD9, 0, "gfx/env/morningdew_up.tga" },
+	{ 0x2B5050D6, 0, "models/hgrunt_opfor.mdl" },
+	{ 0xB4E45D18, 0, "sound/ambience/water_flowing2.wav" },
+	{ 0x4A316068, 0, "gfx/env/de_stormup.bmp" },
+	{ 0xA73601CF, 0, "sprites/fire.spr" },
+	{ 0x5C9B8D68, 0, "sound/drill/oc104.wav" },
+	{ 0x390F2278, 0, "sound/vox/turn.wav" },
+	{ 0x23FEB016, 0, "gfx/vgui/glock18.tga" },
+	{ 0xF520B8E8, 0, "sound/weapons/dartgun.wav" },
+	{ 0xD22C99E2, 0, "sound/houndeye/he_idle1.wav" },
+	{ 0x9B770239, 0, "overviews/de_piranesi.txt" },
+	{ 0xE296C50D, 0, "sound/hgrunt/guard.wav" },
+	{ 0x18B100B3, 0, "overviews/cz2.txt" },
+	{ 0xA78770C9, 0, "sound/player/inh2o.wav" },
+	{ 0x6A37D915, 0, "models/controllert.mdl" },
+	{ 0x2449CB7A, 0, "sound/ambience/sparrow.wav" },
+	{ 0x1136D3C5, 0, "sound/player/pcv_vest.wav" },
+	{ 0x343CD443, 0, "sprites/640_logo.spr" },
+	{ 0xFB5A4D33, 0, "sound/weapons/displacer_spin2.wav" },
+	{ 0x6CB1CD59, 0, "models/ceilinggibs.mdl" },
+	{ 0x4D303AD0, 0, "models/w_adrenaline.mdl" },
+	{ 0x29061583, 0, "sound/player/headshot2.wav" },
+	{ 0x5B85DF92, 0, "sound/ambience/car2.wav" },
+	{ 0xDDC40FC5, 0, "sprites/320_train.spr" },
+	{ 0x3082CD46, 0, "sprites/rockets2.spr" },
+	{ 0x3C53D18E, 0, "models/w_saw.mdl" },
+	{ 0xFBEF5A84, 0, "models/console_civ_scientist.mdl" },
+	{ 0xD95288F8, 0, "sound/vox/fourty.wav" },
+	{ 0x5FAD2CF5, 0, "sound/hgrunt/fight!.wav" },
+	{ 0x28BD3EAC, 0, "maps/flagrun.txt" },
+	{ 0x1B849BB3, 0, "sound/misc/r_tele4.wav" },
+	{ 0x5293A1AB, 0, "sound/ba_holo/tr_holo_move.wav" },
+	{ 0xD2D8B100, 0, "sound/weapons/ric_metal-2.wav" },
+	{ 0x8CDFFB67, 0, "sound/sentences/hev_gr2.wav" },
+	{ 0x7DAB4D05, 0, "sound/weapons/knife_hitwall1.wav" },
+	{ 0x4B0586F7, 0, "models/conveyor3.mdl" },
+	{ 0xC2FF0CD6, 0, "sound/player/pl_shell2.wav" },
+	{ 0x427BA436, 0, "sound/rosenberg/ro_yard_almost2.wav" },
+	{ 0x798C17CD, 0, "overviews/ravelin.txt" },
+	{ 0xF65B105B, 0, "sound/ambience/tankidle1.wav" },
+	{ 0xE94D02E2, 0, "sound/fgrunt/sdamage.wav" },
+	{ 0x116FD117, 0, "gfx/env/blackft.bmp" },
+	{ 0xF758D287, 0, "sound/misc/ear_ringing.wav" },
+	{ 0x8C8E59BA, 0, "gfx/vgui/round_corner_small_sw.tga" },
+	{ 0x451CDA3F, 0, "download.txt" },
+	{ 0x127256B3, 0, "sound/debris/zap7.wav" },
+	{ 0x56E77C2D, 0, "sound/barney/ba_uwish.wav" },
+	{ 0x12CA915D, 0, "models/intro_barney.mdl" },
+	{ 0x7FF48AF7, 0, "sound/aslave/slv_pain1.wav" },
+	{ 0x7D440740, 0, "sound/houndeye/he_hunt4.wav" },
+	{ 0x26FE5733, 0, "sound/weapons/elite_leftclipin.wav" },
+	{ 0xD717F3F1, 0, "sound/ba_holo/tr_holo_usetrain.wav" },
+	{ 0x796F62B9, 0, "models/pipe_bubbles.mdl" },
+	{ 0xBA5BF8A3, 0, "models/wrangler.mdl" },
+	{ 0xA416FDCA, 0, "gfx/env/neb1rt.bmp" },
+	{ 0xEE48E6F2, 0, "resource/icon_load.tga" },
+	{ 0xB7FF6F7C, 0, "sound/misc/party2.wav" },
+	{ 0x22937A8D, 0, "gfx/vgui/urban.tga" },
+	{ 0x889D6653, 0, "sound/scientist/heal5.wav" },
+	{ 0xECC35B9B, 0, "sprites/flames.spr" },
+	{ 0xE7F00F19, 0, "sound/player/drown2.wav" },
+	{ 0xB774C311, 0, "models/w_fg42s.mdl" },
+	{ 0xFB6FD707, 0, "sound/rosenberg/ro_pain8.wav" },
+	{ 0xF701199B, 0, "models/v_aug.mdl" },
+	{ 0x175EC386, 0, "sprites/hud_mode.spr" },
+	{ 0x8C6C901F, 0, "models/w_m249.mdl" },
+	{ 0x09B5C71B, 0, "models/osprey.mdl" },
+	{ 0x08F1174B, 0, "sound/squeek/sqk_die1.wav" },
+	{ 0x5281A395, 0, "sound/hgrunt/kick!.wav" },
+	{ 0x1AE94995, 0, "sprites/obj_icons/dod_merderet/icon_obj_custom1_axis.spr" },
+	{ 0xE08BD290, 0, "sound/player/bhit_kevlar-1.wav" },
+	{ 0x979F2F94, 0, "sound/rosenberg/ro_yard_rose1.wav" },
+	{ 0xAB0F5E98, 0, "gfx/env/doom1up.tga" },
+	{ 0x7D10204A, 0, "sound/weapons/famas-2.wav" },
+	{ 0xCE7105EF, 0, "sound/fvox/power_restored.wav" },
+	{ 0x59A428F2, 0, "sound/player/geiger4.wav" },
+	{ 0xB2E3D202, 0, "sound/fgrunt/of2a1_fg01.wav" },
+	{ 0x9D3E8711, 0, "sprites/fthrow.spr" },
+	{ 0xF1A1AB9E, 0, "models/player/pyro/pyro2.mdl" },
+	{ 0xE6C39B00, 0, "gfx/env/killertomatort.tga" },
+	{ 0xD9D75A40, 0, "gfx/vgui/hint_brithead.tga" },
+	{ 0x4A8EC67B, 0, "sound/vox/holds.wav" },
+	{ 0x287D07CF, 0, "gfx/env/doom1dn.tga" },
+	{ 0x0AF3A006, 0, "gfx/env/cxlf.tga" },
+	{ 0x0E4E6BE2, 0, "sound/scientist/c1a0_sci_lock8a.wav" },
+	{ 0xFD8D6EB4, 0, "dod_avalanche.wad" },
+	{ 0x1AD61420, 0, "sprites/tfchud01.spr" },
+	{ 0x3906E955, 0, "sound/pitdrone/pit_drone_melee_attack2.wav" },
+	{ 0xEEFCF81D, 0, "sound/hgrunt/have!.wav" },
+	{ 0x227F4278, 0, "models/cleansuit_scientist.mdl" },
+	{ 0x25F58605, 0, "models/w_amerk.mdl" },
+	{ 0x1D08D502, 0, "sound/doors/doorstop1.wav" },
+	{ 0xE5E8750B, 0, "sound/vox/acquired.wav" },
+	{ 0xB9D02CA9, 0, "sound/weapons/de_clipout.wav" },
+	{ 0xB5C7E094, 0, "overviews/de_torn.bmp" },
+	{ 0x62EDE26B, 0, "sound/vox/this.wav" },
+	{ 0x340032CF, 0, "gfx/env/backalleydn.tga" },
+	{ 0x916C74A0, 0, "sound/vox/central.wav" },
+	{ 0xA5645BDA, 0, "sound/scientist/c3a2_sci_straws.wav" },
+	{ 0x1A1959BC, 0, "sound/vox/extinguisher.wav" },
+	{ 0x0E158191, 0, "sound/houndeye/he_idle4.wav" },
+	{ 0x6F8570B8, 0, "sound/holo/tr_holo_longjump.wav" },
+	{ 0x71D234C7, 0, "models/w_crossbowt.mdl" },
+	{ 0xBF9A5D4E, 0, "sound/barney/standback.wav" },
+	{ 0x78A9B310, 0, "sound/hgrunt/affirmative.wav" },
+	{ 0xC4E14AEF, 0, "sound/vox/day.wav" },
+	{ 0xA9AB16FE, 0, "models/cleansuit_scientist02.mdl" },
+	{ 0xFB83D71B, 0, "sound/sentences/c2a1_3.wav" },
+	{ 0xAA16CFB2, 0, "sound/vox/warm.wav" },
+	{ 0x98202AF6, 0, "models/v_scout.mdl" },
+	{ 0x918CB905, 0, "sound/fvox/voice_off.wav" },
+	{ 0x9C54EB08, 0, "sound/weapons/timer.wav" },
+	{ 0x6A385397, 0, "sprites/scope_arc_nw.tga" },
+	{ 0xFB2CFD9C, 0, "sound/otis/yessir.wav" },
+	{ 0x1722B9CF, 0, "gfx/env/de_stormlf.bmp" },
+	{ 0x50E690C5, 0, "sound/scientist/scream24.wav" },
+	{ 0x9029F974, 0, "overviews/dod_saints.txt" },
+	{ 0x7E19EAFB, 0, "sound/vox/any.wav" },
+	{ 0x37C2FC0D, 0, "gfx/palette.bmp" },
+	{ 0x9995F56B, 0, "sound/radio/enemydown.wav" },
+	{ 0x6A0785A4, 0, "gfx/vgui/tmp.tga" },
+	{ 0x521C3855, 0, "sound/weapons/sg552_clipin.wav" },
+	{ 0x05BC8630, 0, "gfx/vgui/640_triple.tga" },
+	{ 0xEE3621B5, 0, "sound/shocktrooper/shock_trooper_pain5.wav" },
+	{ 0x3A258C0A, 0, "gfx/vgui/1024_timer.tga" },
+	{ 0xE5C7E4A8, 0, "sound/ambience/alien_cycletone.wav" },
+	{ 0xF397027F, 0, "sound/fgrunt/gr_pain1.wav" },
+	{ 0x2988FCEC, 0, "sound/debris/glass1.wav" },
+	{ 0x1FA5D7E7, 0, "sound/ambience/the_horror3.wav" },
+	{ 0x49CAC162, 0, "sound/weapons/knife2.wav" },
+	{ 0x5229B910, 0, "maps/dod_glider.txt" },
+	{ 0xA4C49359, 0, "overviews/casbah.bmp" },
+	{ 0x3F29689F, 0, "models/helmet_axis_para.mdl" },
+	{ 0x06FDE816, 0, "models/pallet_with_bags2.mdl" },
+	{ 0x90805FDF, 0, "sprites/bmp/2fire11.bmp" },
+	{ 0x4BB4C2EA, 0, "sprites/bmp/2expl11.bmp" },
+	{ 0x50605F28, 0, "sound/plats/vehicle2.wav" },
+	{ 0x5E9DBEFF, 0, "overviews/de_dust2.bmp" },
+	{ 0x294B0CF8, 0, "sound/fgrunt/watchit.wav" },
+	{ 0x09876BE4, 0, "sound/weapons/ump45_clipin.wav" },
+	{ 0x7B3D8A64, 0, "models/axis_gibs.mdl" },
+	{ 0xC9D46D01, 0, "models/w_scoped98k.mdl" },
+	{ 0x575526C3, 0, "sound/barney/workingonstuff.wav" },
+	{ 0x6BE170BC, 0, "gfx/env/tsccity_up.tga" },
+	{ 0x1DB9A25F, 0, "gfx/env/desrt.tga" },
+	{ 0xE4427088, 0, "models/v_usp.mdl" },
+	{ 0x78434DF7, 0, "gfx/env/discft.bmp" },
+	{ 0xAD78CC37, 0, "sprites/hudssg.spr" },
+	{ 0xA848BAD9, 0, "sound/player/britdefendarea.wav" },
+	{ 0xB8F0B7C2, 0, "models/p_mg34sr.mdl" },
+	{ 0x41CA472D, 0, "gfx/env/xen10dn.tga" },
+	{ 0x1E0D289B, 0, "maps/dod_switch_detail.txt" },
+	{ 0xF6D0BC64, 0, "models/player/scientist/scientist.mdl" },
+	{ 0xC72A8F76, 0, "sound/fvox/hiss.wav" },
+	{ 0xA72C5FC2, 0, "sound/sentences/c1a2_0.wav" },
+	{ 0x0E6B7FA0, 0, "sprites/grenade_flash.spr" },
+	{ 0x29B4EA1D, 0, "sound/fgrunt/pain1.wav" },
+	{ 0x622EF85B, 0, "overviews/dod_forest.txt" },
+	{ 0xB99039EC, 0, "sound/fvox/fourty.wav" },
+	{ 0x484D0E4A, 0, "sound/ba_holo/tr_holo_done.wav" },
+	{ 0x740B33C1, 0, "sprites/hudng.spr" },
+	{ 0xFFC40D74, 0, "gfx/env/snowcliffrt.tga" },
+	{ 0x39FE76E2, 0, "sound/hornet/ag_hornethit2.wav" },
+	{ 0x0EBB594E, 0, "models/p_pschreck_l.mdl" },
+	{ 0xAEF403B0, 0, "models/webgibs.mdl" },
+	{ 0xB7B2D331, 0, "sound/ambience/rd_shipshorn.wav" },
+	{ 0xBEDB1D0A, 0, "sound/fvox/biohazard_detected.wav" },
+	{ 0xA87AF3C8, 0, "sprites/hudsg.spr" },
+	{ 0x5B40FD13, 0, "sound/sentences/hg_throw1.wav" },
+	{ 0x36F6412C, 0, "sound/bullchicken/bc_die2.wav" },
+	{ 0xC456DA8B, 0, "sound/otis/onry.wav" },
+	{ 0x5F35454E, 0, "gfx/env/morningdewlf.bmp" },
+	{ 0xD52277B8, 0, "sound/vox/experiment.wav" },
+	{ 0x8AD6A1CD, 0, "sound/scientist/scream06.wav" },
+	{ 0xC2852AC9, 0, "sound/items/flashlight1.wav" },
+	{ 0x45B40A92, 0, "sound/gman/gman_nasty.wav" },
+	{ 0xA5C851C2, 0, "sound/radio/fireassis.wav" },
+	{ 0x07567ADD, 0, "sound/drill/rifle02.wav" },
+	{ 0xD056E524, 0, "sound/sentences/hg_alert2.wav" },
+	{ 0xABFA39CB, 0, "sound/vox/nine.wav" },
+	{ 0x15FAC253, 0, "sound/aslave/slv_alert3.wav" },
+	{ 0xFCF6F1B7, 0, "servers/icon_robotron.tga" },
+	{ 0xC65FCECC, 0, "sound/ambience/squeeks1.wav" },
+	{ 0x42936E14, 0, "models/p_m3.mdl" },
+	{ 0xF343808E, 0, "sound/vox/echo.wav" },
+	{ 0xA1E69360, 0, "sound/player/pl_ladder2.wav" },
+	{ 0x69D680E0, 0, "models/v_m1carbine.mdl" },
+	{ 0x06BF1507, 0, "overviews/de_storm.txt" },
+	{ 0x1C2D306C, 0, "sound/vox/third.wav" },
+	{ 0x5F4EB5B2, 0, "sound/ba_holo/tr_holo_nicejob.wav" },
+	{ 0xA1AC4D82, 0, "sprites/ctf_hud2.spr" },
+	{ 0xD23DD076, 0, "sound/vox/biological.wav" },
+	{ 0x4F2FF572, 0, "sound/items/damage3.wav" },
+	{ 0xDB0C7E71, 0, "classes/long_medic.txt" },
+	{ 0x54187B35, 0, "resource/vgui_koreana.txt" },
+	{ 0xA66EB1F1, 0, "servers/serverbrowser_portuguese.txt" },
+	{ 0x40634AA7, 0, "sound/vox/miles.wav" },
+	{ 0x8AC303C8, 0, "models/mapmodels/furniture.mdl" },
+	{ 0x41C459F2, 0, "models/spy_grenade.mdl" },
+	{ 0xC70440C8, 0, "models/conveyor2.mdl" },
+	{ 0x5ECB1B2E, 0, "sound/weapons/knife_hit4.wav" },
+	{ 0x2B7E83C1, 0, "sound/ambience/loader_hydra1.wav" },
+	{ 0xE969ECEA, 0, "sprites/obj_icons/dod_kraftstoff/icon_obj_custom1_allies.spr" },
+	{ 0xEFCD247C, 0, "models/g_rockt.mdl" },
+	{ 0x31403C88, 0, "sound/ambience/aa4.wav" },
+	{ 0xD7ECFBC0, 0, "sound/rosenberg/ro_xen_call1.wav" },
+	{ 0x198BB91E, 0, "sound/weapons/m4a1_silencer_on.wav" },
+	{ 0x2E98AA5E, 0, "gfx/env/nightdn.bmp" },
+	{ 0xCCC5A9F1, 0, "sound/tentacle/te_move2.wav" },
+	{ 0xB2A40514, 0, "models/voltigore.mdl" },
+	{ 0x77FEA4C6, 0, "chateau.wad" },
+	{ 0x92F9088E, 0, "sprites/grenade_hltv.spr" },
+	{ 0xC4C39DA0, 0, "sound/vox/denied.wav" },
+	{ 0x87A97EC4, 0, "sound/hgrunt/neutralized!.wav" },
+	{ 0xF77DADA5, 0, "sound/drill/livefire04.wav" },
+	{ 0x5B05B5C0, 0, "models/chair.mdl" },
+	{ 0x6EE5862D, 0, "sound/pitdrone/pit_drone_attack_spike2.wav" },
+	{ 0xBD952AE5, 0, "sound/hgrunt/hold.wav" },
+	{ 0x8DEFF933, 0, "sound/scientist/c2a4_sci_4tau.wav" },
+	{ 0x5490D6FD, 0, "sound/scientist/inmesstoo.wav" },
+	{ 0xB99F8F14, 0, "sound/weapons/bar_shoot.wav" },
+	{ 0xD8E096BE, 0, "sound/player/britflank.wav" },
+	{ 0x72DA408B, 0, "models/recruit.mdl" },
+	{ 0x791D89D3, 0, "sound/player/gerneedammo.wav" },
+	{ 0x71BE5DB9, 0, "sound/vox/flag.wav" },
+	{ 0xEBE52C1D, 0, "models/p_sniper2.mdl" },
+	{ 0xC89A10EC, 0, "gfx/env/cliff2bk.tga" },
+	{ 0x5D42B8CD, 0, "models/zombie02.mdl" },
+	{ 0xE985DACD, 0, "sound/weapons/m3-1.wav" },
+	{ 0xF9B0647A, 0, "models/p_medkit.mdl" },
+	{ 0x3A4C669C, 0, "gfx/env/2desertup.bmp" },
+	{ 0xD8C7A7DB, 0, "sound/gonarch/gon_sack2.wav" },
+	{ 0x94EBE834, 0, "models/mapmodels/well.mdl" },
+	{ 0xA6BE3CCA, 0, "sound/sentences/t4.wav" },
+	{ 0xA960E951, 0, "sound/shockroach/shock_angry.wav" },
+	{ 0xE7D6B0CC, 0, "sound/fans/fan2on.wav" },
+	{ 0x0D14E985, 0, "sound/weapons/elite_sliderelease.wav" },
+	{ 0x8961B347, 0, "sound/barney/ba_seethat.wav" },
+	{ 0xB4260F8D, 0, "gfx/vgui/sg550.tga" },
+	{ 0x9C088AC0, 0, "sound/vox/sight.wav" },
+	{ 0xE5FF87DB, 0, "sprites/muz8.spr" },
+	{ 0x11C3E18B, 0, "sprites/weapon_penguin.txt" },
+	{ 0xB6C219D1, 0, "sound/scientist/shutup2.wav" },
+	{ 0x43839FE2, 0, "dod_flugplatz.wad" },
+	{ 0xDFCAB646, 0, "sound/misc/teleport_out.wav" },
+	{ 0xF6D66014, 0, "sound/otis/ot_intro_hello2.wav" },
+	{ 0xD5A0EB21, 0, "overviews/2fort.txt" },
+	{ 0x1A14044E, 0, "sound/ambience/tnt_setup.wav" },
+	{ 0xA377EDEF, 0, "models/v_mills.mdl" },
+	{ 0x8D22AD74, 0, "sound/fgrunt/corners.wav" },
+	{ 0x5376BD05, 0, "gfx/vgui/640_tower.tga" },
+	{ 0x1C910EFB, 0, "sound/ambience/car1.wav" },
+	{ 0x6E6570C4, 0, "sound/squeek/sqk_hunt3.wav" },
+	{ 0x9389E061, 0, "sound/shocktrooper/shock_trooper_die3.wav" },
+	{ 0xBF587E80, 0, "sound/radio/meetme.wav" },
+	{ 0x045E8EAA, 0, "sound/fvox/fuzz.wav" },
+	{ 0xFB9320E5, 0, "sound/weapons/whizz11.wav" },
+	{ 0x5F610489, 0, "gfx/vgui/fonts/640_team info text.tga" },
+	{ 0xEBCC14C7, 0, "sprites/bmp/tffire06.bmp" },
+	{ 0x1CD210BD, 0, "sound/fgrunt/recon.wav" },
+	{ 0xF5209FA9, 0, "sound/scientist/seeheadcrab.wav" },
+	{ 0xE2E0E4C8, 0, "gfx/env/greendn.tga" },
+	{ 0x8DA099B5, 0, "gfx/env/havbk.tga" },
+	{ 0xE2E36563, 0, "sound/fans/fan3off.wav" },
+	{ 0xEB9D8E67, 0, "models/orange.mdl" },
+	{ 0x40B82244, 0, "models/p_bren_l.mdl" },
+	{ 0xE6F9A472, 0, "classes/short_otis.txt" },
+	{ 0xC8ECA951, 0, "sound/player/usmoveupmg.wav" },
+	{ 0xD0322A9F, 0, "sound/pitdrone/pit_drone_die3.wav" },
+	{ 0x3A94501C, 0, "maps/op4ctf_chasm.txt" },
+	{ 0x221E301B, 0, "sound/items/inv2.wav" },
+	{ 0x0F60F49B, 0, "sound/hgrunt/blow!.wav" },
+	{ 0x1933A728, 0, "sound/weapons/g_bounce1.wav" },
+	{ 0xB130A264, 0, "sound/fvox/seconds.wav" },
+	{ 0xFC2A8FA3, 0, "sound/weapons/mgoverheat.wav" },
+	{ 0xE877BF1B, 0, "gfx/env/citybk.tga" },
+	{ 0x157F51F3, 0, "sound/fgrunt/of5a1_fg03.wav" },
+	{ 0x554E579D, 0, "sound/scientist/sci_pain7.wav" },
+	{ 0xE53D85DA, 0, "sound/weapons/pwrench_big_hit1.wav" },
+	{ 0xDD5BB4C9, 0, "sound/misc/teleport_ready.wav" },
+	{ 0x82AC635A, 0, "models/v_scoped98k.mdl" },
+	{ 0x24765643, 0, "sound/doors/doorstop.wav" },
+	{ 0x4AC30F90, 0, "sprites/brush1.spr" },
+	{ 0xD286A3A7, 0, "gfx/vgui/1024_arrowleft.tga" },
+	{ 0x45314C1E, 0, "sound/fgrunt/stand.wav" },
+	{ 0x7FBAF99E, 0, "sound/scientist/sc_stop3.wav" },
+	{ 0x0B19EE3D, 0, "sound/weapons/ric_metal-1.wav" },
+	{ 0x0101D163, 0, "sound/bullchicken/bc_pain1.wav" },
+	{ 0x0DF6E837, 0, "sound/drill/dr2_add19.wav" },
+	{ 0x34A4DEEB, 0, "sprites/ihostage.spr" },
+	{ 0x408664D4, 0, "sprites/small_logo.spr" },
+	{ 0xD8EB6E14, 0, "gfx/env/xen9up.tga" },
+	{ 0x0201EF25, 0, "sound/items/damage.wav" },
+	{ 0x27EED433, 0, "models/scientist_cower01.mdl" },
+	{ 0x9DA5A0F2, 0, "gfx/env/alien2lf.tga" },
+	{ 0x4077D397, 0, "models/zombie.mdl" },
+	{ 0x8CADFF9E, 0, "gfx/vgui/640_banner_small.tga" },
+	{ 0x20095043, 0, "gfx/vgui/marker_arrow_nw.tga" },
+	{ 0x0CD82D27, 0, "overviews/de_survivor.bmp" },
+	{ 0xDBBA780E, 0, "sound/weapons/hit_sand1.wav" },
+	{ 0x327E7F24, 0, "sound/common/bodydrop4.wav" },
+	{ 0xB0D3A908, 0, "sound/weapons/pwrench_hitbod3.wav" },
+	{ 0x3AB2A01E, 0, "models/v_gravity.mdl" },
+	{ 0xB16B2916, 0, "sound/plats/ttrain2.wav" },
+	{ 0xF44D0BA7, 0, "sound/vox/chemical.wav" },
+	{ 0xD8DCAD89, 0, "sound/fgrunt/yessir.wav" },
+	{ 0x21893610, 0, "sprites/muz5.spr" },
+	{ 0x6733B759, 0, "sound/hgrunt/that.wav" },
+	{ 0x634D82D3, 0, "gfx/vgui/m3.tga" },
+	{ 0x4B50F136, 0, "models/hostage02.mdl" },
+	{ 0x861192B8, 0, "maps/op4ctf_biodomes.txt" },
+	{ 0x24DE9FAA, 0, "gfx/vgui/map_usflag.tga" },
+	{ 0x5554C130, 0, "sound/gman/gman_mumble3.wav" },
+	{ 0xFDCA963C, 0, "sound/barney/stench.wav" },
+	{ 0x7657D387, 0, "sprites/biggun.spr" },
+	{ 0x163F0B69, 0, "sound/player/usmedic.wav" },
+	{ 0xF9E08821, 0, "readme.txt" },
+	{ 0xFEDCD036, 0, "models/player/female/female.mdl" },
+	{ 0x9835EA02, 0, "models/mapmodels/by_pipeline_smokestack.mdl" },
+	{ 0x23B5FE70, 0, "sound/barney/ba_power4.wav" },
+	{ 0xF9EB09E8, 0, "maps/dod_anzio.txt" },
+	{ 0x60499D6E, 0, "logos/danger.bmp" },
+	{ 0xC8A96E45, 0, "resource/vgui_tchinese.txt" },
+	{ 0xF0268A75, 0, "models/mapmodels/by_rubble_set.mdl" },
+	{ 0x0DBFDCD0, 0, "models/dead_osprey.mdl" },
+	{ 0x8F2AE679, 0, "sound/geneworm/geneworm_final_pain1.wav" },
+	{ 0x1D76F291, 0, "gfx/env/dustbowlft.tga" },
+	{ 0x1E34050E, 0, "sound/weapons/saw_fire3.wav" },
+	{ 0x980014E1, 0, "sound/garg/gar_die1.wav" },
+	{ 0xD6B33A10, 0, "sound/weapons/reload2.wav" },
+	{ 0x5EB7FB81, 0, "gfx/detail/dt_fabric2.tga" },
+	{ 0xA677F04E, 0, "overviews/hunted.txt" },
+	{ 0x0C109799, 0, "sound/rosenberg/ro_tele_final01.wav" },
+	{ 0x128B3D08, 0, "sound/player/pl_metal1.wav" },
+	{ 0x0B432CDD, 0, "sound/otis/buttugly.wav" },
+	{ 0x51E0A4D7, 0, "overviews/de_airstrip.bmp" },
+	{ 0x26B0A6DF, 0, "sound/sentences/hev_f30.wav" },
+	{ 0x1DA0DCEE, 0, "maps/avanti.txt" },
+	{ 0x37D85AE1, 0, "models/w_hgun.mdl" },
+	{ 0x27C843E2, 0, "gfx/vgui/clsimages/cls_mg34.tga" },
+	{ 0x903EC4ED, 0, "sound/items/suit.wav" },
+	{ 0xED59167F, 0, "models/w_p228.mdl" },
+	{ 0x469B8B0D, 0, "gfx/env/avantilf.bmp" },
+	{ 0xE4F9866E, 0, "sound/weapons/ric1.wav" },
+	{ 0x23681B8A, 0, "dod_glider.wad" },
+	{ 0x3DA3DDDA, 0, "models/shield/v_shield_flashbang.mdl" },
+	{ 0x0281A194, 0, "models/w_m4a1.mdl" },
+	{ 0x3E160D4B, 0, "sound/drill/add03.wav" },
+	{ 0x85AB9720, 0, "sound/barney/ba_hello1.wav" },
+	{ 0x4F0685A9, 0, "models/mapmodels/dod_jagd_statue.mdl" },
+	{ 0x0C93FF0B, 0, "models/mapmodels/by_furniture_group-wreck.mdl" },
+	{ 0xDD00F20E, 0, "gfx/env/dashnight256lf.tga" },
+	{ 0x2730CCF4, 0, "sound/sentences/ef1.wav" },
+	{ 0xE6B12C06, 0, "overviews/crossover2.tga" },
+	{ 0x5A5AC5B2, 0, "models/chainammo.mdl" },
+	{ 0x10476ADD, 0, "sound/agrunt/ag_attack3.wav" },
+	{ 0x3E9A1D12, 0, "sound/debris/beamstart15.wav" },
+	{ 0x624829D7, 0, "sound/weapons/egon_off1.wav" },
+	{ 0x96429AC3, 0, "sound/debris/glass4.wav" },
+	{ 0x81C6940D, 0, "sound/holo/tr_ba_unuse.wav" },
+	{ 0x876585AA, 0, "sound/shocktrooper/kyur.wav" },
+	{ 0xED9C8508, 0, "sound/aslave/slv_word4.wav" },
+	{ 0x1EA736DB, 0, "sprites/obj_icons/dod_saints/icon_obj_custom3_neutral.spr" },
+	{ 0xEDDDEFC2, 0, "models/w_gaussammot.mdl" },
+	{ 0x3D6105D4, 0, "sound/drill/livefire10.wav" },
+	{ 0x6602185F, 0, "sound/player/pl_swim3.wav" },
+	{ 0x7CA7CBB1, 0, "sound/pitworm/pit_worm_flinch1.wav" },
+	{ 0x2E19035C, 0, "sound/vox/mode.wav" },
+	{ 0x5C339C9A, 0, "dod_forest.wad" },
+	{ 0xB2509158, 0, "models/conveyor_turn.mdl" },
+	{ 0xE724549E, 0, "sound/scientist/yes3.wav" },
+	{ 0xFD40941F, 0, "models/mapmodels/zalec_1bulb2wire.mdl" },
+	{ 0xCCF0A2EB, 0, "sprites/xssmke1.spr" },
+	{ 0x5A7E4CDD, 0, "maps/dod_switch.txt" },
+	{ 0x904E376C, 0, "models/w_mills.mdl" },
+	{ 0x3748461A, 0, "sound/vox/all.wav" },
+	{ 0x0D4099CB, 0, "models/mapmodels/flo_coattree.mdl" },
+	{ 0xD677A809, 0, "gfx/vgui/fonts/1600_commandmenu text.tga" },
+	{ 0xF30DC9B9, 0, "sound/barney/c1a0_ba_hevyes.wav" },
+	{ 0x48F0EB77, 0, "sound/items/rope1.wav" },
+	{ 0x71C96907, 0, "sprites/hltv_w_afolder.spr" },
+	{ 0x3E8BF9B6, 0, "gfx/vgui/640_grunt.tga" },
+	{ 0x74EE2A8F, 0, "sound/sentences/hev_rpgammo.wav" },
+	{ 0x4F12C445, 0, "gfx/env/cliff2up.bmp" },
+	{ 0xE8641E83, 0, "sprites/tf_weapon_sniperrifle.txt" },
+	{ 0x43AC4442, 0, "sprites/left.spr" },
+	{ 0xC8C71659, 0, "models/w_bgrap.mdl" },
+	{ 0x8E17CB77, 0, "sound/tram/ba_tram5.wav" },
+	{ 0xEB3FF398, 0, "sound/vox/user.wav" },
+	{ 0x54CBBA0A, 0, "sound/vox/eight.wav" },
+	{ 0xA1598B47, 0, "sound/sentences/c2a1_7.wav" },
+	{ 0xB80BC809, 0, "sprites/obj_icons/dod_saints/icon_obj_custom2_allies.spr" },
+	{ 0x1BE6F917, 0, "sound/barney/getanyworse.wav" },
+	{ 0x2FC31E67, 0, "sound/scientist/excuse.wav" },
+	{ 0xD80BCEED, 0, "models/wire_black32.mdl" },
+	{ 0x32CCD5EA, 0, "overviews/dod_anzio.bmp" },
+	{ 0xCD957C73, 0, "sound/fvox/onehundred.wav" },
+	{ 0x6783FF52, 0, "sound/ambience/mechwhine.wav" },
+	{ 0xAE1A060B, 0, "sound/houndeye/he_idle2.wav" },
+	{ 0xF1B8F708, 0, "sprites/effects/debris_glass.spr" },
+	{ 0x0EB0DC37, 0, "sound/weapons/ric2.wav" },
+	{ 0xE28953EA, 0, "models/dead_barney01.mdl" },
+	{ 0xDBA00A92, 0, "sound/scientist/ofcourse.wav" },
+	{ 0xAE4FD10D, 0, "sound/fvox/adrenaline_shot.wav" },
+	{ 0x42453CC4, 0, "sound/scientist/cough.wav" },
+	{ 0x28C75599, 0, "sprites/bubble.spr" },
+	{ 0x439F7C69, 0, "sound/nihilanth/nil_thieves.wav" },
+	{ 0xD63FAB40, 0, "sound/barney/ba_pok3.wav" },
+	{ 0x935F03B4, 0, "sound/fgrunt/go.wav" },
+	{ 0x30BD970B, 0, "sound/scientist/c1a4_sci_pwr.wav" },
+	{ 0x41A86DD8, 0, "sound/items/weapondrop1.wav" },
+	{ 0x60AAAE81, 0, "sound/radio/hosdown.wav" },
+	{ 0xC78775BE, 0, "sound/weapons/sg550_boltpull.wav" },
+	{ 0xEDB008CC, 0, "sound/player/ustakingfireleft.wav" },
+	{ 0x2A4015E7, 0, "sound/aslave/slv_word1.wav" },
+	{ 0x8D870745, 0, "sprites/bmp/2fire04.bmp" },
+	{ 0x67D12143, 0, "models/rockgibs.mdl" },
+	{ 0x471EAE43, 0, "sound/nihilanth/nil_freeman.wav" },
+	{ 0xBE5F9A20, 0, "sound/voltigore/voltigore_communicate2.wav" },
+	{ 0xE8D53FCF, 0, "sound/sentences/hev_16p.wav" },
+	{ 0x1FEC99FA, 0, "sound/ambience/lv2.wav" },
+	{ 0xD851996B, 0, "sound/barney/iguess.wav" },
+	{ 0xFAC66670, 0, "sound/radio/com_getinpos.wav" },
+	{ 0x09F21A33, 0, "sprites/obj_icons/dod_flugplatz/icon_obj_custom3_allies.spr" },
+	{ 0xA0DB40A3, 0, "sound/agrunt/ag_alert3.wav" },
+	{ 0xD95DE555, 0, "scripts/voicemodel.txt" },
+	{ 0x7AB9B8F4, 0, "sound/barney/youneedmedic.wav" },
+	{ 0x5B9B079B, 0, "sound/barney/alreadyasked.wav" },
+	{ 0x0BD5F592, 0, "sprites/tf_weapon_railgun.txt" },
+	{ 0xB2C9FEA6, 0, "sound/drill/pistol02.wav" },
+	{ 0xB92FB43F, 0, "sprites/bmp/2expl05.bmp" },
+	{ 0xA044E2B0, 0, "sound/sentences/c1a0_17.wav" },
+	{ 0x362EA864, 0, "models/caltrop.mdl" },
+	{ 0x9E0BD84F, 0, "gfx/env/backalleyft.tga" },
+	{ 0x01984A0F, 0, "sound/vox/temperature.wav" },
+	{ 0x62DB52A4, 0, "sound/sentences/hg_monst1.wav" },
+	{ 0xE848F485, 0, "sound/sentences/na15.wav" },
+	{ 0x8405AC1F, 0, "sound/holo/tr_holo_congrats.wav" },
+	{ 0x77C579D9, 0, "sound/rosenberg/ro_ok8.wav" },
+	{ 0x5287200F, 0, "sprites/metalspark.spr" },
+	{ 0x48A75A49, 0, "sound/scientist/scream02.wav" },
+	{ 0x8F3AC0B2, 0, "sound/barney/c1a1_ba_glad.wav" },
+	{ 0x5D46324A, 0, "maps/de_chateau.txt" },
+	{ 0xA042DA96, 0, "gfx/vgui/640_voiceblocked.tga" },
+	{ 0xC607A661, 0, "sound/barney/notelling.wav" },
+	{ 0xE5107A25, 0, "sound/vox/deployed.wav" },
+	{ 0x31EED872, 0, "sprites/bmp/1expl12.bmp" },
+	{ 0x2AE22334, 0, "models/p_m3super90.mdl" },
+	{ 0x3F481FB4, 0, "sound/x/x_teleattack1.wav" },
+	{ 0x4102E6C3, 0, "models/barney07.mdl" },
+	{ 0x14C57228, 0, "gfx/env/discdn.tga" },
+	{ 0xF9CCAE06, 0, "sound/boid/boid_idle3.wav" },
+	{ 0x2B0C43AA, 0, "sprites/spike_trail.spr" },
+	{ 0xE45C6D83, 0, "models/p_fg42pr.mdl" },
+	{ 0x4B6DA492, 0, "models/v_sten.mdl" },
+	{ 0x7CD76A8D, 0, "sound/player/lburn1.wav" },
+	{ 0xAD2F8ACF, 0, "sound/fgrunt/restricted.wav" },
+	{ 0xF4AEF8BA, 0, "sound/weapons/m4a1_deploy.wav" },
+	{ 0x6A0E95AB, 0, "models/gun_mag.mdl" },
+	{ 0x4C4C1CDB, 0, "models/w_357ammobox.mdl" },
+	{ 0xEDCE57F7, 0, "sound/vox/will.wav" },
+	{ 0x5C1F2E18, 0, "sprites/hud4.spr" },
+	{ 0xF12780B3, 0, "sprites/gworm_beam.spr" },
+	{ 0x04AADA8D, 0, "sound/vox/eliminate.wav" },
+	{ 0x56C53F6B, 0, "gfx/env/neb6up.tga" },
+	{ 0xFC62E158, 0, "sound/weapons/dbarrel1.wav" },
+	{ 0x0855FF9D, 0, "sound/ambience/dog7.wav" },
+	{ 0x01C23DE0, 0, "sound/pitdrone/pit_drone_idle2.wav" },
+	{ 0x8A08DD26, 0, "gfx/vgui/fonts/1024_team info text.tga" },
+	{ 0xC1E1B9E7, 0, "sound/rosenberg/ro_ok2.wav" },
+	{ 0xB1C0D2FD, 0, "sound/gonarch/gon_pain2.wav" },
+	{ 0x4683639A, 0, "sound/ambience/labmoan.wav" },
+	{ 0x10998392, 0, "models/intro_medic.mdl" },
+	{ 0xE4BF51FE, 0, "sound/scientist/alienappeal.wav" },
+	{ 0x35717A9E, 0, "sound/vox/used.wav" },
+	{ 0x2D28DD2A, 0, "sound/scientist/c1a2_sci_6zomb.wav" },
+	{ 0x3EDFF1D0, 0, "sound/turret/tu_search.wav" },
+	{ 0xABBDADC1, 0, "sprites/fog6.spr" },
+	{ 0x6601E6F4, 0, "sprites/weapon_rpg.txt" },
+	{ 0x9DBAA930, 0, "sound/player/death5.wav" },
+	{ 0x7376EDB8, 0, "sound/fvox/armor_gone.wav" },
+	{ 0x775F5E9B, 0, "sound/player/britcover.wav" },
+	{ 0xE35ACF8B, 0, "gfx/vgui/fonts/800_scoreboard small text.tga" },
+	{ 0xFC986639, 0, "sound/drill/sixthroom01.wav" },
+	{ 0x2533952B, 0, "sprites/spotlight04.spr" },
+	{ 0x5583581B, 0, "sound/sentences/hev_a0.wav" },
+	{ 0x1070E61B, 0, "sound/vox/xeno.wav" },
+	{ 0x96558381, 0, "sprites/mapsprites/forest_muzzleflash.spr" },
+	{ 0x0371F235, 0, "sound/common/launch_dnmenu1.wav" },
+	{ 0x27463D6D, 0, "models/mapmodels/posts.mdl" },
+	{ 0xAB46D5B8, 0, "sound/scientist/somethingfoul.wav" },
+	{ 0xC54AAE3B, 0, "sound/barney/imdead.wav" },
+	{ 0x7C3654F1, 0, "gfx/vgui/1920_timer.tga" },
+	{ 0x6FFF5B0C, 0, "models/w_rad.mdl" },
+	{ 0xE8234904, 0, "gfx/env/dmcwft.tga" },
+	{ 0xCC1FE6E5, 0, "overviews/flagrun.tga" },
+	{ 0xF69E4F8E, 0, "sound/scientist/hello.wav" },
+	{ 0x40B718D2, 0, "gfx/env/tornskyup.tga" },
+	{ 0x050F6A5E, 0, "sound/geneworm/geneworm_big_attack_forward.wav" },
+	{ 0x7D9ACC3E, 0, "models/w_thighpack.mdl" },
+	{ 0x87707A82, 0, "sound/hgrunt/post.wav" },
+	{ 0x83210512, 0, "sound/sentences/ea2.wav" },
+	{ 0xD1EC7841, 0, "sound/ambience/dronemachine2.wav" },
+	{ 0x18CD27E3, 0, "gfx/env/neb7up.bmp" },
+	{ 0x12992B1C, 0, "sound/hgrunt/hg_canal1.wav" },
+	{ 0x819E30C3, 0, "models/g_nail.mdl" },
+	{ 0x55595ACA, 0, "sound/fans/fan3.wav" },
+	{ 0xFF8ECB6C, 0, "sprites/tfchud05.spr" },
+	{ 0x7BBF32E9, 0, "sound/fvox/ammo_depleted.wav" },
+	{ 0xB0A6E26E, 0, "sprites/e-tele1.spr" },
+	{ 0x346107DC, 0, "maps/dod_forest_detail.txt" },
+	{ 0x75BE1A38, 0, "sound/player/die1.wav" },
+	{ 0x82F1CA49, 0, "sprites/obj_icons/dod_zalec/icon_obj_custom2_axis.spr" },
+	{ 0xB8C922AF, 0, "sound/vox/bypass.wav" },
+	{ 0xD866969A, 0, "models/mapmodels/lamp.mdl" },
+	{ 0x7E103C07, 0, "models/p_sten_l.mdl" },
+	{ 0x5223CCA4, 0, "sound/player/usenemyahead.wav" },
+	{ 0xDDD335F5, 0, "sound/sentences/c2a4_11.wav" },
+	{ 0xA642B282, 0, "sound/sentences/we0.wav" },
+	{ 0x3C6E31D6, 0, "sound/sentences/c1a3_5.wav" },
+	{ 0xF9A6750C, 0, "sound/sentences/c1a0_0.wav" },
+	{ 0xBC3DCBAF, 0, "gfx/env/desertft.bmp" },
+	{ 0x3DABBAA4, 0, "overviews/de_survivor.txt" },
+	{ 0xA3817EFC, 0, "models/player/tower/tower.mdl" },
+	{ 0x3C79674E, 0, "sound/fvox/targetting_system.wav" },
+	{ 0x8053B1D6, 0, "sound/fgrunt/gr_pain2.wav" },
+	{ 0xDB02F0AF, 0, "models/hgruntt.mdl" },
+	{ 0x04E788CE, 0, "sound/debris/bustcrate2.wav" },
+	{ 0xADD1D779, 0, "models/outro_crowbar.mdl" },
+	{ 0xFA758F19, 0, "sound/vox/kit.wav" },
+	{ 0x34A64402, 0, "sound/radio/ct_fireinhole.wav" },
+	{ 0xE5481C0C, 0, "sound/de_torn/torn_water2.wav" },
+	{ 0xF04F7397, 0, "sound/sentences/na6.wav" },
+	{ 0x315B7F88, 0, "sound/x/x_die1.wav" },
+	{ 0x0B88FACC, 0, "gfx/env/discft.tga" },
+	{ 0x5E9851AC, 0, "gfx/env/forestdn.tga" },
+	{ 0x25481811, 0, "sound/sentences/hev_dmg1.wav" },
+	{ 0x3C2D660D, 0, "sound/otis/beer.wav" },
+	{ 0xCDA6D092, 0, "sound/fvox/ten.wav" },
+	{ 0xD1642D83, 0, "sound/scientist/scream04.wav" },
+	{ 0x0AEF2394, 0, "sound/vox/control.wav" },
+	{ 0x3140C808, 0, "gfx/decals/hwshot6.bmp" },
+	{ 0x961F0BC2, 0, "gfx/env/snowlake_dn.tga" },
+	{ 0xC6425E8B, 0, "gfx/env/dustbowlbk.bmp" },
+	{ 0x5EAA2E79, 0, "gfx/env/cityup.tga" },
+	{ 0xDDA2C490, 0, "sound/weapons/mine_activate.wav" },
+	{ 0x908C2FBD, 0, "models/w_porthev.mdl" },
+	{ 0xEC1F1B90, 0, "sound/ba_holo/tr_holo_breath.wav" },
+	{ 0xFCB2A677, 0, "overviews/dod_saints.bmp" },
+	{ 0x26128BB5, 0, "sound/vox/complex.wav" },
+	{ 0x091080FF, 0, "sound/ambience/distantmortar3.wav" },
+	{ 0x7752B21C, 0, "gfx/env/officebk.tga" },
+	{ 0x7CCA44F2, 0, "sound/rosenberg/ro_tele_xen01.wav" },
+	{ 0x8D38FE9C, 0, "sound/player/uscover.wav" },
+	{ 0x2D00A6C9, 0, "sound/fgrunt/busted.wav" },
+	{ 0xC1E7054B, 0, "sound/weapons/flashbang-1.wav" },
+	{ 0xCC91C7D6, 0, "sound/player/brittakingfireright.wav" },
+	{ 0x634CB1E3, 0, "sound/fvox/get_battery.wav" },
+	{ 0x91954484, 0, "sound/hgrunt/gr_step4.wav" },
+	{ 0xCB0F91BC, 0, "sound/player/pl_gravel1.wav" },
+	{ 0x52ABD811, 0, "sound/weapons/hit_snow1.wav" },
+	{ 0x597A361F, 0, "gfx/env/jagdlf.tga" },
+	{ 0x3434EF44, 0, "sound/player/britstartround.wav" },
+	{ 0x622FEBD4, 0, "sound/voltigore/voltigore_alert1.wav" },
+	{ 0x8287D173, 0, "sprites/muzzle_shock.spr" },
+	{ 0x3FC7E404, 0, "sound/sentences/hev_44ammo.wav" },
+	{ 0xD8751B56, 0, "sound/weapons/debris2.wav" },
+	{ 0xF45C5BD9, 0, "sound/sentences/nd3.wav" },
+	{ 0x952C2E49, 0, "sound/fvox/six.wav" },
+	{ 0x2CEDA3AA, 0, "gfx/env/citydn.tga" },
+	{ 0xAB8BA29F, 0, "models/head.mdl" },
+	{ 0xD2B18F07, 0, "overviews/dcdm5.tga" },
+	{ 0x2D58EE89, 0, "sound/items/gunpickup1.wav" },
+	{ 0xB081B669, 0, "sound/weapons/aug_forearm.wav" },
+	{ 0xD0DA1856, 0, "models/gordon_suit.mdl" },
+	{ 0x7614A27F, 0, "resource/background/800_1_d_loading.tga" },
+	{ 0x77A2CD6D, 0, "sound/weapons/displacer_self.wav" },
+	{ 0x81421DC7, 0, "sound/vox/mass.wav" },
+	{ 0x44CE47AA, 0, "sound/rosenberg/ro_cure2.wav" },
+	{ 0x58701418, 0, "models/player/militia/militia.mdl" },
+	{ 0x31EE825D, 0, "models/light.mdl" },
+	{ 0xDABDBAF2, 0, "gfx/env/dustbowlft.bmp" },
+	{ 0xB2A1E021, 0, "sound/sentences/hev_a6.wav" },
+	{ 0xA7A39DBF, 0, "sound/scientist/runtest.wav" },
+	{ 0xF6D4E793, 0, "models/shell_small.mdl" },
+	{ 0x64593474, 0, "gfx/env/xen10bk.tga" },
+	{ 0x53F94336, 0, "sound/vox/operating.wav" },
+	{ 0x780D1FD2, 0, "sound/fgrunt/of1a6_fg05.wav" },
+	{ 0x4E4FB4EF, 0, "sound/ambience/steamburst1.wav" },
+	{ 0x7E3DC65C, 0, "sound/weapons/357_cock1.wav" },
+	{ 0x245FD2DD, 0, "gfx/env/2desertbk.tga" },
+	{ 0x32A2EDD0, 0, "models/player/otis/otis.mdl" },
+	{ 0xFBA03441, 0, "sound/sentences/hev_7p.wav" },
+	{ 0xC0614386, 0, "sound/vox/gordon.wav" },
+	{ 0x430F9566, 0, "sprites/glow_bg.spr" },
+	{ 0xEE821E12, 0, "sound/scientist/newhevsuit.wav" },
+	{ 0x805B7B2D, 0, "maps/de_prodigy.txt" },
+	{ 0xB0A9EBDA, 0, "sound/vox/the.wav" },
+	{ 0x3120924D, 0, "sound/fgrunt/friendly.wav" },
+	{ 0xDC3FAB2A, 0, "sound/scientist/sci_pain6.wav" },
+	{ 0x84C7DE1A, 0, "sound/headcrab/hc_idle4.wav" },
+	{ 0x4E9AB12C, 0, "gfx/env/xen8lf.tga" },
+	{ 0x8881F080, 0, "sprites/ch_sniper.spr" },
+	{ 0x9D41DAF5, 0, "sound/scientist/scream11.wav" },
+	{ 0x0A0A1452, 0, "sound/vox/twenty.wav" },
+	{ 0xE57566DC, 0, "sound/player/pain1.wav" },
+	{ 0x38AF0745, 0, "sprites/obj_icons/icon_obj_bridge_axis.spr" },
+	{ 0x7ACCC55A, 0, "sound/shockroach/shock_die.wav" },
+	{ 0x9D73D4DA, 0, "models/intro_torch.mdl" },
+	{ 0x08DBAE30, 0, "gfx/env/havrt.tga" },
+	{ 0x5EFEE8A2, 0, "sound/player/uspanzerschreck.wav" },
+	{ 0x2D6E6BAB, 0, "sprites/weapon_eagle.txt" },
+	{ 0x8680C0CE, 0, "sound/vox/goodbye.wav" },
+	{ 0x8D44DA06, 0, "sound/vox/team.wav" },
+	{ 0xEBD15F21, 0, "sound/x/x_recharge3.wav" },
+	{ 0x55677253, 0, "models/qtruck.mdl" },
+	{ 0x13900BC5, 0, "sound/sentences/tr_b.wav" },
+	{ 0x88DEFB62, 0, "sprites/weapon_galil.txt" },
+	{ 0xD3C26F58, 0, "sound/ambience/lv_fruit1.wav" },
+	{ 0xFEAA2A14, 0, "sprites/wall_puff3.spr" },
+	{ 0xB5BAC35C, 0, "sound/sentences/c3a2_4.wav" },
+	{ 0x8B66586A, 0, "sound/drill/rifle03.wav" },
+	{ 0x0D9F25C7, 0, "models/p_mini.mdl" },
+	{ 0xC1C0BD1C, 0, "maps/cs_747.txt" },
+	{ 0x38B7A708, 0, "sound/ambience/fluorescent.wav" },
+	{ 0x14A23A7D, 0, "sound/vox/defense.wav" },
+	{ 0xF6D766E0, 0, "sound/sentences/ea8.wav" },
+	{ 0xF7571B05, 0, "sprites/640hud9.spr" },
+	{ 0xB2F177B7, 0, "sound/shockroach/shock_jump1.wav" },
+	{ 0xEB6EB2E2, 0, "sound/hgrunt/bastard!.wav" },
+	{ 0x70291FA3, 0, "overviews/de_torn.txt" },
+	{ 0xB650F5E8, 0, "sound/agrunt/ag_pain4.wav" },
+	{ 0x9E239088, 0, "sound/fgrunt/hellosir.wav" },
+	{ 0x42C3BB59, 0, "sound/sentences/hev_gr8.wav" },
+	{ 0x3DB574EE, 0, "gfx/vgui/g3sg1.tga" },
+	{ 0x58FCBF35, 0, "sound/vox/celsius.wav" },
+	{ 0x2B50F605, 0, "models/strooper.mdl" },
+	{ 0xC5193589, 0, "sound/fans/fan5on.wav" },
+	{ 0x458B5612, 0, "overviews/de_vertigo.txt" },
+	{ 0x59523C72, 0, "sound/houndeye/he_alert3.wav" },
+	{ 0x4F9A83D3, 0, "sound/vox/are.wav" },
+	{ 0x9D3E385B, 0, "sound/vox/level.wav" },
+	{ 0xA0B16163, 0, "gfx/vgui/clsimages/cls_piat.tga" },
+	{ 0x386AFD73, 0, "sound/fvox/torniquette_applied.wav" },
+	{ 0x82E27FF8, 0, "sprites/bmp/1expl03.bmp" },
+	{ 0xED5A062A, 0, "sound/barney/c2a4_ba_arg3a.wav" },
+	{ 0x8D2408C5, 0, "models/v_garand.mdl" },
+	{ 0x01F21065, 0, "cached.wad" },
+	{ 0x453BE02E, 0, "sound/hgrunt/fortymeters.wav" },
+	{ 0xEB917DBF, 0, "sound/geneworm/geneworm_final_pain3.wav" },
+	{ 0x235C45C2, 0, "sound/sentences/hev_17p.wav" },
+	{ 0xD687CCC9, 0, "sound/headcrab/hc_idle1.wav" },
+	{ 0x4E812E40, 0, "models/p_spygun.mdl" },
+	{ 0xF8CC48DD, 0, "sound/plats/vehicle_brake1.wav" },
+	{ 0xC6A5D3D7, 0, "sound/scientist/c1a0_sci_lock5a.wav" },
+	{ 0x67AD2D83, 0, "sound/barney/c1a2_ba_goforit.wav" },
+	{ 0xCF39D76E, 0, "sound/scientist/softethics.wav" },
+	{ 0x0F282482, 0, "sound/scientist/letsgo.wav" },
+	{ 0xA083F525, 0, "sound/hornet/ag_buzz1.wav" },
+	{ 0x5D3B5B14, 0, "sound/sentences/c1a1_1.wav" },
+	{ 0x83E84878, 0, "sprites/exit1.spr" },
+	{ 0x7A9DDF08, 0, "gfx/env/2desertlf.tga" },
+	{ 0xD78ECE02, 0, "sprites/dodcross.blue.spr" },
+	{ 0xA387AA11, 0, "sound/vox/warning.wav" },
+	{ 0x60C90217, 0, "sound/barney/c1a0_ba_button.wav" },
+	{ 0x6EA5FA06, 0, "models/civ_scientist.mdl" },
+	{ 0x701488AC, 0, "sound/controller/con_pain3.wav" },
+	{ 0x3B95F097, 0, "sprites/weapon_awp.txt" },
+	{ 0x69C9A336, 0, "sound/vox/code.wav" },
+	{ 0x12CC1C95, 0, "sound/geneworm/geneworm_beam_attack.wav" },
+	{ 0xB6BB20EF, 0, "overviews/cs_backalley.txt" },
+	{ 0x145EBBA8, 0, "sound/ambience/labdrone1.wav" },
+	{ 0x0D7D9C0A, 0, "sound/sentences/hev_heal6.wav" },
+	{ 0x3E786BC0, 0, "sound/barney/ba_die3.wav" },
+	{ 0x82400687, 0, "sound/ba_holo/tr_holo_lightoff.wav" },
+	{ 0x9318F975, 0, "sprites/smokepuff.spr" },
+	{ 0x06C925D5, 0, "sound/scientist/yesletsgo.wav" },
+	{ 0xE9A8F29F, 0, "models/zombie_barney02.mdl" },
+	{ 0x112A88F4, 0, "sound/vox/escape.wav" },
+	{ 0xB1B7E682, 0, "sound/holo/tr_holo_greatwork.wav" },
+	{ 0x9791EDEB, 0, "models/v_displacer.mdl" },
+	{ 0xD4715266, 0, "sound/items/ammopickup.wav" },
+	{ 0x384AA152, 0, "sprites/nuke_a_1.spr" },
+	{ 0x943B8806, 0, "sound/scientist/fine.wav" },
+	{ 0xF4A5EA1E, 0, "sound/items/itembk2.wav" },
+	{ 0xE6FFD3F6, 0, "sprites/huddiesm.spr" },
+	{ 0x6D065548, 0, "sound/buttons/lever5.wav" },
+	{ 0xAEB528B8, 0, "sprites/radar320.spr" },
+	{ 0xB13E20B0, 0, "sound/scientist/survival.wav" },
+	{ 0x3EC35B97, 0, "sound/sentences/c1a2_7.wav" },
+	{ 0xF208BDCB, 0, "sound/vox/select.wav" },
+	{ 0xE79EC0EE, 0, "sprites/observer.txt" },
+	{ 0x58374109, 0, "sound/tride/c0a0_tr_time.wav" },
+	{ 0x8B25B555, 0, "sound/tram/ba_tram3.wav" },
+	{ 0x199B67CC, 0, "sound/buttons/button7.wav" },
+	{ 0xFB57B24F, 0, "sprites/obj_icons/dod_flugplatz/icon_obj_custom2_alliesusgreen.spr" },
+	{ 0x392FAA30, 0, "gfx/vgui/m4a1.tga" },
+	{ 0xF8B3B90A, 0, "models/uplant3t.mdl" },
+	{ 0x9D5DB485, 0, "sound/barney/maybe.wav" },
+	{ 0x2FF3192B, 0, "sound/fgrunt/move.wav" },
+	{ 0xF0B578DA, 0, "sound/items/gunpickup4.wav" },
+	{ 0x70577B70, 0, "sound/rosenberg/ro_wait0.wav" },
+	{ 0x052BE464, 0, "sound/otis/gladof.wav" },
+	{ 0xAD2E0F35, 0, "sprites/effects/debris_wood2.spr" },
+	{ 0x39AF5105, 0, "overviews/hunted.bmp" },
+	{ 0xB4BFCE0D, 0, "sound/rosenberg/ro_tele_final12.wav" },
+	{ 0xC7415F42, 0, "resource/icon_warning.tga" },
+	{ 0x6E7DBB58, 0, "sound/tram/ba_tram0.wav" },
+	{ 0x804B44A9, 0, "maps/casbah.txt" },
+	{ 0x99677760, 0, "sprites/flare1.spr" },
+	{ 0x68155E3F, 0, "resource/vgui_russian.txt" },
+	{ 0xF60ED615, 0, "models/bm_sack.mdl" },
+	{ 0xBE48DD50, 0, "sound/common/npc_step3.wav" },
+	{ 0x22AA6349, 0, "sound/holo/tr_holo_injury.wav" },
+	{ 0xFE65066A, 0, "sound/hgrunt/sector.wav" },
+	{ 0x96C21A9F, 0, "sound/vox/gun.wav" },
+	{ 0xBD1E3D93, 0, "sound/sentences/hev_9mm.wav" },
+	{ 0x483241E1, 0, "sound/ambience/waterfall3.wav" },
+	{ 0x419F74E0, 0, "sound/agrunt/ag_die2.wav" },
+	{ 0x11503CC3, 0, "sound/buttons/spark1.wav" },
+	{ 0xCD741CE7, 0, "sound/barney/ba_pain2.wav" },
+	{ 0xA178A999, 0, "models/stick.mdl" },
+	{ 0x8A97F5C1, 0, "sprites/weapon_shotgun.txt" },
+	{ 0xCBFE78E9, 0, "sound/sentences/ctr6.wav" },
+	{ 0x7ED17B29, 0, "sound/drill/squad02.wav" },
+	{ 0xCAD03E80, 0, "sound/vox/supply.wav" },
+	{ 0x34EA2C34, 0, "sound/scientist/sc_power2.wav" },
+	{ 0xED2D4B67, 0, "models/turrett.mdl" },
+	{ 0x3C11D31D, 0, "sound/barnacle/bcl_chew2.wav" },
+	{ 0x4C7AD152, 0, "gfx/detail/dt_metal1.tga" },
+	{ 0x78928AD8, 0, "resource/valve_logo.tga" },
+	{ 0x5E789CEC, 0, "sound/items/gunpickup2.wav" },
+	{ 0xF2BC829A, 0, "sound/player/pl_wood1.wav" },
+	{ 0xBE5CDAD1, 0, "models/saw_shell.mdl" },
+	{ 0xE7A47D70, 0, "gfx/env/avabk.tga" },
+	{ 0xB2C59DB9, 0, "gfx/env/sky_blu_ft.tga" },
+	{ 0x5484401F, 0, "models/hgrunt_opfor03.mdl" },
+	{ 0x2387FC26, 0, "maps/warpath.txt" },
+	{ 0x3CDB182E, 0, "gfx/env/alien2ft.tga" },
+	{ 0x6D645FFB, 0, "sound/weapons/galil-2.wav" },
+	{ 0x8C4D35E8, 0, "sound/fvox/south.wav" },
+	{ 0xF21EFA84, 0, "sound/fgrunt/wantsome.wav" },
+	{ 0xD134F72A, 0, "sound/vox/laser.wav" },
+	{ 0xF29AC34E, 0, "resource/menu_steam_no_icon.tga" },
+	{ 0x586BF8FE, 0, "gfx/vgui/fonts/512_hintmessage text.tga" },
+	{ 0x0F150B39, 0, "sound/fgrunt/of5a3_fg03.wav" },
+	{ 0x82CDE658, 0, "sound/scientist/startle5.wav" },
+	{ 0x218403B1, 0, "sprites/obj_icons/dod_kraftstoff/icon_obj_custom1_axis.spr" },
+	{ 0xB9DF8024, 0, "sound/buttons/latchlocked1.wav" },
+	{ 0xC11C7F77, 0, "sprites/shellchrome.spr" },
+	{ 0x868CF3B5, 0, "models/tentacle2.mdl" },
+	{ 0xCB7D44F8, 0, "sound/ambience/alien_squit.wav" },
+	{ 0x038E6A43, 0, "sound/barney/gettingcloser.wav" },
+	{ 0x7D29F67A, 0, "sound/hgrunt/hell!.wav" },
+	{ 0xF2CDFCDB, 0, "sprites/glow03.spr" },
+	{ 0x29F4D1B2, 0, "sound/fvox/twelve.wav" },
+	{ 0xD67E22AC, 0, "gfx/env/de_stormrt.tga" },
+	{ 0xA4E0BB91, 0, "sound/ambience/quail1.wav" },
+	{ 0x39746808, 0, "models/big_momgibs.mdl" },
+	{ 0x85761E2B, 0, "overviews/dod_avalanche.txt" },
+	{ 0xB827FEAF, 0, "sound/gman/gman_choose1.wav" },
+	{ 0xC5A22318, 0, "sound/ambience/fd_v1_sound.wav" },
+	{ 0xDB6DE0F7, 0, "sprites/zbeam5.spr" },
+	{ 0x8B22FF93, 0, "sound/fgrunt/pain3.wav" },
+	{ 0xB480BFD6, 0, "resource/icon_blocked.tga" },
+	{ 0xBDD7D4B4, 0, "sound/rosenberg/ro_tele_final24.wav" },
+	{ 0xA4FABACC, 0, "resource/icon_resizer.tga" },
+	{ 0x5B645AEB, 0, "sound/vox/primary.wav" },
+	{ 0x46AE721D, 0, "sound/ambience/fdmortar.wav" },
+	{ 0x836C70E0, 0, "sound/vox/no.wav" },
+	{ 0x1687B4F9, 0, "models/v_bar.mdl" },
+	{ 0x1F3DA828, 0, "models/player/sniper/sniper2.mdl" },
+	{ 0x6C7DFBBF, 0, "sound/player/britceasefire.wav" },
+	{ 0xC0DAF0F0, 0, "sound/vox/did.wav" },
+	{ 0x0A9F304D, 0, "models/w_longjump.mdl" },
+	{ 0x0CC88DF8, 0, "sound/hgrunt/up!.wav" },
+	{ 0x38BAB7C1, 0, "sound/vox/locate.wav" },
+	{ 0x19F0400F, 0, "sound/fgrunt/sting.wav" },
+	{ 0xB4308A79, 0, "sound/rosenberg/ro_pain2.wav" },
+	{ 0xEA5B83FE, 0, "sound/fgrunt/sir_01.wav" },
+	{ 0xEB67870F, 0, "sprites/rope.spr" },
+	{ 0x1BFDBBC5, 0, "sound/barney/youeverseen.wav" },
+	{ 0x4EF052C1, 0, "sound/scientist/sc_ok0.wav" },
+	{ 0xDB36D162, 0, "gfx/env/alien3ft.bmp" },
+	{ 0xCDC02B15, 0, "sprites/tf_weapon_spanner.txt" },
+	{ 0xFA38188E, 0, "maps/dod_falaise_detail.txt" },
+	{ 0x8B99C9F7, 0, "gfx/env/neb7dn.tga" },
+	{ 0xC448A265, 0, "sound/player/gertakecover.wav" },
+	{ 0x7ED6430B, 0, "sound/weapons/emp_1.wav" },
+	{ 0x43A3321B, 0, "sound/weapons/usp_silencer_off.wav" },
+	{ 0x130AFAD7, 0, "sound/hgrunt/is!.wav" },
+	{ 0x1C3DF935, 0, "sound/hgrunt/god!.wav" },
+	{ 0xACC00072, 0, "sprites/ikgrass1.spr" },
+	{ 0xB6C45DBD, 0, "sound/debris/zap5.wav" },
+	{ 0x2EF7BBBA, 0, "sound/weapons/knife_hit_flesh1.wav" },
+	{ 0x21D95DEF, 0, "sound/vox/nearest.wav" },
+	{ 0x19B618D3, 0, "dod_charlie.wad" },
+	{ 0xBC30FC28, 0, "sound/houndeye/he_alert1.wav" },
+	{ 0x705CC7F1, 0, "gfx/env/xen10rt.tga" },
+	{ 0x08D9EA15, 0, "sound/weapons/ric4.wav" },
+	{ 0x19961C5B, 0, "sprites/weapon_flashbang.txt" },
+	{ 0xE989953C, 0, "models/player/guerilla/guerilla.mdl" },
+	{ 0x7C1BC18F, 0, "sound/hgrunt/gr_pain3.wav" },
+	{ 0x361C0F86, 0, "sound/rosenberg/ro_wait6.wav" },
+	{ 0x4A484D3B, 0, "gfx/env/killertomatoup.tga" },
+	{ 0xC9B64B8B, 0, "sound/barney/missingleg.wav" },
+	{ 0x307A627D, 0, "models/w_health.mdl" },
+	{ 0x788F2680, 0, "sound/barney/yessir.wav" },
+	{ 0x607CD548, 0, "resource/cstrike_spanish.txt" },
+	{ 0x8B5EF4E3, 0, "gfx/vgui/800_arrowdown.tga" },
+	{ 0x035F0658, 0, "gfx/env/alien1lf.bmp" },
+	{ 0xD1ECE25F, 0, "sound/fgrunt/thick.wav" },
+	{ 0x2304C3FE, 0, "sound/player/axhitbod.wav" },
+	{ 0x380D31A7, 0, "sound/player/britnegative.wav" },
+	{ 0xC1A3CFF7, 0, "sound/rosenberg/ro_yard_access1.wav" },
+	{ 0xC1AA0D7B, 0, "sound/vox/immediately.wav" },
+	{ 0x2D6DD326, 0, "gfx/env/morningdew_ft.tga" },
+	{ 0xA3A94AE5, 0, "sound/scientist/waithere.wav" },
+	{ 0x1DAF05DA, 0, "models/wire_black8.mdl" },
+	{ 0x5970EEB6, 0, "sprites/bmp/2fire01.bmp" },
+	{ 0xB54E7F8B, 0, "sound/ambience/glider_radio.wav" },
+	{ 0x3354AAB7, 0, "sound/items/grab_rope.wav" },
+	{ 0x715BF726, 0, "sound/scientist/sci_fear13.wav" },
+	{ 0xE91563EA, 0, "gfx/vgui/clsimages/allies.tga" },
+	{ 0x130B4C0D, 0, "sprites/640hud18.spr" },
+	{ 0x6D8D956C, 0, "models/player/engineer/engineer.mdl" },
+	{ 0x2ED15F0C, 0, "sound/barney/dontfigure.wav" },
+	{ 0x952B5C8D, 0, "sound/hgrunt/control.wav" },
+	{ 0x42B7C8BA, 0, "models/player/hgrunt/hgrunt.bmp" },
+	{ 0x221CBEAE, 0, "sound/items/rope2.wav" },
+	{ 0x849E8788, 0, "sound/sentences/hg_quest2.wav" },
+	{ 0xD9190F0B, 0, "gfx/env/blackdn.bmp" },
+	{ 0xEF05C1FE, 0, "models/zombie_barney01.mdl" },
+	{ 0x07ADD1A4, 0, "models/v_squeak.mdl" },
+	{ 0x68B3B1EF, 0, "sound/ba_holo/tr_holo_spinbridge.wav" },
+	{ 0x6D5DE0BE, 0, "gfx/env/dashnight256dn.tga" },
+	{ 0xFC753EB0, 0, "sound/fgrunt/intro_fg11.wav" },
+	{ 0x8EEACF15, 0, "gfx/vgui/marker_arrow_s.tga" },
+	{ 0xD2FE8B4A, 0, "sound/vox/across.wav" },
+	{ 0xAF2F9873, 0, "models/kingpin.mdl" },
+	{ 0x9457486A, 0, "sound/agrunt/ag_attack2.wav" },
+	{ 0x9E600EFC, 0, "sound/hgrunt/continue!.wav" },
+	{ 0x1ADE8556, 0, "sound/vox/top.wav" },
+	{ 0x92651353, 0, "sound/sentences/buzwarn.wav" },
+	{ 0xC85AB5BB, 0, "sound/vox/approach.wav" },
+	{ 0xC75658D9, 0, "sound/vox/out.wav" },
+	{ 0x3BA17133, 0, "sound/scientist/madness.wav" },
+	{ 0xC4AFCD06, 0, "overviews/boot_camp.txt" },
+	{ 0x1A2637AE, 0, "sound/player/pl_slosh3.wav" },
+	{ 0xD20B79E5, 0, "sound/debris/metal1.wav" },
+	{ 0xE98DAC15, 0, "sound/ambience/water_flowing1.wav" },
+	{ 0x2F2DFF79, 0, "sprites/mg42.spr" },
+	{ 0xE557F7D4, 0, "overviews/de_airstrip.txt" },
+	{ 0xBD01EABD, 0, "models/v_spade.mdl" },
+	{ 0xAB19BDB0, 0, "sound/ambience/alienvalve1.wav" },
+	{ 0xBA3FDB95, 0, "gfx/detail/dt_smooth1.tga" },
+	{ 0xDA9241C5, 0, "sound/fvox/_period.wav" },
+	{ 0xDA4F4C69, 0, "models/zombiegibs1.mdl" },
+	{ 0xFBD421BC, 0, "sound/hgrunt/those!.wav" },
+	{ 0xDC7A3DBF, 0, "models/osprey_enginegibs.mdl" },
+	{ 0x2D7E9F55, 0, "sound/buttons/button8.wav" },
+	{ 0x4CFF902C, 0, "models/player/ctf_gordon/ctf_gordon.bmp" },
+	{ 0xB00DAA10, 0, "sound/plats/vehicle_ignition.wav" },
+	{ 0x1E2E8242, 0, "sound/barney/ba_shot1.wav" },
+	{ 0xCCB48BD2, 0, "gfx/vgui/640_banner.tga" },
+	{ 0xFAA453B9, 0, "sound/fgrunt/cover.wav" },
+	{ 0x1E9D2871, 0, "gfx/env/alien3up.bmp" },
+	{ 0x32749AC3, 0, "models/p_sniper.mdl" },
+	{ 0x82DD199E, 0, "sprites/mapsprites/flames.spr" },
+	{ 0xC8A42672, 0, "sound/controller/con_die1.wav" },
+	{ 0xF06A6955, 0, "sound/ambience/lv_fruit2.wav" },
+	{ 0xDA64570B, 0, "gfx/env/stbk.tga" },
+	{ 0x9B264F20, 0, "sound/player/boots2.wav" },
+	{ 0x3F0E7E3A, 0, "sound/common/weapon_select.wav" },
+	{ 0x9EC532C7, 0, "sound/weapons/generic_shot_reload.wav" },
+	{ 0x37FC6AF9, 0, "sound/sentences/hev_assault.wav" },
+	{ 0x8927D173, 0, "sound/x/x_shoot1.wav" },
+	{ 0xA196D9B1, 0, "gfx/env/tornskyrt.tga" },
+	{ 0x36141388, 0, "models/player/barney/barney.bmp" },
+	{ 0xC4E8B590, 0, "models/player/recruit/recruit.mdl" },
+	{ 0x3A37004D, 0, "sound/barney/yougotit.wav" },
+	{ 0x37F94D2E, 0, "overviews/de_inferno.bmp" },
+	{ 0x2073BE24, 0, "sound/hgrunt/area!.wav" },
+	{ 0x8F3C3C92, 0, "sprites/dodcross.spr" },
+	{ 0x02CECF38, 0, "sound/sentences/hev_det3.wav" },
+	{ 0xECC23F0D, 0, "sound/vox/unauthorized.wav" },
+	{ 0xFEF99982, 0, "sound/vox/of.wav" },
+	{ 0x44A0D632, 0, "de_aztec.wad" },
+	{ 0x1ABBC26D, 0, "sound/vox/mesa.wav" },
+	{ 0xB62F4FAA, 0, "sprites/axis_camera.spr" },
+	{ 0x4D0C3CA9, 0, "sprites/agrunt1.spr" },
+	{ 0x0D606B1C, 0, "models/p_fg42s.mdl" },
+	{ 0x36EE3D35, 0, "gfx/vgui/arrowup.tga" },
+	{ 0x62591088, 0, "sound/scientist/c1a3_sci_team.wav" },
+	{ 0x701C975E, 0, "sound/vox/endgame.wav" },
+	{ 0xE0A0EAED, 0, "sound/hgrunt/under!.wav" },
+	{ 0xE517CF96, 0, "sprites/obj_icons/icon_obj_bridge_allies.spr" },
+	{ 0x4F2ECDE7, 0, "sound/player/pl_metal4.wav" },
+	{ 0x7034046D, 0, "sound/weapons/pwrench_miss2.wav" },
+	{ 0x03970586, 0, "gfx/vgui/deserteagle.tga" },
+	{ 0xD1D42337, 0, "sprites/hud_layout.spr" },
+	{ 0xDF531BE0, 0, "sound/sentences/hg_throw0.wav" },
+	{ 0x875194E1, 0, "sound/ambience/computalk1.wav" },
+	{ 0x3F816781, 0, "models/hairt.mdl" },
+	{ 0x51B524E8, 0, "gfx/env/2desertdn.tga" },
+	{ 0x3B682372, 0, "sound/vox/service.wav" },
+	{ 0x45F5E027, 0, "sound/scientist/sci_pain9.wav" },
+	{ 0xF9417A5F, 0, "models/v_mp44.mdl" },
+	{ 0x3C945C3C, 0, "sound/ambience/industrial1.wav" },
+	{ 0x24048FF0, 0, "sound/ichy/ichy_alert1.wav" },
+	{ 0xBB8480E6, 0, "sound/scientist/c1a0_sci_dis14a.wav" },
+	{ 0x7EC8947E, 0, "models/p_mp5.mdl" },
+	{ 0xC3769313, 0, "sound/ambience/industrial4.wav" },
+	{ 0x99141427, 0, "sound/vox/pipe.wav" },
+	{ 0x9592E4E4, 0, "models/hostage04.mdl" },
+	{ 0x2AE90DFC, 0, "gfx/vgui/fonts/1280_scoreboard small text.tga" },
+	{ 0x33384BB7, 0, "models/otis03.mdl" },
+	{ 0xD832300D, 0, "overviews/dod_anzio.txt" },
+	{ 0xE917EEC9, 0, "gfx/env/officert.tga" },
+	{ 0xF4B6A6D4, 0, "sprites/c4.spr" },
+	{ 0x6C1440FD, 0, "sound/sentences/dadeda.wav" },
+	{ 0x0E7FE5C7, 0, "sound/scientist/catchone.wav" },
+	{ 0x88B40C8C, 0, "models/barneyt.mdl" },
+	{ 0x1BC9754F, 0, "sound/sentences/ed2.wav" },
+	{ 0xF3C57A1F, 0, "sound/holo/tr_holo_pushbox.wav" },
+	{ 0x2DB9621C, 0, "models/mapmodels/mattress_wreck.mdl" },
+	{ 0x317FE942, 0, "sound/vox/facility.wav" },
+	{ 0x589782D8, 0, "sprites/wflag.spr" },
+	{ 0x3F5C54B7, 0, "sound/barney/_comma.wav" },
+	{ 0xDAF29231, 0, "models/mapmodels/door1.mdl" },
+	{ 0xE32F00F3, 0, "gfx/env/xen9ft.tga" },
+	{ 0x26881565, 0, "sound/plats/railstop1.wav" },
+	{ 0x49E0E61D, 0, "models/concretegibs.mdl" },
+	{ 0x3CF17F23, 0, "gfx/vgui/fonts/1280_briefing text.tga" },
+	{ 0x0F7F03AD, 0, "logos/camp1.bmp" },
+	{ 0x9157BD52, 0, "cs_bdog.wad" },
+	{ 0xFF658FB5, 0, "sound/holo/tr_holo_runstart.wav" },
+	{ 0x76B81098, 0, "sound/items/sight1.wav" },
+	{ 0xEBDA0F99, 0, "sound/player/pl_swim1.wav" },
+	{ 0xADE4F6EA, 0, "sound/weapons/c4_beep3.wav" },
+	{ 0x862E3902, 0, "gfx/env/alien3lf.bmp" },
+	{ 0x3A733A01, 0, "sprites/glow01.spr" },
+	{ 0x97444ED0, 0, "models/mapmodels/by_pipe_set1.mdl" },
+	{ 0x9477A823, 0, "sprites/640hud7.spr" },
+	{ 0xF02C6D52, 0, "models/w_galil.mdl" },
+	{ 0x11F9C91C, 0, "sound/scientist/c2a4_sci_sugicaloff.wav" },
+	{ 0x0DA38EFD, 0, "sound/rosenberg/ro_pain6.wav" },
+	{ 0x90C0B9B0, 0, "models/mortar.mdl" },
+	{ 0xC5E10955, 0, "sound/vox/am.wav" },
+	{ 0x9C5F434F, 0, "sound/fgrunt/restricted2.wav" },
+	{ 0x1C23EC38, 0, "sound/sentences/c3a1_7.wav" },
+	{ 0xACDF2287, 0, "sound/sentences/c2a2_0.wav" },
+	{ 0x97576685, 0, "sound/sentences/hev_c20.wav" },
+	{ 0x633D6C8D, 0, "gfx/vgui/terror.tga" },
+	{ 0xE2AE7959, 0, "sound/misc/splash_large.wav" },
+	{ 0xFB0FDB70, 0, "sprites/xenobeam.spr" },
+	{ 0x8CBEBF74, 0, "sound/weapons/aug-1.wav" },
+	{ 0xBC488BB7, 0, "gfx/env/morningdn.tga" },
+	{ 0xB24C67D5, 0, "sound/weapons/sniper_miss.wav" },
+	{ 0x98BC887A, 0, "sprites/zerogxplode.spr" },
+	{ 0x4C44CC69, 0, "sound/rosenberg/ro_wait7.wav" },
+	{ 0x316E29A8, 0, "models/player/ctf_gina/ctf_gina.bmp" },
+	{ 0xE0CE0DD4, 0, "sprites/mapsprites/documents_red_hud.spr" },
+	{ 0xE93FD7B3, 0, "models/p_enfield.mdl" },
+	{ 0x5F50777D, 0, "models/w_medkitlt.mdl" },
+	{ 0xA27EF805, 0, "sound/agrunt/ag_idle5.wav" },
+	{ 0x4D8F0E82, 0, "models/v_nail2.mdl" },
+	{ 0x32A76F29, 0, "sound/weapons/rocket1i.wav" },
+	{ 0x5BC90499, 0, "sprites/weapon_satchel.txt" },
+	{ 0x4A176FB0, 0, "sound/voltigore/voltigore_pain1.wav" },
+	{ 0xD1344DF4, 0, "sound/sentences/hev_15p.wav" },
+	{ 0x3DA36966, 0, "sound/barney/dobettertogether.wav" },
+	{ 0x59205E2E, 0, "sound/aslave/slv_pain2.wav" },
+	{ 0xD44CB9C2, 0, "sprites/left2.spr" },
+	{ 0x8700FE92, 0, "sound/gonarch/gon_attack3.wav" },
+	{ 0x8CCC45D0, 0, "sound/controller/con_idle1.wav" },
+	{ 0x7E9B9D9A, 0, "gfx/vgui/640_soldierblue.tga" },
+	{ 0xA9E4B371, 0, "sound/weapons/cbar_hitbod3.wav" },
+	{ 0xE0DAA098, 0, "gfx/vgui/640_speaker1.tga" },
+	{ 0xC14A3F64, 0, "sound/ambience/jagdbirds.wav" },
+	{ 0xF2F979F7, 0, "sound/scientist/afellowsci.wav" },
+	{ 0x195FB8A4, 0, "tfc2.wad" },
+	{ 0x5DD693C2, 0, "resource/platform_german.txt" },
+	{ 0xCF1BDB56, 0, "sprites/weapon_shieldgun.txt" },
+	{ 0x04B8EBF0, 0, "sprites/hudrl.spr" },
+	{ 0x9C0DDDE1, 0, "sound/fvox/get_9mmclip.wav" },
+	{ 0x4B6F9714, 0, "sprites/mapsprites/speakericon.spr" },
+	{ 0x431A9B2E, 0, "sound/hgrunt/silence!.wav" },
+	{ 0x4A7AEAC1, 0, "sound/agrunt/ag_idle1.wav" },
+	{ 0xA97EE4AB, 0, "sound/player/gerdropguns.wav" },
+	{ 0xF76791EC, 0, "gfx/env/greenft.tga" },
+	{ 0x8FDD856B, 0, "models/p_spanner.mdl" },
+	{ 0xE294515B, 0, "gfx/vgui/round_corner_nw.tga" },
+	{ 0x56BB013B, 0, "sound/vox/threat.wav" },
+	{ 0xAD870618, 0, "resource/platform_italian.txt" },
+	{ 0xC37E64A9, 0, "sound/player/damage7.wav" },
+	{ 0x0DE20C43, 0, "sound/weapons/hit_metal1.wav" },
+	{ 0xAA5E234C, 0, "sound/vox/square.wav" },
+	{ 0xA7AE9E4A, 0, "sound/fgrunt/intro_fg04.wav" },
+	{ 0xE7000DAE, 0, "models/mapmodels/by_cliff_face.mdl" },
+	{ 0x1B203335, 0, "sound/vox/foxtrot.wav" },
+	{ 0xD0378847, 0, "sound/holo/tr_holo_fantastic.wav" },
+	{ 0xCD08765A, 0, "gfx/env/morningdew_lf.tga" },
+	{ 0x948D4D59, 0, "sound/weapons/scout_clipin.wav" },
+	{ 0x3BD8FDFC, 0, "sprites/gwave1.spr" },
+	{ 0x58624BDB, 0, "gfx/env/tsccity_ft.tga" },
+	{ 0xCFADD954, 0, "sound/rosenberg/ro_tele_power3.wav" },
+	{ 0xC4419CEF, 0, "sound/rosenberg/ro_wait5.wav" },
+	{ 0xEBC47A24, 0, "sprites/obj_icons/dod_falaise/icon_obj_custom1_axis.spr" },
+	{ 0x6F89AF47, 0, "sound/ambience/forestwaterrun.wav" },
+	{ 0xA4912BE8, 0, "models/player/ctf_barney/barney.bmp" },
+	{ 0x87F97CE4, 0, "sound/scientist/scream23.wav" },
+	{ 0xCBC8147E, 0, "gfx/env/neb1lf.bmp" },
+	{ 0x07F07430, 0, "sound/hgrunt/weapons!.wav" },
+	{ 0xEE1BF267, 0, "sound/sentences/na13.wav" },
+	{ 0x267E16E5, 0, "sound/barney/dontbuyit.wav" },
+	{ 0x7E24B607, 0, "sound/player/pl_tile3.wav" },
+	{ 0xBF1B973D, 0, "sound/radio/hitassist.wav" },
+	{ 0x15CE4A2F, 0, "sound/barney/donthurtem.wav" },
+	{ 0xAD9F1407, 0, "sound/hgrunt/the.wav" },
+	{ 0x635F3523, 0, "sound/vox/systems.wav" },
+	{ 0x9CBCE163, 0, "resource/icon_left.tga" },
+	{ 0x95375A20, 0, "sound/zombie/zo_alert20.wav" },
+	{ 0x065A3BD5, 0, "sound/otis/somethingmoves.wav" },
+	{ 0xFA69D36B, 0, "sprites/effects/debris_tile1.spr" },
+	{ 0xC820C91F, 0, "sprites/vp_parallel.spr" },
+	{ 0x28A90401, 0, "sound/vox/upper.wav" },
+	{ 0x4BA4068C, 0, "overviews/warpath.bmp" },
+	{ 0xF763D190, 0, "sound/radio/ct_reportingin.wav" },
+	{ 0x02708D7B, 0, "sound/weapons/sg550-1.wav" },
+	{ 0x7AC36FEB, 0, "sound/vox/hazard.wav" },
+	{ 0x17BEA927, 0, "maps/dod_merderet.txt" },
+	{ 0xDC2DAF2F, 0, "sound/sentences/c1a0_12.wav" },
+	{ 0x931E3C65, 0, "models/w_9mmhandgun.mdl" },
+	{ 0x65FC38A5, 0, "sound/ambience/signalgear2.wav" },
+	{ 0xB850622A, 0, "sprites/weapon_ump45.txt" },
+	{ 0xB3F9CDC0, 0, "resource/background/800_1_a_loading.tga" },
+	{ 0x7CAEDA3B, 0, "sound/vox/sewage.wav" },
+	{ 0xE3380B89, 0, "sprites/obj_icons/dod_jagd/icon_obj_custom1_axis.spr" },
+	{ 0x86ED997D, 0, "sound/vox/oscar.wav" },
+	{ 0x60972C21, 0, "sound/vox/turret.wav" },
+	{ 0x90CE44E4, 0, "models/drill.mdl" },
+	{ 0x38428512, 0, "sound/hgrunt/c2a2_hg_chat4a.wav" },
+	{ 0x923EBA71, 0, "gfx/env/avantift.bmp" },
+	{ 0xEC4C2453, 0, "sprites/ctf_hud1.spr" },
+	{ 0xBEFEE9B5, 0, "sprites/scope_enfield.spr" },
+	{ 0x94D4EF0A, 0, "sound/rosenberg/ro_tele_xen09.wav" },
+	{ 0xBC7819A9, 0, "sound/vox/bravo.wav" },
+	{ 0xC607E280, 0, "sound/player/britmoveupmg.wav" },
+	{ 0x9E60122D, 0, "sprites/ripple.spr" },
+	{ 0x7D7D8F2B, 0, "sound/sentences/c2a4_6.wav" },
+	{ 0xF4379745, 0, "ctf manual/resources/pow_big_jump.wav" },
+	{ 0xD58B37BA, 0, "resource/valve_koreana.txt" },
+	{ 0x42A8D035, 0, "sound/barney/slowingyoudown.wav" },
+	{ 0xAF1A2306, 0, "models/v_amerk.mdl" },
+	{ 0x2266E311, 0, "sound/weapons/colt_shoot.wav" },
+	{ 0x3D45E199, 0, "media/launch_deny1.wav" },
+	{ 0x53EDA65E, 0, "sound/vox/secure.wav" },
+	{ 0xC70E2429, 0, "sound/pitdrone/pit_drone_hunt2.wav" },
+	{ 0xEA32C3CE, 0, "sound/fans/fan4on.wav" },
+	{ 0xD0B90304, 0, "sound/scientist/okgetout.wav" },
+	{ 0x4841B3D2, 0, "sound/items/9mmclip1.wav" },
+	{ 0x8FEF2CDE, 0, "sound/hgrunt/backup.wav" },
+	{ 0x1A2981D0, 0, "sound/player/pl_jump2.wav" },
+	{ 0x36A58068, 0, "sound/hgrunt/this.wav" },
+	{ 0xA70A3856, 0, "models/mapmodels/kettenkraftrad.mdl" },
+	{ 0x6D7B50CE, 0, "sound/fgrunt/of2a5_fg01.wav" },
+	{ 0x550E051E, 0, "sound/barney/c1a4_ba_octo2.wav" },
+	{ 0x4DFA76F6, 0, "sound/otis/yes.wav" },
+	{ 0xD8B404B4, 0, "sound/scientist/startle1.wav" },
+	{ 0xEB7396A0, 0, "sound/weapons/awp1.wav" },
+	{ 0xF48DB3EC, 0, "sound/fgrunt/mister.wav" },
+	{ 0x5B2128A2, 0, "sound/fvox/communications_on.wav" },
+	{ 0xD4553ABE, 0, "sound/drill/livefire01.wav" },
+	{ 0xDCF3962A, 0, "gfx/detail/merd_rubble.tga" },
+	{ 0x90647442, 0, "models/w_argrenadet.mdl" },
+	{ 0x590F24AF, 0, "models/civ_coat_scientist01.mdl" },
+	{ 0x79E2FA4A, 0, "sound/scientist/_comma.wav" },
+	{ 0x6DF210AE, 0, "resource/icon_folder_selected.tga" },
+	{ 0xEDFEE108, 0, "sound/sentences/hg_answer2.wav" },
+	{ 0x51FBD95D, 0, "gfx/vgui/fonts/1152_title font.tga" },
+	{ 0xA73B10C2, 0, "sound/scientist/c1a0_sci_dis10a.wav" },
+	{ 0x821B542D, 0, "sprites/tf_weapon_knife.txt" },
+	{ 0x18C958B2, 0, "sound/sentences/c1a3_9.wav" },
+	{ 0xE0FEAFCB, 0, "sound/rosenberg/ro_tele_final21.wav" },
+	{ 0xB5C100CF, 0, "sound/holo/tr_holo_pipeduck.wav" },
+	{ 0xD2F6D181, 0, "sound/barney/aimforhead.wav" },
+	{ 0x776CAFD2, 0, "gfx/vgui/1280_timer.tga" },
+	{ 0x30C3F660, 0, "sound/drill/rope01.wav" },
+	{ 0xE2B8D95F, 0, "sprites/redflare1.spr" },
+	{ 0x52E963A8, 0, "sound/rosenberg/ro_yard_scanner.wav" },
+	{ 0x1838EDD0, 0, "models/w_aug.mdl" },
+	{ 0xEEFB4D76, 0, "models/p_mg34bu.mdl" },
+	{ 0xADAF16E7, 0, "sound/hgrunt/your.wav" },
+	{ 0xED701550, 0, "models/player/beret/beret.bmp" },
+	{ 0xBCC0B95C, 0, "sound/vox/west.wav" },
+	{ 0xB8B1A4B1, 0, "1280_textscheme.txt" },
+	{ 0x0E9A2CD4, 0, "sound/sentences/na7.wav" },
+	{ 0x6EA46587, 0, "sound/weapons/aug_boltpull.wav" },
+	{ 0xFB8AEF90, 0, "sound/vox/uranium.wav" },
+	{ 0x842BAEFC, 0, "sound/weapons/famas_clipout.wav" },
+	{ 0x0A42C98C, 0, "sound/vox/distortion.wav" },
+	{ 0x0F7B5412, 0, "gfx/env/xen10up.tga" },
+	{ 0x7DBA874B, 0, "sprites/glow_prp.spr" },
+	{ 0x32A9A856, 0, "sound/ambience/metalgroan.wav" },
+	{ 0x4879408D, 0, "sprites/ring.spr" },
+	{ 0xD140C1AA, 0, "sound/sentences/hg_clear7.wav" },
+	{ 0xF3A5320C, 0, "sprites/aexplo.spr" },
+	{ 0xA074BF2C, 0, "models/mapmodels/messerschmitt_tail.mdl" },
+	{ 0x64DF2096, 0, "models/w_knife.mdl" },
+	{ 0x1A793EAA, 0, "sound/de_torn/tk_windstreet.wav" },
+	{ 0xD9FAF2AB, 0, "sound/debris/beamstart5.wav" },
+	{ 0x7F6E835E, 0, "gfx/vgui/fonts/1152_scoreboard small text.tga" },
+	{ 0x788C24E5, 0, "sound/drill/oc107.wav" },
+	{ 0x2EA7AF07, 0, "models/pshell.mdl" },
+	{ 0x0B754941, 0, "sound/gonarch/gon_alert2.wav" },
+	{ 0xA91D43BF, 0, "resource/dmc_italian.txt" },
+	{ 0xE1F32157, 0, "sound/weapons/splauncher_impact.wav" },
+	{ 0x5AFDB166, 0, "sprites/hudbmps/tfchud01.bmp" },
+	{ 0xADF0FD63, 0, "gfx/detail/mountain1.tga" },
+	{ 0xB538054F, 0, "sound/vox/going.wav" },
+	{ 0xF680CFA2, 0, "sound/tram/ba_tram2.wav" },
+	{ 0x64A9B720, 0, "models/player/us-inf/us-inft.mdl" },
+	{ 0xF8D69C13, 0, "sound/vox/charlie.wav" },
+	{ 0x4EA27A2B, 0, "sound/hgrunt/down!.wav" },
+	{ 0x12AD9A0E, 0, "sprites/lgtning.spr" },
+	{ 0x7D629602, 0, "models/player/leet/leet.mdl" },
+	{ 0x619FAE10, 0, "sound/player/lburn2.wav" },
+	{ 0x55F487E7, 0, "sound/scientist/c1a0_sci_ctrl3a.wav" },
+	{ 0x76AF4457, 0, "sprites/comp_c03.spr" },
+	{ 0x2E1D301D, 0, "models/p_brenpr.mdl" },
+	{ 0x68DDC547, 0, "gfx/env/xen9rt.tga" },
+	{ 0xD19824F6, 0, "sound/vox/canal.wav" },
+	{ 0x46164769, 0, "sound/barney/of6a4_ba02.wav" },
+	{ 0x67946ADA, 0, "sound/weapons/boltpull1.wav" },
+	{ 0x45F87F52, 0, "models/doctor.mdl" },
+	{ 0x8CE88835, 0, "sprites/effects/adrian/bazooka_smoke.spr" },
+	{ 0x76E21A23, 0, "sprites/obj_icons/dod_escape/icon_obj_custom1_allies.spr" },
+	{ 0xA851F5E7, 0, "sound/agrunt/ag_idle3.wav" },
+	{ 0xBDBA7395, 0, "models/ickyt.mdl" },
+	{ 0x1FC31A87, 0, "sound/ambience/britobjectivesecure.wav" },
+	{ 0x5555DB8E, 0, "models/p_spring_l.mdl" },
+	{ 0x2B2AC683, 0, "maps/dod_donner.txt" },
+	{ 0xCF4A39C8, 0, "sound/barney/c2a5_ba_sniped.wav" },
+	{ 0x909C3EA7, 0, "sound/scientist/noplease.wav" },
+	{ 0x252CF12B, 0, "sound/sentences/hev_1p.wav" },
+	{ 0x119AEC36, 0, "sound/vox/bridge.wav" },
+	{ 0xC12AEED0, 0, "sound/scientist/leavingme.wav" },
+	{ 0xE174BCE0, 0, "sound/sentences/hev_shock.wav" },
+	{ 0x73AF02E4, 0, "sound/tentacle/te_alert2.wav" },
+	{ 0xA1BE00F6, 0, "sound/scientist/heal2.wav" },
+	{ 0xB052F5B6, 0, "sound/vox/water.wav" },
+	{ 0x3338EEC9, 0, "sound/items/kevlar.wav" },
+	{ 0xA24EBA80, 0, "sprites/hudsgsm.spr" },
+	{ 0xE1337EFE, 0, "sound/tentacle/te_roar2.wav" },
+	{ 0x9D47601D, 0, "sound/roach/rch_die.wav" },
+	{ 0xCE370864, 0, "models/mapmodels/waco_glider.mdl" },
+	{ 0x434E8A36, 0, "sound/player/pl_dirt1.wav" },
+	{ 0x85A4A3BC, 0, "gfx/detail/dt_ground3.tga" },
+	{ 0x0A1BEF81, 0, "sound/vox/get.wav" },
+	{ 0x202AEDD2, 0, "gfx/vgui/aug.tga" },
+	{ 0x612EB1F2, 0, "classes/long_demoman.txt" },
+	{ 0x6D60CD5E, 0, "sound/scientist/of3a4_sc02.wav" },
+	{ 0x714C4AEC, 0, "sound/hgrunt/of!.wav" },
+	{ 0xE652D7A2, 0, "models/mapmodels/horse_statue.mdl" },
+	{ 0x2B94094B, 0, "sound/barney/stop2.wav" },
+	{ 0xD72C831A, 0, "gfx/env/neb2bft.tga" },
+	{ 0x5F62F23D, 0, "sound/player/usright.wav" },
+	{ 0xDD8B87C7, 0, "gfx/vgui/fonts/1152_primary button text.tga" },
+	{ 0xF5314C66, 0, "sound/ambience/air.wav" },
+	{ 0x8895607B, 0, "models/sat_globe.mdl" },
+	{ 0x3AA8DCC8, 0, "gfx/vgui/640_cleansuit.tga" },
+	{ 0xEDD0C8CF, 0, "gfx/lambda.bmp" },
+	{ 0xA4A76B59, 0, "sound/hgrunt/gr_die3.wav" },
+	{ 0x4D8621C4, 0, "models/w_paraknife.mdl" },
+	{ 0xE6AFA286, 0, "models/friendly.mdl" },
+	{ 0xA32602D2, 0, "sound/weapons/shock_impact.wav" },
+	{ 0xD5DCEC91, 0, "logos/devl1.bmp" },
+	{ 0x905BFAB4, 0, "sprites/mapsprites/c2_5to1count.spr" },
+	{ 0x36A93097, 0, "sprites/scope_arc.tga" },
+	{ 0x012C0A3B, 0, "sound/rosenberg/ro_ok6.wav" },
+	{ 0x26F9A675, 0, "gfx/env/nightup.bmp" },
+	{ 0x5F60BDA1, 0, "sound/misc/endgame.wav" },
+	{ 0xF71361EC, 0, "sound/vox/ammunition.wav" },
+	{ 0x615AE44C, 0, "resource/cstrike_schinese.txt" },
+	{ 0x8673DC59, 0, "sound/vox/advanced.wav" },
+	{ 0xDDEE8BFC, 0, "sound/drill/thirdroom01.wav" },
+	{ 0x829012A5, 0, "sound/fgrunt/medic_give_shot.wav" },
+	{ 0x2B57F343, 0, "sound/player/usdropguns.wav" },
+	{ 0x2D4D3F61, 0, "sound/vox/locked.wav" },
+	{ 0x00591499, 0, "overviews/de_chateau.txt" },
+	{ 0x233D5470, 0, "models/w_afolder.mdl" },
+	{ 0xD2DD7A92, 0, "sound/fgrunt/now.wav" },
+	{ 0x22FC9DAE, 0, "sound/scientist/whatyoudoing.wav" },
+	{ 0x7287E744, 0, "models/mapmodels/by_banister.mdl" },
+	{ 0x3DC33EF2, 0, "sound/ambience/mortar_background_01.wav" },
+	{ 0x7B93C9AE, 0, "sound/scientist/startle3.wav" },
+	{ 0xB6155A90, 0, "sound/fgrunt/bfeeling.wav" },
+	{ 0xC520819E, 0, "sound/sentences/na10.wav" },
+	{ 0xCCF7D684, 0, "sound/fvox/fifteen.wav" },
+	{ 0xA1F3E44E, 0, "sound/hgrunt/private!.wav" },
+	{ 0xD059318F, 0, "gfx/vgui/640_sniperblue.tga" },
+	{ 0x97BF359C, 0, "sound/sentences/hev_e1.wav" },
+	{ 0x50C5BF98, 0, "sound/fgrunt/medic.wav" },
+	{ 0x6B031D04, 0, "sound/barney/c2a5_ba_helpme.wav" },
+	{ 0x4DAE815F, 0, "sound/fgrunt/nothing.wav" },
+	{ 0x994F3C51, 0, "sound/doors/aliendoor1.wav" },
+	{ 0x3E86647A, 0, "sound/bullchicken/bc_pain2.wav" },
+	{ 0x63F11594, 0, "models/gmant.mdl" },
+	{ 0x916290C9, 0, "sound/sentences/hev_hlth5.wav" },
+	{ 0x85C77A27, 0, "sound/debris/wood3.wav" },
+	{ 0x5433AB41, 0, "sound/debris/concrete3.wav" },
+	{ 0x7B52944F, 0, "sound/fgrunt/suppressing.wav" },
+	{ 0x19E69BF5, 0, "sound/scientist/youlookbad.wav" },
+	{ 0xA442D477, 0, "overviews/rapidcore.txt" },
+	{ 0x82CE1FF6, 0, "sound/intro/g7_goose3_down.wav" },
+	{ 0xA7B75C2B, 0, "models/saw_link.mdl" },
+	{ 0x8FB79398, 0, "sound/sentences/hg_taunt4.wav" },
+	{ 0xCDEB1D83, 0, "sound/vox/after.wav" },
+	{ 0xE5258BC4, 0, "sound/ba_holo/tr_holo_keeptrying.wav" },
+	{ 0x9A4E84E1, 0, "dod_narby.wad" },
+	{ 0x76A784A2, 0, "maps/op4cp_park.txt" },
+	{ 0x424C5FED, 0, "sound/agrunt/ag_alert1.wav" },
+	{ 0xB1E86669, 0, "sound/garg/gar_attack3.wav" },
+	{ 0x4F682F8E, 0, "sound/debris/impact_glass.wav" },
+	{ 0x3145640F, 0, "sound/weapons/hit_glass2.wav" },
+	{ 0x873841EF, 0, "sound/tentacle/te_sing2.wav" },
+	{ 0x020DFD98, 0, "sound/hgrunt/eliminate.wav" },
+	{ 0xDFAF382F, 0, "gfx/env/neb6ft.bmp" },
+	{ 0xB3FAC296, 0, "sound/hgrunt/a!.wav" },
+	{ 0xBDA75F4E, 0, "sound/barney/c2a3_ba_assn.wav" },
+	{ 0xEF60673C, 0, "sound/holo/tr_holo_3jumps.wav" },
+	{ 0xBA33B8A3, 0, "models/v_paraknife.mdl" },
+	{ 0xC50723BC, 0, "sound/ambience/electrical_hum1.wav" },
+	{ 0x92243EE3, 0, "models/pow_invis.mdl" },
+	{ 0xC0B3BCCF, 0, "models/massn.mdl" },
+	{ 0x91D1F7B2, 0, "sound/ba_holo/tr_sci_gwbarney.wav" },
+	{ 0x536A9AB9, 0, "sound/vox/engine.wav" },
+	{ 0xDDA04366, 0, "sound/sentences/c3a1_9.wav" },
+	{ 0x5B3B7D81, 0, "models/tentacle2t.mdl" },
+	{ 0x748BE0A2, 0, "sound/vox/eighteen.wav" },
+	{ 0x0A28BA32, 0, "sound/vox/middle.wav" },
+	{ 0x3F27EDAC, 0, "sound/debris/bustglass3.wav" },
+	{ 0x9F228BEA, 0, "sprites/hint_brithead.spr" },
+	{ 0xD8686780, 0, "sound/player/pain5.wav" },
+	{ 0x7C5E7396, 0, "sprites/bmp/2expl15.bmp" },
+	{ 0x4E9B9949, 0, "sound/vox/ok.wav" },
+	{ 0xBF8D4E0C, 0, "sprites/obj_icons/dod_zalec/icon_obj_custom3_axis.spr" },
+	{ 0x4E142738, 0, "sound/doors/doormove2.wav" },
+	{ 0x6A3CFE76, 0, "sound/barney/ba_power_wound2.wav" },
+	{ 0xDC98E0B6, 0, "sound/ambience/industrial3.wav" },
+	{ 0xB3374E76, 0, "sound/vox/main.wav" },
+	{ 0xC6D2ABC5, 0, "models/mapmodels/flo_bed.mdl" },
+	{ 0xCBAC5EF4, 0, "sound/ichy/ichy_pain1.wav" },
+	{ 0xB2C04243, 0, "sound/fvox/health_dropping2.wav" },
+	{ 0x33B7562C, 0, "models/player/drill/drill.bmp" },
+	{ 0x2528561F, 0, "sound/drill/rifle04.wav" },
+	{ 0x6F21A293, 0, "sound/hostage/hos2.wav" },
+	{ 0x4AF07089, 0, "sound/vox/sector.wav" },
+	{ 0x101BB22C, 0, "sound/sentences/c1a1_9.wav" },
+	{ 0x77908EB8, 0, "sound/ambience/biggun2.wav" },
+	{ 0xA63290D9, 0, "models/mapmodels/couch_fabric-wreck.mdl" },
+	{ 0xA0C0316D, 0, "sound/tentacle/te_strike1.wav" },
+	{ 0x3BCE47F1, 0, "sound/vox/zulu.wav" },
+	{ 0x05900A7B, 0, "sound/hgrunt/these.wav" },
+	{ 0xDBF06839, 0, "sound/vox/order.wav" },
+	{ 0x7A1DE5E5, 0, "sprites/icon_obj_allies.spr" },
+	{ 0x50001809, 0, "sound/vox/zero.wav" },
+	{ 0xCBB16FC1, 0, "gfx/env/snowlake_up.tga" },
+	{ 0xD0E41CA0, 0, "models/w_mg34.mdl" },
+	{ 0xA1491086, 0, "sound/weapons/spring_shoot.wav" },
+	{ 0x9F7F1285, 0, "overviews/push.bmp" },
+	{ 0x2B9C8CD1, 0, "sound/ba_holo/tr_holo_armor.wav" },
+	{ 0x74E13640, 0, "gfx/env/neb6lf.tga" },
+	{ 0x210013B9, 0, "overviews/dmc_dm2.bmp" },
+	{ 0x6E9079BC, 0, "sound/hgrunt/we.wav" },
+	{ 0x67F1B658, 0, "sound/rosenberg/ro_tele_final20.wav" },
+	{ 0xFF2A52CB, 0, "sound/fgrunt/covering.wav" },
+	{ 0x8B318A9B, 0, "sprites/arrow1.spr" },
+	{ 0x51868FDB, 0, "models/w_flaret.mdl" },
+	{ 0xE62C4E54, 0, "sound/weapons/30cal.wav" },
+	{ 0x9F148F51, 0, "gfx/detail/sturm_rubble.tga" },
+	{ 0x3D8EB328, 0, "gfx/env/2desertrt.tga" },
+	{ 0x74EB12A5, 0, "sound/hgrunt/tenmeters.wav" },
+	{ 0xAB0EA466, 0, "sound/sentences/c2a4_9.wav" },
+	{ 0x137EEDE4, 0, "sound/vox/emergency.wav" },
+	{ 0x92B6E37C, 0, "sound/barney/ba_hello5.wav" },
+	{ 0x6DB758DC, 0, "models/mapmodels/shelves_wood.mdl" },
+	{ 0xB01144CE, 0, "sound/misc/doors_shut.wav" },
+	{ 0x7B76CCE8, 0, "models/barney02.mdl" },
+	{ 0x2DA6967C, 0, "sprites/bmp/2expl04.bmp" },
+	{ 0x68D103BA, 0, "models/p_9mmhandgun.mdl" },
+	{ 0xB45CD3BD, 0, "sound/buttons/latchunlocked1.wav" },
+	{ 0x3633BF8E, 0, "gfx/detail/dt_carpet1.tga" },
+	{ 0x112E07B5, 0, "overviews/crossfire.bmp" },
+	{ 0x2135C530, 0, "sound/weapons/displacer_teleport_player.wav" },
+	{ 0xC6C37659, 0, "sound/vox/want.wav" },
+	{ 0x65C40BAA, 0, "sound/hgrunt/zero.wav" },
+	{ 0xD264EC90, 0, "sound/ichy/ichy_die1.wav" },
+	{ 0xFB87CE64, 0, "sound/hgrunt/gr_loadtalk.wav" },
+	{ 0x258B1607, 0, "sound/misc/reveille1.wav" },
+	{ 0xFEB88ACF, 0, "sprites/bmp/2fire02.bmp" },
+	{ 0x890F459E, 0, "sound/debris/concrete2.wav" },
+	{ 0x144B9001, 0, "sound/otis/quitit.wav" },
+	{ 0x592D3FCA, 0, "sound/rosenberg/ro_plfear1.wav" },
+	{ 0x05A30A05, 0, "maps/dod_vicenza_detail.txt" },
+	{ 0xBB9F849A, 0, "gfx/env/cliff2up.tga" },
+	{ 0xD520A5FD, 0, "sound/player/usflank.wav" },
+	{ 0x18E8EF7F, 0, "sound/vox/rapid.wav" },
+	{ 0x4514DE1A, 0, "gfx/env/sky_blu_lf.bmp" },
+	{ 0x93FAAA84, 0, "sound/vox/bottom.wav" },
+	{ 0xACD2D1D9, 0, "sound/drill/thirdroom02.wav" },
+	{ 0x9025D375, 0, "sound/hgrunt/weird.wav" },
+	{ 0x0C0FB5EC, 0, "sprites/bmp/fthrow10.bmp" },
+	{ 0xAA00B185, 0, "sound/agrunt/ag_fire3.wav" },
+	{ 0x6BD35FAA, 0, "gfx/env/backalleybk.tga" },
+	{ 0x169E5C4F, 0, "models/nuke_case.mdl" },
+	{ 0x9FC0186B, 0, "sprites/sshrap1.spr" },
+	{ 0x66998A50, 0, "sound/ambience/sandfall1.wav" },
+	{ 0x1CF3BF44, 0, "sound/vox/clear.wav" },
+	{ 0xE0C12A17, 0, "sound/vox/floor.wav" },
+	{ 0xC7E50D16, 0, "sound/weapons/elite_rightclipin.wav" },
+	{ 0x4FB7D205, 0, "models/w_tommy.mdl" },
+	{ 0xF0941D63, 0, "sound/player/plyrjmp8.wav" },
+	{ 0xD8472DC0, 0, "sound/rosenberg/ro_pain5.wav" },
+	{ 0xC4FBE6A2, 0, "sound/weapons/turridle.wav" },
+	{ 0x0CAF8520, 0, "sound/scientist/heal4.wav" },
+	{ 0xE0881BA9, 0, "sound/sentences/c1a0_3.wav" },
+	{ 0xE1B10DD5, 0, "sound/drill/add01.wav" },
+	{ 0x0A23870E, 0, "overviews/cs_havana.txt" },
+	{ 0x46F6E992, 0, "sprites/640hud4.spr" },
+	{ 0x44198075, 0, "models/shield/v_shield_glock18.mdl" },
+	{ 0x1F164C97, 0, "sound/drill/livefire11.wav" },
+	{ 0x53C143F4, 0, "overviews/dod_merderet.txt" },
+	{ 0x2B1742CB, 0, "sprites/scope_spring.spr" },
+	{ 0xD8896E9B, 0, "sound/drill/oc105.wav" },
+	{ 0xC473B824, 0, "sound/agrunt/ag_idle2.wav" },
+	{ 0xE2F03871, 0, "sound/weapons/357_shot2.wav" },
+	{ 0xE8F4367B, 0, "sound/buttons/lever4.wav" },
+	{ 0x406E1208, 0, "sound/ambience/sparks.wav" },
+	{ 0xBB99E214, 0, "sprites/tf_weapon_tranq.txt" },
+	{ 0x02CC2675, 0, "sound/vox/mike.wav" },
+	{ 0x7A992EDF, 0, "servers/serverbrowser_japanese.txt" },
+	{ 0xEE0CF478, 0, "servers/serverbrowser_italian.txt" },
+	{ 0x7E933B9D, 0, "sound/ambience/cricket.wav" },
+	{ 0xF91A0ED2, 0, "sound/sentences/hev_f6.wav" },
+	{ 0xF42D21FB, 0, "sound/scientist/dontgothere.wav" },
+	{ 0x98CEE111, 0, "sound/geneworm/geneworm_attack_mounted_rocket.wav" },
+	{ 0x3A70662D, 0, "models/w_grenade.mdl" },
+	{ 0xD07CE65D, 0, "sound/misc/broken_tram3.wav" },
+	{ 0xFE8595D8, 0, "sound/vox/dimensional.wav" },
+	{ 0xF509A2EA, 0, "gfx/env/jagdbk.tga" },
+	{ 0x27540FEA, 0, "sound/apache/ap_rotor4.wav" },
+	{ 0x2DC99E2A, 0, "models/helmet_axis.mdl" },
+	{ 0x8B3D68F8, 0, "gfx/env/morningdn.bmp" },
+	{ 0xA3086285, 0, "models/wire_copper16.mdl" },
+	{ 0x52F73B39, 0, "models/mapmodels/hk_radio.mdl" },
+	{ 0x7B629920, 0, "sound/vox/satellite.wav" },
+	{ 0x4EC0061C, 0, "models/p_fg42sr.mdl" },
+	{ 0xABB232D0, 0, "models/player.mdl" },
+	{ 0xD93E4788, 0, "sound/player/britcoverflanks.wav" },
+	{ 0x0F7149FF, 0, "sound/weapons/usp_silencer_on.wav" },
+	{ 0x2EA214FB, 0, "models/shield/p_shield_smokegrenade.mdl" },
+	{ 0xF1830F3C, 0, "maps/dod_northbound.txt" },
+	{ 0x2045B22F, 0, "sound/weapons/hit_wood1.wav" },
+	{ 0x487BF17D, 0, "sound/hgrunt/fuzz.wav" },
+	{ 0x31BE2681, 0, "sound/weapons/m3_insertshell.wav" },
+	{ 0x513B5BD1, 0, "gfx/vgui/fonts/1280_scoreboard text.tga" },
+	{ 0x5AAA4753, 0, "gfx/env/neb6dn.bmp" },
+	{ 0xA82AF107, 0, "sound/ambience/thunder1.wav" },
+	{ 0xBACE5802, 0, "sound/sentences/hev_det1.wav" },
+	{ 0x01FD21B5, 0, "sound/headcrab/hc_alert1.wav" },
+	{ 0xF9473A61, 0, "sound/vox/here.wav" },
+	{ 0x69C41513, 0, "sound/ambience/dog5.wav" },
+	{ 0xA905FDEE, 0, "sound/radio/terwin.wav" },
+	{ 0xF5B53E18, 0, "models/nihilanth.mdl" },
+	{ 0x9795BBE4, 0, "gfx/vgui/640_opposingforce.tga" },
+	{ 0x11E62F5E, 0, "sound/weapons/bgrapple_wait.wav" },
+	{ 0x85E3905E, 0, "sound/bullchicken/bc_attack2.wav" },
+	{ 0xB8F22F36, 0, "sprites/scope_arc_sw.tga" },
+	{ 0x2BD72A4B, 0, "sound/headcrab/hc_attack1.wav" },
+	{ 0x0D3E11CE, 0, "sprites/hudsgammo.spr" },
+	{ 0x4E6FD952, 0, "sound/sentences/beep.wav" },
+	{ 0x3BC79A24, 0, "sound/ambience/the_horror2.wav" },
+	{ 0xB6BC6D13, 0, "sound/scientist/sci_pain5.wav" },
+	{ 0x7519042C, 0, "liquids.wad" },
+	{ 0xF0DAB699, 0, "sound/sentences/hg_clear2.wav" },
+	{ 0x7C3233A9, 0, "sound/sentences/c1a0_10.wav" },
+	{ 0x9E1210EC, 0, "models/p_mg42pr.mdl" },
+	{ 0x206A7154, 0, "sound/player/null.wav" },
+	{ 0xF0C69A16, 0, "resource/vgui_korean.txt" },
+	{ 0x1D760D6F, 0, "sprites/mapsprites/kexplosion1.spr" },
+	{ 0xCDB6A9FA, 0, "sprites/bmp/1expl09.bmp" },
+	{ 0x4A6FFEE2, 0, "dod_anzio.wad" },
+	{ 0x6E57DE22, 0, "sound/hgrunt/my.wav" },
+	{ 0xA7BCD0C7, 0, "sound/scientist/dontwantdie.wav" },
+	{ 0x462E2448, 0, "sound/player/britbehindus.wav" },
+	{ 0x64FE5DB9, 0, "classes/short_spy.txt" },
+	{ 0x2EB13A84, 0, "sprites/shot-dust.spr" },
+	{ 0xD1C8EC23, 0, "sound/barney/ba_raincheck.wav" },
+	{ 0x752531A9, 0, "sound/weapons/xbow_hitbod1.wav" },
+	{ 0x70637DB7, 0, "models/bush.mdl" },
+	{ 0x2F8820E0, 0, "sound/rosenberg/ro_inside_car.wav" },
+	{ 0x901F5CE3, 0, "maps/cs_assault.txt" },
+	{ 0x0E0B564B, 0, "sound/vox/switch.wav" },
+	{ 0xDAE9D464, 0, "sound/buttons/lever1.wav" },
+	{ 0x8B71D141, 0, "gfx/vgui/hint_ushead.tga" },
+	{ 0x00039F1A, 0, "sound/tride/c0a0_tr_emerg.wav" },
+	{ 0x4F846C03, 0, "sound/barney/badarea.wav" },
+	{ 0xB422E764, 0, "sound/misc/beamzap.wav" },
+	{ 0xE7D1D842, 0, "models/playert.mdl" },
+	{ 0x7FE89B85, 0, "sound/vox/highest.wav" },
+	{ 0xF6E3FAE0, 0, "models/mapmodels/panzer.mdl" },
+	{ 0x6BC84C59, 0, "sound/sentences/hev_c4.wav" },
+	{ 0x843F81D0, 0, "models/shell_mg42.mdl" },
+	{ 0xE4FF5C34, 0, "gfx/env/tornskybk.tga" },
+	{ 0xD0D1FB9E, 0, "sound/scientist/fusionshunt.wav" },
+	{ 0x9AF27763, 0, "sprites/obj_icons/dod_vicenza/icon_obj_custom3_axis.spr" },
+	{ 0x0AE67AA4, 0, "sound/sentences/hg_charge0.wav" },
+	{ 0xB2558F3E, 0, "sound/vox/breach.wav" },
+	{ 0x73D8195B, 0, "sound/barney/dontbet.wav" },
+	{ 0x82222892, 0, "sound/scientist/containfail.wav" },
+	{ 0x25E6E5A1, 0, "models/mapmodels/fueltruck.mdl" },
+	{ 0xD6A64896, 0, "sound/weapons/altfire.wav" },
+	{ 0x062794D7, 0, "sound/scream1.wav" },
+	{ 0x2F62FEBC, 0, "sound/weapons/xbow_reload1.wav" },
+	{ 0x78F4F02E, 0, "sound/sentences/hev_bolts.wav" },
+	{ 0xFE857012, 0, "sound/vox/target.wav" },
+	{ 0x168CEED5, 0, "sound/fgrunt/seensquad.wav" },
+	{ 0x1B12A08C, 0, "models/w_g3sg1.mdl" },
+	{ 0x32D2A68B, 0, "sound/radio/com_followcom.wav" },
+	{ 0x36BB5317, 0, "sound/fgrunt/nohealth.wav" },
+	{ 0x4D7B7C5F, 0, "resource/gameui_italian.txt" },
+	{ 0x37DF5073, 0, "sound/scientist/c1a0_sci_crit2a.wav" },
+	{ 0x1AE01A45, 0, "sound/barney/leavealone.wav" },
+	{ 0xCADBBEE8, 0, "models/tool_box_sm.mdl" },
+	{ 0x889A1486, 0, "models/gib_2.mdl" },
+	{ 0xBAB026DE, 0, "models/mapmodels/rug_oriental-large5.mdl" },
+	{ 0x7959046A, 0, "sound/radio/ct_enemys.wav" },
+	{ 0xB1B0ECA8, 0, "models/p_garand_l.mdl" },
+	{ 0xAD86868F, 0, "sound/vox/right.wav" },
+	{ 0xE835E748, 0, "gfx/env/rubbleup.tga" },
+	{ 0xEBC4A05F, 0, "sound/sentences/dr1.wav" },
+	{ 0xB40588A2, 0, "sprites/blood_chnk.spr" },
+	{ 0xA7EDC1B4, 0, "models/mil_stand.mdl" },
+	{ 0xA04B75A2, 0, "models/w_fg42.mdl" },
+	{ 0xA43F50E6, 0, "sound/sentences/c1a4_6.wav" },
+	{ 0x6E5F888A, 0, "sound/shocktrooper/puh.wav" },
+	{ 0x0FE36881, 0, "sound/vox/inoperative.wav" },
+	{ 0xA3B1C1D4, 0, "sprites/weapon_aug.txt" },
+	{ 0xF9035F60, 0, "sound/drill/dr2_add07.wav" },
+	{ 0x1F4B0993, 0, "sound/rosenberg/ro_cure1.wav" },
+	{ 0x56015B4F, 0, "sound/weapons/bgrapple_fire.wav" },
+	{ 0x90E9AFD4, 0, "overviews/dod_glider.bmp" },
+	{ 0x5DC654F6, 0, "sound/hgrunt/gr_die2.wav" },
+	{ 0x46F15BC6, 0, "sound/drill/add13.wav" },
+	{ 0xF254099B, 0, "sprites/explode1.spr" },
+	{ 0x7634586F, 0, "models/shield/v_shield_fiveseven.mdl" },
+	{ 0x1306CE90, 0, "sprites/mapsprites/fog2.spr" },
+	{ 0xDBF03DFA, 0, "logos/smiley.bmp" },
+	{ 0x04486308, 0, "sound/hgrunt/we've.wav" },
+	{ 0x3F81E3FD, 0, "gfx/env/tornskyft.tga" },
+	{ 0x95568B3C, 0, "sprites/gworm_beam_02.spr" },
+	{ 0xE5585687, 0, "sound/barney/ambush.wav" },
+	{ 0x70974EDE, 0, "sound/player/teledth1.wav" },
+	{ 0xB6D61E94, 0, "sound/player/land.wav" },
+	{ 0x7739A3F3, 0, "sound/player/gergogogo.wav" },
+	{ 0x8382677A, 0, "models/truck.mdl" },
+	{ 0x323ED71B, 0, "sound/agrunt/ag_pain5.wav" },
+	{ 0x34F77EDD, 0, "sound/items/suit2.wav" },
+	{ 0x46984B17, 0, "sound/debris/bustcrate1.wav" },
+	{ 0x793198F8, 0, "models/w_gflag.mdl" },
+	{ 0x386E9685, 0, "sound/barney/c1a0_ba_hevno.wav" },
+	{ 0x33ADCFBA, 0, "sound/ba_holo/tr_holo_jump.wav" },
+	{ 0x0DE510DB, 0, "models/shield/v_shield_knife.mdl" },
+	{ 0x915BB475, 0, "sound/fgrunt/of2a5_fg04.wav" },
+	{ 0x08A9F17E, 0, "sound/x/x_recharge2.wav" },
+	{ 0x5EA78622, 0, "sound/vox/amigo.wav" },
+	{ 0x1C433421, 0, "sound/fgrunt/shephard.wav" },
+	{ 0xB894238F, 0, "sound/buttons/spark5.wav" },
+	{ 0x532568FF, 0, "models/can.mdl" },
+	{ 0x97D7DA46, 0, "sound/drill/dr2_add12.wav" },
+	{ 0x24D9BA52, 0, "sprites/black_smoke2.spr" },
+	{ 0x475F98AD, 0, "sound/vox/round.wav" },
+	{ 0xB331F82E, 0, "sound/hgrunt/i!.wav" },
+	{ 0xB0118E85, 0, "sound/sentences/hev_c8.wav" },
+	{ 0x8A3450F4, 0, "sprites/bmp/medic03.bmp" },
+	{ 0x231A3EAF, 0, "sound/drill/dr2_add11.wav" },
+	{ 0x51FFBE22, 0, "sound/rosenberg/ro_yard_hurry02.wav" },
+	{ 0xC005574D, 0, "sound/controller/con_idle2.wav" },
+	{ 0xA0FEF9DC, 0, "sprites/obj_icons/dod_falaise/icon_obj_custom3_neutral.spr" },
+	{ 0xDDDA450E, 0, "sound/player/gerdisplace.wav" },
+	{ 0x1F88A6E0, 0, "sound/weapons/mp5_clipout.wav" },
+	{ 0xE9F53920, 0, "sound/drill/rifle01.wav" },
+	{ 0x9CF17D90, 0, "sound/fgrunt/takecover.wav" },
+	{ 0x3266914F, 0, "sound/sentences/c1a4_5.wav" },
+	{ 0x9D9D3035, 0, "gfx/env/morningdewdn.tga" },
+	{ 0x94A264DC, 0, "sound/misc/r_tele1.wav" },
+	{ 0xBA691050, 0, "sound/vox/sudden.wav" },
+	{ 0xE5A8A38E, 0, "sound/scientist/scream1.wav" },
+	{ 0x8DB50324, 0, "models/mapmodels/flo_tree04.mdl" },
+	{ 0xE59DB1F4, 0, "sound/sentences/hg_taunt0.wav" },
+	{ 0x5B2DBFFE, 0, "models/sentry2.mdl" },
+	{ 0x06A01773, 0, "sound/sentences/hev_e4.wav" },
+	{ 0xBEBB1D31, 0, "models/dead_barney.mdl" },
+	{ 0x77209A8C, 0, "models/leech.mdl" },
+	{ 0xEE3C2A00, 0, "sound/fgrunt/intro_fg06.wav" },
+	{ 0x044B02F8, 0, "sound/sentences/c1a2_2.wav" },
+	{ 0xAD3CA1FE, 0, "sound/fgrunt/of2a4_fg02.wav" },
+	{ 0x8112A994, 0, "sound/weapons/saw_fire1.wav" },
+	{ 0x5C8731F1, 0, "sound/scientist/scream15.wav" },
+	{ 0x7874BD58, 0, "sound/rosenberg/ro_wound0.wav" },
+	{ 0x913E6E6E, 0, "sound/vox/secured.wav" },
+	{ 0x84B60DA3, 0, "sound/sentences/ctr0.wav" },
+	{ 0x0261E5BF, 0, "sound/fvox/get_egon.wav" },
+	{ 0xED5DAAAF, 0, "sound/player/pl_die1.wav" },
+	{ 0x3055883D, 0, "sound/geneworm/geneworm_shot_in_eye.wav" },
+	{ 0x19EDA5B0, 0, "models/zombie_barney03.mdl" },
+	{ 0x514D32C0, 0, "sound/sentences/hev_2p.wav" },
+	{ 0x64A7356B, 0, "sound/rosenberg/ro_tele_xen11.wav" },
+	{ 0xB1981D6B, 0, "gfx/env/desft.tga" },
+	{ 0x0E261884, 0, "sound/weapons/galil_clipin.wav" },
+	{ 0xFCBC3C16, 0, "sound/hgrunt/all!.wav" },
+	{ 0x97E40190, 0, "sound/sentences/hg_idle2.wav" },
+	{ 0x2FEB55DE, 0, "models/spiggot.mdl" },
+	{ 0x5E7C2330, 0, "models/massn01.mdl" },
+	{ 0x3556C2BD, 0, "classes/short_medic.txt" },
+	{ 0xFDA9337B, 0, "sprites/spark1.spr" },
+	{ 0x2177A2D2, 0, "sound/otis/job.wav" },
+	{ 0xB29290D2, 0, "models/mapmodels/saint_grass.mdl" },
+	{ 0x01E621F5, 0, "models/p_pschreck.mdl" },
+	{ 0x60F2BA01, 0, "sound/buttons/lever2.wav" },
+	{ 0x522D8C73, 0, "sound/barney/ba_pok2.wav" },
+	{ 0x78EF57F7, 0, "sound/vox/is.wav" },
+	{ 0x1AD5E966, 0, "models/wire_red8.mdl" },
+	{ 0x19B1C68B, 0, "gfx/env/kraftstoffdn.tga" },
+	{ 0x7C0E1A7E, 0, "sound/sentences/hg_gren4.wav" },
+	{ 0x632525E1, 0, "sound/otis/mall.wav" },
+	{ 0x028BBFE7, 0, "gfx/vgui/scout.tga" },
+	{ 0x8E950802, 0, "sprites/white.spr" },
+	{ 0xD5CC0014, 0, "sound/doors/doorstop7.wav" },
+	{ 0x11ECC9A1, 0, "overviews/datacore.tga" },
+	{ 0x520DCEBC, 0, "sound/weapons/g3sg1-1.wav" },
+	{ 0xA8ADC400, 0, "sound/sentences/c3a2_0.wav" },
+	{ 0x6F24A8AD, 0, "sprites/logo320.spr" },
+	{ 0x88FCE4CD, 0, "sound/aslave/slv_die1.wav" },
+	{ 0xF2C13DA8, 0, "sound/vox/military.wav" },
+	{ 0x780EA6CF, 0, "sound/fgrunt/through.wav" },
+	{ 0xDDBFF79D, 0, "sound/items/suitchargeno1.wav" },
+	{ 0x6C142EBF, 0, "sprites/weapon_crowbar.txt" },
+	{ 0xB4583B9D, 0, "models/mapmodels/enginegibs.mdl" },
+	{ 0x38CBE635, 0, "sound/sentences/c3a1_4.wav" },
+	{ 0x9175D1C6, 0, "gfx/env/alien3rt.bmp" },
+	{ 0x132A70EE, 0, "gfx/env/cxrt.tga" },
+	{ 0x29C3277C, 0, "models/player/ctf_gordon/ctf_gordon.mdl" },
+	{ 0xC76D03C7, 0, "resource/icon_hlicon2.tga" },
+	{ 0x43169D95, 0, "sound/scientist/youneedmedic.wav" },
+	{ 0x0F4F70D2, 0, "sprites/obj_icons/icon_obj_88_axis.spr" },
+	{ 0xE33910E6, 0, "gfx/vgui/guerilla.tga" },
+	{ 0xCC9D1E97, 0, "gfx/vgui/fonts/1024_scoreboard title text.tga" },
+	{ 0xEB53A53F, 0, "sound/hassault/hw_shoot3.wav" },
+	{ 0xCF722AD5, 0, "sound/headcrab/hc_attack3.wav" },
+	{ 0x7BA489A3, 0, "sprites/tinyspit.spr" },
+	{ 0x04531ED7, 0, "sprites/laserbeam.spr" },
+	{ 0x2A5ECE76, 0, "classes/short_demoman.txt" },
+	{ 0xBA24654D, 0, "sound/weapons/boltforward.wav" },
+	{ 0x88331D4D, 0, "models/p_hegrenade.mdl" },
+	{ 0x7E004B89, 0, "sound/houndeye/he_pain2.wav" },
+	{ 0x65E83267, 0, "sprites/oriented.spr" },
+	{ 0xD5A27955, 0, "models/snow_tree.mdl" },
+	{ 0x56FEE969, 0, "sprites/xsmoke3.spr" },
+	{ 0xB0C21068, 0, "gfx/env/bluebk.tga" },
+	{ 0x9F40E574, 0, "sound/sentences/hev_dmg2.wav" },
+	{ 0x288E5151, 0, "sound/vox/now.wav" },
+	{ 0xDF51DC89, 0, "sound/scientist/shutup.wav" },
+	{ 0xA09300F4, 0, "sound/scientist/greetings2.wav" },
+	{ 0xFBAC8397, 0, "sound/vox/interchange.wav" },
+	{ 0xB1A69D38, 0, "maps/dod_northbound_detail.txt" },
+	{ 0x67F60020, 0, "sprites/bmp/2expl13.bmp" },
+	{ 0x421116A1, 0, "sound/fvox/one.wav" },
+	{ 0x344CE411, 0, "sound/sentences/ng2.wav" },
+	{ 0x10C01335, 0, "overviews/cs_office.txt" },
+	{ 0xBD5BCD5F, 0, "overviews/frenzy.bmp" },
+	{ 0xB61AE268, 0, "sound/debris/metal2.wav" },
+	{ 0x440858F4, 0, "models/gargt.mdl" },
+	{ 0xC4A8364C, 0, "sound/weapons/shotgn2.wav" },
+	{ 0xB24D2AA2, 0, "maps/badlands.txt" },
+	{ 0x719C9799, 0, "sound/sentences/dr3.wav" },
+	{ 0x539FE69F, 0, "sound/sentences/nd1.wav" },
+	{ 0x77FC6F4E, 0, "sprites/aflag.spr" },
+	{ 0xAB0DB4C5, 0, "sound/scientist/announcer.wav" },
+	{ 0xD3A6232B, 0, "sound/vox/nineteen.wav" },
+	{ 0xA1F131DA, 0, "sound/scientist/c1a0_sci_crit3a.wav" },
+	{ 0x93FE482F, 0, "sprites/bmp/fthrow11.bmp" },
+	{ 0x0684F54B, 0, "sound/vox/proceed.wav" },
+	{ 0x09CA0073, 0, "sound/fvox/safe_day.wav" },
+	{ 0xF68D76C2, 0, "sound/vox/bad.wav" },
+	{ 0xC6C57D76, 0, "sound/vox/message.wav" },
+	{ 0x014DD1D8, 0, "sound/vox/motor.wav" },
+	{ 0x1B51B274, 0, "models/v_flashbang.mdl" },
+	{ 0x2F5906B8, 0, "sound/weapons/m4a1_unsil-1.wav" },
+	{ 0x282E3E6B, 0, "models/p_garand.mdl" },
+	{ 0x5CF9793F, 0, "sound/barney/nope.wav" },
+	{ 0xAE20784E, 0, "models/hassassint.mdl" },
+	{ 0x22CEE010, 0, "resource/dod_italian.txt" },
+	{ 0x33DCC7CB, 0, "models/w_9mmarclip.mdl" },
+	{ 0x01D294CC, 0, "resource/tfc_english.txt" },
+	{ 0x0F811DA9, 0, "models/hostage07.mdl" },
+	{ 0x10C03AFE, 0, "sound/pitdrone/pit_drone_eat.wav" },
+	{ 0x6F55042B, 0, "sprites/hint_horiz.spr" },
+	{ 0x2B68BAED, 0, "sound/voltigore/voltigore_eat.wav" },
+	{ 0x49C2160D, 0, "models/blkop_tailgibs.mdl" },
+	{ 0xAE13845A, 0, "sound/player/prewarmup.wav" },
+	{ 0xE61AF19B, 0, "gfx/env/alien3bk.bmp" },
+	{ 0x315DD7B2, 0, "models/v_tfc_railgun.mdl" },
+	{ 0x9822A3C5, 0, "models/agrunt01.mdl" },
+	{ 0x058BF845, 0, "gfx/env/killertomatobk.tga" },
+	{ 0x949E0E6C, 0, "media/launch_glow1.wav" },
+	{ 0xB0BDFF7E, 0, "sound/hgrunt/the!.wav" },
+	{ 0xAE42340C, 0, "sound/barney/c1a2_ba_top.wav" },
+	{ 0x809AD685, 0, "sound/ambience/burning2.wav" },
+	{ 0x9E6BBFFF, 0, "sound/vox/down.wav" },
+	{ 0x7662FF30, 0, "sound/vox/may.wav" },
+	{ 0x880652DC, 0, "gfx/env/morningdewbk.tga" },
+	{ 0x2EE4A12C, 0, "models/med_crategibs.mdl" },
+	{ 0xDB704D8E, 0, "sprites/tf_weapon_shotgun.txt" },
+	{ 0x659087A1, 0, "sound/rosenberg/ro_fear0.wav" },
+	{ 0x3BABDD75, 0, "sound/ui/buttonrollover.wav" },
+	{ 0x77D19D25, 0, "sound/weapons/galil_clipout.wav" },
+	{ 0xE1DDA20E, 0, "sound/hgrunt/go.wav" },
+	{ 0x6A9B1BD3, 0, "sound/vox/failure.wav" },
+	{ 0x3C9CFA33, 0, "sound/sentences/c3a2_1.wav" },
+	{ 0xAA969CB1, 0, "sound/shocktrooper/shock_trooper_pain1.wav" },
+	{ 0xB73B31BD, 0, "sound/items/guncock1.wav" },
+	{ 0x9000C6E5, 0, "gfx/env/nightlf.tga" },
+	{ 0x079D4D05, 0, "sound/sentences/hev_gr11.wav" },
+	{ 0x07356089, 0, "gfx/vgui/1152_arrowup.tga" },
+	{ 0x0114992F, 0, "models/pallet.mdl" },
+	{ 0xEDE43C99, 0, "sound/ambience/tankdrivein2.wav" },
+	{ 0xF8B387CC, 0, "sound/debris/alien_teleport.wav" },
+	{ 0x69074776, 0, "sound/weapons/biggun1.wav" },
+	{ 0xD83B6522, 0, "sound/barney/soundsbad.wav" },
+	{ 0x37F594CA, 0, "sound/debris/zap4.wav" },
+	{ 0x4083972F, 0, "sound/sentences/c1a0_1.wav" },
+	{ 0xDD63DAA4, 0, "sound/sentences/hg_quest6.wav" },
+	{ 0xEEFBA539, 0, "sound/player/pl_shell3.wav" },
+	{ 0x4FC81E0B, 0, "sound/player/damage9.wav" },
+	{ 0x1779BEFB, 0, "sound/player/usgogogo.wav" },
+	{ 0x0ECD4CD1, 0, "sound/vox/overload.wav" },
+	{ 0xA4E84AF7, 0, "cstraining.wad" },
+	{ 0x6587976E, 0, "models/feather.mdl" },
+	{ 0x61AFBE4F, 0, "sound/hgrunt/all.wav" },
+	{ 0xC0E06FEF, 0, "sound/scientist/c1a0_sci_catscream.wav" },
+	{ 0x9117C2D7, 0, "sound/player/gerusegrenades.wav" },
+	{ 0xB937CDC7, 0, "sound/ambience/britwin.wav" },
+	{ 0xE2427A67, 0, "sound/weapons/cbar_hit2.wav" },
+	{ 0x27BD94FE, 0, "sound/otis/of1a1_ot03.wav" },
+	{ 0x661AC706, 0, "sound/scientist/c2a4_sci_arg2a.wav" },
+	{ 0xF7E27173, 0, "sound/ambience/squitch.wav" },
+	{ 0x326F8817, 0, "gfx/env/cliff2bk.bmp" },
+	{ 0x353B282F, 0, "models/apache.mdl" },
+	{ 0x044C46DB, 0, "sound/otis/nope.wav" },
+	{ 0x3E1B246E, 0, "sound/fgrunt/hitbad.wav" },
+	{ 0xE359FD7F, 0, "sound/weapons/famas_clipin.wav" },
+	{ 0xFA1CB8FA, 0, "sound/ambience/waterrun.wav" },
+	{ 0x67330206, 0, "overviews/dmc_dm2.tga" },
+	{ 0xD6947FC1, 0, "sound/vox/inspection.wav" },
+	{ 0x013FF563, 0, "models/mapmodels/sandbag_gib.mdl" },
+	{ 0xB0FB7601, 0, "sound/scientist/c1a0_sci_lock3a.wav" },
+	{ 0x61825243, 0, "sound/weapons/grenade.wav" },
+	{ 0x09AB0C5C, 0, "sound/weapons/hit_leaves1.wav" },
+	{ 0x7DBB2FFA, 0, "sprites/640hudof01.spr" },
+	{ 0x7B34D2E3, 0, "sound/scientist/sci_dragoff.wav" },
+	{ 0xD099375B, 0, "sprites/bmp/tffire02.bmp" },
+	{ 0xFCE2BF17, 0, "sound/weapons/garand_reload_clipding.wav" },
+	{ 0x41D38623, 0, "sound/radio/sticktog.wav" },
+	{ 0xC22510AA, 0, "sound/vox/sterilization.wav" },
+	{ 0x22BC2A7D, 0, "sound/scientist/gottogetout.wav" },
+	{ 0x04DBC3F7, 0, "gfx/vgui/fonts/1024_hintmessage text.tga" },
+	{ 0xE7DFA931, 0, "sound/garg/gar_breathe2.wav" },
+	{ 0x0CA415F2, 0, "sound/player/pl_fallpain1.wav" },
+	{ 0x35EC5830, 0, "sound/pitdrone/pit_drone_attack_spike1.wav" },
+	{ 0xA97F819E, 0, "resource/vgui_schinese.txt" },
+	{ 0xC5871170, 0, "sprites/weapon_sniperrifle.txt" },
+	{ 0x1A3985CC, 0, "sound/scientist/c1a0_sci_lock6a.wav" },
+	{ 0xFB945F7C, 0, "sound/hgrunt/five.wav" },
+	{ 0x2BD4E88B, 0, "sound/sentences/hev_amo0.wav" },
+	{ 0x29E1BA7E, 0, "models/v_m3.mdl" },
+	{ 0xC30749A3, 0, "sprites/zbeam1.spr" },
+	{ 0x51F1C893, 0, "sound/player/pl_gravel4.wav" },
+	{ 0x037E539C, 0, "sound/weapons/splauncher_reload.wav" },
+	{ 0x747077B5, 0, "sound/scientist/youlookbad2.wav" },
+	{ 0x7CF7AD27, 0, "sound/drill/fourthroom01.wav" },
+	{ 0x95167721, 0, "gfx/env/spacelf.tga" },
+	{ 0x27EFF534, 0, "models/armour_r.mdl" },
+	{ 0x0C365AF0, 0, "sound/agrunt/ag_alert2.wav" },
+	{ 0x4D1C4754, 0, "sound/sentences/doop.wav" },
+	{ 0x2C16211A, 0, "sound/controller/con_idle3.wav" },
+	{ 0x2B9E0498, 0, "models/b_nail0.mdl" },
+	{ 0xB39A46AC, 0, "sound/x/x_laugh2.wav" },
+	{ 0x04618DC0, 0, "sound/plats/ttrain4.wav" },
+	{ 0xCBE1EA9A, 0, "models/mapmodels/mill.mdl" },
+	{ 0x2B523DDF, 0, "models/p_rock2.mdl" },
+	{ 0x80AECCD2, 0, "sound/fgrunt/death6.wav" },
+	{ 0x01EF5EA4, 0, "dod_falaise.wad" },
+	{ 0x49CA4388, 0, "sound/ambience/burning1.wav" },
+	{ 0xC6DC926A, 0, "models/mapmodels/sherman.mdl" },
+	{ 0x958D75BE, 0, "models/w_chainammot.mdl" },
+	{ 0xAF4E65EF, 0, "models/mapmodels/by_barrel_brown.mdl" },
+	{ 0x5A0174D1, 0, "sprites/xflare2.spr" },
+	{ 0x98BFE0A1, 0, "sound/otis/leftovers.wav" },
+	{ 0xC8C066D2, 0, "sound/geneworm/geneworm_idle3.wav" },
+	{ 0xE7E1ED36, 0, "sound/sentences/hev_tripmine.wav" },
+	{ 0xA9A99488, 0, "sound/otis/somuch.wav" },
+	{ 0x35762AC9, 0, "sprites/obj_icons/dod_jagd/icon_obj_custom2_allies.spr" },
+	{ 0x84B6EAA8, 0, "sprites/gflag.spr" },
+	{ 0x375F54FE, 0, "sound/vox/tactical.wav" },
+	{ 0x6E855E58, 0, "sound/hgrunt/c2a3_hg_2drag.wav" },
+	{ 0x7819D8D4, 0, "sound/scientist/sci_4thou.wav" },
+	{ 0x7CB69C39, 0, "sound/vox/bay.wav" },
+	{ 0x2ADA90B2, 0, "sound/barney/rightway.wav" },
+	{ 0xB7BA6875, 0, "gfx/env/avart.tga" },
+	{ 0xF959AA1C, 0, "sound/player/h2ojump.wav" },
+	{ 0xC2619395, 0, "sound/weapons/mg42_shoot.wav" },
+	{ 0x0D8B7A1B, 0, "sound/weapons/enfieldsniper_shoot.wav" },
+	{ 0x0B6644E5, 0, "classes/long_pyro.txt" },
+	{ 0x12C3770A, 0, "sound/fvox/hev_damage.wav" },
+	{ 0x8B5B0C34, 0, "models/mapmodels/zalec_window.mdl" },
+	{ 0x806B9D9E, 0, "sound/turret/tu_alert.wav" },
+	{ 0x0E1F1008, 0, "resource/icon_right.tga" },
+	{ 0xF96D465A, 0, "gfx/env/strt.tga" },
+	{ 0x7E9916B2, 0, "overviews/bounce.txt" },
+	{ 0x1E7A4742, 0, "sound/hgrunt/over.wav" },
+	{ 0xFF0EE645, 0, "sound/sentences/ea3.wav" },
+	{ 0x258D05BD, 0, "sound/sentences/t5.wav" },
+	{ 0xEC6A6D4C, 0, "sound/vox/and.wav" },
+	{ 0x65AC6E68, 0, "sound/fvox/online.wav" },
+	{ 0x3368FFFF, 0, "models/mini_apache.mdl" },
+	{ 0x2E82A783, 0, "sprites/b-tele1.spr" },
+	{ 0x97C9A12A, 0, "sound/vox/at.wav" },
+	{ 0x5E7769AC, 0, "sound/hgrunt/echo!.wav" },
+	{ 0xE3E0E0FF, 0, "sound/sentences/c3a2_5.wav" },
+	{ 0xBFBA47C3, 0, "sound/weapons/pwrench_big_hit2.wav" },
+	{ 0xD3FA41D7, 0, "sound/hgrunt/three!.wav" },
+	{ 0x5B7D043C, 0, "maps/dod_sturm.txt" },
+	{ 0x9F149102, 0, "sound/weapons/rocket1.wav" },
+	{ 0x70AD890F, 0, "gfx/env/jagddn.tga" },
+	{ 0xCF9C69B4, 0, "sound/headcrab/hc_headbite.wav" },
+	{ 0xAF993FC1, 0, "sound/sentences/hev_gr15.wav" },
+	{ 0x19F6FDC7, 0, "sound/sentences/ctr15.wav" },
+	{ 0xA644C9BD, 0, "gfx/env/alien1bk.bmp" },
+	{ 0x95549132, 0, "gfx/env/snowlake_lf.tga" },
+	{ 0x04584667, 0, "sound/fvox/nineteen.wav" },
+	{ 0x2F503126, 0, "sound/rosenberg/ro_tele_final17.wav" },
+	{ 0x0E3580C2, 0, "gfx/env/avantiup.bmp" },
+	{ 0x2B4A9F48, 0, "gfx/vgui/fonts/640_title font.tga" },
+	{ 0x0DB6017E, 0, "sound/scientist/leadtheway.wav" },
+	{ 0x966ED68D, 0, "gfx/decals/hwshot5.bmp" },
+	{ 0x4E33B7DE, 0, "sound/scientist/c1a4_sci_rocket.wav" },
+	{ 0xA54F6CEA, 0, "sound/fgrunt/tag.wav" },
+	{ 0x5FE9821A, 0, "sprites/bmp/tffire09.bmp" },
+	{ 0x32D10089, 0, "gfx/env/drkglf.tga" },
+	{ 0x8D468449, 0, "sound/houndeye/he_attack2.wav" },
+	{ 0xC54BC5F0, 0, "sprites/320_1bounce.spr" },
+	{ 0x32F4763B, 0, "overviews/lambda_bunker.txt" },
+	{ 0x4A6B0C51, 0, "sound/tram/ba_tram7.wav" },
+	{ 0x3B14FC5B, 0, "models/mapmodels/support_beams1.mdl" },
+	{ 0x64674C9B, 0, "sound/drill/barracks05.wav" },
+	{ 0x38C44484, 0, "sprites/weapon_displacer.txt" },
+	{ 0x9EB8B46D, 0, "models/w_enfields.mdl" },
+	{ 0x2C9EA75A, 0, "models/b_nail0t.mdl" },
+	{ 0xA4819D9E, 0, "resource/icon_stop.tga" },
+	{ 0x035E82EF, 0, "sound/sentences/bizwarn.wav" },
+	{ 0xDC3D1C8C, 0, "sound/drill/dr2_add10.wav" },
+	{ 0x2C24C1E8, 0, "sound/scientist/c2a4_sci_surgury.wav" },
+	{ 0xA2871EB4, 0, "sound/vox/not.wav" },
+	{ 0xC5811C31, 0, "sound/sentences/c1a1_2.wav" },
+	{ 0xC2443360, 0, "sound/vox/forbidden.wav" },
+	{ 0x8E17B1FE, 0, "models/scientist10.mdl" },
+	{ 0x6B02BF5F, 0, "sound/sentences/hg_clear0.wav" },
+	{ 0xFEDCF4CE, 0, "sound/weapons/mp5-2.wav" },
+	{ 0xB2E81C60, 0, "gfx/env/neb6dn.tga" },
+	{ 0x375A8225, 0, "sound/scientist/purereadings.wav" },
+	{ 0x5FA63599, 0, "models/mapmodels/truck.mdl" },
+	{ 0x383C8627, 0, "models/gib_1.mdl" },
+	{ 0x63EBEEAD, 0, "sound/bullchicken/bc_bite1.wav" },
+	{ 0x33865D4B, 0, "overviews/dod_donner.bmp" },
+	{ 0x64C5B848, 0, "sound/houndeye/he_die1.wav" },
+	{ 0x50EC08D6, 0, "sound/scientist/didyouhear.wav" },
+	{ 0xE3E24A42, 0, "models/mapmodels/arc_flower.mdl" },
+	{ 0xC412A355, 0, "gfx/detail/dt_conc.tga" },
+	{ 0x39536DF6, 0, "sound/vox/vox_login.wav" },
+	{ 0x85493E4B, 0, "sound/scientist/getoutalive.wav" },
+	{ 0x928E5F18, 0, "sound/weapons/displacer_teleport.wav" },
+	{ 0xF461BA88, 0, "sound/hgrunt/nothing!.wav" },
+	{ 0x48A6D160, 0, "sound/fvox/get_grenade.wav" },
+	{ 0xFCFBBAAE, 0, "sound/hassault/hw_spinup.wav" },
+	{ 0x43648DB0, 0, "sound/scientist/sc_hello3.wav" },
+	{ 0x5AEF2F7C, 0, "sound/player/gerhold.wav" },
+	{ 0xDC658BF6, 0, "models/w_9mmclipt.mdl" },
+	{ 0x9FBD3D79, 0, "sound/garg/gar_alert1.wav" },
+	{ 0x2EADE316, 0, "sound/items/clipinsert1.wav" },
+	{ 0x2D66CF0D, 0, "sound/ambience/forestcreek.wav" },
+	{ 0xC71D1A85, 0, "sound/hgrunt/alert!.wav" },
+	{ 0xE8FB7504, 0, "sound/hgrunt/c2a2_hg_chat2a.wav" },
+	{ 0xFD5A5888, 0, "gfx/vgui/timer.tga" },
+	{ 0xB0273E39, 0, "sound/scientist/sc_pok6.wav" },
+	{ 0x1514F1B8, 0, "sprites/obj_icons/dod_falaise/icon_obj_custom2_allies.spr" },
+	{ 0x5C7F5E15, 0, "sound/radio/bombpl.wav" },
+	{ 0x7BE772E6, 0, "sprites/tfchud03.spr" },
+	{ 0x7351F044, 0, "models/p_amerk.mdl" },
+	{ 0x44F8505D, 0, "sound/gonome/gonome_eat.wav" },
+	{ 0xF10CE9B4, 0, "sound/hgrunt/gr_mgun1.wav" },
+	{ 0xDB2F42DE, 0, "sound/drill/dr2_add09.wav" },
+	{ 0x0C901B70, 0, "sound/buttons/button3.wav" },
+	{ 0xF103DA07, 0, "xeno.wad" },
+	{ 0x53C0B34C, 0, "models/forklift.mdl" },
+	{ 0x7CE26DAB, 0, "models/nuke_button.mdl" },
+	{ 0x0825676D, 0, "models/pipebomb.mdl" },
+	{ 0x22BF7CAE, 0, "sound/hgrunt/yes!.wav" },
+	{ 0xBC31FDF4, 0, "sprites/weapon_shield.txt" },
+	{ 0xA219B665, 0, "sound/sentences/hg_gren1.wav" },
+	{ 0x4E1CA51E, 0, "sprites/bmp/medic01.bmp" },
+	{ 0xAD94E3A5, 0, "gfx/env/drkgrt.tga" },
+	{ 0xD296A2FF, 0, "overviews/dcdm5.txt" },
+	{ 0x0B606F98, 0, "gfx/vgui/fonts/800_briefing text.tga" },
+	{ 0xE49A53B6, 0, "sound/sentences/hev_c10.wav" },
+	{ 0x9696ED38, 0, "sound/voltigore/voltigore_attack_melee2.wav" },
+	{ 0x94DC8D51, 0, "sprites/american.spr" },
+	{ 0xF503776B, 0, "sprites/wall_puff2.spr" },
+	{ 0xBBA6A89D, 0, "models/mapmodels/barrelcrash.mdl" },
+	{ 0x271C9C31, 0, "sound/doors/doormove5.wav" },
+	{ 0x75A39B66, 0, "sound/weapons/clipout1.wav" },
+	{ 0xD9B15087, 0, "sound/scientist/sc_accident1.wav" },
+	{ 0x19D622CD, 0, "sound/zombie/zo_alert30.wav" },
+	{ 0xEDF2DB88, 0, "sound/scientist/c1a2_sci_dangling.wav" },
+	{ 0x3241E0A9, 0, "sound/scientist/of3a2_sc01.wav" },
+	{ 0x6292D076, 0, "sound/radio/circleback.wav" },
+	{ 0x26A33F6F, 0, "sound/weapons/railgun.wav" },
+	{ 0x9336DC19, 0, "sound/barney/iwaithere.wav" },
+	{ 0xA95112BA, 0, "sound/vox/automatic.wav" },
+	{ 0xEA7F5C6B, 0, "sound/ambience/rifle1.wav" },
+	{ 0x8DB037A9, 0, "maps/dod_jagd_detail.txt" },
+	{ 0x327E982F, 0, "sound/weapons/sten_shoot.wav" },
+	{ 0x686ACA39, 0, "sound/sentences/c1a3_4.wav" },
+	{ 0xA30D3E51, 0, "sprites/scope_arc_ne.tga" },
+	{ 0x6664CBC1, 0, "sound/vox/deeoo.wav" },
+	{ 0x4391F60A, 0, "sound/ambience/particle_suck1.wav" },
+	{ 0x4019B900, 0, "models/shield/p_shield_usp.mdl" },
+	{ 0xAB752A91, 0, "models/w_squeak.mdl" },
+	{ 0xF8C837F6, 0, "sound/vox/hot.wav" },
+	{ 0xB53B94D6, 0, "sound/sentences/t0.wav" },
+	{ 0xE8A0D6EC, 0, "sound/scientist/sci_fear11.wav" },
+	{ 0x8E438B0C, 0, "sound/weapons/xbow_hitbod2.wav" },
+	{ 0x818B64DC, 0, "sound/sentences/c1a3_7.wav" },
+	{ 0x75413879, 0, "models/rshell.mdl" },
+	{ 0x818271D3, 0, "sprites/hudglammo.spr" },
+	{ 0x3DD7AD85, 0, "sound/player/britleft.wav" },
+	{ 0xC329E882, 0, "sound/otis/bridge.wav" },
+	{ 0x5529D5D7, 0, "sound/debris/flesh6.wav" },
+	{ 0xAF2C1317, 0, "sound/fgrunt/of2a5_fg02.wav" },
+	{ 0x2C5F19E6, 0, "models/nuke_timer.mdl" },
+	{ 0x34E31670, 0, "models/civ_paper_scientist01.mdl" },
+	{ 0x660CDFBE, 0, "sound/fgrunt/corporal.wav" },
+	{ 0x2C67F83C, 0, "sound/vox/run.wav" },
+	{ 0x7E041615, 0, "sound/sentences/hev_dmg5.wav" },
+	{ 0x76108D46, 0, "sound/nihilanth/nil_deceive.wav" },
+	{ 0x25A9C942, 0, "sprites/obj_icons/dod_falaise/icon_obj_custom3_axis.spr" },
+	{ 0x3101E515, 0, "overviews/p_se_3.txt" },
+	{ 0xD6C7CA3B, 0, "models/strooper_gibs.mdl" },
+	{ 0x631646F1, 0, "gfx/vgui/640_demomanblue.tga" },
+	{ 0x42CF3EAF, 0, "sound/fgrunt/guard.wav" },
+	{ 0x4AE4AA2C, 0, "sound/x/x_pain1.wav" },
+	{ 0x9374C6F0, 0, "sound/scientist/hopenominal.wav" },
+	{ 0x9C51B5CC, 0, "sound/vox/room.wav" },
+	{ 0x780A1DC8, 0, "sound/fvox/blip.wav" },
+	{ 0xA674BA60, 0, "sound/vox/in.wav" },
+	{ 0x5A468FE6, 0, "gfx/detail/dt_snow1.tga" },
+	{ 0x1D0A9AA1, 0, "sound/vox/hour.wav" },
+	{ 0xA54356AB, 0, "sound/vox/liquid.wav" },
+	{ 0xAE948953, 0, "sound/barney/c2a2_ba_launch.wav" },
+	{ 0xB22AEEEE, 0, "sprites/bmp/1expl05.bmp" },
+	{ 0xA045C155, 0, "gfx/env/nightft.tga" },
+	{ 0xB593FB3F, 0, "sound/houndeye/he_hunt1.wav" },
+	{ 0x7DA3FFB8, 0, "models/w_mp44clip.mdl" },
+	{ 0x1AAE5AFE, 0, "models/mapmodels/charlie_wire.mdl" },
+	{ 0xE18B75BF, 0, "1152_textscheme.txt" },
+	{ 0xAF2B2339, 0, "sound/player/pl_wade2.wav" },
+	{ 0xEB38CDC3, 0, "sound/scientist/stop3.wav" },
+	{ 0xD881E81C, 0, "sound/weapons/m4a1_silencer_off.wav" },
+	{ 0x196E1D0A, 0, "sprites/weapon_gauss.txt" },
+	{ 0x991C472C, 0, "sound/vox/minefield.wav" },
+	{ 0x5B1CCC08, 0, "sound/x/nih_die2.wav" },
+	{ 0x7A62B8A9, 0, "maps/de_survivor.txt" },
+	{ 0xE0CDDB8E, 0, "sprites/crosshairs.spr" },
+	{ 0x684CE1E3, 0, "sound/ambience/copter.wav" },
+	{ 0xE2F280FC, 0, "sound/holo/holostn1.wav" },
+	{ 0x7DCB4C5E, 0, "sound/buttons/lever3.wav" },
+	{ 0x20495B3C, 0, "models/mapmodels/zalec_snowhill.mdl" },
+	{ 0xB1A71CBE, 0, "sound/vox/sixty.wav" },
+	{ 0x948A1397, 0, "sound/scientist/sci_fear3.wav" },
+	{ 0x6F520CB7, 0, "gfx/vgui/elites.tga" },
+	{ 0x44D871A8, 0, "sound/gonarch/gon_sack3.wav" },
+	{ 0x601AC0BB, 0, "gfx/env/jagdrt.tga" },
+	{ 0x650C873E, 0, "sound/ambience/waterfall2.wav" },
+	{ 0x426CB2C7, 0, "resource/gameui_english.txt" },
+	{ 0x61BF479D, 0, "sound/player/pl_pain5.wav" },
+	{ 0xC019FB3F, 0, "sound/fgrunt/of6a1_fg02.wav" },
+	{ 0xCBF34EDE, 0, "sound/hgrunt/your!.wav" },
+	{ 0xC8F1A7BB, 0, "sound/scientist/c1a1_sci_5scan.wav" },
+	{ 0x3BED572E, 0, "sound/vox/slow.wav" },
+	{ 0x51D515D3, 0, "sound/holo/holostn4.wav" },
+	{ 0x2A2F9B8B, 0, "sound/barney/c2a4_ba_steril.wav" },
+	{ 0x441A3F09, 0, "sound/sentences/db3.wav" },
+	{ 0x3B9B2FA3, 0, "gfx/env/neb6rt.bmp" },
+	{ 0x93A2D1DF, 0, "sound/scientist/goodpaper.wav" },
+	{ 0x6BE25CBE, 0, "sound/sentences/c2a2_3.wav" },
+	{ 0x0E5B974D, 0, "sound/scientist/c3a2_sci_5surv.wav" },
+	{ 0xB65FD867, 0, "sound/ambience/alienclicker1.wav" },
+	{ 0x8FBED3A3, 0, "sound/hgrunt/bravo!.wav" },
+	{ 0xB1D6C6D9, 0, "sound/holo/holostn2.wav" },
+	{ 0x6BF7135F, 0, "sound/drill/rope04.wav" },
+	{ 0xA5079672, 0, "models/w_shotbox.mdl" },
+	{ 0xAA32CA73, 0, "sound/sentences/hev_9p.wav" },
+	{ 0xD26C7B3D, 0, "ctf manual/resources/pow_death_ping.wav" },
+	{ 0x9C9A28B9, 0, "sound/sentences/c3a2_7.wav" },
+	{ 0x3902C53B, 0, "sound/vox/arm.wav" },
+	{ 0xE4683E52, 0, "gfx/env/snowlake_rt.tga" },
+	{ 0x0A566B8A, 0, "gfx/env/sky_blu_ft.bmp" },
+	{ 0x8E09741A, 0, "sound/ambience/zipmachine.wav" },
+	{ 0xED6E5411, 0, "sound/hgrunt/continue.wav" },
+	{ 0x0B303FA4, 0, "sound/barney/c1a2_ba_surface.wav" },
+	{ 0xA64315CC, 0, "models/kosobar.mdl" },
+	{ 0xDBA1E416, 0, "sound/ba_holo/tr_holo_greatwork.wav" },
+	{ 0x24DF017B, 0, "models/v_ak47.mdl" },
+	{ 0xE2C2F9B8, 0, "sound/sentences/c1a4_8.wav" },
+	{ 0xBF943F0E, 0, "sound/scientist/c1a0_sci_bigday.wav" },
+	{ 0xE2072DDE, 0, "sound/vox/green.wav" },
+	{ 0xDE17AD81, 0, "sound/vox/lowest.wav" },
+	{ 0x6845CF34, 0, "sound/common/weapon_denyselect.wav" },
+	{ 0x8B92A8CC, 0, "sound/scientist/startle9.wav" },
+	{ 0xAC504A39, 0, "sound/fgrunt/gr_pain3.wav" },
+	{ 0x6EE6DD06, 0, "models/w_enfield.mdl" },
+	{ 0xF6D66E67, 0, "sound/hgrunt/twentymeters.wav" },
+	{ 0xDBD74431, 0, "sound/sentences/hev_det4.wav" },
+	{ 0x073A5026, 0, "sound/scientist/stop4.wav" },
+	{ 0x293BEC16, 0, "sound/hgrunt/yessir!.wav" },
+	{ 0x84C8F330, 0, "models/hgrunt_opfor02.mdl" },
+	{ 0xAFCFF015, 0, "sound/vox/shut.wav" },
+	{ 0x4CFC7560, 0, "sound/debris/bustflesh1.wav" },
+	{ 0x4E06954E, 0, "gfx/vgui/icntlk_squelch.tga" },
+	{ 0x03EB4A26, 0, "sound/buttons/blip2.wav" },
+	{ 0x78C015FB, 0, "sound/fvox/alert.wav" },
+	{ 0x9434BD4A, 0, "sound/items/medcharge4.wav" },
+	{ 0x528088FE, 0, "sound/drill/oc102.wav" },
+	{ 0xC536D369, 0, "maps/cs_militia.txt" },
+	{ 0x01991887, 0, "models/mapmodels/parachute_flattened2.mdl" },
+	{ 0x70C64EF4, 0, "sound/misc/spark3.wav" },
+	{ 0x0C746BBC, 0, "gfx/env/snowcliffdn.tga" },
+	{ 0xCF87CAB2, 0, "gfx/env/avantirt.tga" },
+	{ 0x58702C0A, 0, "sound/ambience/wolfhowl02.wav" },
+	{ 0x2E60FC6D, 0, "models/w_medkit.mdl" },
+	{ 0xF7A93286, 0, "models/w_mp40.mdl" },
+	{ 0xD2C5D944, 0, "models/player/ctf_scientist/scientist.bmp" },
+	{ 0x8AAC8D4C, 0, "sprites/richo2.spr" },
+	{ 0x59DCDF76, 0, "sound/pitworm/pit_worm_death.wav" },
+	{ 0x7FF543AB, 0, "op4ctf.wad" },
+	{ 0xDFCC473B, 0, "maps/op4ctf_power.txt" },
+	{ 0x1AB8F1DD, 0, "sound/hassault/hw_gun4.wav" },
+	{ 0xAC637B70, 0, "gfx/env/killertomatodn.tga" },
+	{ 0xD1B136B5, 0, "sound/scientist/doyousmell.wav" },
+	{ 0xA7A617B2, 0, "sound/vox/motorpool.wav" },
+	{ 0x61D282D9, 0, "sound/apache/ap_rotor1.wav" },
+	{ 0xDEA66BC0, 0, "models/w_accelerator.mdl" },
+	{ 0xA6304EE8, 0, "sound/items/inv3.wav" },
+	{ 0x20862513, 0, "models/w_m3.mdl" },
+	{ 0x1A385755, 0, "sound/scientist/sci_die1.wav" },
+	{ 0x51A2A4FF, 0, "sound/scientist/c1a0_sci_dis15a.wav" },
+	{ 0x43BD0044, 0, "sound/weapons/shock_discharge.wav" },
+	{ 0x6EFE9CE7, 0, "sound/fvox/nine.wav" },
+	{ 0x55C3D350, 0, "sound/aslave/slv_die2.wav" },
+	{ 0xB8AEF2A1, 0, "sound/weapons/whizz15.wav" },
+	{ 0x89F94CC8, 0, "models/breather.mdl" },
+	{ 0x1254523F, 0, "maps/de_train.txt" },
+	{ 0xAB0F2836, 0, "sound/vox/number.wav" },
+	{ 0x4B493BE3, 0, "overviews/dod_glider.txt" },
+	{ 0xE2447DE1, 0, "models/w_antidotet.mdl" },
+	{ 0x12AC6775, 0, "sound/scientist/sc_canals2.wav" },
+	{ 0xA9D4379F, 0, "sound/fgrunt/sirnosir.wav" },
+	{ 0xD53E403D, 0, "sprites/comp_c01.spr" },
+	{ 0xCE02FD0D, 0, "sound/ambience/techamb1.wav" },
+	{ 0x32AF39CA, 0, "de_storm.wad" },
+	{ 0x1814C924, 0, "sound/holo/holostn9.wav" },
+	{ 0x14F39864, 0, "gfx/vgui/1024_arrowright.tga" },
+	{ 0x3D1FA329, 0, "gfx/vgui/fonts/1152_briefing text.tga" },
+	{ 0xA44D6A7D, 0, "gfx/vgui/famas.tga" },
+	{ 0x57B8ACAB, 0, "gfx/env/kraftstofflf.tga" },
+	{ 0x9B2D7512, 0, "sound/fvox/minor_lacerations.wav" },
+	{ 0x5072F946, 0, "models/invis.mdl" },
+	{ 0xE56F41F3, 0, "sprites/hudbmps/tfchud06.bmp" },
+	{ 0x6ED40A53, 0, "sound/agrunt/ag_attack1.wav" },
+	{ 0x2C8D37C7, 0, "models/crystal.mdl" },
+	{ 0x906365B5, 0, "sound/scientist/c3a2_sci_linger.wav" },
+	{ 0x39BDEEFD, 0, "sound/plats/ttrain7.wav" },
+	{ 0x8A32FD34, 0, "resource/background/800_3_c_loading.tga" },
+	{ 0x0DC1FFDA, 0, "sprites/weapon_doubleshotgun.txt" },
+	{ 0x0C068057, 0, "sound/shocktrooper/shock_trooper_pain3.wav" },
+	{ 0xD7BB362B, 0, "sound/hgrunt/west.wav" },
+	{ 0x51A1C507, 0, "gfx/env/nightbk.bmp" },
+	{ 0x0234704E, 0, "sound/voltigore/voltigore_alert3.wav" },
+	{ 0xB3E33759, 0, "sprites/plasma.spr" },
+	{ 0xC0383FD7, 0, "models/hostage01.mdl" },
+	{ 0x661ED9AC, 0, "sprites/flare5.spr" },
+	{ 0xB191A3BB, 0, "gfx/env/snowbk.tga" },
+	{ 0xFC8FFF1D, 0, "gfx/env/discbk.tga" },
+	{ 0x9F5E23FD, 0, "gfx/env/bluert.tga" },
+	{ 0x03F935E8, 0, "sound/weapons/xbow_fly1.wav" },
+	{ 0x4C16D394, 0, "gfx/decals/hwshot2.bmp" },
+	{ 0x3D87D148, 0, "sound/radio/ct_coverme.wav" },
+	{ 0xA262CF25, 0, "sound/vox/head.wav" },
+	{ 0x34EAF3EC, 0, "models/w_mills2.mdl" },
+	{ 0x5720FF87, 0, "sound/vox/sub.wav" },
+	{ 0x28C030FD, 0, "sound/rosenberg/ro_tele_xen08.wav" },
+	{ 0x82A0B49C, 0, "gfx/env/nightbk.tga" },
+	{ 0xC35CE8FC, 0, "sound/fvox/percent.wav" },
+	{ 0x3709D07F, 0, "sound/rosenberg/ro_scared0.wav" },
+	{ 0x9798C449, 0, "sound/x/x_laugh1.wav" },
+	{ 0x8685F396, 0, "sound/fvox/flatline.wav" },
+	{ 0xF4AE5663, 0, "gfx/env/2desertup.tga" },
+	{ 0x03F5C11A, 0, "sound/doors/doormove8.wav" },
+	{ 0xAA641B05, 0, "sound/weapons/pwrench_hit1.wav" },
+	{ 0x965C3E27, 0, "sound/scientist/of3a4_sc01.wav" },
+	{ 0x2DF0D9CA, 0, "sound/sentences/c1a3_1.wav" },
+	{ 0xC5D42536, 0, "sound/drill/rope07.wav" },
+	{ 0x2025D1A9, 0, "sprites/zbeam3.spr" },
+	{ 0xD8856156, 0, "ravelin.wad" },
+	{ 0xC7CCB923, 0, "sound/weapons/explodewater.wav" },
+	{ 0xB7054C0A, 0, "models/hgrunt_opfor04.mdl" },
+	{ 0xC0FD4969, 0, "sound/zombie/zo_idle1.wav" },
+	{ 0x5C28AF17, 0, "sound/vox/romeo.wav" },
+	{ 0xB8680615, 0, "sound/vox/portal.wav" },
+	{ 0x49EDA0BF, 0, "sound/vox/push.wav" },
+	{ 0xB54697C9, 0, "preloads.txt" },
+	{ 0x004CE548, 0, "models/stukabat.mdl" },
+	{ 0xB506AD3B, 0, "sound/ambience/deadsignal1.wav" },
+	{ 0xE874859D, 0, "sound/vox/personnel.wav" },
+	{ 0xBDCEF72E, 0, "sound/drill/add04.wav" },
+	{ 0xA400C69B, 0, "sound/ambience/nebwerfdist.wav" },
+	{ 0xC32D5D13, 0, "sound/player/pl_pain7.wav" },
+	{ 0x9891CE46, 0, "sound/weapons/ric9.wav" },
+	{ 0x4BE545A4, 0, "sound/ambience/dronemachine1.wav" },
+	{ 0x39BB3DC4, 0, "spectcammenu.txt" },
+	{ 0xDC32D813, 0, "sound/player/pl_snow4.wav" },
+	{ 0x96708315, 0, "sound/ambience/alien_twow.wav" },
+	{ 0x1179D74B, 0, "gfx/env/blackrt.bmp" },
+	{ 0x9CD39ADA, 0, "sound/misc/main_elevator.wav" },
+	{ 0x79F0866E, 0, "sound/vox/red.wav" },
+	{ 0xA6997782, 0, "sprites/exp_c.spr" },
+	{ 0x538A9246, 0, "sound/drill/squad03.wav" },
+	{ 0x381A429D, 0, "gfx/vgui/640_civilianblue.tga" },
+	{ 0xD8628FA9, 0, "sound/fgrunt/intro_fg16.wav" },
+	{ 0x3E11C131, 0, "sound/doors/doorstop4.wav" },
+	{ 0xEC131843, 0, "sound/vox/capture.wav" },
+	{ 0x190ED709, 0, "models/p_glauncher2.mdl" },
+	{ 0x2F03EB43, 0, "gfx/vgui/1600_arrowleft.tga" },
+	{ 0xA2B15A0F, 0, "sound/fvox/immediately.wav" },
+	{ 0x624476B2, 0, "sound/ambience/boomer.wav" },
+	{ 0x072BBBED, 0, "sound/fans/fan1on.wav" },
+	{ 0x748C6B96, 0, "sprites/hud_idents.spr" },
+	{ 0x7BC3F5D1, 0, "models/mapmodels/hk_neucar_shot.mdl" },
+	{ 0x9002DDCF, 0, "sound/hgrunt/a.wav" },
+	{ 0xFE821B58, 0, "sound/hgrunt/fire.wav" },
+	{ 0x3BA6D78B, 0, "sound/weapons/bazookareloadshovehome.wav" },
+	{ 0xB6C11223, 0, "sound/fgrunt/area.wav" },
+	{ 0xF3BDF10D, 0, "sound/barney/ba_close.wav" },
+	{ 0x2147F04D, 0, "maps/de_cbble_detail.txt" },
+	{ 0x4B7F5BA4, 0, "sprites/bmp/tffire07.bmp" },
+	{ 0x97189E28, 0, "sound/vox/legal.wav" },
+	{ 0xC90283C3, 0, "sprites/bmp/2fire06.bmp" },
+	{ 0x62653BEB, 0, "sound/ambience/forestambience.wav" },
+	{ 0x50FA559D, 0, "sound/scientist/c1a0_sci_dis17a.wav" },
+	{ 0x3738DAD3, 0, "gfx/env/desertdn.bmp" },
+	{ 0x6CA7CF7D, 0, "models/fungus(small).mdl" },
+	{ 0x75C9CACA, 0, "sound/vox/ceiling.wav" },
+	{ 0xD60E506A, 0, "sprites/bmp/fthrow16.bmp" },
+	{ 0x5C3BE7F0, 0, "models/v_mp5.mdl" },
+	{ 0x63FE422A, 0, "gfx/env/cliffrt.bmp" },
+	{ 0x19161816, 0, "sound/sentences/hev_heal2.wav" },
+	{ 0x80F6877A, 0, "gfx/env/citylf.tga" },
+	{ 0x10C8FB9E, 0, "sound/ambience/usareasecure.wav" },
+	{ 0xD93C2160, 0, "models/w_elite.mdl" },
+	{ 0xCCBC79E1, 0, "sound/fgrunt/roger.wav" },
+	{ 0x8C55FDC1, 0, "sound/vox/health.wav" },
+	{ 0xFE854818, 0, "classes/short_gordon.txt" },
+	{ 0xCA51C4EC, 0, "sprites/weapon_g3sg1.txt" },
+	{ 0x3744CDDF, 0, "models/mapmodels/fern2.mdl" },
+	{ 0x34794E4F, 0, "sound/hgrunt/yessir.wav" },
+	{ 0x55FCBA96, 0, "sound/player/britmedic.wav" },
+	{ 0xF1EAF68D, 0, "sound/weapons/reload1.wav" },
+	{ 0xE16B6920, 0, "sound/gman/of7a0_gm01.wav" },
+	{ 0x7C0986F0, 0, "models/player/otis/otis.bmp" },
+	{ 0xC5A220CC, 0, "sound/fgrunt/moving.wav" },
+	{ 0x837C1407, 0, "sound/vox/attention.wav" },
+	{ 0x0BA9690B, 0, "sound/sentences/hg_taunt5.wav" },
+	{ 0x23B042AA, 0, "sound/sentences/hg_check2.wav" },
+	{ 0xD71A037F, 0, "sound/fans/fan4.wav" },
+	{ 0xD8148B47, 0, "sound/agrunt/ag_pain1.wav" },
+	{ 0xA3A4EB18, 0, "gfx/env/alien1ft.bmp" },
+	{ 0x30D0B03C, 0, "gfx/env/hackrt.tga" },
+	{ 0x822B6033, 0, "sound/fgrunt/intro_fg07.wav" },
+	{ 0xB6D2AF21, 0, "gfx/env/avantiup.tga" },
+	{ 0xFD3F94E6, 0, "sound/player/usdisplace.wav" },
+	{ 0x7B004A2B, 0, "sound/weapons/rocket2.wav" },
+	{ 0xE7734D18, 0, "sound/fvox/west.wav" },
+	{ 0x0A3D00C7, 0, "sound/drill/barracks01.wav" },
+	{ 0x3B673BEA, 0, "models/cindergibs_yellow.mdl" },
+	{ 0x4F0111E8, 0, "sprites/weapon_elite.txt" },
+	{ 0x8CB78AD5, 0, "sound/weapons/bgrapple_impact.wav" },
+	{ 0x7384D249, 0, "gfx/vgui/640_checked.tga" },
+	{ 0x9BA906A4, 0, "maps/ravelin.txt" },
+	{ 0x3AF5A065, 0, "sprites/spotlight02.spr" },
+	{ 0xEC76A2AA, 0, "sound/rosenberg/ro_tele_final04.wav" },
+	{ 0x48B6FC94, 0, "overviews/cs_assault.txt" },
+	{ 0xD16C9FB9, 0, "sound/vox/away.wav" },
+	{ 0xF902CC8D, 0, "sound/fvox/sixteen.wav" },
+	{ 0xC94717AE, 0, "ricochet.wad" },
+	{ 0x02FC4BD5, 0, "sprites/bmp/tffire08.bmp" },
+	{ 0x774672B4, 0, "sound/player/pl_slosh1.wav" },
+	{ 0x4336CA2E, 0, "resource/background/800_3_a_loading.tga" },
+	{ 0x940529A5, 0, "sound/fgrunt/sore.wav" },
+	{ 0x3D76F7BE, 0, "sound/sentences/hev_xbow.wav" },
+	{ 0xD5E734A0, 0, "sound/holo/holostn5.wav" },
+	{ 0x28096363, 0, "sound/weapons/sshell3.wav" },
+	{ 0xEFB053BB, 0, "sprites/effects/debris_grass1.spr" },
+	{ 0x98E6491E, 0, "sound/rosenberg/ro_ok1.wav" },
+	{ 0x542961D4, 0, "resource/steam_menu_mouseover.tga" },
+	{ 0xA6E45369, 0, "sound/weapons/knife_deploy1.wav" },
+	{ 0x80880957, 0, "sound/debris/beamstart1.wav" },
+	{ 0x4A9F224B, 0, "sound/plats/bigstop1.wav" },
+	{ 0x214E383B, 0, "sound/items/9mmclip2.wav" },
+	{ 0x083E5672, 0, "sprites/vp_parallel_oriented.spr" },
+	{ 0x5725E846, 0, "sound/holo/tr_holo_jump.wav" },
+	{ 0x37BD3313, 0, "models/p_gauss.mdl" },
+	{ 0x053CCCAB, 0, "sound/boid/boid_alert2.wav" },
+	{ 0x867B4D43, 0, "sound/scientist/whoareyou.wav" },
+	{ 0xE17BD7AD, 0, "sound/weapons/sshell1.wav" },
+	{ 0xB54132C6, 0, "sound/sentences/c1a0_2.wav" },
+	{ 0xCF7A727E, 0, "sound/sentences/hev_a7.wav" },
+	{ 0x35D9BE8D, 0, "models/v_tfc_knife.mdl" },
+	{ 0xA0369A2F, 0, "sound/hgrunt/force.wav" },
+	{ 0x85428B21, 0, "sound/vox/captured.wav" },
+	{ 0xF3A1B65A, 0, "models/hgibs.mdl" },
+	{ 0xA319B9CF, 0, "sound/vox/feet.wav" },
+	{ 0x06DB84EC, 0, "models/plant_01.mdl" },
+	{ 0x48D9113C, 0, "sound/vox/ass.wav" },
+	{ 0x6044F6E0, 0, "sound/player/pl_snow5.wav" },
+	{ 0xF3EB2B80, 0, "sound/sentences/ctr18.wav" },
+	{ 0x58A25F21, 0, "sound/sentences/c2a1_5.wav" },
+	{ 0x77515FFC, 0, "sound/vox/distance.wav" },
+	{ 0x6019EE42, 0, "sound/barney/standguard.wav" },
+	{ 0xAD07A1BA, 0, "sound/scientist/hearsomething.wav" },
+	{ 0xAD19E36E, 0, "models/metalplategibs_dark.mdl" },
+	{ 0x520D24F8, 0, "sound/scientist/hello2.wav" },
+	{ 0x2E6AEC7F, 0, "sound/holo/tr_sci_unuse.wav" },
+	{ 0xF67E37A0, 0, "sound/scientist/c1a1_sci_scanrpt.wav" },
+	{ 0xB45A9598, 0, "sound/scientist/c1a0_sci_lock2a.wav" },
+	{ 0x237371F5, 0, "sound/weapons/reloadgarand.wav" },
+	{ 0x7CBB6395, 0, "sprites/fog2.spr" },
+	{ 0x2CA6C42D, 0, "sound/scientist/c2a4_sci_2tau.wav" },
+	{ 0x334CFF90, 0, "gfx/vgui/640_hud_health.tga" },
+	{ 0xAE45B174, 0, "sound/sentences/ng1.wav" },
+	{ 0x68A2E54B, 0, "gfx/env/tsccity_lf.tga" },
+	{ 0xDC9CBE0C, 0, "sound/player/damage4.wav" },
+	{ 0xBB192A40, 0, "sound/player/axhit1.wav" },
+	{ 0xA58CFD26, 0, "sound/vox/expect.wav" },
+	{ 0x080088E2, 0, "cs_dust.wad" },
+	{ 0x7E0975E7, 0, "sound/barney/c1a4_ba_octo1.wav" },
+	{ 0x363AF5D4, 0, "sprites/sprite_c_1.spr" },
+	{ 0x1FF2EDB3, 0, "sound/vox/point.wav" },
+	{ 0xF92DA9CA, 0, "sound/vox/outside.wav" },
+	{ 0xD2407EEF, 0, "sound/scientist/administrator.wav" },
+	{ 0x144801EB, 0, "models/p_brenbr.mdl" },
+	{ 0x4CE2D50D, 0, "sound/ba_holo/tr_holo_injury.wav" },
+	{ 0xCAA5971B, 0, "sound/intro/g7_view_lz.wav" },
+	{ 0x0C6A8CB0, 0, "models/bullsquid.mdl" },
+	{ 0xC306F3D2, 0, "gfx/env/cxft.tga" },
+	{ 0xFA8CEE17, 0, "models/w_sg550.mdl" },
+	{ 0xEA40A9BE, 0, "sound/holo/tr_holo_nicejob.wav" },
+	{ 0xC9BA76AC, 0, "sound/vox/pal.wav" },
+	{ 0x30BA7A87, 0, "overviews/dod_jagd.bmp" },
+	{ 0xF4AA59F8, 0, "sprites/tele1.spr" },
+	{ 0x711A46A2, 0, "servers/serverbrowser_german.txt" },
+	{ 0x1D1FEC25, 0, "sound/items/smallmedkit2.wav" },
+	{ 0xA5D2AD0A, 0, "sound/plats/ttrain6.wav" },
+	{ 0x556AF236, 0, "gfx/env/2desertbk.bmp" },
+	{ 0x4881A998, 0, "sound/sentences/hev_grenade.wav" },
+	{ 0xA2AB2A94, 0, "sprites/bmp/1expl14.bmp" },
+	{ 0x2638EE82, 0, "sound/sentences/hev_4p.wav" },
+	{ 0x360D9EE1, 0, "gfx/vgui/640_soldierred.tga" },
+	{ 0x15F6ADCD, 0, "sound/sentences/ed4.wav" },
+	{ 0x9BB484A0, 0, "sound/vox/levels.wav" },
+	{ 0xE8CCA2BA, 0, "sound/vox/year.wav" },
+	{ 0x1AA6C902, 0, "resource/ricochet_spanish.txt" },
+	{ 0x7E3A23B3, 0, "models/v_smokegrenade.mdl" },
+	{ 0x126D36A8, 0, "sound/sentences/hev_aax.wav" },
+	{ 0xD5508048, 0, "gfx/env/neb7ft.bmp" },
+	{ 0xC1C11528, 0, "sprites/weapon_pipewrench.txt" },
+	{ 0xB67173E2, 0, "sound/scientist/noguess.wav" },
+	{ 0x9DB2725E, 0, "gfx/env/desertbk.bmp" },
+	{ 0x20143B7C, 0, "logos/chuckskull.bmp" },
+	{ 0x3A3F7514, 0, "sprites/obj_icons/dod_saints/icon_obj_custom2_neutral.spr" },
+	{ 0x64AC490B, 0, "sound/fgrunt/intro_fg18.wav" },
+	{ 0xF674A7B9, 0, "sound/vox/field.wav" },
+	{ 0x4D2C2BC6, 0, "sound/sentences/deeoo.wav" },
+	{ 0x90C54231, 0, "sound/hgrunt/there!.wav" },
+	{ 0xEF86F8E0, 0, "sound/weapons/r_exp3.wav" },
+	{ 0xADC67A9B, 0, "sound/otis/of1a1_ot04.wav" },
+	{ 0xB40CBC37, 0, "sound/gonome/gonome_death4.wav" },
+	{ 0x6FBF0F00, 0, "sound/fvox/get_medkit.wav" },
+	{ 0xFE507D6C, 0, "sprites/boss_glow.spr" },
+	{ 0xBBB7EAC9, 0, "sound/common/wpn_select.wav" },
+	{ 0x58FE9489, 0, "sound/voltigore/voltigore_die2.wav" },
+	{ 0xE8C28849, 0, "sound/weapons/concgren_blast2.wav" },
+	{ 0x72566B19, 0, "sprites/bmp/2fire08.bmp" },
+	{ 0x0DF4A117, 0, "sound/vox/coolant.wav" },
+	{ 0x0B6A627B, 0, "gfx/env/backalleyrt.tga" },
+	{ 0x638F9A6F, 0, "sound/scientist/c1a2_sci_5zomb.wav" },
+	{ 0x6E88A754, 0, "sprites/640_2bounce.spr" },
+	{ 0x539400A8, 0, "sound/barney/gladtolendhand.wav" },
+	{ 0x2A730907, 0, "sound/barney/hitbad.wav" },
+	{ 0x0BB400A2, 0, "models/p_awp.mdl" },
+	{ 0x47A6F49F, 0, "sound/weapons/c4_beep4.wav" },
+	{ 0x0D1BB56C, 0, "sound/radio/vip.wav" },
+	{ 0xFB520916, 0, "gfx/env/blackbk.bmp" },
+	{ 0xDFC2251C, 0, "sprites/mapsprites/fog6.spr" },
+	{ 0xA713E80D, 0, "sound/ambience/burning16a.wav" },
+	{ 0x175180E5, 0, "models/w_98k.mdl" },
+	{ 0x26957312, 0, "models/v_tommy.mdl" },
+	{ 0xEA1D3BEF, 0, "sound/vox/yellow.wav" },
+	{ 0x7848A3FA, 0, "models/w_spring.mdl" },
+	{ 0x5DB0D90A, 0, "models/loader.mdl" },
+	{ 0x04E0921D, 0, "sound/holo/tr_holo_tryagain.wav" },
+	{ 0x96D2060B, 0, "sound/misc/spark6.wav" },
+	{ 0xA43D3071, 0, "sound/fvox/am.wav" },
+	{ 0xF6D88EED, 0, "sound/drill/add09.wav" },
+	{ 0xBA2D768F, 0, "gfx/env/rubblelf.tga" },
+	{ 0x86291EE8, 0, "sound/sentences/hg_gren2.wav" },
+	{ 0x33FFFB9E, 0, "gfx/env/morningdewdn.bmp" },
+	{ 0xFFE7377B, 0, "gfx/env/doom1rt.tga" },
+	{ 0xA3A28716, 0, "resource/icon_minimize.tga" },
+	{ 0x2AD15083, 0, "models/spike.mdl" },
+	{ 0xE9E22E7E, 0, "sound/weapons/scout_fire-1.wav" },
+	{ 0x8F5D5F21, 0, "sound/agrunt/ag_pain3.wav" },
+	{ 0x59C0B36F, 0, "sound/tride/c0a0_tr_haz.wav" },
+	{ 0xD2717DEF, 0, "sound/scientist/startle8.wav" },
+	{ 0x43C1751B, 0, "gfx/detail/dt_snow.tga" },
+	{ 0xAA066CE1, 0, "sound/weapons/m249-1.wav" },
+	{ 0x4DE1BDCC, 0, "maps/op4ctf_gunyard.txt" },
+	{ 0xD141E1AA, 0, "overviews/ravelin.bmp" },
+	{ 0xFC9E43B2, 0, "sound/drill/oc106.wav" },
+	{ 0x2657C49E, 0, "sound/weapons/glauncher2.wav" },
+	{ 0xE383EDB5, 0, "maps/dod_flash.txt" },
+	{ 0x4AA95D45, 0, "models/headcrab.mdl" },
+	{ 0x39A2C4E9, 0, "models/barney05.mdl" },
+	{ 0x242E54BC, 0, "sound/vox/g.wav" },
+	{ 0x9404CC05, 0, "sound/hgrunt/east.wav" },
+	{ 0xD8B51B92, 0, "models/p_bazooka_l.mdl" },
+	{ 0x7AEF88BC, 0, "sprites/markernull.spr" },
+	{ 0xF21B44CC, 0, "sound/zombie/zo_idle2.wav" },
+	{ 0x732AAC10, 0, "overviews/de_storm.bmp" },
+	{ 0xF975AC81, 0, "sound/hgrunt/charlie!.wav" },
+	{ 0xBFC7A837, 0, "sprites/shot_smoke2.spr" },
+	{ 0x4CB33A83, 0, "models/v_disc.mdl" },
+	{ 0x4E44392A, 0, "gfx/env/de_stormbk.bmp" },
+	{ 0x8EED0DF9, 0, "sound/hassault/hw_shoot1.wav" },
+	{ 0x5BE7ABD1, 0, "overviews/dmc_e1m2.bmp" },
+	{ 0x9709E3CE, 0, "sound/vox/decompression.wav" },
+	{ 0xAB757CF8, 0, "resource/platform_english.txt" },
+	{ 0xF175901E, 0, "sound/fgrunt/death2.wav" },
+	{ 0x296FE312, 0, "sprites/muzzleflash2.spr" },
+	{ 0x810EA9EA, 0, "sound/hgrunt/recon!.wav" },
+	{ 0x09986142, 0, "resource/backgroundloadinglayout.txt" },
+	{ 0x86C06162, 0, "de_piranesi.wad" },
+	{ 0x8F024106, 0, "sprites/zbeam6.spr" },
+	{ 0x9FF2D77D, 0, "sound/vox/mercy.wav" },
+	{ 0x55C84C2B, 0, "gfx/env/rubblert.tga" },
+	{ 0x4F2DF4B3, 0, "sound/player/pl_wade4.wav" },
+	{ 0xEB0A722D, 0, "sound/sentences/hev_10p.wav" },
+	{ 0xAB2CF1AB, 0, "gfx/env/discrt.bmp" },
+	{ 0x469E1D75, 0, "sound/vox/gulf.wav" },
+	{ 0xD3E2B82B, 0, "sprites/xfire.spr" },
+	{ 0x3C329E41, 0, "sound/player/brithold.wav" },
+	{ 0xC3686AAE, 0, "sound/ctf/pow_armor_charge.wav" },
+	{ 0x1AEF3234, 0, "sound/drill/add06.wav" },
+	{ 0x7FCAF94E, 0, "sound/doors/doormove.wav" },
+	{ 0x5356407A, 0, "sound/drill/add17.wav" },
+	{ 0x4D534056, 0, "sound/vox/india.wav" },
+	{ 0xE3BF2A7D, 0, "sound/scientist/of1a5_sc02.wav" },
+	{ 0xEA526F25, 0, "sound/vox/million.wav" },
+	{ 0xA4DD3A8C, 0, "sound/otis/rightdirection.wav" },
+	{ 0x4FF434B7, 0, "gfx/vgui/map_3flag.tga" },
+	{ 0x11CF53E7, 0, "sound/fgrunt/of1a6_fg02.wav" },
+	{ 0x505A40DC, 0, "models/civ_stand.mdl" },
+	{ 0x7C276267, 0, "resource/platform_koreana.txt" },
+	{ 0xF457DDAF, 0, "sound/vox/extinguish.wav" },
+	{ 0xB61B4235, 0, "models/chick.mdl" },
+	{ 0x93B2B9E3, 0, "sprites/mapmarkers/number_three.spr" },
+	{ 0x4504BECA, 0, "models/w_medkitst.mdl" },
+	{ 0x4A72B98E, 0, "models/w_30cal.mdl" },
+	{ 0xD6AFA3B6, 0, "sound/agrunt/ag_die4.wav" },
+	{ 0x90BC1F87, 0, "models/armour_gt.mdl" },
+	{ 0x066604AC, 0, "sound/sentences/c1a4_4.wav" },
+	{ 0x4FAC169A, 0, "gfx/vgui/fonts/800_title font.tga" },
+	{ 0x75AD4DCA, 0, "sound/scientist/sc_pok3.wav" },
+	{ 0x64F40E5A, 0, "gfx/env/morningdewrt.bmp" },
+	{ 0xFAAD8225, 0, "sound/scientist/whatnext.wav" },
+	{ 0x58A2AA44, 0, "sprites/fog5.spr" },
+	{ 0x72644B82, 0, "sound/fvox/hours.wav" },
+	{ 0x2E52F598, 0, "sound/hgrunt/one.wav" },
+	{ 0x972AB303, 0, "sound/barney/helpothers.wav" },
+	{ 0x2951AFF7, 0, "sound/voltigore/voltigore_run_grunt2.wav" },
+	{ 0x7962D541, 0, "sound/vox/status.wav" },
+	{ 0x7B9E174E, 0, "sprites/weapon_m4a1.txt" },
+	{ 0x18BE7B06, 0, "sound/weapons/sniper_zoom.wav" },
+	{ 0x028C3D2E, 0, "gfx/vgui/fonts/1600_team info text.tga" },
+	{ 0xB2D4CCD4, 0, "sound/scientist/sci_fear2.wav" },
+	{ 0x7C0B65A3, 0, "sprites/bmp/fthrow15.bmp" },
+	{ 0xE869627E, 0, "sound/fgrunt/intro_fg08.wav" },
+	{ 0xF21B12AC, 0, "sound/scientist/of1a1_sc01.wav" },
+	{ 0x75A857D5, 0, "sound/player/brittakingfireleft.wav" },
+	{ 0x123CECD7, 0, "sound/scientist/scream2.wav" },
+	{ 0x82BC2C5E, 0, "models/w_357ammot.mdl" },
+	{ 0x9F42A096, 0, "sound/vox/north.wav" },
+	{ 0x36D37ADA, 0, "sound/buttons/spark2.wav" },
+	{ 0x01C4C683, 0, "models/hostage05.mdl" },
+	{ 0x1351D8D9, 0, "sound/ambience/rd_waves.wav" },
+	{ 0xA3F757BC, 0, "sound/plats/bigmove1.wav" },
+	{ 0x8EF6E0B8, 0, "models/player/scout/scout.mdl" },
+	{ 0xDE40DB33, 0, "credits.txt" },
+	{ 0x4B317C25, 0, "sprites/bluejet1.spr" },
+	{ 0x4A53E5E1, 0, "sound/ambience/thunder3.wav" },
+	{ 0x2D3166DE, 0, "sound/rosenberg/ro_tele_final08.wav" },
+	{ 0xD71D2C12, 0, "sprites/icon_88_allies.spr" },
+	{ 0x024C1351, 0, "sound/hgrunt/south.wav" },
+	{ 0xECB79B12, 0, "gfx/env/alien2rt.tga" },
+	{ 0x5E01A865, 0, "gfx/vgui/640_spyred.tga" },
+	{ 0xACBFA2BD, 0, "sound/sentences/c1a3_0.wav" },
+	{ 0x46C43424, 0, "sound/sentences/hg_answer6.wav" },
+	{ 0x64A9083A, 0, "itsitaly.wad" },
+	{ 0x5CC7A1C6, 0, "sound/scientist/positively.wav" },
+	{ 0x28E31F8E, 0, "sound/scientist/dinner.wav" },
+	{ 0xD99576E8, 0, "sound/sentences/hev_a1.wav" },
+	{ 0xDC81A47D, 0, "sound/barney/hearsomething.wav" },
+	{ 0x3F28CEFE, 0, "sprites/effects/adrian/explosion_flash.spr" },
+	{ 0xB1F3FE48, 0, "sound/scientist/smellburn.wav" },
+	{ 0x72E671CC, 0, "sound/vox/back.wav" },
+	{ 0x0AF24994, 0, "sound/fvox/minutes.wav" },
+	{ 0xAFB1827F, 0, "sound/sentences/c1a3_6.wav" },
+	{ 0xCD92796B, 0, "sound/vox/termination.wav" },
+	{ 0xE8C40BF8, 0, "models/blkop_ospreyt.mdl" },
+	{ 0x747E6580, 0, "sound/sentences/c1a3_3.wav" },
+	{ 0x4AD2D140, 0, "models/p_scout.mdl" },
+	{ 0x7E70CA69, 0, "gfx/env/stup.tga" },
+	{ 0x24A69118, 0, "sound/vox/backman.wav" },
+	{ 0xBCF42B18, 0, "dod_escape.wad" },
+	{ 0xCA7C98C4, 0, "models/p_9mmar.mdl" },
+	{ 0xDB7707B7, 0, "sound/fvox/two.wav" },
+	{ 0x5F7520FA, 0, "sound/ambience/foretbirds6.wav" },
+	{ 0xFD1A033A, 0, "models/p_k98.mdl" },
+	{ 0xC7EEDE88, 0, "models/v_awp.mdl" },
+	{ 0x2873FDEF, 0, "sound/scientist/rescueus.wav" },
+	{ 0xCECF5F1A, 0, "gfx/vgui/fonts/800_hintmessage text.tga" },
+	{ 0xFECCAADD, 0, "sound/gman/of7a0_gm02.wav" },
+	{ 0xC9ECEB64, 0, "models/player/scientist/scientist.bmp" },
+	{ 0xBE210F94, 0, "resource/icon_emptybox.tga" },
+	{ 0x749DE38F, 0, "servers/serverbrowser_tchinese.txt" },
+	{ 0xFB4C983B, 0, "sound/ambience/drboomsplash01.wav" },
+	{ 0xBED6DB14, 0, "sound/doors/doormove6.wav" },
+	{ 0xA98A11C1, 0, "models/mapmodels/tiger.mdl" },
+	{ 0x06700120, 0, "sound/barney/crewdied.wav" },
+	{ 0x9BCA9651, 0, "models/mapmodels/flo_toilet.mdl" },
+	{ 0x8363F123, 0, "gfx/vgui/round_corner_small_nw.tga" },
+	{ 0xECCE691C, 0, "gfx/env/forestlf.tga" },
+	{ 0xFBA5154B, 0, "sound/scientist/protectme.wav" },
+	{ 0xB9DDE8EA, 0, "sound/sentences/nd6.wav" },
+	{ 0x2185041B, 0, "sound/ambience/alien_frantic.wav" },
+	{ 0xF2ED4AAF, 0, "sound/fvox/armor_compromised.wav" },
+	{ 0xE73DC310, 0, "sound/vox/dadeda.wav" },
+	{ 0xFFBDA125, 0, "sound/headcrab/hc_die1.wav" },
+	{ 0x3DA44B72, 0, "sound/barney/nosir.wav" },
+	{ 0xA9D0B3B2, 0, "sound/barney/easily.wav" },
+	{ 0xC139AC0E, 0, "gfx/env/nightlf.bmp" },
+	{ 0xFF3CF564, 0, "sprites/tf_weapon_axe.txt" },
+	{ 0x190BD61A, 0, "models/v_m249.mdl" },
+	{ 0xFBDADFCB, 0, "sound/scientist/startle4.wav" },
+	{ 0x9A31E478, 0, "sound/scientist/yees.wav" },
+	{ 0xEF9F27BA, 0, "sound/barney/ba_stepoff.wav" },
+	{ 0x3E727D70, 0, "models/mapmodels/by_barrels_pallet.mdl" },
+	{ 0x6AD4EE68, 0, "models/p_grease_l.mdl" },
+	{ 0x2B639DD8, 0, "sprites/blueflare1.spr" },
+	{ 0x99F78F0C, 0, "models/vgibs.mdl" },
+	{ 0xF1617F89, 0, "sound/x/x_attack2.wav" },
+	{ 0x6459E8B0, 0, "models/pelvis.mdl" },
+	{ 0xEE0F09BC, 0, "sound/drill/dr2_add03.wav" },
+	{ 0x259C144A, 0, "gfx/env/dashnight256ft.tga" },
+	{ 0xD7BA7B6E, 0, "sound/weapons/greasegun_shoot.wav" },
+	{ 0xE73B7C29, 0, "sound/hgrunt/bell.wav" },
+	{ 0x711EDAA9, 0, "maps/dod_donner_detail.txt" },
+	{ 0x9EBD90BA, 0, "sound/weapons/knife_hit_wall1.wav" },
+	{ 0xE385C6A5, 0, "sound/gman/gman_otherwise.wav" },
+	{ 0x317CAE60, 0, "sound/fgrunt/fubar.wav" },
+	{ 0x7A18F764, 0, "sound/scientist/sci_pain8.wav" },
+	{ 0xACFAF70A, 0, "sound/scientist/c3a2_sci_flood.wav" },
+	{ 0x891CCD4F, 0, "models/geneworm.mdl" },
+	{ 0x7553CAF8, 0, "models/w_egont.mdl" },
+	{ 0xABFFDDFE, 0, "sound/debris/metal4.wav" },
+	{ 0x27F74FE4, 0, "sound/weapons/tommy_reload_clipout.wav" },
+	{ 0xE6339BCA, 0, "models/dispenser.mdl" },
+	{ 0x3E77DE9E, 0, "sound/weapons/rocketfire1.wav" },
+	{ 0x5387EF2A, 0, "sound/sentences/c1a0_20.wav" },
+	{ 0x7F99E814, 0, "sound/garg/gar_breathe1.wav" },
+	{ 0xE8425ECE, 0, "gfx/env/neb1ft.bmp" },
+	{ 0x9DE90979, 0, "sound/hgrunt/lay!.wav" },
+	{ 0x325C8296, 0, "sound/shocktrooper/dup.wav" },
+	{ 0xB914AD75, 0, "sound/weapons/dryfire_rifle.wav" },
+	{ 0xEF1DFFBB, 0, "sound/agrunt/ag_fire1.wav" },
+	{ 0xC0AFAE27, 0, "models/v_bazooka.mdl" },
+	{ 0xC4838603, 0, "sound/hgrunt/need!.wav" },
+	{ 0xB4C08A2E, 0, "gfx/env/trainyardup.tga" },
+	{ 0xF9E0EE05, 0, "sprites/xbeam1.spr" },
+	{ 0x7665DDA0, 0, "gfx/env/forestft.tga" },
+	{ 0x103EFC50, 0, "overviews/dod_kraftstoff.txt" },
+	{ 0xD0560E2F, 0, "sound/fgrunt/orders.wav" },
+	{ 0x4625A5AC, 0, "sound/intro/hq_proceed.wav" },
+	{ 0x774ACDBC, 0, "sound/sentences/hg_check4.wav" },
+	{ 0x669B92F9, 0, "sound/sentences/hev_e2.wav" },
+	{ 0xAE5BEAA0, 0, "gfx/env/havdn.tga" },
+	{ 0xA4850D3C, 0, "sound/scientist/istay.wav" },
+	{ 0x6A12968E, 0, "sound/shocktrooper/dit.wav" },
+	{ 0x723844A9, 0, "sound/drill/add12.wav" },
+	{ 0x3D4B3B65, 0, "sound/scientist/c1a0_sci_ctrl1a.wav" },
+	{ 0x9B401DFA, 0, "sound/fvox/bell.wav" },
+	{ 0xF6D91A6B, 0, "sound/otis/teamup.wav" },
+	{ 0xAE9EB14E, 0, "sound/sentences/na5.wav" },
+	{ 0xEE4EC19F, 0, "sound/misc/broken_tram5.wav" },
+	{ 0x3277A9AC, 0, "sound/weapons/garand_reload_clipin.wav" },
+	{ 0x2D6DDD25, 0, "sound/ambience/labdrone2.wav" },
+	{ 0xD6247165, 0, "models/shield/p_shield_knife.mdl" },
+	{ 0xE377D6C8, 0, "sound/hgrunt/something.wav" },
+	{ 0x4A0527FD, 0, "gfx/env/xen10lf.tga" },
+	{ 0x4165E508, 0, "sound/barney/c1a4_ba_octo4.wav" },
+	{ 0x28958C8E, 0, "sound/debris/flesh5.wav" },
+	{ 0xB3DA7D9C, 0, "sound/scientist/c1a3_sci_1man.wav" },
+	{ 0xFE3A6DB8, 0, "resource/cstrike_english.txt" },
+	{ 0x9648999D, 0, "sound/debris/bustconcrete1.wav" },
+	{ 0x0748EC83, 0, "sprites/weapon_axe.txt" },
+	{ 0xE8C56303, 0, "sound/ambience/mgun_burst1.wav" },
+	{ 0x88ECC8F3, 0, "sound/barney/die.wav" },
+	{ 0x06876CBC, 0, "sound/ambience/dodambience1.wav" },
+	{ 0xD9C88C17, 0, "sound/fvox/blood_toxins.wav" },
+	{ 0x3F2CF144, 0, "sound/hgrunt/secure!.wav" },
+	{ 0x655EB492, 0, "sound/ambience/alien_purrmachine.wav" },
+	{ 0x442E1E1C, 0, "sound/ambience/gerareasecure.wav" },
+	{ 0xAF17DCB3, 0, "sound/fgrunt/of5a3_fg05.wav" },
+	{ 0x7961774E, 0, "sound/scientist/scream14.wav" },
+	{ 0xC9E38986, 0, "overviews/avanti.bmp" },
+	{ 0x01B77F1E, 0, "sound/fgrunt/torch_cut_loop.wav" },
+	{ 0x752DC7BE, 0, "sound/vox/explosion.wav" },
+	{ 0x8C820565, 0, "sound/scientist/correcttheory.wav" },
+	{ 0x9EC0A8CE, 0, "sound/weapons/c4_disarmed.wav" },
+	{ 0x90E03DD2, 0, "sound/sentences/hg_answer0.wav" },
+	{ 0xBBF709FA, 0, "models/gib_legbone.mdl" },
+	{ 0xE9339548, 0, "models/uplant3.mdl" },
+	{ 0xB5DE4D8F, 0, "sound/vox/first.wav" },
+	{ 0x41C562D6, 0, "gfx/env/stft.tga" },
+	{ 0x4337513E, 0, "models/v_shock.mdl" },
+	{ 0x939A6409, 0, "sound/vox/_period.wav" },
+	{ 0x03B41486, 0, "sound/vox/shield.wav" },
+	{ 0x6EE27206, 0, "models/p_stg44.mdl" },
+	{ 0xA90CA943, 0, "sound/shocktrooper/blis.wav" },
+	{ 0x895634C6, 0, "sound/headcrab/hc_pain2.wav" },
+	{ 0x675586AB, 0, "gfx/env/havup.tga" },
+	{ 0xF8534475, 0, "models/w_9mmart.mdl" },
+	{ 0xF2FE6398, 0, "models/egg.mdl" },
+	{ 0xCDD2FADA, 0, "sound/hgrunt/he!.wav" },
+	{ 0x695D7C76, 0, "sound/vox/helicopter.wav" },
+	{ 0xCEDC20FE, 0, "gfx/env/morningdewft.bmp" },
+	{ 0x4564FFA2, 0, "sound/doors/aliendoor4.wav" },
+	{ 0x307C62DE, 0, "sound/items/armor1.wav" },
+	{ 0x2E93A40C, 0, "models/mapmodels/zalec_2bulb2wire.mdl" },
+	{ 0x55A66399, 0, "sound/vox/thousand.wav" },
+	{ 0xA2E42A30, 0, "sound/drill/squad05.wav" },
+	{ 0x0AA196B8, 0, "sound/barney/whatisthat.wav" },
+	{ 0x7142A0C1, 0, "sound/scientist/sc_power_wound1.wav" },
+	{ 0x7EA6EB6C, 0, "sound/fgrunt/athority.wav" },
+	{ 0x62425596, 0, "sound/weapons/ak47_clipin.wav" },
+	{ 0x7B342CC7, 0, "models/islavet.mdl" },
+	{ 0x2421D23C, 0, "sound/items/protect3.wav" },
+	{ 0xF7D936D7, 0, "sound/weapons/desert_eagle_sight2.wav" },
+	{ 0x259B1490, 0, "sound/fgrunt/coverup.wav" },
+	{ 0x48CEACEC, 0, "sound/vox/location.wav" },
+	{ 0xEC44E009, 0, "overviews/cs_militia.bmp" },
+	{ 0xFEE43557, 0, "sound/hgrunt/you.wav" },
+	{ 0x0BB6F271, 0, "sound/barney/heybuddy.wav" },
+	{ 0x447C7149, 0, "sound/player/pl_wood4.wav" },
+	{ 0x79B2A1E5, 0, "sound/hgrunt/up.wav" },
+	{ 0x98D1BA8B, 0, "gfx/env/disclf.bmp" },
+	{ 0x819F81EF, 0, "sound/fgrunt/notfail.wav" },
+	{ 0x4250DB94, 0, "sound/shocktrooper/shock_trooper_pain2.wav" },
+	{ 0x4A5B8EDC, 0, "models/rshell_big.mdl" },
+	{ 0x7988FAEE, 0, "models/sentry.mdl" },
+	{ 0x8365659F, 0, "sound/weapons/357_reload1.wav" },
+	{ 0x33A85C4B, 0, "sound/barney/ba_firepl.wav" },
+	{ 0x114801DF, 0, "gfx/env/doom1lf.tga" },
+	{ 0xF08437CB, 0, "models/v_mp40.mdl" },
+	{ 0xF81F3521, 0, "models/mapmodels/street_lamp1.mdl" },
+	{ 0xC0B19A9C, 0, "resource/platform_korean.txt" },
+	{ 0x9E01FC53, 0, "sound/barney/ba_openfire.wav" },
+	{ 0xD4F8AF92, 0, "sound/scientist/scream25.wav" },
+	{ 0x3E897140, 0, "sound/barney/ba_security2_nopass.wav" },
+	{ 0x18BD4E73, 0, "models/shield/p_shield_hegrenade.mdl" },
+	{ 0x133236A8, 0, "sound/vox/then.wav" },
+	{ 0xB20AB667, 0, "sound/debris/concrete1.wav" },
+	{ 0x607A3CEF, 0, "sound/buttons/button6.wav" },
+	{ 0x00A00257, 0, "sound/common/bodysplat.wav" },
+	{ 0xB4051AAF, 0, "sound/fvox/powermove_on.wav" },
+	{ 0x6789D3D5, 0, "sprites/hudssgammo.spr" },
+	{ 0x95005AF7, 0, "sound/ichy/ichy_bite2.wav" },
+	{ 0x1623FFB0, 0, "sound/otis/friends.wav" },
+	{ 0x8A90C5C6, 0, "sound/pspawn.wav" },
+	{ 0x05961D7E, 0, "sound/hgrunt/fight.wav" },
+	{ 0xF541C3E8, 0, "sound/scientist/sc_yard_box1b.wav" },
+	{ 0x24B45901, 0, "sound/player/sprayer.wav" },
+	{ 0xC5E4CB59, 0, "sound/drill/rifle06.wav" },
+	{ 0x1CBB438E, 0, "sound/garg/gar_breathe3.wav" },
+	{ 0xF221BB51, 0, "sound/ambience/3dmthrill.wav" },
+	{ 0xB4B465BF, 0, "sound/gonarch/gon_pain4.wav" },
+	{ 0x57D7F919, 0, "sound/weapons/m4a1_boltpull.wav" },
+	{ 0x13C3E93F, 0, "sound/barney/c3a1_ba_5sat.wav" },
+	{ 0xDDCD7008, 0, "sound/fgrunt/death4.wav" },
+	{ 0x6382DD22, 0, "sound/otis/another.wav" },
+	{ 0xA73AC871, 0, "sound/scientist/ushouldsee.wav" },
+	{ 0xC87A9AFA, 0, "models/tech_crategibs.mdl" },
+	{ 0x003F7255, 0, "sound/hgrunt/nothing.wav" },
+	{ 0x5FEDBDD4, 0, "sound/ba_holo/tr_holo_charger.wav" },
+	{ 0x76B73F62, 0, "sound/vox/quick.wav" },
+	{ 0x966CB2C7, 0, "gfx/env/morningft.tga" },
+	{ 0x10BE2043, 0, "sprites/flare4.spr" },
+	{ 0x2D7E5682, 0, "sprites/obj_icons/dod_glider/icon_obj_custom1_axis.spr" },
+	{ 0x1820666C, 0, "resource/background/800_2_b_loading.tga" },
+	{ 0x8CB2F1F3, 0, "sound/player/ow.wav" },
+	{ 0x0B2A3D33, 0, "sound/hgrunt/negative.wav" },
+	{ 0xF65F8F13, 0, "gfx/vgui/fonts/800_team info text.tga" },
+	{ 0x09515D2C, 0, "sound/weapons/zoom.wav" },
+	{ 0x7B345F5D, 0, "sound/scientist/tunnelcalc.wav" },
+	{ 0x01E9DDEE, 0, "sound/vox/granted.wav" },
+	{ 0xB6C198FC, 0, "sound/otis/help.wav" },
+	{ 0x5DFCB97B, 0, "sound/vox/inches.wav" },
+	{ 0x69773E30, 0, "sound/drill/seventhroom01.wav" },
+	{ 0xAB04E3AE, 0, "gfx/env/cliffft.bmp" },
+	{ 0xF82C9EDA, 0, "sound/sentences/boop.wav" },
+	{ 0x109721BF, 0, "sound/rosenberg/ro_pain0.wav" },
+	{ 0x1C9E861F, 0, "sound/gman/of7a0_gm04.wav" },
+	{ 0x421659B6, 0, "rebuy.txt" },
+	{ 0xB2CB4090, 0, "sound/ambience/techamb2.wav" },
+	{ 0x6CCD4AEC, 0, "sound/hgrunt/shot.wav" },
+	{ 0x4BADC433, 0, "models/pg-150.mdl" },
+	{ 0xE975F1A6, 0, "sound/vox/armed.wav" },
+	{ 0x254A15B0, 0, "sound/holo/holostn14.wav" },
+	{ 0xFD9DBB7B, 0, "sprites/bmp/2expl09.bmp" },
+	{ 0x56D2A775, 0, "overviews/dod_flugplatz.txt" },
+	{ 0x00D4191F, 0, "sound/vox/test.wav" },
+	{ 0x1E26CC86, 0, "sound/plats/platstop1.wav" },
+	{ 0xDDC13B7C, 0, "sound/plats/rackstop1.wav" },
+	{ 0xDD79DC48, 0, "sound/tride/c0a0_tr_dest.wav" },
+	{ 0x8B1F7F47, 0, "sound/ambience/port_suckout1.wav" },
+	{ 0x0347F4A5, 0, "sound/ambience/truck2.wav" },
+	{ 0xE603F9F9, 0, "gfx/env/avadn.tga" },
+	{ 0x6220384A, 0, "sound/sentences/c3a2_2.wav" },
+	{ 0xA1BAB171, 0, "gfx/env/bluelf.tga" },
+	{ 0x14BC7051, 0, "sound/barney/cantfigure.wav" },
+	{ 0xF1CF0A99, 0, "sound/drill/rope06.wav" },
+	{ 0x7BDA4561, 0, "sound/scientist/sc_accident3.wav" },
+	{ 0x4DD41188, 0, "sound/sentences/hev_medkit.wav" },
+	{ 0xA291FBFD, 0, "sprites/flare2.spr" },
+	{ 0x721650B8, 0, "sprites/bmp/2expl08.bmp" },
+	{ 0xB40008C7, 0, "sound/hgrunt/check!.wav" },
+	{ 0xCC54CC39, 0, "sound/player/pain2.wav" },
+	{ 0x2275EF93, 0, "sound/ba_holo/tr_holo_fantastic.wav" },
+	{ 0x5CC88592, 0, "models/p_m1carb.mdl" },
+	{ 0x76740345, 0, "sound/gonarch/gon_birth1.wav" },
+	{ 0x53F00964, 0, "sound/vox/cryogenic.wav" },
+	{ 0x3F7E7162, 0, "sound/hgrunt/hundredmeters.wav" },
+	{ 0x61BA4D57, 0, "sound/bullchicken/bc_spithit2.wav" },
+	{ 0xA8038D9F, 0, "sound/sentences/hev_f9.wav" },
+	{ 0xE3F01E8C, 0, "gfx/env/2desertft.tga" },
+	{ 0x6E2C2E2E, 0, "sound/ichy/ichy_bite1.wav" },
+	{ 0xA039D3B3, 0, "sound/pitdrone/pit_drone_pain1.wav" },
+	{ 0xB4C72133, 0, "sound/holo/tr_holo_target.wav" },
+	{ 0xB6928998, 0, "gfx/env/backalleyup.tga" },
+	{ 0x29CEAA1B, 0, "models/p_fcarb_l.mdl" },
+	{ 0x8B743114, 0, "sound/debris/flesh7.wav" },
+	{ 0x73215583, 0, "sound/sentences/c1a4_1.wav" },
+	{ 0x5255B134, 0, "models/w_9mmclip.mdl" },
+	{ 0x2280CBC1, 0, "sound/weapons/sniper_bolt1.wav" },
+	{ 0x7AA882C5, 0, "sound/vox/vacate.wav" },
+	{ 0x5CEA74B2, 0, "sound/hgrunt/moves.wav" },
+	{ 0x90A6DBBA, 0, "sprites/sprite_01.spr" },
+	{ 0x61321FF8, 0, "models/pent.mdl" },
+	{ 0xD23F343F, 0, "sound/vox/sewer.wav" },
+	{ 0xE18C84F4, 0, "models/player/medic/medic2.mdl" },
+	{ 0xFB5F0C04, 0, "sound/fvox/get_satchel.wav" },
+	{ 0x70D212B2, 0, "sound/ambience/forestcricket.wav" },
+	{ 0xED4AE707, 0, "sound/hgrunt/gr_idle1.wav" },
+	{ 0xA87CEFD7, 0, "sound/hgrunt/silence.wav" },
+	{ 0x129A96C2, 0, "sprites/bmp/tffire01.bmp" },
+	{ 0x27BBF4C6, 0, "sound/plats/railmove1.wav" },
+	{ 0x8499B055, 0, "sound/rosenberg/ro_tele_final23.wav" },
+	{ 0x1A6C2746, 0, "gfx/detail/dt_plaster1.tga" },
+	{ 0xDDE88976, 0, "models/mapmodels/merd_chim.mdl" },
+	{ 0x071C848F, 0, "models/shock_effect.mdl" },
+	{ 0xFF55F386, 0, "sound/vox/johnson.wav" },
+	{ 0xFCCD6D72, 0, "800_textscheme.txt" },
+	{ 0xDCD46AD7, 0, "models/bullsquid01.mdl" },
+	{ 0xDDD7A5D0, 0, "models/player/fassn/fassn.mdl" },
+	{ 0x5D892B7A, 0, "resource/icon_stepf.tga" },
+	{ 0xB3469A18, 0, "sound/hgrunt/bravo.wav" },
+	{ 0x93099CAA, 0, "sound/sentences/c2a2_launch.wav" },
+	{ 0x4050E39E, 0, "sound/gonarch/gon_alert3.wav" },
+	{ 0x5921849D, 0, "sound/weapons/mac10_clipin.wav" },
+	{ 0xA59E2847, 0, "sound/otis/go_on.wav" },
+	{ 0xDD089860, 0, "models/mapmodels/jeep.mdl" },
+	{ 0x6BD4F97B, 0, "sound/plats/train_use1.wav" },
+	{ 0xDA3D8A67, 0, "sound/fvox/internal_bleeding.wav" },
+	{ 0xF797451B, 0, "sound/fvox/_comma.wav" },
+	{ 0x9AC66CE2, 0, "resource/icon_start.tga" },
+	{ 0xDF260B4B, 0, "sound/vox/fifty.wav" },
+	{ 0x54779E28, 0, "sound/fvox/powermove_overload.wav" },
+	{ 0x5E6BDFE8, 0, "models/p_fcarb.mdl" },
+	{ 0xBEC68EEF, 0, "gfx/vgui/fonts/1024_title font.tga" },
+	{ 0xF5411548, 0, "resource/cstrike_french.txt" },
+	{ 0x6CA4E5E7, 0, "sound/scientist/dontconcur.wav" },
+	{ 0x20F2FCF5, 0, "sound/sentences/c1a2_1.wav" },
+	{ 0x38695B3F, 0, "sound/scientist/c1a4_sci_gener.wav" },
+	{ 0xD9D3611A, 0, "sound/vox/do.wav" },
+	{ 0x5A1A94ED, 0, "sound/ichy/ichy_alert2.wav" },
+	{ 0x3A4D7B53, 0, "sound/voltigore/voltigore_communicate3.wav" },
+	{ 0xC00AC172, 0, "resource/vgui_spanish.txt" },
+	{ 0xD8E083EB, 0, "sound/scientist/sci_fear7.wav" },
+	{ 0xD632703D, 0, "sound/vox/temporal.wav" },
+	{ 0x9BC73B46, 0, "sound/pitdrone/pit_drone_hunt3.wav" },
+	{ 0xF6A8C791, 0, "sound/otis/together.wav" },
+	{ 0x1CB0300B, 0, "sound/hgrunt/formation.wav" },
+	{ 0x592461CF, 0, "sprites/wdrip2.spr" },
+	{ 0x08A033EE, 0, "models/disc_hard.mdl" },
+	{ 0xF646E119, 0, "sound/weapons/glock18-2.wav" },
+	{ 0x05DE2EE3, 0, "sound/ctf/marine_flag_capture.wav" },
+	{ 0x5C988CC8, 0, "sprites/radaropaque640.spr" },
+	{ 0x8287BF12, 0, "gfx/vgui/mouse.tga" },
+	{ 0x0A41D303, 0, "gfx/vgui/fonts/1280_title font.tga" },
+	{ 0x2CC18A3B, 0, "sound/weapons/pwrench_hitbod2.wav" },
+	{ 0x3805121C, 0, "models/v_9mmhandgun.mdl" },
+	{ 0x99B387CE, 0, "sound/weapons/mortar_move.wav" },
+	{ 0xDFA28968, 0, "sound/weapons/whizz12.wav" },
+	{ 0xEF4229A4, 0, "gfx/vgui/640_unchecked.tga" },
+	{ 0xD5AFCA57, 0, "models/flag.mdl" },
+	{ 0xD1048FCB, 0, "sound/common/wpn_hudoff.wav" },
+	{ 0x665D314B, 0, "models/spit.mdl" },
+	{ 0xE2428D7A, 0, "models/blkop_osprey.mdl" },
+	{ 0xE68AF892, 0, "gfx/env/neb7bk.tga" },
+	{ 0x8B2CCF22, 0, "models/v_deagle.mdl" },
+	{ 0x6808DDE0, 0, "gfx/env/alien1up.tga" },
+	{ 0xE3110930, 0, "models/p_shotgun.mdl" },
+	{ 0xA3E1BFEE, 0, "sound/player/land2.wav" },
+	{ 0x78168F4B, 0, "sound/rosenberg/ro_heal2.wav" },
+	{ 0x11DAB9F1, 0, "sound/hgrunt/my!.wav" },
+	{ 0xD94E13BC, 0, "sound/gman/gman_noreg.wav" },
+	{ 0x9A40915F, 0, "sprites/xbeam3.spr" },
+	{ 0x0DFC0C9B, 0, "sound/rosenberg/ro_tele_almost1.wav" },
+	{ 0xE4F40F43, 0, "models/w_fgrenade.mdl" },
+	{ 0x28480618, 0, "models/p_shot2.mdl" },
+	{ 0xE045982D, 0, "sound/fgrunt/checkrecon.wav" },
+	{ 0xDE9F4143, 0, "sound/vox/shock.wav" },
+	{ 0xFD5C7430, 0, "classes/long_engineer.txt" },
+	{ 0x98E5CA42, 0, "sound/scientist/sc_canals3.wav" },
+	{ 0x551318F4, 0, "sound/scientist/c1a0_sci_dis16a.wav" },
+	{ 0x735A5546, 0, "sprites/shot_smoke1.spr" },
+	{ 0x70C236C4, 0, "sound/vox/operative.wav" },
+	{ 0x5E7509C9, 0, "models/p_snailgun.mdl" },
+	{ 0x0E307C9A, 0, "sound/debris/bustmetal2.wav" },
+	{ 0xECF5FEB1, 0, "models/p_30calr.mdl" },
+	{ 0x4E54ADCA, 0, "sound/weapons/mortar.wav" },
+	{ 0xF59742E9, 0, "classes/short_pyro.txt" },
+	{ 0x2E4E8E16, 0, "sound/vox/damaged.wav" },
+	{ 0xDB998606, 0, "sound/hgrunt/creeps.wav" },
+	{ 0xC40D9E0A, 0, "sound/ichy/ichy_idle1.wav" },
+	{ 0xF5683DF0, 0, "gfx/env/neb6rt.tga" },
+	{ 0xAC6D2F77, 0, "sound/vox/fuel.wav" },
+	{ 0xAB39BE1E, 0, "sprites/spray.spr" },
+	{ 0x57BE2F69, 0, "sound/hgrunt/squad!.wav" },
+	{ 0xC2232E94, 0, "sound/scientist/freeman.wav" },
+	{ 0x8D0D2575, 0, "sound/scientist/everseen.wav" },
+	{ 0x855812FC, 0, "sound/scientist/illwait.wav" },
+	{ 0x79BDB80B, 0, "sound/scientist/lowervoice.wav" },
+	{ 0xC5C18F60, 0, "sound/radio/of4a3_rd01.wav" },
+	{ 0x48CD77C0, 0, "sprites/zbeam4.spr" },
+	{ 0x38FA19EF, 0, "sound/zombie/zo_idle3.wav" },
+	{ 0xCB19A292, 0, "overviews/cs_office.bmp" },
+	{ 0xC83E5348, 0, "sound/sentences/ea0.wav" },
+	{ 0xA9D12DF4, 0, "sound/hgrunt/check.wav" },
+	{ 0xE3101879, 0, "sound/player/britfireinhole.wav" },
+	{ 0x68DFD9A2, 0, "sound/scientist/newsample.wav" },
+	{ 0xBA16D02A, 0, "sound/vox/detonation.wav" },
+	{ 0xECABA052, 0, "sound/ambience/burning3.wav" },
+	{ 0x39CFB4A9, 0, "sound/scientist/freemanalive.wav" },
+	{ 0x7F03B4F6, 0, "sound/drill/rifle07.wav" },
+	{ 0xFCF317C2, 0, "sound/scientist/sci_fear4.wav" },
+	{ 0x75B68584, 0, "maps/de_aztec.txt" },
+	{ 0x0D94B56E, 0, "sprites/weapon_handgrenade.txt" },
+	{ 0x2776FFDB, 0, "models/w_bflag.mdl" },
+	{ 0xB295C716, 0, "sound/hgrunt/hg_canal3.wav" },
+	{ 0x100F7558, 0, "models/islave01.mdl" },
+	{ 0x89452134, 0, "models/mapmodels/hay.mdl" },
+	{ 0x55F14E6B, 0, "sound/hgrunt/tight!.wav" },
+	{ 0xB4D2198C, 0, "gfx/vgui/1280_arrowright.tga" },
+	{ 0x7C601D8E, 0, "sound/weapons/mac10_clipout.wav" },
+	{ 0xE561536A, 0, "models/v_sg552.mdl" },
+	{ 0xB6D30E46, 0, "models/mapmodels/flo_light.mdl" },
+	{ 0x4157D2C8, 0, "sound/vox/bizwarn.wav" },
+	{ 0x80B0EC6B, 0, "gfx/env/2desertrt.bmp" },
+	{ 0xB3C5F690, 0, "dod_caen.wad" },
+	{ 0xE4570DD1, 0, "sound/sentences/hev_f10.wav" },
+	{ 0x46B9BE20, 0, "sound/vox/lower.wav" },
+	{ 0x4EFE8A6E, 0, "sound/radio/of2a3_rd01.wav" },
+	{ 0xCB0BD71F, 0, "sound/sentences/hev_c6.wav" },
+	{ 0x47E82B6C, 0, "models/keycard.mdl" },
+	{ 0x5CDB978C, 0, "gfx/vgui/fonts/800_commandmenu text.tga" },
+	{ 0x4CA04D47, 0, "sound/items/nvg_off.wav" },
+	{ 0xCF2A16F6, 0, "sound/vox/reach.wav" },
+	{ 0x41318F55, 0, "sound/weapons/m249_chain.wav" },
+	{ 0x751D689D, 0, "models/mapmodels/null.mdl" },
+	{ 0xCAAE9DEC, 0, "sound/player/gerbazooka.wav" },
+	{ 0x69D3FACC, 0, "sound/weapons/flmgrexp.wav" },
+	{ 0xAE54E62C, 0, "sound/vox/sorry.wav" },
+	{ 0x1AB0F889, 0, "sprites/obj_icons/dod_zalec/icon_obj_custom1_allies.spr" },
+	{ 0x46C61DF4, 0, "sound/sentences/c1a0_8.wav" },
+	{ 0xE46281F2, 0, "sound/player/pl_tile4.wav" },
+	{ 0x98858C48, 0, "models/mapmodels/concretegibs.mdl" },
+	{ 0x8B397170, 0, "models/player/axis-inf/axis-inf.mdl" },
+	{ 0xF0F7E999, 0, "sound/hgrunt/c2a3_hg_5drag.wav" },
+	{ 0xBC2AB801, 0, "sound/sentences/ea7.wav" },
+	{ 0xB19CBDB2, 0, "sound/scientist/c1a0_sci_dis3a.wav" },
+	{ 0xCA550530, 0, "sound/weapons/g3sg1_slide.wav" },
+	{ 0xCA804147, 0, "models/b_nail1.mdl" },
+	{ 0x42A5E824, 0, "models/miniturret.mdl" },
+	{ 0x454ECAE7, 0, "sound/vox/_comma.wav" },
+	{ 0x9C640168, 0, "models/houndeyet.mdl" },
+	{ 0x1058D481, 0, "sound/rosenberg/ro_tele_final09.wav" },
+	{ 0xFBF306E7, 0, "sound/holo/holostn8.wav" },
+	{ 0x73DFA42D, 0, "models/fungus(large)t.mdl" },
+	{ 0x3D9F74BB, 0, "gfx/env/hackft.bmp" },
+	{ 0x600C0099, 0, "models/player/remapped.bmp" },
+	{ 0xCC0449FD, 0, "gfx/vgui/640_blackmesa.tga" },
+	{ 0xF7C0087F, 0, "sound/hgrunt/radio.wav" },
+	{ 0x56F4EF16, 0, "sound/player/usyessir.wav" },
+	{ 0x2E35FE15, 0, "sound/ambience/foliage.wav" },
+	{ 0x045A66E3, 0, "gfx/vgui/640_squadleader.tga" },
+	{ 0x53C39403, 0, "sprites/obj_icons/dod_falaise/icon_obj_custom1_allies.spr" },
+	{ 0xCEFDEC03, 0, "gfx/vgui/800_arrowright.tga" },
+	{ 0x35913970, 0, "sound/hgrunt/seventymeters.wav" },
+	{ 0x7B101E28, 0, "models/player/hvyweapon/hvyweapon2.mdl" },
+	{ 0x4C3D0D24, 0, "sound/player/gertakingfireleft.wav" },
+	{ 0xFEAB89DD, 0, "sound/player/gerusepanzerschreck.wav" },
+	{ 0x5CAF9D05, 0, "sound/geneworm/geneworm_idle2.wav" },
+	{ 0xEA4E3892, 0, "models/wire_red24.mdl" },
+	{ 0xC175FAA8, 0, "sprites/weapon_snark.txt" },
+	{ 0x77AE44DC, 0, "classes/short_engineer.txt" },
+	{ 0xDD58F378, 0, "models/pi_tree3.mdl" },
+	{ 0x73866EFB, 0, "sound/fgrunt/critical.wav" },
+	{ 0xC6DE75DE, 0, "sound/ambience/cicada3.wav" },
+	{ 0x8EE32F07, 0, "sound/hgrunt/c2a3_hg_3drag.wav" },
+	{ 0x90178AEC, 0, "sound/hgrunt/damn.wav" },
+	{ 0xAF4A5867, 0, "sound/scientist/yesok.wav" },
+	{ 0x41696FB9, 0, "sound/otis/tooyoung.wav" },
+	{ 0xEAF781A6, 0, "overviews/casbah.tga" },
+	{ 0x4F4EF3D8, 0, "sound/weapons/elite_deploy.wav" },
+	{ 0xBA1ABEA8, 0, "sound/sentences/fuel_off.wav" },
+	{ 0x546FF65B, 0, "sound/scientist/c1a0_sci_dis11a.wav" },
+	{ 0x7552A6AD, 0, "sound/vox/armory.wav" },
+	{ 0xB7AE91D7, 0, "sound/ambience/fd_flyby2.wav" },
+	{ 0xF5681A90, 0, "models/p_grenade2.mdl" },
+	{ 0x2ADAF4DE, 0, "sound/scientist/scream21.wav" },
+	{ 0xD64E5D14, 0, "sprites/weapon_hegrenade.txt" },
+	{ 0xA8F9AF39, 0, "sound/pitdrone/pit_drone_communicate2.wav" },
+	{ 0x30090D7D, 0, "sound/vox/three.wav" },
+	{ 0x18942F7D, 0, "sound/scientist/of2a3_sc01.wav" },
+	{ 0xF89E0441, 0, "maps/dod_kraftstoff_detail.txt" },
+	{ 0x0BFC5605, 0, "sound/fgrunt/of1a6_fg04.wav" },
+	{ 0xC7997425, 0, "sound/fgrunt/hostiles.wav" },
+	{ 0xD2439880, 0, "hlbasics.wad" },
+	{ 0xE92A58DE, 0, "sound/barney/ba_whoathere.wav" },
+	{ 0x8BCDF65F, 0, "models/wire_copper32.mdl" },
+	{ 0x96BB53EB, 0, "sound/ambience/chimes.wav" },
+	{ 0x0410CAA8, 0, "sound/items/smallmedkit1.wav" },
+	{ 0xC624B5AE, 0, "sound/fgrunt/blocked.wav" },
+	{ 0x4592415A, 0, "sprites/iflagblue.spr" },
+	{ 0x3B19C42E, 0, "sound/fvox/chemical_detected.wav" },
+	{ 0xFC183835, 0, "sprites/640hud10.spr" },
+	{ 0xCC401AAA, 0, "sound/player/pl_swim4.wav" },
+	{ 0x4D4B4A7B, 0, "sound/weapons/g3sg1_clipout.wav" },
+	{ 0x82E0E10D, 0, "gfx/env/alien2rt.bmp" },
+	{ 0xEBA98C66, 0, "sound/weapons/fg42_shoot.wav" },
+	{ 0xB4717607, 0, "sound/ambience/truck-1ka.wav" },
+	{ 0x2EFF2031, 0, "sound/vox/detected.wav" },
+	{ 0x5A14EE20, 0, "models/p_nailgun.mdl" },
+	{ 0x4216D22A, 0, "sprites/gas_puff_01.spr" },
+	{ 0xD58FB33E, 0, "sound/rosenberg/ro_tele_xen05.wav" },
+	{ 0xD9F4333E, 0, "sound/weapons/p228_sliderelease.wav" },
+	{ 0x95969C2F, 0, "sound/scientist/c1a0_sci_dis6a.wav" },
+	{ 0x25A7644F, 0, "maps/op4ctf_mortar.txt" },
+	{ 0x2886937B, 0, "sound/scientist/nothostile.wav" },
+	{ 0x6BF5723D, 0, "sound/player/gerattack.wav" },
+	{ 0x19BB1A2C, 0, "models/w_rpg.mdl" },
+	{ 0x548CC3EA, 0, "sound/misc/broken_tram2.wav" },
+	{ 0x119B1F6C, 0, "sound/player/usleft.wav" },
+	{ 0xC049F0F7, 0, "overviews/dod_merderet.bmp" },
+	{ 0x9F370B42, 0, "models/mapmodels/dod_jagd_tub.mdl" },
+	{ 0x31811C16, 0, "sound/weapons/pwrench_big_miss.wav" },
+	{ 0xB72BAD35, 0, "sound/scientist/imsure.wav" },
+	{ 0x587B74E5, 0, "sound/bullchicken/bc_attackgrowl2.wav" },
+	{ 0xF36265AB, 0, "sound/gman/gman_noregret.wav" },
+	{ 0x7C61FCF2, 0, "models/hgrunt_medic.mdl" },
+	{ 0xB417C91B, 0, "sprites/mapmarkers/number_one.spr" },
+	{ 0x9688A846, 0, "models/glassgibs.mdl" },
+	{ 0xB8995B6F, 0, "sound/fgrunt/staydown.wav" },
+	{ 0xB0CF1F01, 0, "sprites/obj_icons/icon_obj_radio_axis.spr" },
+	{ 0x4C531BB3, 0, "sound/fgrunt/gr_pain5.wav" },
+	{ 0x1BB18FD5, 0, "sound/rosenberg/ro_heal0.wav" },
+	{ 0xCC36644B, 0, "sound/scientist/c1a0_sci_dis2a.wav" },
+	{ 0xBBD66602, 0, "sound/player/britfallback.wav" },
+	{ 0x3DA8F4B8, 0, "sprites/fast_wallpuff1.spr" },
+	{ 0x928B6252, 0, "sound/hgrunt/charlie.wav" },
+	{ 0xDD0C8FF0, 0, "sound/scientist/c1a0_sci_mumble.wav" },
+	{ 0x03D502AE, 0, "sound/vox/front.wav" },
+	{ 0x44B1B310, 0, "models/mapmodels/by_canopy.mdl" },
+	{ 0x4F8531D6, 0, "sound/misc/r_tele3.wav" },
+	{ 0xD9034A5E, 0, "sound/sentences/ea6.wav" },
+	{ 0x77919208, 0, "sound/sentences/hg_alert6.wav" },
+	{ 0x565BC37F, 0, "sound/fgrunt/of5a3_fg01.wav" },
+	{ 0x639C662E, 0, "gfx/vgui/640_discred2.tga" },
+	{ 0x8971711C, 0, "sound/gonarch/gon_pain5.wav" },
+	{ 0x1C280134, 0, "models/w_sqknest.mdl" },
+	{ 0xFA95C87D, 0, "sound/vox/cross.wav" },
+	{ 0xD20A143B, 0, "overviews/rock2.txt" },
+	{ 0xA91621CA, 0, "sound/gonome/gonome_pain3.wav" },
+	{ 0xE7275C2A, 0, "models/w_weaponbox.mdl" },
+	{ 0xF59EF65A, 0, "sound/fvox/antitoxin_shot.wav" },
+	{ 0x23190182, 0, "overviews/cs_estate.bmp" },
+	{ 0xEAB4E2CF, 0, "sound/turret/tu_deploy.wav" },
+	{ 0x4C8AEE5D, 0, "sound/player/britspeadout.wav" },
+	{ 0x914F02DE, 0, "sound/scientist/headcrab.wav" },
+	{ 0xDB91CCBA, 0, "gfx/vgui/640_recruit.tga" },
+	{ 0x55CE96C9, 0, "sprites/mapsprites/caparea.spr" },
+	{ 0xEE557243, 0, "sound/scientist/getalong.wav" },
+	{ 0xA8F3E5DC, 0, "sound/fans/fan5.wav" },
+	{ 0xF3806975, 0, "sound/ctf/pow_health_charge.wav" },
+	{ 0x134809B4, 0, "sound/doors/aliendoor2.wav" },
+	{ 0x36B0A8E1, 0, "overviews/avanti.txt" },
+	{ 0x942F91A3, 0, "mapcycle.txt" },
+	{ 0x274566DC, 0, "sound/drill/intro01.wav" },
+	{ 0x7414BBCE, 0, "sound/barney/ba_shot5.wav" },
+	{ 0x1D2E2B15, 0, "sprites/flash1.tga" },
+	{ 0x06E67154, 0, "sprites/xflare1.spr" },
+	{ 0x6B9D2827, 0, "sound/scientist/holdstill.wav" },
+	{ 0x051BFF26, 0, "sound/vox/roger.wav" },
+	{ 0x0DD70AE6, 0, "models/concrete_gibs.mdl" },
+	{ 0xF5DA63E8, 0, "gfx/env/alien1dn.bmp" },
+	{ 0x2D1F5442, 0, "models/mapmodels/ouitz_tree2.mdl" },
+	{ 0x3DCBDFF2, 0, "models/scientist03.mdl" },
+	{ 0x04F13C99, 0, "gfx/env/duskbk.tga" },
+	{ 0xD2EF1604, 0, "sound/fgrunt/lost.wav" },
+	{ 0x919A074C, 0, "gfx/env/neb1bk.tga" },
+	{ 0xE9586AB1, 0, "sound/weapons/saw_fire2.wav" },
+	{ 0x0F094493, 0, "sound/scientist/notcertain.wav" },
+	{ 0x4A52132A, 0, "gfx/vgui/clsimages/cls_grease.tga" },
+	{ 0x6BF27AAE, 0, "models/g_rock2.mdl" },
+	{ 0x93A73039, 0, "sound/rosenberg/ro_plfear4.wav" },
+	{ 0x065CB0C1, 0, "models/p_disc_hard.mdl" },
+	{ 0x9D9F1E59, 0, "sound/fvox/pain_block.wav" },
+	{ 0xF41944D8, 0, "sound/scientist/c1a0_sci_crit1a.wav" },
+	{ 0xAF7BE784, 0, "sound/vox/progress.wav" },
+	{ 0x4B21582A, 0, "sound/vox/for.wav" },
+	{ 0x66732DDE, 0, "sound/rosenberg/ro_to_teleport.wav" },
+	{ 0x20B5F55F, 0, "sprites/weapons1.spr" },
+	{ 0xDBC0DBDD, 0, "sound/voltigore/voltigore_communicate1.wav" },
+	{ 0x9E64E2ED, 0, "models/mapmodels/dod_tree1.mdl" },
+	{ 0x33A32BC3, 0, "sound/scientist/whyleave.wav" },
+	{ 0x079D22BD, 0, "sound/weapons/usp_unsil-1.wav" },
+	{ 0x013766A9, 0, "sound/holo/holostn13.wav" },
+	{ 0x36BF1436, 0, "models/mapmodels/jagd.mdl" },
+	{ 0x2FBE8859, 0, "gfx/vgui/1920_arrowdown.tga" },
+	{ 0xC7D24FD9, 0, "sound/weapons/p228_clipin.wav" },
+	{ 0x536404A5, 0, "sound/sentences/hev_aim_on.wav" },
+	{ 0x7289EA7E, 0, "sound/scientist/sci_2thou.wav" },
+	{ 0xE7CE80DD, 0, "models/v_m4a1.mdl" },
+	{ 0x1CCB2CDF, 0, "gfx/env/backalleylf.tga" },
+	{ 0x947C625E, 0, "sound/debris/beamstart11.wav" },
+	{ 0x10A6933E, 0, "overviews/undertow.txt" },
+	{ 0x271CB66A, 0, "sound/barney/ba_hello3.wav" },
+	{ 0xE0FC95EA, 0, "models/p_usp.mdl" },
+	{ 0xADFC3571, 0, "models/w_shotshell.mdl" },
+	{ 0x00CF3B15, 0, "sound/weapons/mine_charge.wav" },
+	{ 0x2070A6C8, 0, "models/player/us-para/us-para.mdl" },
+	{ 0xBA7445AD, 0, "sound/bullchicken/bc_pain3.wav" },
+	{ 0x154FBC89, 0, "models/w_scout.mdl" },
+	{ 0x962E27F2, 0, "models/p_medkit2.mdl" },
+	{ 0xFF0E6C34, 0, "resource/icon_file.tga" },
+	{ 0x6B4E3113, 0, "opfor.wad" },
+	{ 0xFB563B35, 0, "models/nail.mdl" },
+	{ 0x3476F061, 0, "sprites/obj_icons/icon_obj_bridge_neutral.spr" },
+	{ 0xE9D8618C, 0, "sprites/640hud6.spr" },
+	{ 0xE7727CBD, 0, "sound/ambience/cat1.wav" },
+	{ 0xD58784FE, 0, "sound/weapons/whizz14.wav" },
+	{ 0x68AC4A6F, 0, "models/cindergibs.mdl" },
+	{ 0x0217001B, 0, "sound/sentences/hg_gren3.wav" },
+	{ 0xD0DD2022, 0, "sound/weapons/flashbang-2.wav" },
+	{ 0xFBC89901, 0, "sound/barnacle/bcl_die3.wav" },
+	{ 0x2810D91E, 0, "sound/ambience/alien_beacon.wav" },
+	{ 0x502E555F, 0, "sound/drill/secondroom01.wav" },
+	{ 0x6BAFD62B, 0, "sound/scientist/scream6.wav" },
+	{ 0x38CD7559, 0, "sound/weapons/k43_shoot.wav" },
+	{ 0xB1786188, 0, "sound/sentences/na16.wav" },
+	{ 0x7E2DBDA1, 0, "sound/scientist/ibelieveso.wav" },
+	{ 0xD5717FAB, 0, "gfx/env/tsccity_dn.tga" },
+	{ 0x62B7AAB5, 0, "sound/debris/beamstart7.wav" },
+	{ 0xB61FF05A, 0, "sound/scientist/sc_outro2.wav" },
+	{ 0xC5D40BC8, 0, "gfx/env/de_stormft.tga" },
+	{ 0x1F25B1E5, 0, "gfx/vgui/unchecked.tga" },
+	{ 0x448BDABD, 0, "sound/pitdrone/pit_drone_pain3.wav" },
+	{ 0xE8B183BD, 0, "sound/scientist/youwounded.wav" },
+	{ 0xBCEA7ABA, 0, "sprites/bmp/2expl02.bmp" },
+	{ 0x07A4EBFF, 0, "sound/hgrunt/roger.wav" },
+	{ 0xAD63372B, 0, "sprites/mapsprites/c2_axis_target.spr" },
+	{ 0xD7A088A4, 0, "models/w_gausst.mdl" },
+	{ 0x20772FE1, 0, "sound/vox/transportation.wav" },
+	{ 0xA184779A, 0, "sound/vox/required.wav" },
+	{ 0x511BF90B, 0, "sound/zombie/zo_alert10.wav" },
+	{ 0xB1632017, 0, "sound/rosenberg/ro_tele_power2.wav" },
+	{ 0xDB5A8172, 0, "gfx/decals/hwshot4.bmp" },
+	{ 0x4FF2DC7B, 0, "sound/otis/seethat.wav" },
+	{ 0x0FC3B14B, 0, "sprites/bmp/1expl11.bmp" },
+	{ 0xFFDBD03D, 0, "gfx/env/sildom2rt.tga" },
+	{ 0xC65F8018, 0, "sound/hgrunt/east!.wav" },
+	{ 0xB54DB0A0, 0, "sound/houndeye/he_blast1.wav" },
+	{ 0x1C28AAC4, 0, "sound/ambience/computalk2.wav" },
+	{ 0xDFE98B0A, 0, "sound/barney/ba_die1.wav" },
+	{ 0x11090461, 0, "sound/fvox/three.wav" },
+	{ 0xE56C3366, 0, "sprites/hudrlammo.spr" },
+	{ 0x187A6DB4, 0, "models/crashed_osprey.mdl" },
+	{ 0x05D91250, 0, "models/player/gordon/gordon.bmp" },
+	{ 0x83F25DFB, 0, "gfx/env/morningdew_bk.tga" },
+	{ 0x82044000, 0, "classes/short_op4_random.txt" },
+	{ 0x23370499, 0, "maps/dod_saints_detail.txt" },
+	{ 0xDD4B06E7, 0, "models/p_m4a1.mdl" },
+	{ 0xF98CBC08, 0, "sound/vox/meter.wav" },
+	{ 0x2FBECB56, 0, "sound/vox/reset.wav" },
+	{ 0x4A835DAA, 0, "resource/dod_german.txt" },
+	{ 0xB07656A2, 0, "sound/barney/hardtosay.wav" },
+	{ 0x935378D7, 0, "sound/vox/alert.wav" },
+	{ 0x7601A8DF, 0, "sound/scientist/sci_pain1.wav" },
+	{ 0x9262967E, 0, "sound/rosenberg/ro_yard_follow1.wav" },
+	{ 0x1ABBBAEF, 0, "sound/plats/squeekstop1.wav" },
+	{ 0xF0E25531, 0, "gfx/env/xen8bk.tga" },
+	{ 0xE03853F1, 0, "sound/sentences/c1a2_5.wav" },
+	{ 0x87DA61B3, 0, "sound/sentences/ctr19.wav" },
+	{ 0x3C70E238, 0, "models/player/barney/barney.mdl" },
+	{ 0x5FC47BC9, 0, "sprites/hudlgammo.spr" },
+	{ 0xA5163250, 0, "sound/holo/tr_ba_use.wav" },
+	{ 0x0C567F6C, 0, "sound/weapons/knifeswing2.wav" },
+	{ 0x1991A64D, 0, "overviews/stalkyard.tga" },
+	{ 0x802EF15C, 0, "models/player/helmet/helmet.bmp" },
+	{ 0x40FA6751, 0, "sound/vox/containment.wav" },
+	{ 0x1469BDA3, 0, "sound/barney/c1a0_ba_late.wav" },
+	{ 0x8F76AFE0, 0, "gfx/env/desertdn.tga" },
+	{ 0x067C5E67, 0, "gfx/vgui/fonts/1600_title font.tga" },
+	{ 0x22C5C7A3, 0, "models/barnacle.mdl" },
+	{ 0xAE6B4E05, 0, "models/w_satchelt.mdl" },
+	{ 0x66B758F8, 0, "sound/hgrunt/hold!.wav" },
+	{ 0x317F2837, 0, "sound/otis/yourback.wav" },
+	{ 0x891C4675, 0, "models/brit_ammo.mdl" },
+	{ 0x22812DEC, 0, "sound/x/x_attack1.wav" },
+	{ 0x394A140B, 0, "sound/otis/doubt.wav" },
+	{ 0xE9589C80, 0, "sound/weapons/shock_fire.wav" },
+	{ 0x0A2095D7, 0, "sound/hgrunt/yeah.wav" },
+	{ 0x36F6C236, 0, "sound/player/pl_ladder4.wav" },
+	{ 0x134EAEC3, 0, "sound/rosenberg/ro_tele_final10.wav" },
+	{ 0x42747E80, 0, "overviews/dod_flash.txt" },
+	{ 0x803CFC48, 0, "gfx/env/dustbowlbk.tga" },
+	{ 0x55D52A8F, 0, "sound/vox/science.wav" },
+	{ 0xA8598151, 0, "sprites/weapon_deagle.txt" },
+	{ 0xECEE9A3C, 0, "sound/otis/candy.wav" },
+	{ 0xA90B499D, 0, "sound/otis/bring.wav" },
+	{ 0xF6EEBC48, 0, "sound/sentences/hev_19p.wav" },
+	{ 0x0440C8BC, 0, "sound/fgrunt/pain6.wav" },
+	{ 0x66CD92E6, 0, "sound/hgrunt/mother!.wav" },
+	{ 0xBDBE654B, 0, "gfx/env/2desertlf.bmp" },
+	{ 0x36611B38, 0, "sound/vox/your.wav" },
+	{ 0xF160EB87, 0, "sound/shocktrooper/shock_trooper_die1.wav" },
+	{ 0xE15BE446, 0, "gfx/env/cityft.tga" },
+	{ 0x25D13955, 0, "models/civ_scientist01.mdl" },
+	{ 0x38487215, 0, "gfx/env/neb1lf.tga" },
+	{ 0x257815FC, 0, "sound/sentences/nd0.wav" },
+	{ 0xBA92644B, 0, "sprites/bigspit.spr" },
+	{ 0xD6B3D72D, 0, "sound/player/death6.wav" },
+	{ 0x23A2D116, 0, "sound/ambience/lv_elvis.wav" },
+	{ 0xD233C02F, 0, "sound/drill/add10.wav" },
+	{ 0x2F08867E, 0, "sound/weapons/egon_windup2.wav" },
+	{ 0x21E4D2BC, 0, "sound/ambience/tankdrivein1.wav" },
+	{ 0x769B9827, 0, "sprites/gplayer.spr" },
+	{ 0x79235B73, 0, "gfx/env/xen9dn.tga" },
+	{ 0xEDA5B9F5, 0, "overviews/dmc_dm3.tga" },
+	{ 0x3CC57477, 0, "sound/scientist/sc_sec2_admin1.wav" },
+	{ 0xF4555DFB, 0, "models/w_isotopeboxt.mdl" },
+	{ 0x83DB0837, 0, "sound/sentences/hev_dmg3.wav" },
+	{ 0x30ECF8CB, 0, "sound/storm/thunder-theme.wav" },
+	{ 0xFD6FA060, 0, "sprites/wxplo1.spr" },
+	{ 0x7A1647D1, 0, "sound/vox/safety.wav" },
+	{ 0x01A1D174, 0, "sound/scientist/hellofreeman.wav" },
+	{ 0x134EF082, 0, "resource/cstrike_german.txt" },
+	{ 0x4D0B05D3, 0, "sound/scientist/c1a2_sci_1zomb.wav" },
+	{ 0xC0B19D39, 0, "resource/background/800_2_a_loading.tga" },
+	{ 0xB6C636A0, 0, "sound/player/pl_duct2.wav" },
+	{ 0x9C5A1CA9, 0, "sound/sentences/hg_cover4.wav" },
+	{ 0x08E48A69, 0, "sound/player/gasp1.wav" },
+	{ 0x368F9417, 0, "models/w_rpgammo_big.mdl" },
+	{ 0xF577654A, 0, "sound/hgrunt/formation!.wav" },
+	{ 0x29A518D4, 0, "sound/player/pl_step4.wav" },
+	{ 0xCB780613, 0, "sound/sentences/hev_c17.wav" },
+	{ 0x3210CA1A, 0, "gfx/env/snowlf.tga" },
+	{ 0x3C8D8904, 0, "sound/weapons/whizz3.wav" },
+	{ 0xB84FF7B5, 0, "models/mapmodels/flags.mdl" },
+	{ 0xECFB5710, 0, "sound/weapons/grenade_hit1.wav" },
+	{ 0x705554DB, 0, "sprites/bexplo.spr" },
+	{ 0x8F2DAE8F, 0, "sound/buttons/blip1.wav" },
+	{ 0x3F2CE1DC, 0, "sound/vox/thirteen.wav" },
+	{ 0xF48D2D92, 0, "sound/hgrunt/no!.wav" },
+	{ 0x306DD6A6, 0, "sound/weapons/gewehr_reload_clipout.wav" },
+	{ 0x766FD19B, 0, "sound/garg/gar_pain1.wav" },
+	{ 0xC2307586, 0, "models/p_colt.mdl" },
+	{ 0x6E62996C, 0, "sound/fans/fan4off.wav" },
+	{ 0x3ED1AF5D, 0, "sprites/obj_icons/icon_obj_truck_axis.spr" },
+	{ 0xB86F90FE, 0, "sound/weapons/spike1.wav" },
+	{ 0xBB6C4892, 0, "sound/vox/i.wav" },
+	{ 0xA1350123, 0, "sound/buttons/button2.wav" },
+	{ 0x3BE07D31, 0, "sound/vox/entry.wav" },
+	{ 0xE1F9B1F2, 0, "sound/gonarch/gon_sack1.wav" },
+	{ 0x1621A9C8, 0, "overviews/cs_747.bmp" },
+	{ 0xF3071B22, 0, "sound/scientist/hideglasses.wav" },
+	{ 0xD0AF1695, 0, "sound/shocktrooper/hyu.wav" },
+	{ 0xD25D0F62, 0, "sprites/glow_red.spr" },
+	{ 0x8E64D84E, 0, "sound/otis/imhit.wav" },
+	{ 0xD10705DA, 0, "sound/vox/effect.wav" },
+	{ 0x0D2654C5, 0, "models/intro_otis.mdl" },
+	{ 0xEDDF022F, 0, "gfx/env/tsccity_rt.tga" },
+	{ 0xF7558559, 0, "sound/otis/quarter.wav" },
+	{ 0x6E556C56, 0, "gfx/env/badlandsft.tga" },
+	{ 0xED972679, 0, "overviews/dmc_dm3.txt" },
+	{ 0xF92912B2, 0, "sound/scientist/sc_tele_work1.wav" },
+	{ 0x8D3A14C1, 0, "sprites/of_nv_a.spr" },
+	{ 0xA1F8822F, 0, "sound/vox/flooding.wav" },
+	{ 0xD93E10AD, 0, "sound/sentences/c1a0_14.wav" },
+	{ 0x01552D3E, 0, "sound/fgrunt/nohostiles.wav" },
+	{ 0xA1245D55, 0, "models/v_357.mdl" },
+	{ 0x7BA75C1C, 0, "models/torch1.mdl" },
+	{ 0x0C6D7459, 0, "gfx/env/cliffrt.tga" },
+	{ 0xBCB8DFA4, 0, "models/w_30cal_box.mdl" },
+	{ 0x3FF4880D, 0, "sound/weapons/boltup.wav" },
+	{ 0x6D9A7186, 0, "sound/nihilanth/nil_thelast.wav" },
+	{ 0xEA49BF30, 0, "models/mapmodels/flo_becken.mdl" },
+	{ 0x98AE366C, 0, "sprites/obj_icons/icon_obj_88_neutral.spr" },
+	{ 0xE97897EB, 0, "sound/weapons/ak47_clipout.wav" },
+	{ 0xF7604A49, 0, "models/v_saw.mdl" },
+	{ 0x076A2998, 0, "models/rope32.mdl" },
+	{ 0x3EA64C2F, 0, "sound/scientist/c1a0_sci_samp.wav" },
+	{ 0x38EAE45C, 0, "sound/barney/c2a4_ba_arg5a.wav" },
+	{ 0xF8CB2E8E, 0, "models/mapmodels/jed_kubelwagen_camo.mdl" },
+	{ 0x06BA67C6, 0, "sound/hgrunt/north!.wav" },
+	{ 0xA710FF24, 0, "sound/fgrunt/alert.wav" },
+	{ 0xCCC37BF6, 0, "models/w_sqknestt.mdl" },
+	{ 0x5859F23B, 0, "models/computergibs.mdl" },
+	{ 0x6C8A9FFA, 0, "sound/ambience/forestbridge.wav" },
+	{ 0x2CF1D7CB, 0, "sound/ba_holo/tr_holo_pushbox.wav" },
+	{ 0x58C111DA, 0, "sound/vox/walk.wav" },
+	{ 0x8EA993FE, 0, "sound/vox/alien.wav" },
+	{ 0x150B8A7A, 0, "sprites/dirt.spr" },
+	{ 0x79DBBCFC, 0, "sound/sentences/hev_f8.wav" },
+	{ 0xC3EA1040, 0, "models/sphere.mdl" },
+	{ 0x3A7707A4, 0, "sound/player/gerflankleft.wav" },
+	{ 0x5CE8FF6F, 0, "sound/sentences/hg_clear11.wav" },
+	{ 0x8812238C, 0, "sound/ambience/pulsemachine.wav" },
+	{ 0x0C2A2E16, 0, "sound/sentences/dc1.wav" },
+	{ 0x15737217, 0, "gfx/vgui/marker_arrow_e.tga" },
+	{ 0x48F09069, 0, "models/v_c4.mdl" },
+	{ 0x9ED1ACCC, 0, "models/w_batteryl.mdl" },
+	{ 0x6AAA2C70, 0, "sound/tentacle/te_strike2.wav" },
+	{ 0x7F95F5E8, 0, "sound/sentences/c2a1_2.wav" },
+	{ 0xBF20F770, 0, "sound/garg/gar_step2.wav" },
+	{ 0x3BC400A2, 0, "sound/vox/forms.wav" },
+	{ 0x17BE918C, 0, "sound/items/suitcharge1.wav" },
+	{ 0x50EDBB04, 0, "models/player/medic/medic.mdl" },
+	{ 0x55E1F0A8, 0, "sound/ambience/3dmeagle.wav" },
+	{ 0x864AEBD9, 0, "sound/plats/platmove1.wav" },
+	{ 0x246D1805, 0, "sound/aslave/slv_word7.wav" },
+	{ 0x36EF4752, 0, "models/p_k98s_l.mdl" },
+	{ 0x0281FBE2, 0, "overviews/dustbowl.tga" },
+	{ 0xAF294533, 0, "sprites/weapon_sg550.txt" },
+	{ 0x92D9C618, 0, "models/player/massn/massn.mdl" },
+	{ 0x68B02DE6, 0, "sound/intro/w6_watchit.wav" },
+	{ 0x0DA8FE59, 0, "sprites/bolt1.spr" },
+	{ 0x95DCA9AB, 0, "sound/misc/b1.wav" },
+	{ 0xC609E227, 0, "sound/scientist/ihearsomething.wav" },
+	{ 0x9DFA0CBA, 0, "gfx/env/sky_blu_dn.bmp" },
+	{ 0x11AA9EC3, 0, "sound/sentences/hg_idle3.wav" },
+	{ 0x5079D743, 0, "sound/weapons/reload3.wav" },
+	{ 0x8E7BB6C1, 0, "models/mapmodels/wood_barrel1.mdl" },
+	{ 0xA4874F33, 0, "sprites/iflagred.spr" },
+	{ 0x5E2B6416, 0, "sound/misc/main_elevator_fall.wav" },
+	{ 0x901DDCDC, 0, "models/pi_stlamp.mdl" },
+	{ 0xBA4F7908, 0, "resource/icon_play.tga" },
+	{ 0xDE8796F5, 0, "sound/weapons/splauncher_fire.wav" },
+	{ 0x147F19EC, 0, "sound/tride/c0a0_tr_jobs.wav" },
+	{ 0x5C1F409D, 0, "sound/agrunt/ag_die1.wav" },
+	{ 0x0DC3FA86, 0, "sound/scientist/howinteresting.wav" },
+	{ 0x3325F724, 0, "models/hgrunt_torch02.mdl" },
+	{ 0x97E4F74D, 0, "sound/doors/doormove9.wav" },
+	{ 0xE92EA4DE, 0, "sound/weapons/clampdown.wav" },
+	{ 0xFD0A1A0E, 0, "sound/scientist/c3a2_sci_2glu.wav" },
+	{ 0xA5AB3D79, 0, "sound/vox/minimum.wav" },
+	{ 0x885004D4, 0, "sound/hgrunt/sweep.wav" },
+	{ 0x68FE1503, 0, "models/w_famas.mdl" },
+	{ 0x8D493C09, 0, "sound/player/germoveupmg.wav" },
+	{ 0x307D1DE4, 0, "models/v_colt.mdl" },
+	{ 0x631CB2AE, 0, "sound/weapons/tink1.wav" },
+	{ 0x61669532, 0, "resource/ricochet_french.txt" },
+	{ 0xF7FCB030, 0, "sound/player/britusegrenades.wav" },
+	{ 0xC961D893, 0, "models/p_mg42sr.mdl" },
+	{ 0xAF52A749, 0, "sound/common/npc_step4.wav" },
+	{ 0x9A6D4DCB, 0, "sound/player/pl_slosh4.wav" },
+	{ 0x55CA2734, 0, "sound/ambience/bigwarning.wav" },
+	{ 0xB2C15C0D, 0, "sound/buttons/spark3.wav" },
+	{ 0xBEDCEC0C, 0, "sound/ops/of2a5_bo01.wav" },
+	{ 0xED4DAAD7, 0, "sound/shocktrooper/wirt.wav" },
+	{ 0x94AD3FF2, 0, "sound/fvox/seek_medic.wav" },
+	{ 0x8CD879BD, 0, "logos/8ball1.bmp" },
+	{ 0x078FD26C, 0, "overviews/dod_forest.bmp" },
+	{ 0xC4895723, 0, "models/mapmodels/charlie_plans.mdl" },
+	{ 0x70BA779E, 0, "sound/scientist/notsure.wav" },
+	{ 0x296A599E, 0, "models/intro_otis01.mdl" },
+	{ 0xFE0F3982, 0, "sound/debris/beamstart6.wav" },
+	{ 0x12FD774B, 0, "sprites/640hudof02.spr" },
+	{ 0x431B068B, 0, "sound/vox/rocket.wav" },
+	{ 0x43C3C1F1, 0, "sprites/xbeam5.spr" },
+	{ 0x6C3539B4, 0, "sound/vox/surrounded.wav" },
+	{ 0x229C7EC0, 0, "sound/ichy/ichy_idle3.wav" },
+	{ 0x37827B38, 0, "sprites/kexplosion1.spr" },
+	{ 0x7E5E1978, 0, "sound/sentences/hev_shotgun.wav" },
+	{ 0x64FE6881, 0, "sound/fgrunt/sniper.wav" },
+	{ 0x3C0A864E, 0, "sprites/3dmflaora.spr" },
+	{ 0xAECCC7AB, 0, "sound/otis/noway.wav" },
+	{ 0xA612E1B3, 0, "sound/scientist/odorfromyou.wav" },
+	{ 0xE6B86B58, 0, "gfx/vgui/xm1014.tga" },
+	{ 0xF46C8E35, 0, "sound/scientist/scream4.wav" },
+	{ 0xB70A2D5A, 0, "sound/leech/leech_bite1.wav" },
+	{ 0xEB072AA2, 0, "sound/zombie/claw_miss2.wav" },
+	{ 0xBC99F5C1, 0, "sound/fgrunt/death3.wav" },
+	{ 0x9516F596, 0, "models/quad.mdl" },
+	{ 0x5D2DADDF, 0, "sound/vox/question.wav" },
+	{ 0x6B287A4F, 0, "sound/debris/bustglass2.wav" },
+	{ 0xD16DB3E2, 0, "models/p_30calsr.mdl" },
+	{ 0xDFAC1958, 0, "sound/weapons/p90_cliprelease.wav" },
+	{ 0xC45F8A99, 0, "models/base_flag.mdl" },
+	{ 0x9686DBE1, 0, "sound/hgrunt/of.wav" },
+	{ 0x106D4FE9, 0, "sound/plats/elevmove2.wav" },
+	{ 0x8831D20B, 0, "overviews/dod_flash.bmp" },
+	{ 0xA4693AE8, 0, "sound/tride/c0a0_tr_tourn.wav" },
+	{ 0xA741A0D1, 0, "gfx/vgui/640_drillsgt.tga" },
+	{ 0xC1B06BCA, 0, "gfx/env/morningdew_rt.tga" },
+	{ 0xDCB8DC7F, 0, "models/wire_black16.mdl" },
+	{ 0x4EEA6E31, 0, "sound/vox/hundred.wav" },
+	{ 0x84503BB8, 0, "sprites/hudrlsm.spr" },
+	{ 0x8F0ACFA5, 0, "sound/sentences/c2a2_6.wav" },
+	{ 0xB1EC5206, 0, "models/w_mortar.mdl" },
+	{ 0x849A12B3, 0, "models/mapmodels/foot_locker.mdl" },
+	{ 0xDC36B52E, 0, "models/mapmodels/hono.mdl" },
+	{ 0xFBE2A4F6, 0, "sound/sentences/hev_gr9.wav" },
+	{ 0x3FF38563, 0, "sound/sentences/hg_cover2.wav" },
+	{ 0x21470693, 0, "sound/vox/door.wav" },
+	{ 0x3F535941, 0, "sound/sentences/hev_c24.wav" },
+	{ 0x4652BC9C, 0, "sound/hgrunt/stay!.wav" },
+	{ 0xE9F82839, 0, "overviews/as_oilrig.txt" },
+	{ 0x95508D0C, 0, "sound/sentences/c1a0_13.wav" },
+	{ 0x29EF130B, 0, "sound/scientist/c1a0_sci_itsyou.wav" },
+	{ 0x36A38A39, 0, "gfx/detail/dt_brick.tga" },
+	{ 0x0D63EA5E, 0, "models/player/hgrunt/hgrunt.mdl" },
+	{ 0x402B44E8, 0, "gfx/env/morninglf.bmp" },
+	{ 0xDF37B011, 0, "sprites/mapmarkers/arrow_sw.spr" },
+	{ 0xC68F7FBA, 0, "models/mapmodels/me262.mdl" },
+	{ 0x9DCDD62B, 0, "sound/holo/tr_holo_duck.wav" },
+	{ 0x3353D2EB, 0, "gfx/env/desertup.tga" },
+	{ 0xC0BCA5FE, 0, "sound/scientist/c3a1_sci_dome.wav" },
+	{ 0xCFCC4C96, 0, "sound/hgrunt/fivemeters.wav" },
+	{ 0x9BBFA986, 0, "sound/garg/gar_attack2.wav" },
+	{ 0xF47A74CD, 0, "models/garbagegibs.mdl" },
+	{ 0xD58D2B88, 0, "gfx/env/xen9rt.bmp" },
+	{ 0xA4D0CF63, 0, "sound/holo/holostn15.wav" },
+	{ 0x624B53D1, 0, "sprites/ballsmoke.spr" },
+	{ 0x5E0D50E1, 0, "gfx/env/dustbowlup.bmp" },
+	{ 0x6BB4B327, 0, "models/wire_blue8.mdl" },
+	{ 0xFAEF6ECA, 0, "sprites/tf_weapon_flamethrower.txt" },
+	{ 0x94CEC0E9, 0, "models/w_longjumpt.mdl" },
+	{ 0x73536C5A, 0, "models/shells.mdl" },
+	{ 0x4474F4B9, 0, "models/mapmodels/bell.mdl" },
+	{ 0xA050131D, 0, "sprites/mapsprites/c2_allied_target.spr" },
+	{ 0xBB236B76, 0, "sound/ambience/rocket_groan2.wav" },
+	{ 0x9A893EE5, 0, "sound/barney/checkwounds.wav" },
+	{ 0x004C1AB0, 0, "models/g_armor.mdl" },
+	{ 0x964AF3B0, 0, "sound/drill/add15.wav" },
+	{ 0xF52C6131, 0, "sound/sentences/c3a1_0.wav" },
+	{ 0x6F328B78, 0, "sound/player/pl_organic3.wav" },
+	{ 0xC50913D8, 0, "sound/drill/add02.wav" },
+	{ 0x2DC8FC2D, 0, "sound/barney/hearsomething2.wav" },
+	{ 0x1A9510A4, 0, "sound/scientist/sc_maint.wav" },
+	{ 0x96DED5BD, 0, "gfx/vgui/640_gina.tga" },
+	{ 0x7AFB8C7D, 0, "sound/de_torn/tk_steam.wav" },
+	{ 0xCCCB66C1, 0, "sound/sentences/hg_answer5.wav" },
+	{ 0x1FBBFF60, 0, "sound/hgrunt/eightymeters.wav" },
+	{ 0x3ACD4522, 0, "sound/headcrab/hc_attack2.wav" },
+	{ 0xD32BB7DA, 0, "sound/weapons/desert_eagle_fire.wav" },
+	{ 0x43C09163, 0, "models/w_webley.mdl" },
+	{ 0xE0BE39D7, 0, "sound/weapons/sg550_clipin.wav" },
+	{ 0x284AC150, 0, "sound/scientist/lambdalab.wav" },
+	{ 0x59953D22, 0, "sound/plats/bigstop2.wav" },
+	{ 0x6F152444, 0, "sound/radio/ct_affirm.wav" },
+	{ 0xF6F7C8B4, 0, "models/mapmodels/dinner_table1.mdl" },
+	{ 0x00FAAC30, 0, "gfx/detail/dt_rock1.tga" },
+	{ 0x1CE83A0E, 0, "sound/vox/exchange.wav" },
+	{ 0x3B34E8F8, 0, "sound/scientist/c2a4_sci_surgery.wav" },
+	{ 0x50AA71B7, 0, "gfx/env/2desertft.bmp" },
+	{ 0xB5BB395B, 0, "overviews/dod_kraftstoff.bmp" },
+	{ 0x160A2A4C, 0, "sound/sentences/hg_clear10.wav" },
+	{ 0x4F42BF0D, 0, "sound/weapons/gren_cock1.wav" },
+	{ 0xC658CF7C, 0, "sound/holo/tr_holo_breath.wav" },
+	{ 0xD573CECF, 0, "resource/icon_steam_disabled.tga" },
+	{ 0x7BFED696, 0, "models/mbarrel.mdl" },
+	{ 0xEE01546B, 0, "sound/player/pl_organic2.wav" },
+	{ 0x61A1D111, 0, "gfx/env/city1rt.tga" },
+	{ 0x83CBED1E, 0, "sound/scientist/sc_ok1.wav" },
+	{ 0x7E3D7B50, 0, "sprites/hltv_icons.spr" },
+	{ 0xF570A92D, 0, "sprites/blast.spr" },
+	{ 0x0833138D, 0, "sound/weapons/grenade_hit2.wav" },
+	{ 0x44CB620C, 0, "sound/vox/farthest.wav" },
+	{ 0x20603B21, 0, "sound/weapons/colt_reload_clipin.wav" },
+	{ 0xFC508016, 0, "models/v_p228.mdl" },
+	{ 0xE9424598, 0, "models/p_umbrella.mdl" },
+	{ 0xB517B308, 0, "models/xen_rockgib_small.mdl" },
+	{ 0xF8D76E5F, 0, "sound/hgrunt/position.wav" },
+	{ 0x2A12A880, 0, "sound/fvox/get_shotgun.wav" },
+	{ 0xBB8A078E, 0, "sound/vox/nice.wav" },
+	{ 0x0B854F9B, 0, "sprites/effects/debris_leaf1.spr" },
+	{ 0x9DAE1BB1, 0, "gfx/env/sildom2lf.tga" },
+	{ 0x0CF37497, 0, "sound/sentences/efire0.wav" },
+	{ 0xEFC31839, 0, "sound/rosenberg/ro_scared2.wav" },
+	{ 0x894E41DC, 0, "sprites/explode02.spr" },
+	{ 0xDA6EB437, 0, "sound/weapons/mortar_hit1.wav" },
+	{ 0xEF75B8CC, 0, "sound/fgrunt/grenade.wav" },
+	{ 0x5B03027D, 0, "sound/ambience/fd_tree.wav" },
+	{ 0x893A21EE, 0, "sound/shockroach/shock_jump2.wav" },
+	{ 0xB251B6E3, 0, "sound/powerup.wav" },
+	{ 0x1CC841E8, 0, "maps/dod_flugplatz.txt" },
+	{ 0x31206755, 0, "sound/player/gerflankright.wav" },
+	{ 0x75868B12, 0, "sprites/zbeam2.spr" },
+	{ 0x508B3881, 0, "sound/r_tele1.wav" },
+	{ 0xC1F7455D, 0, "gfx/vgui/round_corner_small_ne.tga" },
+	{ 0xC7CF5752, 0, "gfx/env/morningbk.tga" },
+	{ 0xA6094D07, 0, "sound/ambience/waterfall1.wav" },
+	{ 0x7A77A9C6, 0, "sound/ops/of2a5_bo03.wav" },
+	{ 0x6112E94E, 0, "gfx/vgui/clsimages/cls_30cal.tga" },
+	{ 0x13AB0528, 0, "sound/tentacle/te_death2.wav" },
+	{ 0x1A7100E7, 0, "sound/fgrunt/death1.wav" },
+	{ 0xA337012F, 0, "models/w_mp5.mdl" },
+	{ 0x80A636C6, 0, "models/support2.mdl" },
+	{ 0x0F2BE89F, 0, "sound/weapons/biggun2.wav" },
+	{ 0xAB8CC0D4, 0, "maps/cs_backalley.txt" },
+	{ 0xD8008CC7, 0, "sound/vox/severe.wav" },
+	{ 0x7BDBC411, 0, "sound/weapons/mortar_hit3.wav" },
+	{ 0xDC14C4C6, 0, "sound/barney/badfeeling.wav" },
+	{ 0xFA4C4E61, 0, "sound/barney/waitin.wav" },
+	{ 0xABA6CA43, 0, "sound/vox/freeman.wav" },
+	{ 0x9E46DF18, 0, "sprites/weapon_supernail.txt" },
+	{ 0x450DB1E2, 0, "sound/otis/chump.wav" },
+	{ 0xA94806AC, 0, "sound/houndeye/he_attack1.wav" },
+	{ 0xE3C835E8, 0, "sound/weapons/whizz7.wav" },
+	{ 0x57828E3B, 0, "models/p_snailgun2.mdl" },
+	{ 0x6C0F534B, 0, "sound/barney/yup.wav" },
+	{ 0x52156758, 0, "sprites/radio.spr" },
+	{ 0x8CA9ED0D, 0, "sound/scientist/stop1.wav" },
+	{ 0x00C920DF, 0, "gfx/vgui/640_freeze.tga" },
+	{ 0x086D9BB3, 0, "sound/sentences/c1a3_2.wav" },
+	{ 0x4A952469, 0, "sound/geneworm/geneworm_attack_mounted_gun.wav" },
+	{ 0x81963306, 0, "sound/pitworm/pit_worm_alert(scream).wav" },
+	{ 0x5844C4E5, 0, "models/massn02.mdl" },
+	{ 0xB457EE6E, 0, "sound/sentences/bloop.wav" },
+	{ 0xAA39D999, 0, "sound/ops/of6a2_bo03.wav" },
+	{ 0xD0425F28, 0, "sound/fgrunt/of2a6_fg02.wav" },
+	{ 0xDA3CE6B5, 0, "sound/shocktrooper/ku.wav" },
+	{ 0xCD9F569A, 0, "resource/ricochet_english.txt" },
+	{ 0x3621D264, 0, "sound/sentences/ea4.wav" },
+	{ 0xE02D51F8, 0, "models/w_garand.mdl" },
+	{ 0x2DB59F80, 0, "models/pow_fast.mdl" },
+	{ 0xF9EEBDAF, 0, "sound/weapons/mortarhit.wav" },
+	{ 0xB9EC8E50, 0, "sound/barney/ba_whatyou.wav" },
+	{ 0x648A036B, 0, "sprites/bmp/tffire11.bmp" },
+	{ 0xFDA52B9D, 0, "sound/sentences/hev_c13t.wav" },
+	{ 0x9191E3D7, 0, "sound/weapons/asscan3.wav" },
+	{ 0x05F4A1B8, 0, "models/p_webley.mdl" },
+	{ 0x589E643E, 0, "models/p_penguin.mdl" },
+	{ 0x17C05210, 0, "sound/leech/leech_bite3.wav" },
+	{ 0x1DB7B05D, 0, "sound/fgrunt/sirtexas.wav" },
+	{ 0x14ED0602, 0, "sound/player/britgrenade.wav" },
+	{ 0x7B25FB62, 0, "sound/scientist/c2a3_sci_icky.wav" },
+	{ 0xA4888DCD, 0, "sound/vox/six.wav" },
+	{ 0x35A7F6A1, 0, "sound/drill/oc103.wav" },
+	{ 0x8A56DA25, 0, "models/v_mg34.mdl" },
+	{ 0x86EE242D, 0, "sprites/weapon_p228.txt" },
+	{ 0xDE6E8C28, 0, "sound/drill/livefire07.wav" },
+	{ 0x29D5195D, 0, "sound/weapons/c4_beep2.wav" },
+	{ 0x59D5D504, 0, "sound/barney/seeya.wav" },
+	{ 0x757BD611, 0, "sprites/weapon_crossbow.txt" },
+	{ 0xF2279388, 0, "models/p_deagle.mdl" },
+	{ 0x5B0CECDA, 0, "sprites/obj_icons/icon_obj_radio_allies.spr" },
+	{ 0xDC6315FA, 0, "sound/barney/ba_dontmake.wav" },
+	{ 0xA336EB06, 0, "sound/holo/tr_holo_done.wav" },
+	{ 0x4CB6616E, 0, "sound/vox/twelve.wav" },
+	{ 0x555A74C3, 0, "sound/scientist/sci_fear14.wav" },
+	{ 0x8319CBEB, 0, "sound/sentences/c1a2_3.wav" },
+	{ 0xDFE7A048, 0, "models/v_pipe_wrench.mdl" },
+	{ 0x2E3AD5C9, 0, "sound/weapons/explode3.wav" },
+	{ 0xFF8D1A72, 0, "sound/ambience/tankidle2.wav" },
+	{ 0x53A55F89, 0, "sound/ba_holo/tr_holo_runstart.wav" },
+	{ 0xE0D8920F, 0, "sound/vox/secondary.wav" },
+	{ 0x34A33756, 0, "sound/ambience/forestmortar.wav" },
+	{ 0x2251FB6B, 0, "sound/sentences/hev_12p.wav" },
+	{ 0xAE35CA15, 0, "sound/gonome/gonome_death2.wav" },
+	{ 0x9BC0187E, 0, "models/mapmodels/ouitz_hill1.mdl" },
+	{ 0x50764E7C, 0, "overviews/frenzy.txt" },
+	{ 0xD271C3CC, 0, "sound/vox/engaged.wav" },
+	{ 0x3C12B981, 0, "gfx/detail/dt_ground4.tga" },
+	{ 0xB88790DD, 0, "sound/player/boots1.wav" },
+	{ 0xB43D117A, 0, "sound/fgrunt/freaks.wav" },
+	{ 0x207B81C2, 0, "sound/weapons/scout_clipout.wav" },
+	{ 0xC68A2020, 0, "sound/fgrunt/nomovement.wav" },
+	{ 0xC63530C4, 0, "sound/sentences/hev_heal8.wav" },
+	{ 0x1178B399, 0, "sound/hgrunt/freeman!.wav" },
+	{ 0x34E4162A, 0, "models/p_hgun.mdl" },
+	{ 0x356BC58F, 0, "sound/hgrunt/hot.wav" },
+	{ 0x23DDFC41, 0, "sprites/weapon_tripmine.txt" },
+	{ 0xD732B177, 0, "sound/hgrunt/private.wav" },
+	{ 0x865DB6D1, 0, "sound/vox/without.wav" },
+	{ 0x4753C5C9, 0, "sound/hgrunt/lets!.wav" },
+	{ 0x999170C0, 0, "sound/fgrunt/of5a1_fg02.wav" },
+	{ 0xC4C358F9, 0, "models/scientist02.mdl" },
+	{ 0x65604FDC, 0, "sound/drill/oc108.wav" },
+	{ 0x2D2F169C, 0, "models/scientist_cower.mdl" },
+	{ 0x99881190, 0, "sound/rosenberg/ro_tele_final11.wav" },
+	{ 0xCFF7CA93, 0, "sprites/tongue.spr" },
+	{ 0xCF41AF30, 0, "gfx/vgui/icntlk_sv.tga" },
+	{ 0xF15373ED, 0, "sound/hgrunt/niner!.wav" },
+	{ 0x1BF0A53C, 0, "sound/player/drown1.wav" },
+	{ 0x06FC191B, 0, "models/pi_bush.mdl" },
+	{ 0x82F9E6D8, 0, "models/player/ctf_scientist/ctf_scientist.mdl" },
+	{ 0xEFB6D632, 0, "sound/weapons/ump45-1.wav" },
+	{ 0xF07864EE, 0, "resource/tfc_german.txt" },
+	{ 0x2D21BEAE, 0, "sound/vox/maintenance.wav" },
+	{ 0x31E8611E, 0, "overviews/de_piranesi.bmp" },
+	{ 0x245378F1, 0, "sound/otis/tomb.wav" },
+	{ 0x4137103F, 0, "models/p_30cal.mdl" },
+	{ 0x92661435, 0, "sound/player/die2.wav" },
+	{ 0x54350EF3, 0, "sound/rosenberg/ro_pain4.wav" },
+	{ 0x75C64098, 0, "sound/ichy/ichy_pain5.wav" },
+	{ 0x40884D30, 0, "sound/plats/elevbell1.wav" },
+	{ 0x8B322968, 0, "gfx/env/greenlf.tga" },
+	{ 0x3D6B3AE3, 0, "sprites/yelflare2.spr" },
+	{ 0xE1758879, 0, "sound/hgrunt/hg_canal2.wav" },
+	{ 0xFA5CB68E, 0, "sound/sentences/c1a1_3.wav" },
+	{ 0x8B710508, 0, "sound/player/gerprepare.wav" },
+	{ 0xF8907AF6, 0, "models/helmet_allie_para_med.mdl" },
+	{ 0xAE01736D, 0, "models/mapmodels/steel_supports1.mdl" },
+	{ 0xC1CECCC1, 0, "sound/ambience/the_horror1.wav" },
+	{ 0x70EE9FD9, 0, "sound/pitdrone/pit_drone_die1.wav" },
+	{ 0xF1EE81F8, 0, "gfx/vgui/fonts/640_scoreboard text.tga" },
+	{ 0x4DACDD39, 0, "sound/vox/found.wav" },
+	{ 0x7E31FE61, 0, "sound/hgrunt/two!.wav" },
+	{ 0xDE8B27FC, 0, "sound/vox/barracks.wav" },
+	{ 0x1DB8AD1C, 0, "gfx/vgui/fonts/1152_team info text.tga" },
+	{ 0x9F4DB3FE, 0, "gfx/vgui/clsimages/cls_bar.tga" },
+	{ 0xC8553F1F, 0, "sound/fgrunt/hellout.wav" },
+	{ 0x332EB731, 0, "gfx/env/dustbowldn.tga" },
+	{ 0xAFD6D531, 0, "sound/gonarch/gon_childdie2.wav" },
+	{ 0xCA454589, 0, "models/w_medkitt.mdl" },
+	{ 0x866EC682, 0, "gfx/env/alien2dn.tga" },
+	{ 0x5DF0C17E, 0, "sprites/glow04.spr" },
+	{ 0x574B1A97, 0, "sound/scientist/sc_yard_box2.wav" },
+	{ 0x12600DFA, 0, "sound/gman/gman_mumble1.wav" },
+	{ 0xD3C76649, 0, "sound/sentences/ed0.wav" },
+	{ 0x4558C713, 0, "sound/hgrunt/this!.wav" },
+	{ 0x600137CF, 0, "sound/vox/dish.wav" },
+	{ 0x841B947F, 0, "sound/scientist/sci_somewhere.wav" },
+	{ 0x4830082F, 0, "resource/menu_steam_with_icon.tga" },
+	{ 0x71E651B1, 0, "sound/ambience/crtnoise.wav" },
+	{ 0xDC74B4BB, 0, "sound/sentences/hev_c22.wav" },
+	{ 0xEE4FE833, 0, "sound/otis/hey.wav" },
+	{ 0x93854083, 0, "sound/barney/ba_attack2.wav" },
+	{ 0xD21DA719, 0, "sound/sentences/power_off.wav" },
+	{ 0x5B906A9B, 0, "sound/weapons/whizz13.wav" },
+	{ 0x025734B0, 0, "sound/bullchicken/bc_idle2.wav" },
+	{ 0xC70E3B6C, 0, "models/v_enfield_scoped.mdl" },
+	{ 0x0913C22B, 0, "sound/pitworm/pit_worm_idle3.wav" },
+	{ 0x4C27720F, 0, "sprites/obj_icons/icon_obj_docs_axis.spr" },
+	{ 0xAAD9139E, 0, "sound/vox/unlocked.wav" },
+	{ 0xB7792ED6, 0, "sound/barney/mrfreeman.wav" },
+	{ 0xDF24FB9D, 0, "sound/barney/ba_tomb.wav" },
+	{ 0x9512E7D8, 0, "servers/serverbrowser_english.txt" },
+	{ 0xA2EA5196, 0, "gfx/vgui/icntlk_ban.tga" },
+	{ 0x4F3C2242, 0, "models/mapmodels/jed_pines_1a.mdl" },
+	{ 0xE69BF9EB, 0, "models/metalplategibs_green.mdl" },
+	{ 0x204DAAE1, 0, "sound/player/pl_tile1.wav" },
+	{ 0x73AE16D2, 0, "sound/sentences/hev_gr10.wav" },
+	{ 0x75D7C2EE, 0, "sound/fgrunt/hear.wav" },
+	{ 0xAEDF0127, 0, "sound/bullchicken/bc_attack1.wav" },
+	{ 0xF7195F8C, 0, "models/w_silencer.mdl" },
+	{ 0xA168DDFD, 0, "sound/sentences/hev_heal7.wav" },
+	{ 0x7FB5717B, 0, "sound/hgrunt/gr_alert1.wav" },
+	{ 0xB96F2BB4, 0, "sound/ambience/birds2.wav" },
+	{ 0xC3AC1B41, 0, "sound/rosenberg/ro_stop2.wav" },
+	{ 0xD6F83889, 0, "gfx/vgui/fonts/1152_scoreboard title text.tga" },
+	{ 0xD286D699, 0, "sound/ambience/dodambience2.wav" },
+	{ 0x53169BBB, 0, "logos/v_1.bmp" },
+	{ 0x0B5D22DE, 0, "sprites/brit_camera.spr" },
+	{ 0x17AA02E7, 0, "sound/ambience/flies.wav" },
+	{ 0xE02C7D8C, 0, "sound/pitdrone/pit_drone_hunt1.wav" },
+	{ 0x2286A3B3, 0, "sprites/xpl_001.spr" },
+	{ 0x2EAAE87D, 0, "sound/fans/fan5off.wav" },
+	{ 0x2AC08A16, 0, "sprites/640hud20.spr" },
+	{ 0x8C227D22, 0, "models/hostage06.mdl" },
+	{ 0x34C02D4A, 0, "sound/sentences/c2a1_8.wav" },
+	{ 0xD713A2C2, 0, "sound/zombie/zo_attack2.wav" },
+	{ 0x9ACA07FD, 0, "sprites/cnt1.spr" },
+	{ 0x56BECFEA, 0, "sound/houndeye/he_blast3.wav" },
+	{ 0x8E8FD38A, 0, "sprites/bs_hud.spr" },
+	{ 0x2AAE86F1, 0, "sound/ctf/civ_flag_capture.wav" },
+	{ 0x9D769571, 0, "overviews/de_vertigo.bmp" },
+	{ 0x61A64B63, 0, "sound/fvox/evacuate_area.wav" },
+	{ 0x1C829029, 0, "models/v_galil.mdl" },
+	{ 0x89910A9F, 0, "sprites/320_0bounce.spr" },
+	{ 0x174035F3, 0, "sound/vox/whiskey.wav" },
+	{ 0x8A0F9D19, 0, "sound/scientist/bodydrop4.wav" },
+	{ 0x5D8F700F, 0, "maps/cs_italy.txt" },
+	{ 0x4B78E423, 0, "sprites/scope_k43_soft.spr" },
+	{ 0x10BDF2B3, 0, "sound/rosenberg/_comma.wav" },
+	{ 0xA0DD1455, 0, "sound/player/pl_long_jump.wav" },
+	{ 0x495BD005, 0, "sound/player/pl_metal2.wav" },
+	{ 0x01706E78, 0, "sound/turret/tu_die2.wav" },
+	{ 0xAEF8D31A, 0, "gfx/env/nightrt.bmp" },
+	{ 0xD7C29A87, 0, "sprites/tile.spr" },
+	{ 0x373D176D, 0, "sound/fvox/get_44pistol.wav" },
+	{ 0x3CB5975C, 0, "sound/vox/ventillation.wav" },
+	{ 0x7E5921A0, 0, "gfx/env/sky_blu_bk.tga" },
+	{ 0x186C8BD5, 0, "sound/gman/gman_wise.wav" },
+	{ 0xCD6A80BC, 0, "sound/barney/c1a4_ba_wisp.wav" },
+	{ 0xEFE63942, 0, "sound/hgrunt/c2a5_hg_lebuz.wav" },
+	{ 0x368ADDB5, 0, "sound/weapons/bullet_hit2.wav" },
+	{ 0x0E60259F, 0, "sound/misc/osprey_takeoff.wav" },
+	{ 0x2F22AA60, 0, "sound/vox/c.wav" },
+	{ 0x3AA4D1E5, 0, "sprites/obj_icons/dod_saints/icon_obj_custom1_neutral.spr" },
+	{ 0xC1A6177A, 0, "sound/sentences/c1a0_6.wav" },
+	{ 0x34CD6946, 0, "gfx/vgui/usp45.tga" },
+	{ 0xB4BDD29B, 0, "sound/hgrunt/gr_step1.wav" },
+	{ 0x70281123, 0, "sound/vox/two.wav" },
+	{ 0x2D51BF26, 0, "sound/buttons/spark6.wav" },
+	{ 0x06C8129E, 0, "sound/ambience/dronemachine3.wav" },
+	{ 0x39C7DF98, 0, "sound/vox/cable.wav" },
+	{ 0x7FE49D08, 0, "sprites/puff.spr" },
+	{ 0xFB0CA9F5, 0, "gfx/env/clifflf.tga" },
+	{ 0xF25EC232, 0, "gfx/vgui/fonts/1280_team info text.tga" },
+	{ 0x8937720F, 0, "sound/sentences/db1.wav" },
+	{ 0xD0A252C1, 0, "models/p_m1carb_l.mdl" },
+	{ 0x39AF79F6, 0, "models/stickygibpink.mdl" },
+	{ 0x96868426, 0, "overviews/dod_escape.bmp" },
+	{ 0x8479427A, 0, "sound/fgrunt/incoming.wav" },
+	{ 0x0F7E3603, 0, "sound/scientist/improbable.wav" },
+	{ 0x2FCFA260, 0, "sound/sentences/hg_clear5.wav" },
+	{ 0x41668350, 0, "models/bskull_template1.mdl" },
+	{ 0x2A4DA296, 0, "sound/houndeye/he_hunt2.wav" },
+	{ 0xA75A3485, 0, "models/v_tfc_sniper.mdl" },
+	{ 0xA22EEA25, 0, "sound/hgrunt/move.wav" },
+	{ 0x4C721206, 0, "sound/weapons/sg552_clipout.wav" },
+	{ 0x44DCB21A, 0, "sprites/wall_puff1.spr" },
+	{ 0xC19D6AFB, 0, "sound/vox/last.wav" },
+	{ 0x3110CAD6, 0, "sound/vox/that.wav" },
+	{ 0x7539ED6C, 0, "sound/sentences/db0.wav" },
+	{ 0xBAE13394, 0, "maps/dod_anzio_detail.txt" },
+	{ 0x8EF351A6, 0, "sound/ambience/guit1.wav" },
+	{ 0xA956B1A1, 0, "sound/sentences/hev_buckshot.wav" },
+	{ 0xA30CD8DD, 0, "sound/barney/ba_hello2.wav" },
+	{ 0x0BE7D1F6, 0, "sound/hgrunt/force!.wav" },
+	{ 0x87C44FE8, 0, "sprites/tf_weapon_ac.txt" },
+	{ 0x43F5A856, 0, "models/pallet_with_bags.mdl" },
+	{ 0x4FD73D1A, 0, "sound/sentences/c3a2_portal.wav" },
+	{ 0x8FC41D02, 0, "sound/scientist/scream5.wav" },
+	{ 0xBC2B600F, 0, "sound/pitdrone/pit_drone_run_on_grate.wav" },
+	{ 0x72DC74D8, 0, "sprites/eexplo.spr" },
+	{ 0x4D59DE86, 0, "gfx/detail/dt_stone3.tga" },
+	{ 0x4D6650C3, 0, "sound/scientist/of1a6_sc01.wav" },
+	{ 0x52C11879, 0, "sound/ambience/des_wind2.wav" },
+	{ 0xE1E29650, 0, "sound/weapons/de_clipin.wav" },
+	{ 0x1F1825B1, 0, "sound/debris/beamstart3.wav" },
+	{ 0x433875D7, 0, "gfx/env/de_stormrt.bmp" },
+	{ 0x56A75C84, 0, "models/p_youthk.mdl" },
+	{ 0x73B3CA55, 0, "sound/weapons/ric11.wav" },
+	{ 0xA7A5D247, 0, "sound/weapons/hks2.wav" },
+	{ 0x51D150B8, 0, "sound/sentences/c1a2_11.wav" },
+	{ 0xC8E92024, 0, "sound/scientist/sc_ok3.wav" },
+	{ 0x37ECDD74, 0, "sound/player/britattack.wav" },
+	{ 0x2C2DAD2E, 0, "sound/hgrunt/yeah!.wav" },
+	{ 0x4EB2A39C, 0, "sound/gman/gman_suit.wav" },
+	{ 0xD6845611, 0, "overviews/bounce.bmp" },
+	{ 0x4ADA5B28, 0, "models/blkop_apachet.mdl" },
+	{ 0x826919FE, 0, "sound/rosenberg/ro_fear1.wav" },
+	{ 0x7CE6667F, 0, "sound/vox/malfunction.wav" },
+	{ 0xB801541D, 0, "sprites/weapon_scout.txt" },
+	{ 0x65DF87FC, 0, "sound/voltigore/voltigore_footstep3.wav" },
+	{ 0x84FCAD37, 0, "sprites/weapon_usp.txt" },
+	{ 0x81A6C9A6, 0, "sound/ambience/treejump.wav" },
+	{ 0xB881A66E, 0, "sound/items/armoron_1.wav" },
+	{ 0x8D69A393, 0, "sound/ambience/dodambience4.wav" },
+	{ 0x31348A7A, 0, "sound/barney/aintgoin.wav" },
+	{ 0x231068C9, 0, "sound/vox/check.wav" },
+	{ 0xDE2CB3BA, 0, "sound/ichy/ichy_alert3.wav" },
+	{ 0x3E0C630F, 0, "sound/drill/pistol01.wav" },
+	{ 0x49E402EC, 0, "sound/shocktrooper/kiml.wav" },
+	{ 0x712CE79D, 0, "sound/scientist/c1a3_sci_silo2a.wav" },
+	{ 0xC5D81ECF, 0, "sound/controller/con_idle4.wav" },
+	{ 0x19AC14AF, 0, "sound/weapons/grenpinpull.wav" },
+	{ 0x98C15CC2, 0, "sound/vox/break.wav" },
+	{ 0x956B1CF3, 0, "sound/scientist/seencup.wav" },
+	{ 0xC78CA9EE, 0, "sound/vox/touch.wav" },
+	{ 0x7D62C7CC, 0, "sound/rosenberg/ro_wait4.wav" },
+	{ 0x3AA443B2, 0, "models/w_mp44.mdl" },
+	{ 0xB1915388, 0, "models/p_satchel_radio.mdl" },
+	{ 0x5B0D1273, 0, "sound/scientist/neverseen.wav" },
+	{ 0xAF26BFCD, 0, "sound/vox/access.wav" },
+	{ 0xE7583684, 0, "sprites/glow02.spr" },
+	{ 0x3F70B153, 0, "sound/vox/fine.wav" },
+	{ 0x6F8B2770, 0, "sound/weapons/hit_grass1.wav" },
+	{ 0x14A20C5B, 0, "sound/barney/of1a5_ba02.wav" },
+	{ 0xBC70C630, 0, "models/player/gordon/gordon.mdl" },
+	{ 0x120EBC2E, 0, "sound/player/gersniper.wav" },
+	{ 0xB464A566, 0, "models/mapmodels/tube.mdl" },
+	{ 0xD0188996, 0, "gfx/env/neb2brt.tga" },
+	{ 0x2FBA5AD1, 0, "sound/fgrunt/take.wav" },
+	{ 0xF2B9056B, 0, "sound/vox/exit.wav" },
+	{ 0x2650AC8E, 0, "sound/sentences/hev_d00.wav" },
+	{ 0xF0DFD1FA, 0, "sound/player/gertankahead.wav" },
+	{ 0x2F82AF66, 0, "sound/scientist/letmehelp.wav" },
+	{ 0x0210B4FE, 0, "models/w_radt.mdl" },
+	{ 0x380F7A83, 0, "sound/common/npc_step2.wav" },
+	{ 0xC5A49D33, 0, "models/cindergibs_green.mdl" },
+	{ 0x7AF82FBE, 0, "sound/scientist/asexpected.wav" },
+	{ 0x88B9C942, 0, "sound/rosenberg/ro_tele_xen12.wav" },
+	{ 0x7E9873A8, 0, "sound/hgrunt/weird!.wav" },
+	{ 0x9DBDC54E, 0, "sound/fvox/ammo_pickup.wav" },
+	{ 0xF195ABE0, 0, "sound/common/nuke_ticking.wav" },
+	{ 0x26933374, 0, "models/wire_blue16.mdl" },
+	{ 0xE31872D6, 0, "sound/fgrunt/of5a3_fg02.wav" },
+	{ 0xD005FD61, 0, "sound/shocktrooper/ka.wav" },
+	{ 0xD23515AA, 0, "sound/drill/rope03.wav" },
+	{ 0x76C5960E, 0, "sound/vox/you.wav" },
+	{ 0xAC142B80, 0, "models/w_glock18.mdl" },
+	{ 0xDEC769F3, 0, "overviews/dod_northbound.txt" },
+	{ 0x52CC5848, 0, "gfx/env/disclf.tga" },
+	{ 0xE6253D13, 0, "sound/vox/us.wav" },
+	{ 0xBC0EBC05, 0, "sound/rosenberg/ro_ok4.wav" },
+	{ 0x5BB7817E, 0, "gfx/vgui/fonts/640_scoreboard title text.tga" },
+	{ 0xEF99531A, 0, "sprites/sshrap2.spr" },
+	{ 0x6132E22F, 0, "sound/holo/holostn11.wav" },
+	{ 0xB77764BD, 0, "sound/weapons/galil_boltpull.wav" },
+	{ 0xBD16B591, 0, "gfx/vgui/640_hard.tga" },
+	{ 0xACA4547D, 0, "sound/scientist/rightwayout.wav" },
+	{ 0x1F243274, 0, "gfx/env/dusklf.tga" },
+	{ 0x7F13F366, 0, "sound/hgrunt/radio!.wav" },
+	{ 0x8210C39B, 0, "sound/vox/lie.wav" },
+	{ 0xF45441A7, 0, "sound/ambience/alien_powernode.wav" },
+	{ 0x526F482A, 0, "sound/player/gernegative.wav" },
+	{ 0x977086BF, 0, "sound/sentences/dc2.wav" },
+	{ 0x995BA448, 0, "models/null.mdl" },
+	{ 0x6BB8B4DA, 0, "sound/sentences/na9.wav" },
+	{ 0x8FA2D00C, 0, "gfx/env/avantibk.bmp" },
+	{ 0x281F85D2, 0, "sound/rosenberg/ro_ok5.wav" },
+	{ 0x2FCEC2FE, 0, "sound/fvox/hev_logon.wav" },
+	{ 0x3A8B434E, 0, "gfx/env/avantift.tga" },
+	{ 0x2ABC17C1, 0, "maps/de_vertigo.txt" },
+	{ 0xFF9E1BD7, 0, "sound/ambience/disgusting.wav" },
+	{ 0x98496AE4, 0, "gfx/vgui/arrowdown.tga" },
+	{ 0x4B3D5F66, 0, "sound/sentences/hev_hlth4.wav" },
+	{ 0x36019014, 0, "models/gib_hgrunt.mdl" },
+	{ 0xA229841A, 0, "sound/weapons/m3_pump.wav" },
+	{ 0xE2C418BF, 0, "gfx/vgui/fonts/1024_briefing text.tga" },
+	{ 0x9FD8427D, 0, "sound/scientist/excellentteam.wav" },
+	{ 0xB863E580, 0, "sound/fgrunt/gr_pain4.wav" },
+	{ 0x306DB528, 0, "sound/common/null.wav" },
+	{ 0x9D77ED35, 0, "sound/turret/tu_retract.wav" },
+	{ 0xD9ED5880, 0, "sound/otis/reputation.wav" },
+	{ 0x02CF6627, 0, "resource/dmc_english.txt" },
+	{ 0x9ECCCE63, 0, "sound/hgrunt/out!.wav" },
+	{ 0x52ADAE8D, 0, "models/islave02.mdl" },
+	{ 0xEBC30A61, 0, "sound/fvox/bleeding_stopped.wav" },
+	{ 0xFB49295C, 0, "sound/fgrunt/intro_fg02.wav" },
+	{ 0xC1C2A282, 0, "gfx/vgui/fonts/640_briefing text.tga" },
+	{ 0x3CB181BF, 0, "sound/plats/ttrain1.wav" },
+	{ 0xC03C636C, 0, "sound/common/launch_deny1.wav" },
+	{ 0x4548990C, 0, "overviews/snark_pit.bmp" },
+	{ 0x48B2CFA8, 0, "sprites/spotlight01.spr" },
+	{ 0x35500803, 0, "models/w_penguin.mdl" },
+	{ 0x9CBEC353, 0, "models/v_tfgl.mdl" },
+	{ 0x00B052C1, 0, "models/gib_skull.mdl" },
+	{ 0x4E2F4C11, 0, "sound/hgrunt/away!.wav" },
+	{ 0xBD8D5613, 0, "sound/agrunt/ag_die3.wav" },
+	{ 0x5EC2CDBB, 0, "sound/weapons/grenthrow.wav" },
+	{ 0xD40D1A09, 0, "models/p_mills.mdl" },
+	{ 0xF9B43BD5, 0, "logos/splatt.bmp" },
+	{ 0x86327884, 0, "sound/sentences/erad0.wav" },
+	{ 0x7FA4DC80, 0, "sprites/xsmoke4.spr" },
+	{ 0x522876F3, 0, "gfx/vgui/fonts/1280_hintmessage text.tga" },
+	{ 0x4B4E095D, 0, "sound/vox/questioning.wav" },
+	{ 0x7FDB8363, 0, "sound/weapons/kar_shoot.wav" },
+	{ 0x1A173F4B, 0, "gfx/env/duskft.bmp" },
+	{ 0xD60A60EF, 0, "models/pit_drone_gibs.mdl" },
+	{ 0x44435AC1, 0, "logos/royals.bmp" },
+	{ 0x15EBE30B, 0, "sound/hornet/ag_hornethit1.wav" },
+	{ 0x2D07A9ED, 0, "gfx/env/spacert.tga" },
+	{ 0x51DD25A2, 0, "overviews/badlands.bmp" },
+	{ 0xB23F3E1D, 0, "gfx/env/avantidn.bmp" },
+	{ 0xC185D4A1, 0, "sound/drill/barracks03.wav" },
+	{ 0x57AA9A68, 0, "sound/scientist/c1a0_sci_dis9a.wav" },
+	{ 0x71AEC7DA, 0, "sound/ichy/ichy_die3.wav" },
+	{ 0x28F352A7, 0, "models/pow_curve.mdl" },
+	{ 0xE26806E3, 0, "sound/ambience/lv1.wav" },
+	{ 0x37C9D388, 0, "sound/ba_holo/tr_holo_flashlight.wav" },
+	{ 0x90F8C3CC, 0, "gfx/vgui/640_arrowup.tga" },
+	{ 0x2A4E09D0, 0, "sprites/ch_sniper2.spr" },
+	{ 0x03158611, 0, "models/mapmodels/cow.mdl" },
+	{ 0xD1F6D170, 0, "gfx/env/desertrt.tga" },
+	{ 0x6901CE0D, 0, "sprites/hint_gerhead.spr" },
+	{ 0xA6457B75, 0, "sound/sentences/hev_pistol.wav" },
+	{ 0x5F88D53E, 0, "sound/hgrunt/god.wav" },
+	{ 0x64338E36, 0, "sound/weapons/m4a1-1.wav" },
+	{ 0x0E47D23D, 0, "gfx/env/xen10ft.tga" },
+	{ 0xE2F3D2D7, 0, "logos/ironcross.bmp" },
+	{ 0xEB3B6E24, 0, "sound/scientist/sc_power_wound2.wav" },
+	{ 0x3F5FABA3, 0, "sound/weapons/aug_clipout.wav" },
+	{ 0x1C57DDC9, 0, "sound/vox/fahrenheit.wav" },
+	{ 0xE95CE412, 0, "models/mapmodels/uplant1_2x.mdl" },
+	{ 0xA6F935C6, 0, "sound/weapons/xm1014-1.wav" },
+	{ 0x538CE4D6, 0, "sound/otis/standguard.wav" },
+	{ 0xA6F963B5, 0, "sound/barney/hellonicesuit.wav" },
+	{ 0xD2FC601B, 0, "models/wire_red16.mdl" },
+	{ 0xE379AAEC, 0, "models/napalm.mdl" },
+	{ 0xD4736E5F, 0, "sound/hgrunt/we!.wav" },
+	{ 0xD2E5B54A, 0, "models/p_brensr.mdl" },
+	{ 0x0B9C0C7D, 0, "sound/barney/ba_pok0.wav" },
+	{ 0x0B6D774A, 0, "sound/vox/surface.wav" },
+	{ 0x22DEA03A, 0, "sound/scientist/youneedmedic_sci1.wav" },
+	{ 0xCC28B307, 0, "sprites/muz4.spr" },
+	{ 0xAB4D9EDC, 0, "sprites/xspark4.spr" },
+	{ 0xEA7F218A, 0, "gfx/env/officeup.tga" },
+	{ 0x6255ADA4, 0, "sound/scientist/c1a0_sci_dis5a.wav" },
+	{ 0x2F6CFED6, 0, "sound/fvox/power_level_is.wav" },
+	{ 0xFF0995D8, 0, "sound/rosenberg/ro_heal3.wav" },
+	{ 0x6D054D49, 0, "models/grass_01.spr" },
+	{ 0x8E8C4C5E, 0, "gfx/env/clifflf.bmp" },
+	{ 0xABAABAE6, 0, "dod_northbound.wad" },
+	{ 0xC1D1BEFD, 0, "gfx/env/cxup.tga" },
+	{ 0x06110778, 0, "gfx/env/hackup.bmp" },
+	{ 0x00724A58, 0, "sound/vox/command.wav" },
+	{ 0xAF5CC7F8, 0, "sound/player/gerceasefire.wav" },
+	{ 0x5F1531E4, 0, "sound/player/gercover.wav" },
+	{ 0xBDD93956, 0, "sound/vox/hours.wav" },
+	{ 0xCFDEBAB6, 0, "sound/scientist/sci_pain2.wav" },
+	{ 0xE5542D1C, 0, "sound/rosenberg/ro_pain1.wav" },
+	{ 0xA57352A6, 0, "sound/player/usmgahead.wav" },
+	{ 0x145250C3, 0, "sprites/hudlgsm.spr" },
+	{ 0xD6D630FE, 0, "models/helmet_brit.mdl" },
+	{ 0x4C0100B5, 0, "sound/weapons/m4a1_unsil-2.wav" },
+	{ 0x084070C3, 0, "sound/ambience/hum1.wav" },
+	{ 0xB43ED599, 0, "sound/hostage/hos4.wav" },
+	{ 0xAEB92BD1, 0, "sound/scientist/fascinating.wav" },
+	{ 0x18F78E31, 0, "models/v_panzerschreck.mdl" },
+	{ 0x69B2BBAC, 0, "sound/debris/beamstart8.wav" },
+	{ 0xCA6FB826, 0, "sound/ambience/uspointcaptured.wav" },
+	{ 0x75E17B9F, 0, "models/w_shotbox_bigt.mdl" },
+	{ 0xCF8E684E, 0, "models/shield/p_shield_p228.mdl" },
+	{ 0x29920D24, 0, "sound/sentences/hev_gr16.wav" },
+	{ 0x3596E721, 0, "servers/icon_password.tga" },
+	{ 0xB538563D, 0, "models/blkop_enginegibs.mdl" },
+	{ 0xBC3AD980, 0, "sound/scientist/sc_pok1.wav" },
+	{ 0xFB40CC2D, 0, "gfx/env/alien3rt.tga" },
+	{ 0x67BEEA05, 0, "dod_merderet.wad" },
+	{ 0xA79A59EC, 0, "gfx/env/blackft.tga" },
+	{ 0x257B1792, 0, "sprites/mapsprites/dog1roofdust01.spr" },
+	{ 0x5125ABD4, 0, "sound/radio/locknload.wav" },
+	{ 0x58CFD18B, 0, "sound/hgrunt/affirmative!.wav" },
+	{ 0xB6D99A60, 0, "sound/fgrunt/sir.wav" },
+	{ 0x7C9A88D2, 0, "sound/common/bodydrop2.wav" },
+	{ 0x628585FB, 0, "sound/weapons/displacer_spin.wav" },
+	{ 0x1586BB8A, 0, "gfx/vgui/640_medicblue.tga" },
+	{ 0xA7BEB8AF, 0, "gfx/env/xen9up.bmp" },
+	{ 0xA1DFFC23, 0, "sound/barney/illwait.wav" },
+	{ 0x68A2CD07, 0, "gfx/env/neb7ft.tga" },
+	{ 0x26F0FFD7, 0, "sound/sentences/c1a1_0.wav" },
+	{ 0x2CE88AC7, 0, "sound/vox/adios.wav" },
+	{ 0xC9BCBF2F, 0, "sound/barney/ba_duty.wav" },
+	{ 0xC2D7AF6B, 0, "sound/barney/letsgo.wav" },
+	{ 0x47B9560F, 0, "sprites/comp_b02.spr" },
+	{ 0x26E3C1BD, 0, "sprites/tfchud02.spr" },
+	{ 0x21C08F9A, 0, "sound/nihilanth/nil_alone.wav" },
+	{ 0x4B5E947A, 0, "sound/hgrunt/neutralize!.wav" },
+	{ 0x98830A5C, 0, "models/p_tripmine.mdl" },
+	{ 0x6921A38B, 0, "sound/fvox/fourteen.wav" },
+	{ 0x91CD7F65, 0, "sound/player/britspreadout.wav" },
+	{ 0x0ED8202D, 0, "models/gib_3.mdl" },
+	{ 0x8A48C37B, 0, "models/v_hegrenade.mdl" },
+	{ 0xD40670BB, 0, "sound/vox/fool.wav" },
+	{ 0x9CE4BD56, 0, "models/w_pschreck.mdl" },
+	{ 0xE22833D6, 0, "sound/drill/intro03.wav" },
+	{ 0x54090545, 0, "sprites/weapon_m3.txt" },
+	{ 0xBA9F347E, 0, "gfx/vgui/640_scientist.tga" },
+	{ 0x7EC188FC, 0, "gfx/vgui/galil.tga" },
+	{ 0x2D487A48, 0, "models/disc.mdl" },
+	{ 0xC7D69D8F, 0, "gfx/env/kraftstoffrt.tga" },
+	{ 0xB5AF0C0A, 0, "sound/ba_holo/tr_holo_steam.wav" },
+	{ 0x26AA363A, 0, "sound/ambience/labgear.wav" },
+	{ 0x774E6976, 0, "sound/barney/c2a5_ba_letout.wav" },
+	{ 0xCC513114, 0, "sound/otis/yeah.wav" },
+	{ 0xF5868ED6, 0, "gfx/detail/dt_ground1.tga" },
+	{ 0x40453E0F, 0, "sound/hgrunt/call!.wav" },
+	{ 0x3AE73791, 0, "sound/barney/ba_security1_door2.wav" },
+	{ 0x3DF8F7C8, 0, "models/civ_coat_scientist.mdl" },
+	{ 0x3C137509, 0, "sound/barney/stophere.wav" },
+	{ 0x9F6430B6, 0, "models/player/gsg9/gsg9.mdl" },
+	{ 0x09EAE45B, 0, "sound/sentences/c2a2_4.wav" },
+	{ 0xA9CB0131, 0, "sprites/bmp/fthrow13.bmp" },
+	{ 0x442C347B, 0, "sound/sentences/ea1.wav" },
+	{ 0xB1627C76, 0, "models/w_gauss.mdl" },
+	{ 0x78A75BC1, 0, "gfx/vgui/640_arrowright.tga" },
+	{ 0xE751EB40, 0, "sprites/weapon_grapple.txt" },
+	{ 0x58D248F7, 0, "models/b_nail1t.mdl" },
+	{ 0x9FF7828D, 0, "sound/scientist/c1a0_sci_dis1b.wav" },
+	{ 0xA5CA4A0F, 0, "sound/scientist/c1a0_sci_dis1d.wav" },
+	{ 0x45DC083C, 0, "sound/fvox/position.wav" },
+	{ 0xBAF85B0C, 0, "sprites/voiceicon.spr" },
+	{ 0x67CF16BB, 0, "sound/scientist/luckwillchange.wav" },
+	{ 0x640F3AAD, 0, "sound/sentences/eh0.wav" },
+	{ 0xA6BF8F24, 0, "models/deadhaz.mdl" },
+	{ 0x122EAF19, 0, "sound/scientist/iwounded.wav" },
+	{ 0xF887B59E, 0, "sound/rosenberg/ro_stop3.wav" },
+	{ 0x3DE3B70A, 0, "sprites/bmp/2fire05.bmp" },
+	{ 0x4060D895, 0, "cs_havana.wad" },
+	{ 0x421D845A, 0, "sprites/bmp/fthrow05.bmp" },
+	{ 0x596D0499, 0, "gfx/env/snowup.tga" },
+	{ 0x131CEE72, 0, "sound/sentences/c2a2_7.wav" },
+	{ 0xD9AB9AAB, 0, "models/mapmodels/jed_exploding_pine2.mdl" },
+	{ 0xA8071B0C, 0, "models/sentryt.mdl" },
+	{ 0xB00F2E2B, 0, "sound/sentences/c3a1_6.wav" },
+	{ 0x5FCC45A8, 0, "sound/scientist/c1a0_sci_stall.wav" },
+	{ 0x5C9E6393, 0, "sound/gman/gman_nowork.wav" },
+	{ 0xAA7C27E8, 0, "sound/controller/con_attack3.wav" },
+	{ 0xCDDB976B, 0, "sound/items/nvg_on.wav" },
+	{ 0x9D39F7EE, 0, "sound/ambience/port_suckin1.wav" },
+	{ 0x98C1A988, 0, "sound/holo/tr_holo_medkit.wav" },
+	{ 0xCF3C45AA, 0, "models/player/spetsnaz/spetsnaz.mdl" },
+	{ 0x434A3799, 0, "sound/sentences/hg_check7.wav" },
+	{ 0xE8574E9E, 0, "sound/barney/teamup1.wav" },
+	{ 0x145F3F27, 0, "models/p_bren.mdl" },
+	{ 0x21500B19, 0, "sound/player/pl_snow2.wav" },
+	{ 0x65D5E941, 0, "sound/common/menu1.wav" },
+	{ 0xB46A1C40, 0, "gfx/vgui/640_arrowleft.tga" },
+	{ 0xBA7D7728, 0, "sound/shocktrooper/shock_trooper_die4.wav" },
+	{ 0xE823ABE9, 0, "sound/agrunt/ag_alert5.wav" },
+	{ 0x1AFAF6BC, 0, "gfx/detail/dt_leather1.tga" },
+	{ 0xB5D71AF8, 0, "sound/sentences/na3.wav" },
+	{ 0x79982D32, 0, "sound/sentences/hev_a3.wav" },
+	{ 0x84C68101, 0, "models/mapmodels/end_table1.mdl" },
+	{ 0xDD81FA27, 0, "gfx/env/de_stormup.tga" },
+	{ 0x17143053, 0, "sound/player/boots3.wav" },
+	{ 0x69397ED4, 0, "sound/hgrunt/fall!.wav" },
+	{ 0xEC18AAEF, 0, "sound/fvox/hev_critical_fail.wav" },
+	{ 0xDAF6E6D1, 0, "sound/rosenberg/ro_heal4.wav" },
+	{ 0xC53D4900, 0, "models/ball.mdl" },
+	{ 0xAC593092, 0, "sound/weapons/galil-1.wav" },
+	{ 0xAF52530B, 0, "sound/scientist/ahfreeman.wav" },
+	{ 0x323E449D, 0, "sound/ambience/clock-tic.wav" },
+	{ 0xEAABE5F2, 0, "cs_747.wad" },
+	{ 0x2633D938, 0, "sound/weapons/lock4.wav" },
+	{ 0x16102211, 0, "sound/ambience/clocktick.wav" },
+	{ 0x4BE30B77, 0, "sound/nihilanth/nil_thetruth.wav" },
+	{ 0x3208C39B, 0, "sound/debris/metal3.wav" },
+	{ 0x8F13AF44, 0, "resource/tfc_spanish.txt" },
+	{ 0x4A7EDE32, 0, "sound/controller/con_attack1.wav" },
+	{ 0x0C73D7A0, 0, "sound/weapons/c4_beep1.wav" },
+	{ 0xA87C953E, 0, "gfx/detail/brick2.tga" },
+	{ 0xD849C97E, 0, "models/mapmodels/desk_office-mahg.mdl" },
+	{ 0xF32BBB4C, 0, "sprites/nuke_a_3.spr" },
+	{ 0xA66D806D, 0, "sound/rosenberg/ro_wait3.wav" },
+	{ 0xDE64D790, 0, "sound/player/usceasefire.wav" },
+	{ 0x4DC4465E, 0, "sound/sentences/hev_13p.wav" },
+	{ 0xFFF8CD03, 0, "sound/weapons/c4_disarm.wav" },
+	{ 0x2495E8E0, 0, "sprites/mommaspit.spr" },
+	{ 0xA32F5D91, 0, "sound/otis/wuss.wav" },
+	{ 0x74E3CF29, 0, "models/p_fg42.mdl" },
+	{ 0x35A917A1, 0, "models/pit_drone.mdl" },
+	{ 0xF53B50C7, 0, "models/p_ump45.mdl" },
+	{ 0x836C0FE7, 0, "sound/player/gercoverflanks.wav" },
+	{ 0x931F9EE3, 0, "sound/weapons/dryfire1.wav" },
+	{ 0x13920551, 0, "gfx/env/grnplsntrt.tga" },
+	{ 0xE8E28541, 0, "sound/sentences/hg_monst2.wav" },
+	{ 0xD85B4904, 0, "sound/sentences/c2a1_6.wav" },
+	{ 0xF42F4D92, 0, "sprites/obj_icons/dod_jagd/icon_obj_custom1_allies.spr" },
+	{ 0x3159DB8A, 0, "maps/dod_caen.txt" },
+	{ 0x379A94C4, 0, "gfx/env/hacklf.tga" },
+	{ 0x966A44A1, 0, "sound/scientist/absolutelynot.wav" },
+	{ 0xCB7A58E5, 0, "sound/bullchicken/bc_attackgrowl.wav" },
+	{ 0xBDFB4750, 0, "sound/scientist/limitsok.wav" },
+	{ 0x11E65C21, 0, "models/torch2.mdl" },
+	{ 0x0E48A11A, 0, "sound/ambience/mgun_burst2.wav" },
+	{ 0x436B27A4, 0, "sound/ambience/ae_radiocall.wav" },
+	{ 0x2BCF632B, 0, "models/ospreyt.mdl" },
+	{ 0x958F51E1, 0, "sound/player/geiger1.wav" },
+	{ 0x34A5CC96, 0, "sprites/320_3bounce.spr" },
+	{ 0x1717255E, 0, "sprites/bmp/1medic02.bmp" },
+	{ 0x265E82B4, 0, "sound/sentences/hev_6p.wav" },
+	{ 0x280D2CBA, 0, "gfx/vgui/800_arrowup.tga" },
+	{ 0x76EE03BE, 0, "gfx/vgui/map_mgflag.tga" },
+	{ 0xE3A2FB11, 0, "sound/hgrunt/maintain.wav" },
+	{ 0x7E1D588E, 0, "sound/vox/repair.wav" },
+	{ 0x369CC602, 0, "resource/background/800_2_d_loading.tga" },
+	{ 0x30918A2C, 0, "sound/vox/immediate.wav" },
+	{ 0xE00F2CB3, 0, "gfx/env/neb7rt.tga" },
+	{ 0x8FC707F7, 0, "models/bigtree.mdl" },
+	{ 0x689D3AEF, 0, "resource/icon_end.tga" },
+	{ 0xD2385736, 0, "sprites/weapon_357.txt" },
+	{ 0xA9390F58, 0, "sound/vox/an.wav" },
+	{ 0x5693DBAF, 0, "sound/weapons/bgrapple_cough.wav" },
+	{ 0xEEBCF4FE, 0, "sound/player/geryessir.wav" },
+	{ 0x75C2697C, 0, "sound/vox/victor.wav" },
+	{ 0x40A9769F, 0, "sprites/ic4.spr" },
+	{ 0xBA9EF262, 0, "sprites/mapsprites/explosion_smoke1.spr" },
+	{ 0xD42823BD, 0, "sound/fans/fan2.wav" },
+	{ 0x3B7F8CE9, 0, "sound/ambience/alienvoices1.wav" },
+	{ 0x2BD6951F, 0, "sound/weapons/boltback.wav" },
+	{ 0xD71CAFD8, 0, "resource/cstrike_italian.txt" },
+	{ 0xFEE2F6B1, 0, "sound/vox/permitted.wav" },
+	{ 0x9C98BCF6, 0, "gfx/vgui/fonts/400_hintmessage text.tga" },
+	{ 0xE85A033E, 0, "models/mapmodels/barbed_wire.mdl" },
+	{ 0x9FAC70DF, 0, "models/blkop_bodygibs.mdl" },
+	{ 0x698A663B, 0, "sound/aslave/slv_word5.wav" },
+	{ 0x99D290C4, 0, "sound/vox/inspector.wav" },
+	{ 0x100CC241, 0, "sound/ambience/aa3.wav" },
+	{ 0x8A81FC49, 0, "gfx/env/sky_blu_lf.tga" },
+	{ 0x73523100, 0, "overviews/rapidcore.bmp" },
+	{ 0x8641CA45, 0, "sound/sentences/pmhev_shock.wav" },
+	{ 0xACC75DE7, 0, "sound/scientist/sc_ok2.wav" },
+	{ 0x98ED43F8, 0, "gfx/detail/dt_fabric1.tga" },
+	{ 0xA407C930, 0, "models/player/beret/beret.mdl" },
+	{ 0xC2066D3F, 0, "sound/sentences/c2a2_8.wav" },
+	{ 0x61E542DC, 0, "gfx/env/discup.bmp" },
+	{ 0xCA1172FD, 0, "sound/player/pl_shot1.wav" },
+	{ 0x67BC536B, 0, "sound/weapons/rifleselect.wav" },
+	{ 0xF0ADE5C0, 0, "overviews/dod_donner.txt" },
+	{ 0xF68B147C, 0, "gfx/detail/dt_rough1.tga" },
+	{ 0xF9D2E79D, 0, "sound/sentences/hg_throw3.wav" },
+	{ 0xA85609A7, 0, "sound/player/britflankleft.wav" },
+	{ 0x16CC2776, 0, "gfx/vgui/kevlar_helmet.tga" },
+	{ 0x3FC2EFBD, 0, "sound/radio/of1a2_rd02.wav" },
+	{ 0x1B9969E0, 0, "sound/fvox/near_death.wav" },
+	{ 0x0856FA77, 0, "sound/controller/con_alert2.wav" },
+	{ 0x2F7B3538, 0, "sound/holo/tr_holo_keeptrying.wav" },
+	{ 0xB086DD2D, 0, "gfx/vgui/640_arrow.tga" },
+	{ 0x5982D360, 0, "sound/scientist/c1a0_sci_dis12a.wav" },
+	{ 0x782EB0A9, 0, "models/xen_rockgib_big.mdl" },
+	{ 0xDC993FA8, 0, "gfx/vgui/fonts/1600_scoreboard small text.tga" },
+	{ 0xD1B0EC53, 0, "overviews/rock2.tga" },
+	{ 0x8D467774, 0, "sound/scientist/c1a1_sci_4scan.wav" },
+	{ 0xD0CCBA08, 0, "sound/sentences/hev_gr12.wav" },
+	{ 0x636B0D41, 0, "sound/sentences/hg_quest5.wav" },
+	{ 0x027D832E, 0, "sound/voltigore/voltigore_run_grunt1.wav" },
+	{ 0xBF88251A, 0, "sound/scientist/noidea.wav" },
+	{ 0x1B9F4437, 0, "sound/de_torn/torn_ak-47.wav" },
+	{ 0xF1B9F31C, 0, "overviews/de_dust2.txt" },
+	{ 0x9D382ACB, 0, "sound/plats/freightmove1.wav" },
+	{ 0xF1832A1F, 0, "sound/nihilanth/nil_done.wav" },
+	{ 0x1BE094B5, 0, "sprites/mommablob.spr" },
+	{ 0xC48CD3F9, 0, "sound/vox/have.wav" },
+	{ 0x4B6E7348, 0, "sprites/glow_grn.spr" },
+	{ 0xF1E142A6, 0, "models/zombie03.mdl" },
+	{ 0x8227DB14, 0, "sound/weapons/mac10_boltpull.wav" },
+	{ 0xAB81BE06, 0, "sound/vox/suit.wav" },
+	{ 0x2D01D917, 0, "sound/fvox/health_critical.wav" },
+	{ 0x3EB0E104, 0, "sound/otis/talkmuch.wav" },
+	{ 0xDC4E1591, 0, "models/mapmodels/zalec_tree1.mdl" },
+	{ 0x1955222A, 0, "gfx/env/badlandslf.tga" },
+	{ 0xAC234C91, 0, "sound/vox/accelerating.wav" },
+	{ 0x8A78A3D6, 0, "models/intro_barney01.mdl" },
+	{ 0x464D3484, 0, "models/mapmodels/rock_japan_rooftop.mdl" },
+	{ 0x5875D744, 0, "resource/tfc_italian.txt" },
+	{ 0x0985B96A, 0, "sound/vox/truck.wav" },
+	{ 0x3242C8A5, 0, "sound/weapons/g_bounce2.wav" },
+	{ 0xDC0ED888, 0, "sound/vox/great.wav" },
+	{ 0x46C6A8C2, 0, "sound/vox/acquisition.wav" },
+	{ 0x6BB541C6, 0, "overviews/2fort.bmp" },
+	{ 0x61C46641, 0, "sound/vox/hole.wav" },
+	{ 0x52B516FB, 0, "sound/nihilanth/nil_last.wav" },
+	{ 0x4E20E600, 0, "sound/sentences/hev_squeek.wav" },
+	{ 0x726FDBC9, 0, "sound/player/britenemyahead.wav" },
+	{ 0xDD516833, 0, "overviews/subtransit.tga" },
+	{ 0x92DFD437, 0, "sound/sentences/ng0.wav" },
+	{ 0x976A78FB, 0, "sound/weapons/sg_explode.wav" },
+	{ 0x8F930CC6, 0, "sound/hgrunt/position!.wav" },
+	{ 0xE93F9CB8, 0, "sprites/steam1.spr" },
+	{ 0xF38A48F0, 0, "sound/plats/squeekmove1.wav" },
+	{ 0x69361ED9, 0, "sprites/exp_b.spr" },
+	{ 0xD37BDEA7, 0, "gfx/env/morninglf.tga" },
+	{ 0xA7475F0D, 0, "gfx/vgui/clsimages/cls_tommy.tga" },
+	{ 0xB637B575, 0, "sound/ctf/pow_big_jump.wav" },
+	{ 0x938A94FE, 0, "sound/player/germanleft.wav" },
+	{ 0x42F5E31C, 0, "gfx/env/kraftstoffup.tga" },
+	{ 0x05054081, 0, "gfx/env/spaceft.tga" },
+	{ 0x05393DF8, 0, "sound/weapons/boltdown.wav" },
+	{ 0xC0DEB41F, 0, "sound/barney/ba_hello4.wav" },
+	{ 0x9F75E055, 0, "sound/scientist/startle6.wav" },
+	{ 0x721F6085, 0, "sound/player/britmgahead.wav" },
+	{ 0x80274B6F, 0, "models/bookgibs.mdl" },
+	{ 0x10F19321, 0, "sound/weapons/sg552-1.wav" },
+	{ 0x5FBB1E43, 0, "sprites/320hud4.spr" },
+	{ 0x0D8496BB, 0, "sound/vox/kill.wav" },
+	{ 0x6C661950, 0, "sound/player/usprepare.wav" },
+	{ 0xA7929FE6, 0, "gfx/env/snowft.tga" },
+	{ 0x460C6BCB, 0, "sound/scientist/alright.wav" },
+	{ 0x14620A94, 0, "sound/pitworm/pit_worm_flinch2.wav" },
+	{ 0xC5273C64, 0, "sound/barney/ba_somuch.wav" },
+	{ 0x39181479, 0, "overviews/dod_chemille.txt" },
+	{ 0xAFCA5600, 0, "sound/sentences/c1a1 intercom anomalous.wav" },
+	{ 0xF08A71B9, 0, "sound/weapons/hit_leaves2.wav" },
+	{ 0xF7D1D31E, 0, "models/rip.mdl" },
+	{ 0xA2C3D5D3, 0, "sound/holo/tr_holo_startlift.wav" },
+	{ 0x0FA321EA, 0, "gfx/env/cliff2rt.bmp" },
+	{ 0xF02D6D9E, 0, "sound/player/britdropguns.wav" },
+	{ 0x7CF5D767, 0, "models/barney_vest.mdl" },
+	{ 0xD7FC08BD, 0, "sound/rosenberg/ro_plfear0.wav" },
+	{ 0x1962FB3C, 0, "sprites/large_smoke_01_ind.spr" },
+	{ 0x4E611146, 0, "sound/player/death3.wav" },
+	{ 0xECF3A433, 0, "motd.txt" },
+	{ 0xBF32351D, 0, "sound/common/launch_glow1.wav" },
+	{ 0x7C5DBBAD, 0, "sound/scientist/sc_hello0.wav" },
+	{ 0x3593238F, 0, "sound/ambience/wind1.wav" },
+	{ 0x8671D1A7, 0, "sound/hgrunt/clik.wav" },
+	{ 0x18C71011, 0, "resource/platform_portuguese.txt" },
+	{ 0xA7100E3B, 0, "sound/weapons/displacer_fire.wav" },
+	{ 0xBE413047, 0, "sound/rosenberg/ro_yard_follow2.wav" },
+	{ 0xECE8D309, 0, "sound/scientist/thatsodd.wav" },
+	{ 0x7BE0A2E5, 0, "gfx/env/neb2bup.tga" },
+	{ 0x97EFD48C, 0, "sound/drill/squad01.wav" },
+	{ 0x1F5FC6A9, 0, "sprites/weapon_sg552.txt" },
+	{ 0x5ABA51A7, 0, "sound/weapons/tommy_reload_clipin.wav" },
+	{ 0xDB9A9A54, 0, "models/mapmodels/kingtiger.mdl" },
+	{ 0x97B8D42B, 0, "gfx/env/2desertdn.bmp" },
+	{ 0xC81A1B25, 0, "sprites/effects/rainsplash.spr" },
+	{ 0x1FB9F011, 0, "sound/scientist/c1a2_sci_transm.wav" },
+	{ 0xD692B795, 0, "sound/barnacle/bcl_bite3.wav" },
+	{ 0x9E091FEE, 0, "sound/vox/use.wav" },
+	{ 0x84BFC610, 0, "sound/scientist/c1a0_sci_dis1a.wav" },
+	{ 0x52399D0C, 0, "sound/ba_holo/tr_holo_medkit.wav" },
+	{ 0xB0123EC7, 0, "sound/hgrunt/some!.wav" },
+	{ 0xFE52D9EC, 0, "sprites/snow.spr" },
+	{ 0x3C4115A3, 0, "sound/ctf/soldier_flagtaken.wav" },
+	{ 0x367B7ADA, 0, "sound/scientist/scream18.wav" },
+	{ 0x2C93C9CD, 0, "sound/sentences/c1a4_3.wav" },
+	{ 0x02A17798, 0, "models/zombie01.mdl" },
+	{ 0xB216CFE0, 0, "sound/sentences/c1a0_22.wav" },
+	{ 0xA07E3DB9, 0, "overviews/crossover2.bmp" },
+	{ 0xEE1863FE, 0, "sound/sentences/ctr16.wav" },
+	{ 0x146E7E33, 0, "sound/weapons/colt_draw_pullslide.wav" },
+	{ 0xE8BA7398, 0, "sound/fgrunt/intro_fg19.wav" },
+	{ 0x1D4162E3, 0, "sound/player/death4.wav" },
+	{ 0x62444D2A, 0, "sound/rosenberg/ro_tele_xen03b.wav" },
+	{ 0xF1F8DA82, 0, "sound/drill/oc107c.wav" },
+	{ 0x33777ECD, 0, "sound/barnacle/bcl_tongue1.wav" },
+	{ 0xAA1A4CC3, 0, "sprites/clip_bullets.spr" },
+	{ 0x33E33C0F, 0, "gfx/env/xen8up.tga" },
+	{ 0xFE027ABD, 0, "sound/vox/towards.wav" },
+	{ 0xBE523D49, 0, "overviews/dod_caen.txt" },
+	{ 0x212C89BE, 0, "models/w_batterylt.mdl" },
+	{ 0x034ABAFE, 0, "sprites/obj_icons/icon_obj_truck_allies.spr" },
+	{ 0xA20BC875, 0, "sound/barney/c2a_ba_hub1a.wav" },
+	{ 0xAD64132C, 0, "sound/sentences/hev_hlth6.wav" },
+	{ 0x5D2A38D6, 0, "sound/fvox/antidote_shot.wav" },
+	{ 0xDFC97BBD, 0, "gfx/env/tornskylf.tga" },
+	{ 0x60999E03, 0, "models/p_rpg2.mdl" },
+	{ 0x31E1FCE1, 0, "gfx/vgui/640_op4_random.tga" },
+	{ 0x9A6506FC, 0, "models/p_fairbairn.mdl" },
+	{ 0xACE1CFE6, 0, "overviews/stalkyard.bmp" },
+	{ 0x38D44E3F, 0, "classes/short_randompc.txt" },
+	{ 0xD200CBD2, 0, "sound/hgrunt/bogies!.wav" },
+	{ 0xD4863C00, 0, "gfx/vgui/clsimages/cls_bazooka.tga" },
+	{ 0x3867DC84, 0, "sound/weapons/whizz16.wav" },
+	{ 0x01194372, 0, "overviews/dmc_e1m2.txt" },
+	{ 0x2461E25F, 0, "sound/ops/of6a2_bo01.wav" },
+	{ 0x5F548F8C, 0, "sound/plats/vehicle_start1.wav" },
+	{ 0x081AEC6B, 0, "sound/player/gerbackup.wav" },
+	{ 0x2CA3E2FD, 0, "sound/scientist/c3a1_sci_done.wav" },
+	{ 0xD5B5CA53, 0, "sound/hgrunt/bastard.wav" },
+	{ 0xE5F60E63, 0, "sound/barney/c3a1_ba_1sat.wav" },
+	{ 0x40E06B28, 0, "sound/weapons/pl_gun2.wav" },
+	{ 0xFD12994E, 0, "sound/sentences/c1a2_4.wav" },
+	{ 0x79ECF20E, 0, "sprites/rockets.spr" },
+	{ 0x7B018E87, 0, "sound/vox/high.wav" },
+	{ 0x579D9050, 0, "sound/scientist/scream05.wav" },
+	{ 0x457487A4, 0, "sound/weapons/de_shot1.wav" },
+	{ 0xB9B63D7F, 0, "sound/debris/zap3.wav" },
+	{ 0x6D25ADC6, 0, "models/w_battery.mdl" },
+	{ 0x8A58B6CE, 0, "models/lv_bottle.mdl" },
+	{ 0xC03D04D0, 0, "sound/hgrunt/suppressing!.wav" },
+	{ 0x73312812, 0, "resource/icon_close.tga" },
+	{ 0x960085A7, 0, "sound/vox/got.wav" },
+	{ 0xCE00A5F9, 0, "sound/ambience/turretrot2.wav" },
+	{ 0x2FF4D539, 0, "sound/scientist/sc_power_alt1.wav" },
+	{ 0xFF77570B, 0, "sound/vox/search.wav" },
+	{ 0x79A7FA29, 0, "sound/player/death2.wav" },
+	{ 0xF8EE0C42, 0, "sound/hgrunt/negative!.wav" },
+	{ 0x3F5F4248, 0, "overviews/dcdm5.bmp" },
+	{ 0xFE545A77, 0, "gfx/env/neb1bk.bmp" },
+	{ 0x048FE1D2, 0, "resource/icon_radiounsel.tga" },
+	{ 0x31421229, 0, "sound/gman/gman_mumble4.wav" },
+	{ 0xA8058A5E, 0, "sound/items/cliprelease1.wav" },
+	{ 0x83F5C3A1, 0, "sound/fvox/meters.wav" },
+	{ 0xCEBB7154, 0, "sound/vox/seven.wav" },
+	{ 0xCFFCD9F5, 0, "sound/vox/micro.wav" },
+	{ 0xB9087E9A, 0, "sound/barney/ba_attack1.wav" },
+	{ 0x28A7F8E5, 0, "models/pow_quad.mdl" },
+	{ 0xB2695C0D, 0, "sound/scientist/scream19.wav" },
+	{ 0xB628AB9C, 0, "sprites/fexplo1.spr" },
+	{ 0x29B84928, 0, "sound/vox/invasion.wav" },
+	{ 0xA90C440C, 0, "sound/player/gerenemyahead.wav" },
+	{ 0x5A62777D, 0, "models/otis01.mdl" },
+	{ 0x68DA5F8E, 0, "sound/vox/left.wav" },
+	{ 0xA3F1DC80, 0, "sound/sentences/nh0.wav" },
+	{ 0x0EE03584, 0, "sound/debris/metal6.wav" },
+	{ 0x8207779A, 0, "sound/sentences/ed5.wav" },
+	{ 0x64A8F92C, 0, "resource/valve_tchinese.txt" },
+	{ 0x8AB23640, 0, "sound/sentences/hev_e5.wav" },
+	{ 0x62F81649, 0, "sound/hgrunt/area.wav" },
+	{ 0x1829C323, 0, "gfx/env/desertrt.bmp" },
+	{ 0x59BC4EA3, 0, "sound/nihilanth/nil_win.wav" },
+	{ 0x913D8DAF, 0, "sound/gman/gman_mumble6.wav" },
+	{ 0x863BF328, 0, "gfx/vgui/round_corner_se.tga" },
+	{ 0x1924477F, 0, "sprites/obj_tnt.spr" },
+	{ 0xD2419EBB, 0, "sound/barney/openfire.wav" },
+	{ 0xEE4329B8, 0, "sound/sentences/we2.wav" },
+	{ 0xFBD9A019, 0, "sound/scientist/sci_pain3.wav" },
+	{ 0xD7AE7EF0, 0, "sprites/invisible.spr" },
+	{ 0x4F191125, 0, "sound/player/gerflank.wav" },
+	{ 0x4E527235, 0, "sound/weapons/sniper_reload_second_seq.wav" },
+	{ 0x823B2373, 0, "models/p_tmp.mdl" },
+	{ 0x44DF2379, 0, "sprites/water1.spr" },
+	{ 0x578CE233, 0, "sound/weapons/famas-1.wav" },
+	{ 0x4F467F91, 0, "sound/fgrunt/imhit.wav" },
+	{ 0xC034E599, 0, "models/shell_medium.mdl" },
+	{ 0xC31EC329, 0, "sound/drill/dr2_add13.wav" },
+	{ 0xCEA7B74D, 0, "sound/hgrunt/sixtymeters.wav" },
+	{ 0xC1421867, 0, "sound/sentences/hg_quest7.wav" },
+	{ 0x96FCA27E, 0, "gfx/vgui/1024_arrowdown.tga" },
+	{ 0x373A4063, 0, "resource/icon_faster.tga" },
+	{ 0x4BD4B276, 0, "sound/player/pl_duct4.wav" },
+	{ 0xC5BD11CA, 0, "sound/pitdrone/pit_drone_pain2.wav" },
+	{ 0xCCA4A574, 0, "sound/weapons/hit_snow2.wav" },
+	{ 0x3A96C29B, 0, "models/console_civ_scientist01.mdl" },
+	{ 0x617220A9, 0, "sound/vox/dual.wav" },
+	{ 0x1E55E32D, 0, "models/p_luger.mdl" },
+	{ 0x1A3DD640, 0, "sprites/640hud2.spr" },
+	{ 0x4221B16F, 0, "sound/ambience/pumper.wav" },
+	{ 0x6AA89927, 0, "sound/gonome/gonome_melee2.wav" },
+	{ 0x5A5A2B69, 0, "sound/fgrunt/alien.wav" },
+	{ 0x3E1B3B51, 0, "sound/fgrunt/dogs.wav" },
+	{ 0x9288AD4F, 0, "gfx/env/doom1ft.tga" },
+	{ 0xF465F149, 0, "gfx/env/nightrt.tga" },
+	{ 0x10C59CCA, 0, "overviews/undertow.tga" },
+	{ 0x5F15CA10, 0, "sprites/obj_icons/icon_obj_docs_allies.spr" },
+	{ 0xDB3A2ECC, 0, "gfx/vgui/p90.tga" },
+	{ 0xA49654D5, 0, "sprites/german.spr" },
+	{ 0xD51AA2E4, 0, "sprites/640hud17.spr" },
+	{ 0x75756289, 0, "sound/rosenberg/ro_tele_final16.wav" },
+	{ 0x4B058360, 0, "sound/rosenberg/ro_tele_final06.wav" },
+	{ 0x34C08B0E, 0, "sound/rosenberg/ro_yard_rose3.wav" },
+	{ 0xE39C53C7, 0, "models/office_gibs.mdl" },
+	{ 0xAE2A7673, 0, "sound/otis/ot_intro_seeya.wav" },
+	{ 0xC6A58755, 0, "sprites/hudglsm.spr" },
+	{ 0x4A48317B, 0, "resource/vgui_portuguese.txt" },
+	{ 0x71C6A05F, 0, "sound/vox/chamber.wav" },
+	{ 0x5B869F12, 0, "gfx/vgui/640_sniperred.tga" },
+	{ 0x745C7B8F, 0, "sound/vox/valid.wav" },
+	{ 0x218C15F0, 0, "models/pit_drone_spike.mdl" },
+	{ 0xB13F67BA, 0, "sound/items/tr_kevlar.wav" },
+	{ 0xE0B456F0, 0, "sound/items/weaponpickup.wav" },
+	{ 0x0DA638A9, 0, "models/mapmodels/books1.mdl" },
+	{ 0xBD191923, 0, "sound/shockroach/shock_idle3.wav" },
+	{ 0x77230773, 0, "sound/ambience/pounder.wav" },
+	{ 0x90580CCE, 0, "sprites/spotlight03.spr" },
+	{ 0x64F0D4CA, 0, "sound/misc/main_elevator_catch.wav" },
+	{ 0x0848F1D6, 0, "sound/vox/ed.wav" },
+	{ 0x460FB0B8, 0, "sound/debris/beamstart4.wav" },
+	{ 0xFB54E15F, 0, "sound/vox/squad.wav" },
+	{ 0xFDDFC730, 0, "sound/fvox/ninety.wav" },
+	{ 0xC30C86CA, 0, "resource/icon_folder.tga" },
+	{ 0x7A4C644C, 0, "overviews/rock2.bmp" },
+	{ 0x18B7144D, 0, "sound/headcrab/hc_idle5.wav" },
+	{ 0x8D094505, 0, "sound/sentences/hev_f7.wav" },
+	{ 0xE7091734, 0, "sprites/iunknown.spr" },
+	{ 0x1019D0DE, 0, "sound/scientist/illwaithere.wav" },
+	{ 0xEEC2C381, 0, "models/hornet.mdl" },
+	{ 0xE33CEEF4, 0, "models/w_batteryt.mdl" },
+	{ 0xABBD8393, 0, "sound/sentences/hg_clear4.wav" },
+	{ 0x0AC582A5, 0, "sprites/wall_puff4.spr" },
+	{ 0x93E74A7E, 0, "overviews/de_chateau.bmp" },
+	{ 0x7AD79ED7, 0, "sound/hgrunt/i.wav" },
+	{ 0xB0EE1105, 0, "models/mapmodels/jed_begravning.mdl" },
+	{ 0x9804A894, 0, "sound/bullchicken/bc_spithit3.wav" },
+	{ 0xC29AC231, 0, "sound/sentences/c2a4_0.wav" },
+	{ 0x2AF27AFF, 0, "sound/plats/train1.wav" },
+	{ 0x2E2AD6CC, 0, "models/w_greasegun.mdl" },
+	{ 0xB06425BE, 0, "sound/shocktrooper/shock_trooper_die2.wav" },
+	{ 0xC014E51C, 0, "gfx/env/dmcpbk.tga" },
+	{ 0xBFE17E9A, 0, "sound/plats/ttrain_start1.wav" },
+	{ 0x601643E5, 0, "sound/scientist/saved.wav" },
+	{ 0x7E832080, 0, "sound/debris/zap6.wav" },
+	{ 0x3FA37048, 0, "sound/gonarch/gon_birth2.wav" },
+	{ 0xA478AC1E, 0, "sound/barney/ba_pain1.wav" },
+	{ 0x46DB043C, 0, "models/baby_headcrab.mdl" },
+	{ 0x95F7E21F, 0, "models/g_light.mdl" },
+	{ 0x52E61EC7, 0, "sprites/obj_icons/dod_falaise/icon_obj_custom2_axis.spr" },
+	{ 0x56A14BB5, 0, "sound/drill/oc107b.wav" },
+	{ 0x866A76D5, 0, "sound/fvox/powerarmor_on.wav" },
+	{ 0xF3AF7426, 0, "sprites/portal1.spr" },
+	{ 0x57076347, 0, "gfx/env/morningdewbk.bmp" },
+	{ 0x4EA0F12A, 0, "sound/weapons/de_deploy.wav" },
+	{ 0x7CB43E8D, 0, "gfx/env/neb7bk.bmp" },
+	{ 0x6690023A, 0, "sound/sentences/hev_hornet.wav" },
+	{ 0xB3F9A646, 0, "sound/voltigore/voltigore_idle1.wav" },
+	{ 0x69B12F43, 0, "sound/radio/of6a2_rd01.wav" },
+	{ 0xEC32F0FE, 0, "models/player/zombie/zombie.bmp" },
+	{ 0x73847E16, 0, "sound/barney/ba_security2_desk1.wav" },
+	{ 0x0D166282, 0, "sound/hgrunt/oh!.wav" },
+	{ 0x703DC9B9, 0, "sound/fgrunt/hell.wav" },
+	{ 0xCBE4C3F1, 0, "sound/ambience/artyboom.wav" },
+	{ 0x0C0A1FDA, 0, "overviews/push.tga" },
+	{ 0x412DA3BF, 0, "sound/sentences/nchem0.wav" },
+	{ 0x77F41B41, 0, "sprites/bmp/2expl07.bmp" },
+	{ 0xA303F8D9, 0, "sound/scientist/sci_pain10.wav" },
+	{ 0xB9AE0B6D, 0, "sprites/bmp/medic04.bmp" },
+	{ 0xCB736307, 0, "sound/vox/screen.wav" },
+	{ 0xDF627683, 0, "sprites/ikgrass2.spr" },
+	{ 0x74EDBCCE, 0, "torntextures.wad" },
+	{ 0x817362D1, 0, "models/detpack.mdl" },
+	{ 0x8C3E3E39, 0, "sound/barney/ba_bring.wav" },
+	{ 0xCD63DF4D, 0, "gfx/vgui/clsimages/cls_sten.tga" },
+	{ 0xF5CD240A, 0, "gfx/env/nightup.tga" },
+	{ 0x26BC1984, 0, "sound/vox/renegade.wav" },
+	{ 0x26C682B0, 0, "sound/hgrunt/down.wav" },
+	{ 0xD1FAEF06, 0, "sound/agrunt/ag_alert4.wav" },
+	{ 0xAE8CBCFB, 0, "classes/long_hwguy.txt" },
+	{ 0x1334D98D, 0, "sprites/of_nv.spr" },
+	{ 0xCB165BBC, 0, "overviews/dod_avalanche.bmp" },
+	{ 0x6B6D6E4F, 0, "gfx/detail/wall2.tga" },
+	{ 0x6A2137B5, 0, "sound/hgrunt/c2a3_ambush_fx.wav" },
+	{ 0x866A13F3, 0, "sprites/mapsprites/jagd_grass_01.spr" },
+	{ 0x2A970924, 0, "sound/shocktrooper/kss.wav" },
+	{ 0xD6199049, 0, "sound/scientist/of1a1_sc02.wav" },
+	{ 0xB96BB96F, 0, "sound/barney/survive.wav" },
+	{ 0xFFA374E4, 0, "gfx/env/duskdn.tga" },
+	{ 0x7B9445F0, 0, "sound/vox/stolen.wav" },
+	{ 0xC63A0366, 0, "sprites/ikgrass5.spr" },
+	{ 0xA29D56E6, 0, "sound/weapons/concgren_blast3.wav" },
+	{ 0x3F451240, 0, "sound/fgrunt/scout.wav" },
+	{ 0x422B87C1, 0, "sound/vox/until.wav" },
+	{ 0x6A55C75F, 0, "sound/vox/f.wav" },
+	{ 0x9BAFAEA3, 0, "sound/hgrunt/bogies.wav" },
+	{ 0xAA29E85F, 0, "models/w_shotbox_big.mdl" },
+	{ 0x681E142B, 0, "sound/vox/grenade.wav" },
+	{ 0x4DA5B7F4, 0, "models/w_xm1014.mdl" },
+	{ 0x03407ADA, 0, "gfx/env/stdn.tga" },
+	{ 0x9F5C1795, 0, "sound/misc/teleport_in.wav" },
+	{ 0x47A32195, 0, "sound/player/gerbehindus.wav" },
+	{ 0x48DACE2C, 0, "gfx/vgui/fonts/640_hintmessage text.tga" },
+	{ 0xB22EFD50, 0, "models/w_gaussammo.mdl" },
+	{ 0x58B09363, 0, "resource/dmc_german.txt" },
+	{ 0xC32F538C, 0, "gfx/detail/dt_smooth2.tga" },
+	{ 0x74C8792A, 0, "sprites/obj_icons/dod_zalec/icon_obj_custom1_axis.spr" },
+	{ 0x649BBFD5, 0, "sound/player/gertakingfireright.wav" },
+	{ 0x277FE452, 0, "sound/sentences/hg_quest0.wav" },
+	{ 0x65854F1D, 0, "sound/rosenberg/ro_tele_final05.wav" },
+	{ 0x6A864854, 0, "models/mapmodels/barber_sign.mdl" },
+	{ 0x46330532, 0, "sound/items/inv1.wav" },
+	{ 0x6FC2D1EE, 0, "sound/barney/ba_security1_door3.wav" },
+	{ 0xAC1697D9, 0, "models/p_egon.mdl" },
+	{ 0x506B2B7E, 0, "sound/player/helmet_hit.wav" },
+	{ 0x655BB8EC, 0, "sound/fgrunt/locksmith.wav" },
+	{ 0x69723308, 0, "models/mapmodels/electric_wire1.mdl" },
+	{ 0xF181B6CB, 0, "sound/rosenberg/ro_wound1.wav" },
+	{ 0x8743D387, 0, "sound/plats/vehicle7.wav" },
+	{ 0x660537D8, 0, "sound/weapons/knife_hit2.wav" },
+	{ 0xB32E7C9E, 0, "sound/sentences/c2a2_3v2.wav" },
+	{ 0xA4533992, 0, "sound/scientist/statusreport.wav" },
+	{ 0x021AF472, 0, "gfx/env/grnplsntup.tga" },
+	{ 0xEFC8E8AC, 0, "sound/sentences/ed3.wav" },
+	{ 0x078D16BB, 0, "gfx/env/dmcwup.tga" },
+	{ 0x593FBF65, 0, "models/v_rock2.mdl" },
+	{ 0x6C5FE863, 0, "sound/hgrunt/in.wav" },
+	{ 0x55561EC8, 0, "sound/vox/hangar.wav" },
+	{ 0x35CE0BE9, 0, "models/mapmodels/bord.mdl" },
+	{ 0x3DDE1D27, 0, "sound/hgrunt/quiet!.wav" },
+	{ 0x692957B9, 0, "gfx/vgui/hint_gerhead.tga" },
+	{ 0xD213E82A, 0, "sound/player/britbackup.wav" },
+	{ 0xFECDDC23, 0, "sound/barney/of6a4_ba04.wav" },
+	{ 0x77B28FDE, 0, "sound/weapons/p228_slidepull.wav" },
+	{ 0x686D1DA4, 0, "sound/hgrunt/is.wav" },
+	{ 0x95C8CE7A, 0, "sound/vox/activated.wav" },
+	{ 0xE8AD3E83, 0, "sound/debris/bustmetal1.wav" },
+	{ 0x499B6AD4, 0, "sound/tentacle/te_move1.wav" },
+	{ 0x6BC7EF6E, 0, "gfx/env/cliff2ft.bmp" },
+	{ 0xE4B26F8E, 0, "sound/gonarch/gon_childdie3.wav" },
+	{ 0x92DD651E, 0, "sound/barney/ba_another.wav" },
+	{ 0x6B39FA6F, 0, "sound/barney/youhearthat.wav" },
+	{ 0xC04E891C, 0, "sound/geneworm/geneworm_final_pain2.wav" },
+	{ 0x6C81E62B, 0, "sound/otis/damn.wav" },
+	{ 0xC54C9C8B, 0, "sound/sentences/hev_dmg7.wav" },
+	{ 0x3B7126D0, 0, "sound/fgrunt/post.wav" },
+	{ 0x728E7A2F, 0, "overviews/de_train.bmp" },
+	{ 0x03EAF61F, 0, "sound/hgrunt/gr_die1.wav" },
+	{ 0x2912C06A, 0, "gfx/env/cityrt.tga" },
+	{ 0xCB85B828, 0, "sound/weapons/spore_hit2.wav" },
+	{ 0xDE6FA715, 0, "sound/weapons/knife3.wav" },
+	{ 0x9ECA19AF, 0, "sound/ambience/lv5.wav" },
+	{ 0xBFD5D06D, 0, "sound/holo/tr_holo_usetrain.wav" },
+	{ 0x66F0EBD7, 0, "sprites/sniper_scope.spr" },
+	{ 0xF6BAD29E, 0, "gfx/vgui/clsimages/brits.tga" },
+	{ 0xD391D84D, 0, "sound/sentences/hev_hlth1.wav" },
+	{ 0xDD6981C6, 0, "sound/fvox/get_bolts.wav" },
+	{ 0xCB228708, 0, "sound/player/inlava.wav" },
+	{ 0xDB36C64C, 0, "overviews/lambda_bunker.bmp" },
+	{ 0x2797ADEC, 0, "models/player/engineer/engineer2.mdl" },
+	{ 0x77A3D001, 0, "sound/debris/beamstart10.wav" },
+	{ 0x8A97DA47, 0, "sound/scientist/allnominal.wav" },
+	{ 0xF657D7A8, 0, "sound/barney/diebloodsucker.wav" },
+	{ 0xEFC13A74, 0, "sound/scientist/c1a0_sci_stayback.wav" },
+	{ 0x7E6A63D2, 0, "sprites/obj_icons/dod_saints/icon_obj_custom1_allies.spr" },
+	{ 0xA058C6D0, 0, "sound/sentences/hev_hlth2.wav" },
+	{ 0x2409A15A, 0, "sound/scientist/c1a0_sci_dis1c.wav" },
+	{ 0xFF873F8C, 0, "sprites/discreturn.spr" },
+	{ 0x0C284434, 0, "sprites/icon_truck_axis.spr" },
+	{ 0x89B144A2, 0, "sound/items/medshot4.wav" },
+	{ 0x4F1666BC, 0, "sound/pitworm/pit_worm_attack_swipe1.wav" },
+	{ 0xD41C284D, 0, "sound/turret/tu_spinup.wav" },
+	{ 0x454276E2, 0, "gfx/env/alien3dn.bmp" },
+	{ 0x5BE9FD0C, 0, "sprites/bmp/2fire03.bmp" },
+	{ 0xE494D9A5, 0, "sound/weapons/spore_hit1.wav" },
+	{ 0x2BA91BEE, 0, "sound/misc/spark1.wav" },
+	{ 0x677C411D, 0, "sound/debris/bustflesh2.wav" },
+	{ 0xB6E7C0D1, 0, "sound/misc/outro_truck.wav" },
+	{ 0xC81E4F7A, 0, "sound/ambience/fallscream.wav" },
+	{ 0xF865F023, 0, "sprites/weapon_grenadel.txt" },
+	{ 0x7FCAC8CA, 0, "models/v_fairbairn.mdl" },
+	{ 0x5DF247D0, 0, "sound/fgrunt/short.wav" },
+	{ 0x58BC934D, 0, "sound/scientist/c1a0_sci_gm1.wav" },
+	{ 0x7E88A8F9, 0, "maps/hunted.txt" },
+	{ 0x2D673267, 0, "models/support1.mdl" },
+	{ 0x341F3322, 0, "sound/ambience/ambient_summer.wav" },
+	{ 0x173A373D, 0, "sound/hgrunt/lookout.wav" },
+	{ 0x7C1B9680, 0, "sound/buttons/latchunlocked2.wav" },
+	{ 0x3053EA7B, 0, "gfx/env/deslf.tga" },
+	{ 0x3458AC4F, 0, "sound/vox/blue.wav" },
+	{ 0xD92F605A, 0, "gfx/vgui/800_arrowleft.tga" },
+	{ 0x53913268, 0, "sound/weapons/generic_reload.wav" },
+	{ 0xC010B09C, 0, "sound/hassault/hw_shoot2.wav" },
+	{ 0xDB93D790, 0, "sound/scientist/sci_fear15.wav" },
+	{ 0x5EC60174, 0, "sound/radio/roger.wav" },
+	{ 0xA61C1A52, 0, "models/v_fcarb.mdl" },
+	{ 0xBD9C719D, 0, "models/pi_tree.mdl" },
+	{ 0x6B5A3F73, 0, "sound/fvox/beep.wav" },
+	{ 0x9EE12604, 0, "gfx/vgui/icntlk_nottalking.tga" },
+	{ 0x0E47647C, 0, "sprites/bmp/2medic01.bmp" },
+	{ 0x3D8626C1, 0, "sprites/tree2.spr" },
+	{ 0x75F52AAD, 0, "classes/short_grunt.txt" },
+	{ 0x7EC51486, 0, "sound/common/splash_large.wav" },
+	{ 0x97736B51, 0, "gfx/env/alien2ft.bmp" },
+	{ 0x2FB78988, 0, "sound/weapons/mgbolt.wav" },
+	{ 0x6B1AF9F8, 0, "sprites/dot.spr" },
+	{ 0x371C2A37, 0, "gfx/env/hackup.tga" },
+	{ 0xD0403299, 0, "sound/fgrunt/pain5.wav" },
+	{ 0x88324EDB, 0, "sound/weapons/tommy_draw_slideback.wav" },
+	{ 0x7A1A9975, 0, "sound/sentences/hev_18p.wav" },
+	{ 0x95A2C942, 0, "sound/fvox/get_crossbow.wav" },
+	{ 0xA7748C22, 0, "sound/player/britareaclear.wav" },
+	{ 0x3FDC3908, 0, "models/pi_fern.mdl" },
+	{ 0x7EDD41AB, 0, "gfx/vgui/640_pyrored.tga" },
+	{ 0x2B20B694, 0, "sound/scientist/shutdownchart.wav" },
+	{ 0x1D624DC6, 0, "sound/fvox/buzz.wav" },
+	{ 0xF98BD2E5, 0, "sprites/icninvin.spr" },
+	{ 0x325ACA04, 0, "sound/sentences/hev_a5.wav" },
+	{ 0x0A2E95E6, 0, "models/gman.mdl" },
+	{ 0x3B5C7E95, 0, "gfx/env/morningdewft.tga" },
+	{ 0x0DC5AC1D, 0, "sound/otis/insurance.wav" },
+	{ 0xE7317230, 0, "sound/drill/dr2_add14.wav" },
+	{ 0xF5124CE5, 0, "sprites/iplayerblue.spr" },
+	{ 0x10B2DE8E, 0, "sound/sentences/hev_det5.wav" },
+	{ 0xFC93AFBB, 0, "sound/vox/biohazard.wav" },
+	{ 0xC947D8DC, 0, "sound/scientist/sc_pok5.wav" },
+	{ 0x26A85E2C, 0, "models/v_sg550.mdl" },
+	{ 0x3CBA9038, 0, "gfx/detail/dt_wood1.tga" },
+	{ 0xFA25A8C5, 0, "overviews/badlands.txt" },
+	{ 0xA8D6E118, 0, "sprites/rifle_smoke1.spr" },
+	{ 0xD16496DD, 0, "sound/vox/mister.wav" },
+	{ 0x65293714, 0, "gfx/vgui/1920_arrowup.tga" },
+	{ 0x068BBA3B, 0, "maps/cs_siege.txt" },
+	{ 0x1E0732A7, 0, "models/p_mg42bu.mdl" },
+	{ 0xE5D86C78, 0, "sound/rosenberg/ro_tele_xen10.wav" },
+	{ 0xE637CA7B, 0, "sound/rosenberg/ro_yard_notime1.wav" },
+	{ 0x5C74FF4D, 0, "sprites/320_2bounce.spr" },
+	{ 0x43233892, 0, "sound/fgrunt/six.wav" },
+	{ 0x21151F25, 0, "gfx/env/neb1dn.tga" },
+	{ 0x56F2F6C3, 0, "sprites/obj_icons/dod_falaise/icon_obj_custom2_neutral.spr" },
+	{ 0x50C7C81D, 0, "sound/misc/cow.wav" },
+	{ 0xEEE2747C, 0, "sound/vox/those.wav" },
+	{ 0x6A431281, 0, "gfx/vgui/fonts/1152_hintmessage text.tga" },
+	{ 0x995BD288, 0, "sound/vox/processing.wav" },
+	{ 0x47F5DC82, 0, "maps/de_inferno.txt" },
+	{ 0x79CDB185, 0, "gfx/env/cliffft.tga" },
+	{ 0x8165D31C, 0, "sound/scientist/c3a2_sci_shower.wav" },
+	{ 0xB7F99A08, 0, "resource/vgui_german.txt" },
+	{ 0xE3DF2D44, 0, "sound/sentences/c2a2_1.wav" },
+	{ 0xCCA93AB4, 0, "sound/vox/buzwarn.wav" },
+	{ 0x495B8D18, 0, "sound/fgrunt/needmedic.wav" },
+	{ 0x65294268, 0, "gfx/env/discrt.tga" },
+	{ 0xACDE3F77, 0, "sprites/640hud3.spr" },
+	{ 0xF9B7E881, 0, "sound/tentacle/te_alert1.wav" },
+	{ 0x2997A6CF, 0, "sprites/tf_weapon_gl.txt" },
+	{ 0xCC9532C3, 0, "sprites/tf_weapon_rpg.txt" },
+	{ 0x5968EDE2, 0, "models/v_tripmine.mdl" },
+	{ 0x25B82D8B, 0, "sound/weapons/knife1.wav" },
+	{ 0xD371D3B1, 0, "sound/otis/youbet.wav" },
+	{ 0x522F817E, 0, "models/w_jumppack.mdl" },
+	{ 0x1EA46B9F, 0, "models/w_oxygent.mdl" },
+	{ 0x0395006D, 0, "sound/hgrunt/c2a2_hg_chat3a.wav" },
+	{ 0x13CB0A73, 0, "sprites/320_decapitate.spr" },
+	{ 0xB1C88594, 0, "sound/scientist/scream09.wav" },
+	{ 0x24CF7405, 0, "sound/sentences/hg_answer1.wav" },
+	{ 0x1F8905F4, 0, "sprites/640hudof03.spr" },
+	{ 0xEE49B295, 0, "sprites/spore_exp_b_01.spr" },
+	{ 0x51C6E22F, 0, "sprites/effects/debris_foliage.spr" },
+	{ 0x431199F9, 0, "gfx/env/drkgft.tga" },
+	{ 0x98361EB2, 0, "sound/sentences/ctr12.wav" },
+	{ 0x2F1B5CF6, 0, "sound/aslave/slv_alert4.wav" },
+	{ 0x5F74EE5B, 0, "sound/weapons/spore_hit3.wav" },
+	{ 0x9CA178B2, 0, "dod_sturm.wad" },
+	{ 0xF76DF67F, 0, "sound/scientist/sc_pok4.wav" },
+	{ 0x94F7BED5, 0, "gfx/env/officeft.tga" },
+	{ 0xDC3C2FA1, 0, "gfx/vgui/flashbang.tga" },
+	{ 0x2D2AF687, 0, "sound/weapons/ofmortar.wav" },
+	{ 0x9E9919B7, 0, "sound/player/hud_nightvision.wav" },
+	{ 0xA7803E1D, 0, "models/w_securityt.mdl" },
+	{ 0x1B3280C8, 0, "models/wire_copper8.mdl" },
+	{ 0x9B868D65, 0, "sound/sentences/c2a1_1.wav" },
+	{ 0x4EB5DAE6, 0, "sprites/mapmarkers/arrow_s.spr" },
+	{ 0x5459BE52, 0, "sound/sentences/na14.wav" },
+	{ 0xAFD1F699, 0, "gfx/decals/hwshot1.bmp" },
+	{ 0x42A6504B, 0, "gfx/vgui/fonts/1280_scoreboard title text.tga" },
+	{ 0x5109C5D7, 0, "models/p_m40a1.mdl" },
+	{ 0xFA516946, 0, "sound/hgrunt/niner.wav" },
+	{ 0x616FF806, 0, "sprites/obj_icons/dod_merderet/icon_obj_custom1_allies.spr" },
+	{ 0x37DB1A26, 0, "sound/houndeye/he_pain3.wav" },
+	{ 0xAF13B411, 0, "sound/barney/c2a4_ba_1tau.wav" },
+	{ 0xD54D3A00, 0, "sound/sentences/hev_a9.wav" },
+	{ 0x73C363C2, 0, "sound/player/pl_step2.wav" },
+	{ 0xB90C0A08, 0, "sprites/puff2.spr" },
+	{ 0x1E0EB7F3, 0, "sound/ambience/particle_suck2.wav" },
+	{ 0x3F6CFBE8, 0, "halflife.wad" },
+	{ 0x7990FA4F, 0, "sound/barney/ba_later.wav" },
+	{ 0x6BFF19E5, 0, "models/p_displacer.mdl" },
+	{ 0x2E101B94, 0, "maps/dod_flugplatz_detail.txt" },
+	{ 0x6D0AF9FC, 0, "sound/fvox/danger.wav" },
+	{ 0x491EEF3C, 0, "sound/scientist/c1a3_sci_atlast.wav" },
+	{ 0x8C80ED1D, 0, "sound/misc/machine_off.wav" },
+	{ 0xEC5AFC6B, 0, "sound/gonarch/gon_step2.wav" },
+	{ 0xB682F3E0, 0, "sound/ambience/biotone.wav" },
+	{ 0x10C625DD, 0, "prodigy.wad" },
+	{ 0xA7CCF04F, 0, "sound/scientist/c1a1_sci_1scan.wav" },
+	{ 0x118567A1, 0, "sound/sentences/hev_rpg.wav" },
+	{ 0xEDB8606E, 0, "sprites/weapons2.spr" },
+	{ 0x173B04E4, 0, "sound/radio/rescued.wav" },
+	{ 0xED5F0F6B, 0, "sound/barney/gladof38.wav" },
+	{ 0x6E0FF1EF, 0, "models/w_deagle.mdl" },
+	{ 0x0E24B85B, 0, "models/v_egon.mdl" },
+	{ 0x86003C2F, 0, "sound/voltigore/voltigore_pain4.wav" },
+	{ 0x5B78C2BE, 0, "gfx/vgui/640_spyblue.tga" },
+	{ 0x31ADDEB2, 0, "sound/vox/base.wav" },
+	{ 0x7755E75E, 0, "sound/barney/c1a2_ba_climb.wav" },
+	{ 0x6C2B5441, 0, "resource/valve_italian.txt" },
+	{ 0x6FD3BF23, 0, "sound/sentences/hev_gauss.wav" },
+	{ 0x603CE2D4, 0, "sound/vox/released.wav" },
+	{ 0x497BE9A3, 0, "gfx/env/morningup.bmp" },
+	{ 0x15138B73, 0, "sprites/scope_binoc.spr" },
+	{ 0x85E3A3D2, 0, "sound/ambience/the_horror4.wav" },
+	{ 0xCB8E1597, 0, "sound/pitdrone/pit_drone_alert3.wav" },
+	{ 0x525BBD3C, 0, "sound/barney/icanhear.wav" },
+	{ 0xD40739A1, 0, "sound/otis/maybe.wav" },
+	{ 0xC75031EB, 0, "models/w_357ammoboxt.mdl" },
+	{ 0xF1963029, 0, "sprites/640hud5.spr" },
+	{ 0x6FB25DCE, 0, "sound/rosenberg/ro_tele_power1.wav" },
+	{ 0x3A0285CC, 0, "sound/player/gasp2.wav" },
+	{ 0xA9167236, 0, "models/rpgrocket.mdl" },
+	{ 0x9B5C573F, 0, "sound/vox/pain.wav" },
+	{ 0xBC82E8A8, 0, "sound/player/geiger6.wav" },
+	{ 0x3A4A43E5, 0, "sound/player/gersticktogether.wav" },
+	{ 0xB504A6D9, 0, "models/w_mac10.mdl" },
+	{ 0x4D382FBB, 0, "gfx/env/kraftstoffft.tga" },
+	{ 0x8FF45EE6, 0, "sound/scientist/of1a1_sc03.wav" },
+	{ 0x1A8171BE, 0, "sprites/nhth1.spr" },
+	{ 0x03213292, 0, "resource/icon_hlicon1.tga" },
+	{ 0x1B6409DB, 0, "sound/hornet/ag_buzz3.wav" },
+	{ 0xD91B3BC7, 0, "sound/fgrunt/of2a4_fg01.wav" },
+	{ 0xB92EE591, 0, "sound/otis/slowingyoudown.wav" },
+	{ 0x2C20FBFC, 0, "sound/ambience/rain.wav" },
+	{ 0x7E445ECE, 0, "sound/hgrunt/here.wav" },
+	{ 0xB85891C3, 0, "gfx/env/blackup.tga" },
+	{ 0xAAA8840A, 0, "gfx/env/morningdew_dn.tga" },
+	{ 0xE21399EE, 0, "sound/sentences/ef3.wav" },
+	{ 0x710D3C1A, 0, "models/w_icon.mdl" },
+	{ 0x25CFA0BC, 0, "sound/drill/rope05.wav" },
+	{ 0x6FE1E949, 0, "sound/leech/leech_alert2.wav" },
+	{ 0x1EC98467, 0, "gfx/detail/dt_stone4.tga" },
+	{ 0x52162078, 0, "models/player/civilian/civilian.mdl" },
+	{ 0xC5D7CCA2, 0, "models/p_sg550.mdl" },
+	{ 0x3C15F858, 0, "sound/fvox/wound_sterilized.wav" },
+	{ 0x7E34A902, 0, "sound/weapons/c4_plant.wav" },
+	{ 0xB6D92D6B, 0, "sound/vox/destroy.wav" },
+	{ 0x30E46376, 0, "sound/rosenberg/ro_ok9.wav" },
+	{ 0xBBAA6F85, 0, "sound/garg/gar_idle1.wav" },
+	{ 0x92B9EAF3, 0, "sprites/blood.spr" },
+	{ 0xEA3C7B05, 0, "sound/fvox/shock_damage.wav" },
+	{ 0x91D120F0, 0, "models/bomblet.mdl" },
+	{ 0xD95A0850, 0, "gfx/env/dmcwlf.tga" },
+	{ 0x4383F271, 0, "models/qloader.mdl" },
+	{ 0xC39D12CB, 0, "sound/weapons/thompson_shoot.wav" },
+	{ 0xFE2D0493, 0, "sound/sentences/hg_check1.wav" },
+	{ 0xC7DFA26F, 0, "sound/otis/imdead.wav" },
+	{ 0x4F81F45C, 0, "models/gordon.mdl" },
+	{ 0xC919270D, 0, "models/p_mortar.mdl" },
+	{ 0xFA7A5401, 0, "overviews/badlands.tga" },
+	{ 0xE821597A, 0, "sound/sentences/eh1.wav" },
+	{ 0x29511382, 0, "sound/boid/boid_alert1.wav" },
+	{ 0xE3430446, 0, "sound/discreturn.wav" },
+	{ 0xE2F6714C, 0, "maps/op4ctf_dam.txt" },
+	{ 0xC3D8B729, 0, "sound/weapons/ric8.wav" },
+	{ 0x32E1CDDD, 0, "classes/short_civ_random.txt" },
+	{ 0x718250DA, 0, "models/mapmodels/light_industrial2.mdl" },
+	{ 0xB2ED56FC, 0, "sound/ambience/usobjectivesecure.wav" },
+	{ 0x628FC408, 0, "sound/fvox/thirteen.wav" },
+	{ 0xF1D653B8, 0, "sprites/640hud13.spr" },
+	{ 0xE412EBAD, 0, "sound/ambience/alienvalve2.wav" },
+	{ 0xAF187615, 0, "sound/vox/been.wav" },
+	{ 0x73E0B179, 0, "sound/hgrunt/command.wav" },
+	{ 0xBAF5FFDD, 0, "maps/dod_kalt.txt" },
+	{ 0x024319B1, 0, "sound/otis/hearsomething.wav" },
+	{ 0x001781D5, 0, "sound/weapons/awp_deploy.wav" },
+	{ 0x21920760, 0, "sound/barnacle/bcl_chew1.wav" },
+	{ 0x5DF55195, 0, "sound/vox/shower.wav" },
+	{ 0xF8CE7DEE, 0, "sound/vox/armor.wav" },
+	{ 0x7B10BFF9, 0, "sound/vox/report.wav" },
+	{ 0x5F66E66A, 0, "gfx/env/duskbk.bmp" },
+	{ 0x35B30428, 0, "models/p_mg42bd.mdl" },
+	{ 0xE8B09B2A, 0, "sound/player/pl_pain4.wav" },
+	{ 0x82DC886A, 0, "sound/gman/of7a0_gm03.wav" },
+	{ 0x3A8B9C90, 0, "sound/hgrunt/four.wav" },
+	{ 0xB30C1190, 0, "sound/ambience/hammer.wav" },
+	{ 0x92486F51, 0, "sound/player/ustigerahead.wav" },
+	{ 0x7276218F, 0, "sound/items/gunpickup3.wav" },
+	{ 0x015E1B0F, 0, "sound/hgrunt/c2a2_hg_chat1a.wav" },
+	{ 0xB76E22DD, 0, "sound/aslave/slv_alert1.wav" },
+	{ 0xFA024615, 0, "sound/items/weapondrop.wav" },
+	{ 0xB0991FE7, 0, "sound/fvox/atmospherics_on.wav" },
+	{ 0xD5920A25, 0, "sound/player/geiger5.wav" },
+	{ 0x5DA28AD4, 0, "sound/hgrunt/quiet.wav" },
+	{ 0x96C46605, 0, "sound/player/usattack.wav" },
+	{ 0xA8F32F02, 0, "sound/weapons/flmfire2.wav" },
+	{ 0xAEE14819, 0, "sound/ambience/dog3.wav" },
+	{ 0x5638B208, 0, "sound/sentences/hev_f4.wav" },
+	{ 0xE255627A, 0, "sound/holo/holostn16.wav" },
+	{ 0xBA5C93A6, 0, "sound/player/h2odeath.wav" },
+	{ 0xE9D8CED4, 0, "sound/pitdrone/pit_drone_alert2.wav" },
+	{ 0x4DBC3BC2, 0, "models/v_mac10.mdl" },
+	{ 0x424BCD6A, 0, "models/mapmodels/pallet.mdl" },
+	{ 0xCA6BDC9D, 0, "models/teleporter_blue_sprites.mdl" },
+	{ 0xDE86AD2C, 0, "sound/items/flashlight2.wav" },
+	{ 0xB31AE05A, 0, "sound/vox/idiot.wav" },
+	{ 0xC50C6691, 0, "models/v_m40a1.mdl" },
+	{ 0x6FD1C42F, 0, "sound/ambience/thunder_clap.wav" },
+	{ 0xD02A05BB, 0, "sound/barney/sir.wav" },
+	{ 0xA9590A7F, 0, "overviews/cs_747.txt" },
+	{ 0x770BD2D3, 0, "sound/scientist/g_bounce1.wav" },
+	{ 0xDE31A760, 0, "models/p_m249.mdl" },
+	{ 0x5E49499B, 0, "maps/dod_kalt_detail.txt" },
+	{ 0xDB3572F0, 0, "sprites/obj_icons/dod_saints/icon_obj_custom3_allies.spr" },
+	{ 0x12F1A19E, 0, "sound/vox/ten.wav" },
+	{ 0x8E13028C, 0, "sprites/hud_mgbarrels.spr" },
+	{ 0x2D09C779, 0, "ajawad.wad" },
+	{ 0x1CC41258, 0, "sound/barney/howdy.wav" },
+	{ 0x3CCC8417, 0, "models/p_saw.mdl" },
+	{ 0xFF766017, 0, "models/barney03.mdl" },
+	{ 0xC8667077, 0, "sound/fgrunt/command.wav" },
+	{ 0x8069871E, 0, "overviews/as_oilrig.bmp" },
+	{ 0x48D0834B, 0, "gfx/detail/dt_plaster2.tga" },
+	{ 0xD3024FE5, 0, "sound/debris/impact_crete.wav" },
+	{ 0xEE448C9C, 0, "sprites/muz1.spr" },
+	{ 0x10619F9F, 0, "sound/barney/ba_power_wound1.wav" },
+	{ 0xE3A89B23, 0, "sound/scientist/c1a3_sci_thankgod.wav" },
+	{ 0x06BBFDB9, 0, "sound/vox/something.wav" },
+	{ 0x55C4C4F0, 0, "sound/sentences/hev_a10.wav" },
+	{ 0xBE096507, 0, "sound/scientist/whocansay.wav" },
+	{ 0xF95AB850, 0, "sound/sentences/c1a4_0.wav" },
+	{ 0x1A2F9B8F, 0, "sound/debris/pushbox1.wav" },
+	{ 0x4ED826FF, 0, "resource/platform_japanese.txt" },
+	{ 0x67F7E2AA, 0, "sprites/obj_tnt_sm.spr" },
+	{ 0x2203C045, 0, "sound/barney/c1a2_ba_2zomb.wav" },
+	{ 0xBB91517B, 0, "sound/gonarch/gon_birth3.wav" },
+	{ 0x88AF976A, 0, "sound/otis/joinyou.wav" },
+	{ 0x5BAFEAAE, 0, "sound/scientist/c1a0_sci_ctrl2a.wav" },
+	{ 0x0C2B2092, 0, "sound/fgrunt/feel.wav" },
+	{ 0xEACEB923, 0, "models/wranglert.mdl" },
+	{ 0xCF9CF2E1, 0, "sound/weapons/splauncher_bounce.wav" },
+	{ 0x395D5AC4, 0, "models/mapmodels/dod_jagd_horsa.mdl" },
+	{ 0x233B44F8, 0, "sound/weapons/garand_shoot.wav" },
+	{ 0x6AB26953, 0, "maps/de_dust.txt" },
+	{ 0x58BAC2FB, 0, "gfx/vgui/640_speaker4.tga" },
+	{ 0x9F32F296, 0, "sound/drill/livefire09.wav" },
+	{ 0xCFCE4EE9, 0, "sprites/bmp/tffire04.bmp" },
+	{ 0xC0F53A24, 0, "overviews/cz2.bmp" },
+	{ 0xCD74F765, 0, "gfx/env/dmcplf.tga" },
+	{ 0xE89F1759, 0, "sound/scientist/heal3.wav" },
+	{ 0x0471B3B9, 0, "sound/weapons/debris3.wav" },
+	{ 0x426CBA8D, 0, "models/w_squeakt.mdl" },
+	{ 0x8EF031DB, 0, "sound/scientist/ofcoursenot.wav" },
+	{ 0x16828E85, 0, "sound/ambience/3dmbridge.wav" },
+	{ 0xDE037C24, 0, "sound/rosenberg/ro_ok3.wav" },
+	{ 0x593A64BE, 0, "overviews/dod_zalec.bmp" },
+	{ 0x1F6122E1, 0, "sound/ambience/ae_snipsnip.wav" },
+	{ 0xD5DFE396, 0, "models/w_smokegrenade.mdl" },
+	{ 0xB524C0C4, 0, "sound/player/pl_tile2.wav" },
+	{ 0xD226933B, 0, "sound/sentences/hev_f5.wav" },
+	{ 0x7607237F, 0, "sound/holo/tr_sci_goodwork.wav" },
+	{ 0x064E1318, 0, "sprites/320_falling.spr" },
+	{ 0xA1C11FA2, 0, "sound/scientist/corporal.wav" },
+	{ 0x8168A0AB, 0, "gfx/env/blacklf.bmp" },
+	{ 0xC06CCBB0, 0, "sound/sentences/hg_cover3.wav" },
+	{ 0x1152BF67, 0, "sound/barney/teamup2.wav" },
+	{ 0xCC2B8716, 0, "sound/player/brittakecover.wav" },
+	{ 0xBA87FE45, 0, "sound/debris/beamstart14.wav" },
+	{ 0x4D4A3150, 0, "gfx/vgui/640_discred.tga" },
+	{ 0x4A6898AA, 0, "sprites/640_0bounce.spr" },
+	{ 0xDEEE7204, 0, "sound/sentences/hg_gren6.wav" },
+	{ 0x50AC9FAF, 0, "sound/player/britdisplace.wav" },
+	{ 0x5099963D, 0, "sound/holo/tr_ba_lightson.wav" },
+	{ 0x1387B546, 0, "sound/ambience/lv6.wav" },
+	{ 0xC2D0C1C5, 0, "gfx/env/dmcwbk.tga" },
+	{ 0x4699E60B, 0, "sound/weapons/webley_shoot.wav" },
+	{ 0x3AA5BF77, 0, "sound/hgrunt/six!.wav" },
+	{ 0x7D78187A, 0, "sound/sentences/hg_cover1.wav" },
+	{ 0x028228E6, 0, "sound/scientist/scream03.wav" },
+	{ 0x9651B270, 0, "models/v_crowbar.mdl" },
+	{ 0x08E0ED6B, 0, "models/gib_b_bone.mdl" },
+	{ 0x3D462761, 0, "models/qmeal.mdl" },
+	{ 0x7C198A41, 0, "sound/plats/talkmove2.wav" },
+	{ 0x24BC9F7E, 0, "models/player/axis-para/axis-parat.mdl" },
+	{ 0xFDE85A7E, 0, "sound/weapons/famas_forearm.wav" },
+	{ 0x2BFB8E1D, 0, "sound/ambience/dodambience6.wav" },
+	{ 0xE0CEF68C, 0, "models/v_light.mdl" },
+	{ 0x9F5B9552, 0, "sound/sentences/hev_f20.wav" },
+	{ 0x2744B5FB, 0, "logos/turtle.bmp" },
+	{ 0x3E218E8E, 0, "sound/hgrunt/got.wav" },
+	{ 0x1EC52252, 0, "gfx/vgui/640_fast.tga" },
+	{ 0x3EE55FDC, 0, "models/mapmodels/tnt_crate.mdl" },
+	{ 0x62BFA961, 0, "models/p_shield.mdl" },
+	{ 0x82DC913D, 0, "sound/vox/pacify.wav" },
+	{ 0x686E28F3, 0, "gfx/vgui/640_hwguyred.tga" },
+	{ 0x6872F5CD, 0, "sound/object/object_dropped.wav" },
+	{ 0xD3D64898, 0, "sound/player/damage8.wav" },
+	{ 0xBDDA6607, 0, "sound/barney/c3a2_ba_6surv.wav" },
+	{ 0xEEC113EF, 0, "sprites/hud5.spr" },
+	{ 0xD3FB2C0D, 0, "gfx/env/trainyardrt.tga" },
+	{ 0xC80B3096, 0, "sound/scientist/c1a0_sci_dis7a.wav" },
+	{ 0x2495FA9D, 0, "sound/vox/son.wav" },
+	{ 0xA4783002, 0, "sound/sentences/c1a1_7.wav" },
+	{ 0xB578760C, 0, "sound/sentences/hg_cover7.wav" },
+	{ 0x186CC9A0, 0, "sound/sentences/nd4.wav" },
+	{ 0x2D6642BB, 0, "sound/sentences/na17.wav" },
+	{ 0x70ABB76C, 0, "sound/hgrunt/request!.wav" },
+	{ 0x24A1F264, 0, "models/agruntt.mdl" },
+	{ 0x6134838E, 0, "logos/washere.bmp" },
+	{ 0x93ECAEAE, 0, "sound/hgrunt/gr_mgun3.wav" },
+	{ 0x62F6CDCF, 0, "sound/bullchicken/bc_die3.wav" },
+	{ 0x9BB95F84, 0, "overviews/cs_siege.txt" },
+	{ 0x3E6586CF, 0, "models/v_scopedfg42.mdl" },
+	{ 0x1990E462, 0, "sound/gonome/gonome_death3.wav" },
+	{ 0x853D8E84, 0, "logos/gun1.bmp" },
+	{ 0x4D0C78DF, 0, "sound/vox/four.wav" },
+	{ 0x5FEF76FA, 0, "sound/drill/squad07.wav" },
+	{ 0x136BDFDC, 0, "sound/sentences/c1a3_lock.wav" },
+	{ 0xDD365703, 0, "sound/sentences/bell.wav" },
+	{ 0x7C8E5027, 0, "sound/ba_holo/tr_holo_startlift.wav" },
+	{ 0x26272CED, 0, "sound/sentences/ctr2.wav" },
+	{ 0x287EE57F, 0, "sound/sentences/t3.wav" },
+	{ 0xA5838492, 0, "gfx/vgui/smokegrenade.tga" },
+	{ 0xFE0843F1, 0, "models/p_paraknife.mdl" },
+	{ 0x30118885, 0, "models/p_mp40.mdl" },
+	{ 0xC30326AA, 0, "sound/barnacle/bcl_chew3.wav" },
+	{ 0x645AB20E, 0, "models/w_ump45.mdl" },
+	{ 0xA9C12C7E, 0, "models/teleporter_orange_rings.mdl" },
+	{ 0xA3F8D09A, 0, "sound/weapons/luger_shoot.wav" },
+	{ 0xEED0E52B, 0, "models/p_grease.mdl" },
+	{ 0x760CABE3, 0, "models/bag.mdl" },
+	{ 0xF60E28CC, 0, "sound/barney/c2a5_ba_rpg.wav" },
+	{ 0xE51EC5A7, 0, "sound/common/launch_select2.wav" },
+	{ 0x00C7BDBB, 0, "sound/garg/gar_idle3.wav" },
+	{ 0xDA17CA79, 0, "sound/scientist/c3a2_sci_position.wav" },
+	{ 0xC7385A88, 0, "models/otis02.mdl" },
+	{ 0xB2767616, 0, "sound/vox/system.wav" },
+	{ 0x6D734911, 0, "sound/player/britusepiat.wav" },
+	{ 0xC2A46B27, 0, "sound/hgrunt/sweep!.wav" },
+	{ 0x77162A3B, 0, "sound/vox/seventy.wav" },
+	{ 0xC7DC3F14, 0, "sound/weapons/asscan2.wav" },
+	{ 0x09D5C7AA, 0, "sound/scientist/checkatten.wav" },
+	{ 0x175CF403, 0, "n0th1ng.wad" },
+	{ 0x4C862FF9, 0, "gfx/env/neb1rt.tga" },
+	{ 0xE7FA5DF3, 0, "sound/sentences/hev_heal5.wav" },
+	{ 0x00B46CD9, 0, "dod_donner.wad" },
+	{ 0x77ED5A66, 0, "models/p_enfields.mdl" },
+	{ 0x5D502F7A, 0, "sound/sentences/c1a0_15.wav" },
+	{ 0x479EE767, 0, "models/uplant2t.mdl" },
+	{ 0x3575E988, 0, "sound/fgrunt/talking.wav" },
+	{ 0x771213E9, 0, "sound/fvox/time_remaining.wav" },
+	{ 0x4FB0CFEB, 0, "sound/player/pl_step1.wav" },
+	{ 0x1C2B4583, 0, "sound/turret/tu_fire1.wav" },
+	{ 0x34A96384, 0, "sound/weapons/deagle-2.wav" },
+	{ 0x56D5329D, 0, "resource/background/800_3_d_loading.tga" },
+	{ 0xB70979A5, 0, "gfx/env/neb1ft.tga" },
+	{ 0xA2A9E325, 0, "ctf manual/resources/pow_health_charge.wav" },
+	{ 0x466E0C8C, 0, "resource/platform_schinese.txt" },
+	{ 0xDC110FCB, 0, "sound/zombie/claw_miss1.wav" },
+	{ 0x8F47532A, 0, "sound/ambience/dog6.wav" },
+	{ 0x8ACD867F, 0, "sound/roach/rch_smash.wav" },
+	{ 0x87964730, 0, "sound/hgrunt/_period.wav" },
+	{ 0x0E19F156, 0, "sound/otis/diealone.wav" },
+	{ 0x7FDA7817, 0, "models/oranget.mdl" },
+	{ 0x6AC76CF7, 0, "sound/tride/c0a0_tr_noeat.wav" },
+	{ 0x09747DA3, 0, "sound/weapons/knife_hit_flesh2.wav" },
+	{ 0xECD9E2DC, 0, "models/chumtoad.mdl" },
+	{ 0x64F59275, 0, "sound/weapons/gewehr_reload_clipin.wav" },
+	{ 0x2EFA1132, 0, "sprites/parkhud.spr" },
+	{ 0xD35AB000, 0, "models/w_shotboxt.mdl" },
+	{ 0x2F59EF4B, 0, "models/v_spring.mdl" },
+	{ 0x86E59582, 0, "sound/holo/tr_holo_pullbox.wav" },
+	{ 0x54EF5A03, 0, "models/mapmodels/arc_bush.mdl" },
+	{ 0x6AF1AA0F, 0, "models/rope24.mdl" },
+	{ 0x2B4762A4, 0, "sound/apache/ap_whine1.wav" },
+	{ 0x3A9E816E, 0, "sound/weapons/aug_clipin.wav" },
+	{ 0xD4802643, 0, "sound/rosenberg/ro_outro1.wav" },
+	{ 0xA34A05BC, 0, "sound/player/pl_dirt3.wav" },
+	{ 0x294B4B9D, 0, "sound/player/tornoff2.wav" },
+	{ 0x006FDA7A, 0, "sound/scientist/sc_hello1.wav" },
+	{ 0x10E2A86D, 0, "sound/scientist/shakeunification.wav" },
+	{ 0xAA4B8AA8, 0, "sound/ambience/rocketflame1.wav" },
+	{ 0x947CF3FD, 0, "sound/sentences/dc4.wav" },
+	{ 0x9FBACB80, 0, "sound/rosenberg/ro_plfear3.wav" },
+	{ 0x0A83B310, 0, "models/tree_palm.mdl" },
+	{ 0x681E3CEC, 0, "sound/hgrunt/gr_pain2.wav" },
+	{ 0x5452D244, 0, "models/v_bgrap_tonguetip.mdl" },
+	{ 0x5724C4E9, 0, "sound/ba_holo/tr_holo_tryagain.wav" },
+	{ 0x38A1A69B, 0, "sprites/hud1.spr" },
+	{ 0x84F20B9C, 0, "models/mapmodels/fan_ceiling-hang.mdl" },
+	{ 0x4B603A0C, 0, "sound/scientist/of3a2_sc02.wav" },
+	{ 0x4E7F9DF1, 0, "gfx/vgui/640_discblue2.tga" },
+	{ 0xC29E23D1, 0, "sound/scientist/thiswillhelp.wav" },
+	{ 0xA704C074, 0, "sound/sentences/c1a1_10.wav" },
+	{ 0xD2AEF25D, 0, "sound/houndeye/he_blast2.wav" },
+	{ 0x450B0E1A, 0, "overviews/de_dust.txt" },
+	{ 0x6F82D5A8, 0, "sound/player/pl_fallpain3.wav" },
+	{ 0xED63A000, 0, "models/player/gman/gman.mdl" },
+	{ 0x2AB471ED, 0, "sound/vox/shipment.wav" },
+	{ 0xD949C28D, 0, "sound/hgrunt/level!.wav" },
+	{ 0xFA832402, 0, "gfx/vgui/clsimages/cls_garand.tga" },
+	{ 0x6AC84DF9, 0, "models/v_30cal.mdl" },
+	{ 0xD84B9ABD, 0, "sprites/320hudof01.spr" },
+	{ 0x74350462, 0, "sound/weapons/ric5.wav" },
+	{ 0x06172CF5, 0, "models/mapmodels/hedgehog.mdl" },
+	{ 0xFE85DB79, 0, "sound/ichy/ichy_idle4.wav" },
+	{ 0x8960EC97, 0, "sound/barney/ba_security2_pass.wav" },
+	{ 0x2DF5C2E1, 0, "sprites/640hud14.spr" },
+	{ 0x112DE9D2, 0, "overviews/dod_flugplatz.bmp" },
+	{ 0x902B2513, 0, "sound/vox/panel.wav" },
+	{ 0xCA1C2B58, 0, "gfx/vgui/1920_arrowleft.tga" },
+	{ 0x9BE6E680, 0, "sound/fans/fan1.wav" },
+	{ 0x008C68BB, 0, "sound/sentences/hg_quest3.wav" },
+	{ 0x822960C6, 0, "gfx/vgui/marker_red_x.tga" },
+	{ 0xC9DA361B, 0, "gfx/vgui/mac10.tga" },
+	{ 0xE9499DE4, 0, "sprites/effects/adrian/rain_splash.spr" },
+	{ 0x145030AA, 0, "gfx/vgui/1600_arrowdown.tga" },
+	{ 0x7C9D1828, 0, "models/player/ctf_scientist/ctf_scientist.bmp" },
+	{ 0x72AD3FB0, 0, "models/hostage08.mdl" },
+	{ 0xBBCFB5B5, 0, "gfx/env/cliff2lf.tga" },
+	{ 0x050262EC, 0, "cs_cbble.wad" },
+	{ 0xE8647560, 0, "sprites/320hud1.spr" },
+	{ 0xA91CCF77, 0, "sound/plats/ttrain_brake1.wav" },
+	{ 0xB3FC5EF7, 0, "gfx/vgui/map_sflag.tga" },
+	{ 0x4FE423C1, 0, "classes/short_soldier.txt" },
+	{ 0xC17FBA86, 0, "sound/otis/soundsbad.wav" },
+	{ 0xC0767681, 0, "sound/scientist/c2a3_sci_track.wav" },
+	{ 0x2FD0845A, 0, "gfx/env/badlandsdn.tga" },
+	{ 0x331BC6FF, 0, "sprites/mapsprites/ao_bangaloreobj.spr" },
+	{ 0x5798A953, 0, "models/backpack.mdl" },
+	{ 0x3D310BD0, 0, "sound/weapons/explode4.wav" },
+	{ 0x7CEF390D, 0, "sound/scientist/c1a0_sci_dis4a.wav" },
+	{ 0xE0C21789, 0, "sound/ambience/crow.wav" },
+	{ 0x51B39191, 0, "sound/ichy/ichy_pain2.wav" },
+	{ 0xA602FFA6, 0, "sound/weapons/hit_glass1.wav" },
+	{ 0x086FBB17, 0, "sound/weapons/cbar_hitbod1.wav" },
+	{ 0x0B3314F4, 0, "sound/player/breathe2.wav" },
+	{ 0x93CF6185, 0, "sound/scientist/weartie.wav" },
+	{ 0xD74F9576, 0, "sound/weapons/mp40_shoot.wav" },
+	{ 0x76CD7117, 0, "sound/vox/stairway.wav" },
+	{ 0xB54BE7CE, 0, "models/tentacle3.mdl" },
+	{ 0x28F40A17, 0, "sound/garg/gar_flamerun1.wav" },
+	{ 0x09025F35, 0, "models/p_spring.mdl" },
+	{ 0x9A7CDA38, 0, "sound/otis/alright.wav" },
+	{ 0xC967C91D, 0, "sound/scientist/nogrant.wav" },
+	{ 0x7354F34B, 0, "sound/de_torn/torn_thndrstrike.wav" },
+	{ 0x4B8C28E9, 0, "sprites/aplayer.spr" },
+	{ 0x8D2E2464, 0, "models/mapmodels/filecabinet.mdl" },
+	{ 0xA06A9C02, 0, "models/p_famas.mdl" },
+	{ 0x7C42AAF2, 0, "models/mapmodels/vicenza_tree1.mdl" },
+	{ 0x81404B22, 0, "gfx/env/avantidn.tga" },
+	{ 0x0FC41DA6, 0, "sound/hgrunt/people!.wav" },
+	{ 0x782CD88B, 0, "sound/otis/bigboned.wav" },
+	{ 0xF6046D78, 0, "sound/scientist/sc_canals1.wav" },
+	{ 0x564876E7, 0, "sound/barney/somethingdied.wav" },
+	{ 0xA4969EEC, 0, "sound/buttons/spark4.wav" },
+	{ 0x8C3D1895, 0, "gfx/vgui/icon_!-bigger.tga" },
+	{ 0xDCE68452, 0, "sprites/mapsprites/xsmoke3.spr" },
+	{ 0x62E7B0B5, 0, "sound/shocktrooper/kur.wav" },
+	{ 0x3FA4B706, 0, "sound/scientist/noo.wav" },
+	{ 0x5F8C5933, 0, "sound/scientist/c1a0_sci_lock1a.wav" },
+	{ 0x72797F18, 0, "sprites/fog1.spr" },
+	{ 0x7BF536AF, 0, "sound/weapons/xbow_fire1.wav" },
+	{ 0x0B2321CF, 0, "sound/weapons/tmp-2.wav" },
+	{ 0x84CDD867, 0, "models/p_tommy_l.mdl" },
+	{ 0x4B471355, 0, "models/p_30calpr.mdl" },
+	{ 0xE0257E1A, 0, "sound/weapons/fiveseven-1.wav" },
+	{ 0xE89C3FC0, 0, "sound/otis/of1a5_ot01.wav" },
+	{ 0xD322AEDF, 0, "sound/otis/die.wav" },
+	{ 0x87CDB457, 0, "sound/vox/thirty.wav" },
+	{ 0x7170416B, 0, "models/p_galil.mdl" },
+	{ 0xF4C0711B, 0, "sound/hgrunt/hell.wav" },
+	{ 0x8243CE47, 0, "sound/weapons/desert_eagle_sight.wav" },
+	{ 0xD7482614, 0, "sound/ambience/fd.wav" },
+	{ 0xD98A9CFC, 0, "sound/vox/before.wav" },
+	{ 0xE89B922F, 0, "sound/fvox/seventy.wav" },
+	{ 0x168D0699, 0, "sound/hgrunt/going!.wav" },
+	{ 0x47F5D979, 0, "sound/sentences/hev_heal3.wav" },
+	{ 0xD72CE7BF, 0, "sound/barney/c2a4_ba_teach.wav" },
+	{ 0xD36DF9D4, 0, "sound/radio/takepoint.wav" },
+	{ 0xA9DEFCF7, 0, "sound/ambience/britareasecure.wav" },
+	{ 0xF690E677, 0, "models/r_armor.mdl" },
+	{ 0xC5370531, 0, "gfx/env/snowcliffbk.tga" },
+	{ 0x3CA7656A, 0, "sound/sentences/hg_quest8.wav" },
+	{ 0x46D0A53B, 0, "sound/fgrunt/stay.wav" },
+	{ 0x83CAEC32, 0, "sound/weapons/whizz5.wav" },
+	{ 0xE5BA355A, 0, "sound/vox/antenna.wav" },
+	{ 0x1C04216D, 0, "models/support3.mdl" },
+	{ 0x0FCB08D3, 0, "gfx/env/alien1up.bmp" },
+	{ 0xE80D4371, 0, "sound/debris/bustcrate3.wav" },
+	{ 0xF6E76B9A, 0, "sound/scientist/scream07.wav" },
+	{ 0x690AFE01, 0, "sound/bullchicken/bc_attack3.wav" },
+	{ 0x7E3EF436, 0, "sound/ops/of6a2_bo02.wav" },
+	{ 0xE95180A5, 0, "sound/fgrunt/of2a6_fg01.wav" },
+	{ 0x4543C1C0, 0, "models/pit_worm_gibs.mdl" },
+	{ 0x1051086A, 0, "sound/vox/failed.wav" },
+	{ 0x53F3C00E, 0, "sound/debris/beamstart2.wav" },
+	{ 0xABF01B93, 0, "models/torch2b.mdl" },
+	{ 0x4902DAE3, 0, "models/w_sten.mdl" },
+	{ 0x5FAD58E1, 0, "sound/pitworm/pit_worm_angry2.wav" },
+	{ 0xE50FC650, 0, "sound/scientist/of1a1_sc05.wav" },
+	{ 0x41E5C411, 0, "gfx/env/sildom2dn.tga" },
+	{ 0xEE23A6A3, 0, "overviews/dod_falaise.txt" },
+	{ 0x5D6A1A46, 0, "sprites/smoke.spr" },
+	{ 0x1D4E4CDD, 0, "gfx/env/city1ft.tga" },
+	{ 0x94A4E0AA, 0, "sound/hostage/hos1.wav" },
+	{ 0xD4F2E659, 0, "sound/scientist/sci_3thou.wav" },
+	{ 0xECC518AA, 0, "gfx/env/stlf.tga" },
+	{ 0x3AEC8156, 0, "sound/otis/hiya.wav" },
+	{ 0x19FC86A3, 0, "maps/op4ctf_hairball.txt" },
+	{ 0x45E8C10E, 0, "classes/short_adrian.txt" },
+	{ 0x22C691AA, 0, "sound/barney/c1a2_ba_slew.wav" },
+	{ 0x36A46EC0, 0, "models/p_umbrella2.mdl" },
+	{ 0xA0AA4EB4, 0, "sound/fvox/range.wav" },
+	{ 0xC297FB0F, 0, "models/crossbow_bolt.mdl" },
+	{ 0x10B7E826, 0, "models/w_kevlar.mdl" },
+	{ 0xE9F7708C, 0, "sound/vox/lock.wav" },
+	{ 0xE423754B, 0, "models/w_saw_clip.mdl" },
+	{ 0x2D7A9923, 0, "models/w_pipe_wrench.mdl" },
+	{ 0xB1F9F986, 0, "gfx/env/tsccity_bk.tga" },
+	{ 0x8F61D368, 0, "models/player/massn/massn.bmp" },
+	{ 0x3DE305EE, 0, "sound/ba_holo/tr_holo_hitall.wav" },
+	{ 0x1C4231C6, 0, "sprites/spore_exp_01.spr" },
+	{ 0xFB449407, 0, "sprites/mapsprites/ae_satchel2.spr" },
+	{ 0x2DF11624, 0, "sound/fgrunt/of1a6_fg03.wav" },
+	{ 0x001C95E0, 0, "sound/weapons/awp_clipout.wav" },
+	{ 0xFF68A9EB, 0, "sound/scientist/scream13.wav" },
+	{ 0x34D538D8, 0, "sound/vox/seventeen.wav" },
+	{ 0x0D08C957, 0, "sound/weapons/m249_coverdown.wav" },
+	{ 0x88E902EC, 0, "gfx/env/xen9ft.bmp" },
+	{ 0xFFE4F0B1, 0, "sound/rosenberg/ro_yard_rose2.wav" },
+	{ 0x0A095ACD, 0, "resource/gameui_french.txt" },
+	{ 0x332EFCAB, 0, "sound/rosenberg/ro_too_slow.wav" },
+	{ 0x8CE6A014, 0, "sound/sentences/c3a1_3.wav" },
+	{ 0x09B1B07D, 0, "models/w_desert_eagle.mdl" },
+	{ 0xE65AF12F, 0, "sprites/tf_weapon_autorifle.txt" },
+	{ 0xAFBD4AB0, 0, "models/spore.mdl" },
+	{ 0x8FCB0575, 0, "gfx/env/officedn.tga" },
+	{ 0x8063E92B, 0, "sound/sentences/c1a1_4.wav" },
+	{ 0xCB22D7E6, 0, "sound/weapons/elite_reloadstart.wav" },
+	{ 0x10BDEE73, 0, "gfx/env/morningrt.tga" },
+	{ 0x4CF117B9, 0, "models/w_enfield_scoped.mdl" },
+	{ 0x9313ACC8, 0, "gfx/env/blackdn.tga" },
+	{ 0x74695D4E, 0, "models/mapmodels/cretegibs.mdl" },
+	{ 0xFB1A6776, 0, "sound/speech/saveme1.wav" },
+	{ 0xEF174973, 0, "gfx/env/alien2bk.tga" },
+	{ 0x84218463, 0, "sound/sentences/c1a0_5.wav" },
+	{ 0xB582480D, 0, "sprites/obj_icons/dod_vicenza/icon_obj_custom1_axis.spr" },
+	{ 0xE8D3E31E, 0, "sound/fgrunt/of1a6_fg01.wav" },
+	{ 0xC1879095, 0, "sound/barney/justdontknow.wav" },
+	{ 0xFF9F69FA, 0, "sprites/hint_bri.spr" },
+	{ 0x5A6D031C, 0, "sound/scientist/uselessphd.wav" },
+	{ 0x7360D778, 0, "models/player/vip/vip.mdl" },
+	{ 0xBD894420, 0, "models/p_satchel.mdl" },
+	{ 0x96608414, 0, "models/v_piat.mdl" },
+	{ 0x3E0FAAAB, 0, "sound/misc/tuner_blip1.wav" },
+	{ 0x49E15BEC, 0, "sprites/ikgrass3.spr" },
+	{ 0xE5F1A215, 0, "sound/weapons/sgun1.wav" },
+	{ 0xFB32C24A, 0, "gfx/env/morningdewup.tga" },
+	{ 0xD9382802, 0, "sound/vox/disengaged.wav" },
+	{ 0xD04F8EB0, 0, "sprites/disp_ring.spr" },
+	{ 0x56129C78, 0, "resource/ricochet_german.txt" },
+	{ 0x031C1908, 0, "gfx/env/morningft.bmp" },
+	{ 0x29F7F0FF, 0, "sound/ba_holo/tr_holo_4jumps.wav" },
+	{ 0x04594DBF, 0, "sound/fgrunt/torch_light.wav" },
+	{ 0xD693936F, 0, "gfx/vgui/fonts/1600_scoreboard title text.tga" },
+	{ 0xCBF967BA, 0, "sprites/blooddrop.spr" },
+	{ 0x7E2B5133, 0, "sprites/mapsprites/voiceicon.spr" },
+	{ 0xA57BA56A, 0, "sound/vox/save.wav" },
+	{ 0xB781BED4, 0, "sound/fvox/seventeen.wav" },
+	{ 0xB3377751, 0, "gfx/vgui/fonts/1280_primary button text.tga" },
+	{ 0x626D6FF2, 0, "sprites/tfchud07.spr" },
+	{ 0x6F12F1FC, 0, "sound/barney/ba_crazy.wav" },
+	{ 0x872A6971, 0, "gfx/vgui/640_discblue.tga" },
+	{ 0x5AF08EC2, 0, "sprites/shadow_circle.spr" },
+	{ 0x4EEDF382, 0, "models/v_9mmar.mdl" },
+	{ 0x3B2FD469, 0, "sound/ambience/birds9.wav" },
+	{ 0xF2BA2AB8, 0, "sprites/gargeye1.spr" },
+	{ 0x81A9D44D, 0, "sound/hgrunt/delta!.wav" },
+	{ 0x7A37E610, 0, "gfx/vgui/640_engineerred.tga" },
+	{ 0xE0745DE0, 0, "resource/mic_meter_live.tga" },
+	{ 0x758AECE4, 0, "sound/fgrunt/right.wav" },
+	{ 0x11937BBB, 0, "sound/vox/button.wav" },
+	{ 0x9DCB01E3, 0, "sprites/nuke_a_2.spr" },
+	{ 0x5DDB291C, 0, "sound/fvox/bio_reading.wav" },
+	{ 0xAFBB446E, 0, "sprites/redflare2.spr" },
+	{ 0xA770F6B9, 0, "sound/barney/c3a2_ba_8surv.wav" },
+	{ 0xCD18FA60, 0, "sound/weapons/weaponempty.wav" },
+	{ 0x2E13CC92, 0, "sound/scientist/greetings.wav" },
+	{ 0x32CA1735, 0, "models/p_mg34pr.mdl" },
+	{ 0xF51D6550, 0, "gfx/env/xen8ft.tga" },
+	{ 0xA44B42D0, 0, "spraypaint.wad" },
+	{ 0x5C8E1843, 0, "sprites/obj_icons/dod_glider/icon_obj_custom3_allies.spr" },
+	{ 0x48FC80B3, 0, "sound/pitdrone/pit_drone_communicate4.wav" },
+	{ 0x2E6AFF8A, 0, "sound/hgrunt/are.wav" },
+	{ 0x11325B65, 0, "sound/scientist/sc_yard_box1a.wav" },
+	{ 0xF3815CB1, 0, "models/rocket.mdl" },
+	{ 0xEEEBED05, 0, "models/mapmodels/fuel_dump.mdl" },
+	{ 0x3D8DC3D7, 0, "models/grass.mdl" },
+	{ 0x65534538, 0, "sound/weapons/mg34_shoot.wav" },
+	{ 0x44236C84, 0, "gfx/vgui/sas.tga" },
+	{ 0xD7959CE4, 0, "sound/object/object_taken.wav" },
+	{ 0x60F63062, 0, "sound/vox/eleven.wav" },
+	{ 0xE62175AD, 0, "sound/misc/killchicken.wav" },
+	{ 0x06F4608B, 0, "gfx/env/badlandsbk.tga" },
+	{ 0xAF752D71, 0, "sound/ambience/alien_hollow.wav" },
+	{ 0xBEB30F00, 0, "resource/icon_maximize.tga" },
+	{ 0x5A0950DE, 0, "sound/vox/quebec.wav" },
+	{ 0x333D517E, 0, "sound/player/germgahead.wav" },
+	{ 0x5FC088E9, 0, "sprites/dexplo.spr" },
+	{ 0x3FA94E56, 0, "sprites/xspark2.spr" },
+	{ 0x9C9AC28A, 0, "sound/events/enemy_died.wav" },
+	{ 0x7A1ECD8E, 0, "sound/ctf/itemthrow.wav" },
+	{ 0x265D065E, 0, "sound/ambience/alien_zonerator.wav" },
+	{ 0xCC29C2A9, 0, "sound/de_torn/torn_water1.wav" },
+	{ 0xD0C6645F, 0, "sound/ambience/alienlaser1.wav" },
+	{ 0xC8666B21, 0, "sound/scientist/letstrythis.wav" },
+	{ 0x7DB01F13, 0, "sound/pitdrone/pit_drone_idle3.wav" },
+	{ 0x11B81C75, 0, "sound/fgrunt/makeit.wav" },
+	{ 0xDC9606CB, 0, "sound/ambience/birds7.wav" },
+	{ 0xC9949B6D, 0, "sprites/streak.spr" },
+	{ 0x3F0CF901, 0, "sound/misc/plane_drone.wav" },
+	{ 0x37CAF858, 0, "models/player/ctf_gina/ctf_gina.mdl" },
+	{ 0xDD6282F2, 0, "maps/dod_chemille_detail.txt" },
+	{ 0x4118DF53, 0, "sound/pitworm/pit_worm_attack_eyeblast_impact.wav" },
+	{ 0xF4CC8CC4, 0, "sound/fgrunt/corporal_01.wav" },
+	{ 0x3B335CAA, 0, "sound/player/usspreadout.wav" },
+	{ 0x9C6E08E9, 0, "sound/hgrunt/right!.wav" },
+	{ 0x4DD5807B, 0, "sound/player/stopbleed.wav" },
+	{ 0x484F6F34, 0, "gfx/env/de_stormlf.tga" },
+	{ 0x0DEDD4E6, 0, "sound/controller/con_pain1.wav" },
+	{ 0x2413E356, 0, "sound/otis/aliencombat.wav" },
+	{ 0x7B91FAAA, 0, "models/allied_gibs.mdl" },
+	{ 0xCB609D62, 0, "models/barney04.mdl" },
+	{ 0xA6AD67F6, 0, "gfx/vgui/fonts/640_basic text.tga" },
+	{ 0x5C0E6645, 0, "sound/barney/youtalkmuch.wav" },
+	{ 0x94A53F37, 0, "models/houndeye_dead.mdl" },
+	{ 0xB9E01712, 0, "models/player/us-inf/us-inf.mdl" },
+	{ 0x6AB8456C, 0, "models/v_stick.mdl" },
+	{ 0xFEFDB916, 0, "sound/weapons/m249_boxin.wav" },
+	{ 0x504952C1, 0, "sound/radio/letsgo.wav" },
+	{ 0xD7880579, 0, "maps/op4ctf_crash.txt" },
+	{ 0xDC74B597, 0, "sound/weapons/famas_boltslap.wav" },
+	{ 0x9CDF92FF, 0, "sprites/of_nv_int.spr" },
+	{ 0xFE8EE723, 0, "sound/fgrunt/fwound.wav" },
+	{ 0xA1C77CAD, 0, "sprites/mapmarkers/mg.spr" },
+	{ 0x8A5A1AE3, 0, "sprites/black_smoke1.spr" },
+	{ 0xC120F8BF, 0, "sound/scientist/c3a2_sci_3glu.wav" },
+	{ 0x090CA25B, 0, "gfx/detail/dt_ground2.tga" },
+	{ 0x8FBE0E66, 0, "sprites/rain01.spr" },
+	{ 0xDB05E8CF, 0, "models/w_bazooka_rocket.mdl" },
+	{ 0x5BF8368E, 0, "sound/doors/doormove4.wav" },
+	{ 0x7A682CE5, 0, "logos/andre.bmp" },
+	{ 0x49294F26, 0, "sound/vox/activity.wav" },
+	{ 0xC333911C, 0, "sound/hgrunt/sign!.wav" },
+	{ 0x628B53AC, 0, "sprites/640_pain.spr" },
+	{ 0x40013675, 0, "gfx/env/dashnight256up.tga" },
+	{ 0x462E2E6C, 0, "sound/hgrunt/left!.wav" },
+	{ 0x11981E65, 0, "overviews/datacore.txt" },
+	{ 0x1AA89047, 0, "models/p_glauncher.mdl" },
+	{ 0x5A23B26E, 0, "sound/sentences/hev_dmg0.wav" },
+	{ 0xD25ADF2C, 0, "sound/sentences/hev_satchel.wav" },
+	{ 0xC56DEDE0, 0, "models/mapmodels/jed_pines_stumps2.mdl" },
+	{ 0xA58E8B35, 0, "models/p_enfields_l.mdl" },
+	{ 0x86A30E0B, 0, "resource/icon_checked.tga" },
+	{ 0x0D4F9099, 0, "sound/barney/c1a0_ba_headdown.wav" },
+	{ 0xEFDAC91C, 0, "sprites/bmp/2fire10.bmp" },
+	{ 0xDE807021, 0, "gfx/env/forestbk.tga" },
+	{ 0x5334ED79, 0, "models/mapmodels/dinner_table2.mdl" },
+	{ 0x9D99B8D6, 0, "sound/fgrunt/cutting.wav" },
+	{ 0x0C93BAA2, 0, "sprites/sdrip1.spr" },
+	{ 0xFF98EBA4, 0, "sound/vox/organic.wav" },
+	{ 0x39E5E6A4, 0, "gfx/env/forestrt.tga" },
+	{ 0x74F14093, 0, "sound/drill/dr2_add06.wav" },
+	{ 0x3034CAF6, 0, "sound/player/boots4.wav" },
+	{ 0x25DF0A08, 0, "sound/geneworm/geneworm_idle1.wav" },
+	{ 0x30220031, 0, "sound/weapons/asscan1.wav" },
+	{ 0xA15620F9, 0, "models/g_nail2t.mdl" },
+	{ 0xFA449306, 0, "sound/plats/elevmove3.wav" },
+	{ 0xB2FD9CC6, 0, "sound/bullchicken/bc_idle4.wav" },
+	{ 0x9CF55ADE, 0, "sound/fgrunt/quiet.wav" },
+	{ 0x174F5236, 0, "sound/sentences/hg_check6.wav" },
+	{ 0xE0CD1E4A, 0, "resource/vgui_english.txt" },
+	{ 0xDFA71FCB, 0, "sound/otis/hitbad.wav" },
+	{ 0xD6F6B908, 0, "gfx/env/duskft.tga" },
+	{ 0x24DB4CBC, 0, "sound/sentences/hg_clear1.wav" },
+	{ 0xB7812889, 0, "sound/scientist/sci_fear12.wav" },
+	{ 0xA19A38F0, 0, "sound/fvox/time_is_now.wav" },
+	{ 0xDE965DB7, 0, "classes/short_hwguy.txt" },
+	{ 0x4FB09823, 0, "maps/de_dust2.txt" },
+	{ 0xAD9501EA, 0, "sound/ambience/jetflyby1.wav" },
+	{ 0x472152E6, 0, "sound/houndeye/he_attack3.wav" },
+	{ 0x727A2BBB, 0, "sound/sentences/hg_quest10.wav" },
+	{ 0x6A4944DF, 0, "sound/items/protect2.wav" },
+	{ 0x23F8D865, 0, "sound/ambience/bee1.wav" },
+	{ 0x9041EFFC, 0, "models/w_bazooka.mdl" },
+	{ 0x6EC71ABF, 0, "sprites/mapmarkers/camper.spr" },
+	{ 0x7D4DE2E9, 0, "sprites/richo1.spr" },
+	{ 0x0C931504, 0, "sprites/640_decapitate.spr" },
+	{ 0xEEC4B867, 0, "sound/sentences/hg_charge1.wav" },
+	{ 0xD11C083D, 0, "sound/items/ammopickup1.wav" },
+	{ 0x33E4CAB1, 0, "sound/radio/blow.wav" },
+	{ 0x9E2B8C08, 0, "models/mapmodels/flo_pak37.mdl" },
+	{ 0x5CC6C6B3, 0, "sound/scientist/c3a1_sci_6sat.wav" },
+	{ 0xDA81BA8F, 0, "sound/vox/wall.wav" },
+	{ 0x7BD33343, 0, "sound/weapons/mortar_load.wav" },
+	{ 0x6717CD63, 0, "sound/player/damage1.wav" },
+	{ 0x9D31C157, 0, "sprites/mapsprites/flagh_sch.spr" },
+	{ 0x473F7BE0, 0, "sound/player/pl_pain6.wav" },
+	{ 0x967770FF, 0, "sound/vox/enter.wav" },
+	{ 0xF814B7AD, 0, "sprites/obj_icons/dod_falaise/icon_obj_custom4_axis.spr" },
+	{ 0xE3D3ACA4, 0, "gfx/vgui/fonts/800_scoreboard title text.tga" },
+	{ 0x21EB5016, 0, "sound/fgrunt/allclear.wav" },
+	{ 0xFB11C5FC, 0, "gfx/env/blackup.bmp" },
+	{ 0xECD0D004, 0, "sound/nihilanth/nil_comes.wav" },
+	{ 0x54BF4CB6, 0, "sound/hgrunt/thirtymeters.wav" },
+	{ 0x4813FD18, 0, "models/player/recon/recon.mdl" },
+	{ 0x439ACFFC, 0, "sound/vox/yankee.wav" },
+	{ 0xD9AD317E, 0, "sound/weapons/whizz1.wav" },
+	{ 0x99D29BCD, 0, "sound/ambience/sandfall2.wav" },
+	{ 0x53CA0AE1, 0, "sound/player/gerareaclear.wav" },
+	{ 0xEB657321, 0, "models/w_security.mdl" },
+	{ 0x86B37792, 0, "sprites/bmp/tffire12.bmp" },
+	{ 0xB1F228FF, 0, "gfx/env/rubbledn.tga" },
+	{ 0xC9721550, 0, "gfx/env/snowcliffft.tga" },
+	{ 0x63F12303, 0, "sprites/snowflake.spr" },
+	{ 0xA191D602, 0, "sound/sentences/c2a4_5.wav" },
+	{ 0xCDF0A0D3, 0, "gfx/env/xen9lf.tga" },
+	{ 0xA0F664D1, 0, "sound/drill/add05.wav" },
+	{ 0xB71946C3, 0, "sound/plats/talkstop1.wav" },
+	{ 0x99253274, 0, "models/w_piatmodel.mdl" },
+	{ 0x38F11982, 0, "sound/scientist/importantspecies.wav" },
+	{ 0x496A301B, 0, "sprites/mapmarkers/arrow_se.spr" },
+	{ 0x9EDCF386, 0, "sound/player/pl_grate3.wav" },
+	{ 0x0BCAEFB7, 0, "sound/sentences/ef0.wav" },
+	{ 0xE799163F, 0, "sound/hgrunt/people.wav" },
+	{ 0x01BF1BEB, 0, "sound/rosenberg/ro_tele_final18.wav" },
+	{ 0x33B55621, 0, "sound/drill/oc106a.wav" },
+	{ 0x7A669F8E, 0, "sound/weapons/p90-1.wav" },
+	{ 0xC6026629, 0, "gfx/env/drkgdn.tga" },
+	{ 0x32E6637E, 0, "maps/dod_caen_detail.txt" },
+	{ 0xC74102AE, 0, "sound/vox/press.wav" },
+	{ 0xBC665F1D, 0, "sound/player/pl_ladder1.wav" },
+	{ 0xD442FFEC, 0, "gfx/vgui/fiveseven.tga" },
+	{ 0x75B99B3B, 0, "sound/player/goprone.wav" },
+	{ 0xE488727F, 0, "sound/geneworm/geneworm_death.wav" },
+	{ 0xFCB6CFC0, 0, "sprites/muzzleflash4.spr" },
+	{ 0x6086D388, 0, "sound/sentences/hev_c23.wav" },
+	{ 0xF30DB8DA, 0, "sound/hgrunt/these!.wav" },
+	{ 0xEDED8755, 0, "models/mapmodels/pine_tree.mdl" },
+	{ 0x0FFAA4DA, 0, "gfx/env/cliffup.tga" },
+	{ 0x084EC157, 0, "sound/weapons/hit_sand2.wav" },
+	{ 0xB6F7A903, 0, "sound/weapons/explode5.wav" },
+	{ 0x6990D200, 0, "gfx/vgui/round_corner_small_se.tga" },
+	{ 0x964579BD, 0, "sound/weapons/ax1.wav" },
+	{ 0x5E7BE8CF, 0, "resource/valve_schinese.txt" },
+	{ 0x35EDE289, 0, "sound/vox/acknowledge.wav" },
+	{ 0x4B6E82B7, 0, "sound/weapons/spore_ammo.wav" },
+	{ 0x32ECEDF3, 0, "sound/ambience/wolfhowl01.wav" },
+	{ 0x9AD9FE1C, 0, "sprites/bmp/fthrow03.bmp" },
+	{ 0xB6D4266D, 0, "models/p_mg34bd.mdl" },
+	{ 0x15520087, 0, "sound/drill/livefire02.wav" },
+	{ 0x1DD41672, 0, "sound/barney/of1a5_ba01.wav" },
+	{ 0xC12BADE7, 0, "sound/weapons/chainpull.wav" },
+	{ 0xD29DC67B, 0, "models/plant_palm.mdl" },
+	{ 0x5D0E14D4, 0, "sound/sentences/c1a2_6.wav" },
+	{ 0x887C21B2, 0, "sound/drill/barracks06.wav" },
+	{ 0x6F10E601, 0, "gfx/env/spacedn.tga" },
+	{ 0x8C1CA87E, 0, "sound/hgrunt/mission.wav" },
+	{ 0x93E96135, 0, "models/w_fcarb.mdl" },
+	{ 0x61DE2363, 0, "sound/fgrunt/ass.wav" },
+	{ 0xA1FCBB1B, 0, "resource/icon_folderup.tga" },
+	{ 0xAA394BBA, 0, "sound/sentences/ctr3.wav" },
+	{ 0x7C1ACB4D, 0, "sound/vox/november.wav" },
+	{ 0xA950B4F7, 0, "models/p_knife.mdl" },
+	{ 0x16FDE89A, 0, "models/y_armor.mdl" },
+	{ 0x546270DE, 0, "sound/scientist/c3a2_sci_ljump.wav" },
+	{ 0x799BBCE7, 0, "sound/vox/tank.wav" },
+	{ 0xBCDDE7C0, 0, "gfx/vgui/1152_arrowdown.tga" },
+	{ 0x21A4ACF3, 0, "sprites/clip_extras.spr" },
+	{ 0xD5D394EE, 0, "gfx/env/cliff2dn.bmp" },
+	{ 0x9B3BAF02, 0, "sound/fgrunt/oneshot.wav" },
+	{ 0x1F7173B1, 0, "sprites/bmp/2expl14.bmp" },
+	{ 0xF6CCC3FB, 0, "models/mini_osprey_tailgibs.mdl" },
+	{ 0xE95F3062, 0, "sound/sentences/hev_dmg4.wav" },
+	{ 0xF71C5683, 0, "sound/weapons/mortar_incoming.wav" },
+	{ 0x9C61E776, 0, "gfx/vgui/shield.tga" },
+	{ 0x28F3B954, 0, "sprites/weapon_glock18.txt" },
+	{ 0xE0EBA0C5, 0, "maps/dustbowl.txt" },
+	{ 0x37BB9837, 0, "sound/weapons/guncock.wav" },
+	{ 0x10E05819, 0, "models/palmtree.mdl" },
+	{ 0x74F0A09F, 0, "sound/hgrunt/five!.wav" },
+	{ 0xADD2D484, 0, "sound/ambience/mgun_background_01.wav" },
+	{ 0xB9EA9164, 0, "sound/debris/wood2.wav" },
+	{ 0x7C77966F, 0, "models/catwalkgibs.mdl" },
+	{ 0xE10572FA, 0, "sound/barney/ba_canal_death1.wav" },
+	{ 0x98A560CE, 0, "models/v_satchel_radio.mdl" },
+	{ 0xB90798C4, 0, "sound/ichy/ichy_attack1.wav" },
+	{ 0x2DB6258E, 0, "sound/items/r_item2.wav" },
+	{ 0x334963A1, 0, "models/ventgibs.mdl" },
+	{ 0xE6A75FFA, 0, "overviews/crossover2.txt" },
+	{ 0x5B60CB8A, 0, "sprites/effects/debris_leaf2.spr" },
+	{ 0xA212FA90, 0, "sound/houndeye/he_pain5.wav" },
+	{ 0x25CE7221, 0, "sound/items/health1.wav" },
+	{ 0xD57D5F30, 0, "gfx/env/neb7up.tga" },
+	{ 0x84B2C465, 0, "gfx/env/officelf.tga" },
+	{ 0x25569B12, 0, "gfx/vgui/marker_green_x.tga" },
+	{ 0x14639641, 0, "sprites/obj_icons/dod_forest/icon_obj_custom1_allies.spr" },
+	{ 0x68EE6EE4, 0, "models/v_k43.mdl" },
+	{ 0x1DA42D55, 0, "sprites/blueflare2.spr" },
+	{ 0x9F42C2AC, 0, "models/v_tfc_medkit.mdl" },
+	{ 0xE46CF557, 0, "models/fungust.mdl" },
+	{ 0x046A02E5, 0, "sound/drill/barracks07.wav" },
+	{ 0x42B10B04, 0, "classes/short_drillsgt.txt" },
+	{ 0x5A550114, 0, "sound/sentences/c2a4_3.wav" },
+	{ 0x8FAD6C5D, 0, "sound/weapons/fiveseven_clipout.wav" },
+	{ 0x856DE1F8, 0, "overviews/cs_backalley.bmp" },
+	{ 0x907CC4E3, 0, "sound/vox/with.wav" },
+	{ 0x47E2A21F, 0, "sound/scientist/heal1.wav" },
+	{ 0x7669815A, 0, "gfx/vgui/640_randompcblue.tga" },
+	{ 0x99B92106, 0, "models/pi_tree1.mdl" },
+	{ 0xF69B4746, 0, "sound/tentacle/te_search2.wav" },
+	{ 0x64A8DCAC, 0, "sound/scientist/scream01.wav" },
+	{ 0x70710F39, 0, "gfx/vgui/clsimages/cls_random_allies.tga" },
+	{ 0x095B0D2B, 0, "gfx/vgui/640_barney.tga" },
+	{ 0xA630836E, 0, "models/barney.mdl" },
+	{ 0xDD65A6B9, 0, "sound/scientist/ridiculous.wav" },
+	{ 0x1E562A55, 0, "sound/items/medshot5.wav" },
+	{ 0xE87A0D99, 0, "resource/valve_english.txt" },
+	{ 0x76147984, 0, "media/launch_dnmenu1.wav" },
+	{ 0x870CAA22, 0, "sound/rosenberg/ro_heal1.wav" },
+	{ 0x9392C175, 0, "sound/rosenberg/ro_tele_power4.wav" },
+	{ 0x85D566B5, 0, "sound/weapons/egon_run3.wav" },
+	{ 0xBE433DAC, 0, "sound/ambience/steamjet1.wav" },
+	{ 0xEAC1E472, 0, "gfx/vgui/640_discgrey.tga" },
+	{ 0x5006D194, 0, "models/fern.mdl" },
+	{ 0x495AAD6C, 0, "sound/bullchicken/bc_acid1.wav" },
+	{ 0x49156FDC, 0, "sound/scientist/sc_power_alt2.wav" },
+	{ 0x53378748, 0, "sound/vox/doctor.wav" },
+	{ 0xEE011247, 0, "gfx/vgui/fonts/1152_scoreboard text.tga" },
+	{ 0x04C27AC0, 0, "models/player/brit-inf/brit-inf.mdl" },
+	{ 0xB96720FC, 0, "sound/fvox/get_44ammo.wav" },
+	{ 0xE78AB4CB, 0, "sound/tram/ba_tram1.wav" },
+	{ 0xF96B1FD1, 0, "gfx/env/bluedn.tga" },
+	{ 0xC7FBF5DF, 0, "sound/ambience/thunder_rain.wav" },
+	{ 0x78893A2C, 0, "models/p_mac10.mdl" },
+	{ 0xF2F9B7E0, 0, "sound/hgrunt/lookout!.wav" },
+	{ 0xCFA0733E, 0, "sprites/bmp/2fire09.bmp" },
+	{ 0xFD668860, 0, "gfx/vgui/fonts/1024_scoreboard small text.tga" },
+	{ 0x052F5D94, 0, "sound/ba_holo/tr_holo_drown.wav" },
+	{ 0x1ABF888E, 0, "sound/common/nuke_explode.wav" },
+	{ 0xC36AEAC1, 0, "models/mapmodels/cromwell.mdl" },
+	{ 0x01FEBB27, 0, "sound/sentences/ea5.wav" },
+	{ 0x1AF4BEC9, 0, "sound/bullchicken/bc_die1.wav" },
+	{ 0xE55527B8, 0, "sound/headcrab/hc_alert2.wav" },
+	{ 0x5532D630, 0, "gfx/vgui/speaker4.tga" },
+	{ 0x1A79D788, 0, "resource/platform_french.txt" },
+	{ 0xBE737C0C, 0, "sound/weapons/turrspot.wav" },
+	{ 0xB16CDF1F, 0, "sprites/ofch2.spr" },
+	{ 0xDF162D0D, 0, "models/axis_grunt.mdl" },
+	{ 0xD6483D34, 0, "models/p_sten.mdl" },
+	{ 0xDB62CECD, 0, "sound/fvox/get_pistol.wav" },
+	{ 0xA49C607A, 0, "sound/player/damage2.wav" },
+	{ 0x5F0FE800, 0, "maps/as_oilrig.txt" },
+	{ 0x3B5062AD, 0, "sound/bullchicken/bc_idle1.wav" },
+	{ 0x12434E6E, 0, "sound/hgrunt/mister.wav" },
+	{ 0x0240F7E9, 0, "models/shield/p_shield_fiveseven.mdl" },
+	{ 0x2E9E898E, 0, "maps/dod_escape_detail.txt" },
+	{ 0x69C42DB9, 0, "sound/scientist/yes.wav" },
+	{ 0xD1859F6C, 0, "gfx/vgui/clsimages/cls_spring.tga" },
+	{ 0x47B38BEB, 0, "sound/scientist/hungryyet.wav" },
+	{ 0x1EDD5D6C, 0, "gfx/env/xen9dn.bmp" },
+	{ 0x7878A31B, 0, "models/w_9mmarclipt.mdl" },
+	{ 0x3A1F1144, 0, "sprites/of_nv_b.spr" },
+	{ 0x22B448D8, 0, "resource/game_menu.tga" },
+	{ 0x780848D1, 0, "sound/scientist/c1a4_sci_blind.wav" },
+	{ 0x4F081761, 0, "sound/sentences/c2a2_2.wav" },
+	{ 0xF700857C, 0, "sound/drill/rifle05.wav" },
+	{ 0xBA356AEA, 0, "sound/otis/cousin.wav" },
+	{ 0x7FDE4565, 0, "models/sentry3.mdl" },
+	{ 0x6C1CC778, 0, "sound/ambience/gerpointcaptured.wav" },
+	{ 0xB0724512, 0, "gfx/env/avantilf.tga" },
+	{ 0x98B7B7C6, 0, "resource/gameui_russian.txt" },
+	{ 0xCCC5E49E, 0, "models/p_spore_launcher.mdl" },
+	{ 0xC59D28FE, 0, "maps/dod_chemille.txt" },
+	{ 0x7BF5871F, 0, "gfx/env/neb2bbk.tga" },
+	{ 0x74169A5C, 0, "sound/hgrunt/tango!.wav" },
+	{ 0x19579CDC, 0, "sound/pitdrone/pit_drone_pain4.wav" },
+	{ 0xBA48C372, 0, "sound/weapons/pwrench_big_hitbod2.wav" },
+	{ 0x45A1B236, 0, "sound/sentences/dr2.wav" },
+	{ 0xBCAEC9C1, 0, "models/v_ump45.mdl" },
+	{ 0x1498992F, 0, "sound/headcrab/hc_pain1.wav" },
+	{ 0x5D0B94FC, 0, "sound/hgrunt/twohundredmeters.wav" },
+	{ 0x4D33455F, 0, "sound/hgrunt/checking!.wav" },
+	{ 0xD659D58B, 0, "sound/weapons/mp5_clipin.wav" },
+	{ 0x1F75F6C0, 0, "sound/vox/quantum.wav" },
+	{ 0xE228B97D, 0, "models/mapmodels/window1.mdl" },
+	{ 0x870CFD85, 0, "sound/sentences/hev_gr4.wav" },
+	{ 0xC91B3EC2, 0, "gfx/detail/dt_wood3.tga" },
+	{ 0x5F5AEB23, 0, "sound/vox/soldier.wav" },
+	{ 0x51F21366, 0, "maps/de_nuke.txt" },
+	{ 0x44B588EE, 0, "models/p_crowbar.mdl" },
+	{ 0xB3295FB2, 0, "gfx/vgui/clsimages/cls_enfield.tga" },
+	{ 0xE3A51705, 0, "sound/misc/sheep.wav" },
+	{ 0x4B9CF08E, 0, "gfx/env/sky_blu_rt.bmp" },
+	{ 0x59BBBBDD, 0, "maps/crossover2.txt" },
+	{ 0x197F23FC, 0, "sound/weapons/c4_beep5.wav" },
+	{ 0xE8A03BB6, 0, "models/wire_black24.mdl" },
+	{ 0x7E36ACD0, 0, "sprites/bmp/fthrow07.bmp" },
+	{ 0x5FB6171B, 0, "sound/weapons/whizz6.wav" },
+	{ 0x81255C5E, 0, "overviews/dmc_dm3.bmp" },
+	{ 0x150ECC1E, 0, "ctf manual/resources/pow_armor_charge.wav" },
+	{ 0xA306DB93, 0, "overviews/warpath.tga" },
+	{ 0x81641079, 0, "models/v_tfc_pistol.mdl" },
+	{ 0x90D3E94E, 0, "sound/otis/stupidmachines.wav" },
+	{ 0x2D072FFB, 0, "sound/barney/c2a4_ba_3tau.wav" },
+	{ 0x55D0F09F, 0, "models/sentry1.mdl" },
+	{ 0x12B89B2D, 0, "sprites/muz6.spr" },
+	{ 0x60FFDFC2, 0, "sound/vox/authorized.wav" },
+	{ 0x7CD3C9D2, 0, "overviews/dod_kalt.txt" },
+	{ 0xB076EEEC, 0, "sound/vox/egress.wav" },
+	{ 0x5F4435D3, 0, "sound/vox/electromagnetic.wav" },
+	{ 0xE623ABCC, 0, "sound/player/pl_grate1.wav" },
+	{ 0xFAABA332, 0, "sound/drill/oc106d.wav" },
+	{ 0x9D91F913, 0, "sound/otis/behind.wav" },
+	{ 0x3506DDFF, 0, "overviews/epicenter.tga" },
+	{ 0xB0971AE6, 0, "gfx/vgui/clsimages/cls_bren.tga" },
+	{ 0x4B36C458, 0, "sound/plats/freightstop1.wav" },
+	{ 0xE8BDF666, 0, "sound/x/x_pain3.wav" },
+	{ 0xD4237502, 0, "sound/sentences/c3a1_5.wav" },
+	{ 0xB1C909BD, 0, "sound/vox/slime.wav" },
+	{ 0xF8336868, 0, "sound/sentences/ctr10.wav" },
+	{ 0x29584194, 0, "models/guerilla.mdl" },
+	{ 0xCACB119E, 0, "gfx/env/sildom2up.tga" },
+	{ 0xE8895436, 0, "sound/holo/tr_holo_ladder.wav" },
+	{ 0x5CA63812, 0, "sound/vox/resevoir.wav" },
+	{ 0xA5EF51BA, 0, "sound/barney/wayout.wav" },
+	{ 0x41744464, 0, "sound/player/ushold.wav" },
+	{ 0xF7ED86C3, 0, "sound/hgrunt/alien.wav" },
+	{ 0x9D380BE5, 0, "sound/barney/heyfella.wav" },
+	{ 0x184F3BD0, 0, "sound/hgrunt/at!.wav" },
+	{ 0x117BC260, 0, "sound/ambience/dodambience5.wav" },
+	{ 0x017319B1, 0, "gfx/env/blueft.tga" },
+	{ 0x5B8869AC, 0, "models/player/male/male.mdl" },
+	{ 0xCE31E00D, 0, "sound/weapons/pinpull.wav" },
+	{ 0x7EA4ED90, 0, "sound/weapons/bgrapple_release.wav" },
+	{ 0xDA09E555, 0, "sound/doors/aliendoor5.wav" },
+	{ 0x89F56191, 0, "sprites/hotglow.spr" },
+	{ 0x31B97970, 0, "models/mapmodels/by_blueprints.mdl" },
+	{ 0xB234BA7E, 0, "sprites/effects/debris_dirt3.spr" },
+	{ 0x6A75A82A, 0, "sound/scientist/bodydrop1.wav" },
+	{ 0xFC74151D, 0, "sound/hgrunt/c2a3_hg_laugh.wav" },
+	{ 0x6FF6C199, 0, "sound/plats/bigmove2.wav" },
+	{ 0x7E677405, 0, "dod_saints.wad" },
+	{ 0x79B84D0A, 0, "sound/rosenberg/ro_pain7.wav" },
+	{ 0x1AB17D38, 0, "sound/debris/flesh3.wav" },
+	{ 0x7502B9D5, 0, "sound/hgrunt/backup!.wav" },
+	{ 0xE13A57F9, 0, "classes/short_scout.txt" },
+	{ 0x5C0735B6, 0, "overviews/dmc_dm6.txt" },
+	{ 0x1753BDCA, 0, "sound/sentences/nf0.wav" },
+	{ 0x0B70EFD5, 0, "sprites/glow05.spr" },
+	{ 0xF845E9A6, 0, "gfx/vgui/gign.tga" },
+	{ 0x81A13A56, 0, "overviews/dod_switch.txt" },
+	{ 0x9938EAF8, 0, "sprites/640_train.spr" },
+	{ 0x778E7722, 0, "sound/ambience/alienflyby1.wav" },
+	{ 0xB8E30343, 0, "models/mapmodels/stang.mdl" },
+	{ 0xF24F8DA0, 0, "sprites/bmp/fthrow14.bmp" },
+	{ 0x09F16550, 0, "resource/dod_english.txt" },
+	{ 0x39C1448B, 0, "sound/ambience/owl_hoot.wav" },
+	{ 0x5C8E5FA1, 0, "gfx/env/trainyardft.tga" },
+	{ 0xD36851BB, 0, "sound/sentences/hev_battery.wav" },
+	{ 0x4C711575, 0, "classes/long_spy.txt" },
+	{ 0x94D14B6C, 0, "gfx/env/alien2bk.bmp" },
+	{ 0xC9595FA6, 0, "models/stickygib.mdl" },
+	{ 0xA61376CA, 0, "models/mapmodels/snow_panzer.mdl" },
+	{ 0x79FA9C18, 0, "sprites/red.spr" },
+	{ 0x5106FA7C, 0, "sound/vox/lambda.wav" },
+	{ 0xF501A19A, 0, "gfx/detail/wall1.tga" },
+	{ 0x1039BD09, 0, "models/protozoa.mdl" },
+	{ 0x350537C1, 0, "sound/sentences/hev_f3.wav" },
+	{ 0x9D8431DE, 0, "sound/barney/c3a2_ba_stay.wav" },
+	{ 0x1324119C, 0, "sound/tride/c0a0_tr_exit.wav" },
+	{ 0x98891DD0, 0, "gfx/vgui/640_demomanred.tga" },
+	{ 0x46B42E59, 0, "sound/geneworm/geneworm_entry.wav" },
+	{ 0x8F0257A4, 0, "sound/weapons/bgrapple_pull.wav" },
+	{ 0xBF91D16C, 0, "maps/op4ctf_wonderland.txt" },
+	{ 0x91C46BF1, 0, "sound/sentences/na4.wav" },
+	{ 0xF1D55B0C, 0, "models/player/spy/spy2.mdl" },
+	{ 0x806C46C4, 0, "sound/vox/launch.wav" },
+	{ 0xF0B103EC, 0, "sprites/logo.spr" },
+	{ 0x9AB54609, 0, "sprites/icon_88_axis.spr" },
+	{ 0x212EC164, 0, "sprites/weapon_egon.txt" },
+	{ 0xB4AF1270, 0, "sound/hgrunt/tight.wav" },
+	{ 0x6E2B819D, 0, "gfx/env/city1lf.tga" },
+	{ 0x8B7405B9, 0, "sound/player/usareaclear.wav" },
+	{ 0xC1ED98C3, 0, "models/big_momt.mdl" },
+	{ 0xA664FAAE, 0, "models/v_98k.mdl" },
+	{ 0x7B51589A, 0, "sound/barnacle/bcl_alert2.wav" },
+	{ 0x7125B271, 0, "sound/intro/hq_the_hell.wav" },
+	{ 0x02EEDFC5, 0, "sound/gonarch/gon_attack2.wav" },
+	{ 0x51E08F7E, 0, "sound/weapons/gauss2.wav" },
+	{ 0x229E3DCE, 0, "sound/intro/g7_watch_vector.wav" },
+	{ 0x3CD14BA9, 0, "resource/platform_russian.txt" },
+	{ 0x90E6B722, 0, "sprites/mapsprites/fexplo.spr" },
+	{ 0xC9F0F706, 0, "sprites/bmp/2fire12.bmp" },
+	{ 0xC00E8C93, 0, "gfx/vgui/clsimages/cls_allies_random.tga" },
+	{ 0x68DC9CDC, 0, "models/v_knife_r.mdl" },
+	{ 0x77791AF6, 0, "sound/radio/followme.wav" },
+	{ 0x6C970035, 0, "sound/vox/heat.wav" },
+	{ 0xE0EA6517, 0, "sound/holo/tr_sci_hardlynoticed.wav" },
+	{ 0x1D1A295B, 0, "sound/ambience/alien_minddrill.wav" },
+	{ 0x8F6831E3, 0, "sound/hgrunt/no.wav" },
+	{ 0xCD7C1E7E, 0, "sound/vox/key.wav" },
+	{ 0xB56C99D2, 0, "sound/player/pl_metal3.wav" },
+	{ 0x39F951B8, 0, "sound/drill/oc107a.wav" },
+	{ 0xF5A6F460, 0, "sound/vox/beyond.wav" },
+	{ 0x2F9144C1, 0, "sound/vox/prosecute.wav" },
+	{ 0xA9C77774, 0, "logos/skull.bmp" },
+	{ 0xD35D7A88, 0, "sound/drill/rifle09.wav" },
+	{ 0xD314AFD4, 0, "resource/icon_vac.tga" },
+	{ 0xB3010EEB, 0, "sound/zombie/zo_attack1.wav" },
+	{ 0x1EE485DC, 0, "sound/vox/condition.wav" },
+	{ 0xB1343B6E, 0, "sound/weapons/alienweap_draw.wav" },
+	{ 0xA7BAF84A, 0, "sound/scientist/c1a1_sci_2scan.wav" },
+	{ 0x8BEC1693, 0, "sound/scientist/chaostheory.wav" },
+	{ 0xD35BB8A9, 0, "sound/radio/rounddraw.wav" },
+	{ 0x8E69094C, 0, "models/baby_strooper.mdl" },
+	{ 0xDA1D8C7D, 0, "models/v_knife.mdl" },
+	{ 0x9F381C3A, 0, "sound/zombie/zo_idle4.wav" },
+	{ 0x56997623, 0, "models/barnaclet.mdl" },
+	{ 0x0605A025, 0, "models/zombie_barney.mdl" },
+	{ 0xFDCE6133, 0, "sound/misc/main_elevator_stop.wav" },
+	{ 0xA4454D36, 0, "sound/fgrunt/pain4.wav" },
+	{ 0xE868720D, 0, "sound/gonome/gonome_jumpattack.wav" },
+	{ 0xFA03645A, 0, "sound/rosenberg/ro_outro2.wav" },
+	{ 0x6BDA9C25, 0, "models/v_enfield.mdl" },
+	{ 0x392F94EC, 0, "sound/scientist/c2a5_sci_lebuz.wav" },
+	{ 0x8FF36B6E, 0, "sound/vox/research.wav" },
+	{ 0x267D673D, 0, "sound/fgrunt/intro_fg05.wav" },
+	{ 0x8126B630, 0, "sound/weapons/saw_reload.wav" },
+	{ 0x191B81F3, 0, "sprites/weapon_9mmhandgun.txt" },
+	{ 0x21F98F68, 0, "sound/vox/take.wav" },
+	{ 0xCC690AC1, 0, "sound/aslave/slv_word3.wav" },
+	{ 0xD8F15DB3, 0, "sound/hgrunt/c2a5_hg_abandon.wav" },
+	{ 0x227FABA1, 0, "sprites/laserdot.spr" },
+	{ 0x1F51DEA9, 0, "sound/scientist/sc_hello4.wav" },
+	{ 0xB6298BBD, 0, "dmc.wad" },
+	{ 0x856E16A4, 0, "sound/gonarch/gon_alert1.wav" },
+	{ 0x02904B66, 0, "overviews/dustbowl.txt" },
+	{ 0x68317F78, 0, "sprites/wallpuff.spr" },
+	{ 0x904CEDB1, 0, "sound/otis/dontguess.wav" },
+	{ 0x1A1F6403, 0, "sound/sentences/hev_hlth3.wav" },
+	{ 0x69953D30, 0, "models/player/ctf_gordon/gordon.bmp" },
+	{ 0xB654E772, 0, "sound/weapons/g_bounce3.wav" },
+	{ 0xC29EDF3F, 0, "models/mapmodels/streetlight_saints_lt.mdl" },
+	{ 0x161F4C44, 0, "sound/vox/platform.wav" },
+	{ 0x69BEC3E6, 0, "sound/vox/must.wav" },
+	{ 0x6872FD0F, 0, "sound/bootcamp/reveille.wav" },
+	{ 0x6D6DE754, 0, "sound/scientist/hopeyouknow.wav" },
+	{ 0xB998AECC, 0, "models/g_rock2t.mdl" },
+	{ 0xAF1FF9EC, 0, "sound/houndeye/he_pain1.wav" },
+	{ 0xC9D333BB, 0, "sound/vox/wilco.wav" },
+	{ 0xC1189257, 0, "gfx/env/cliffbk.bmp" },
+	{ 0xB0E3C722, 0, "sound/fgrunt/check.wav" },
+	{ 0x20B08FE4, 0, "sound/weapons/bren_shoot.wav" },
+	{ 0xF80A9FC9, 0, "sound/radio/com_go.wav" },
+	{ 0xEA16233A, 0, "sound/weapons/famas-burst.wav" },
+	{ 0x4FCF5FE7, 0, "sound/scientist/c1a0_sci_scanrpt.wav" },
+	{ 0x3B7F94DF, 0, "sprites/bmp/fthrow02.bmp" },
+	{ 0x5384181E, 0, "sound/sentences/hev_0p.wav" },
+	{ 0x8BF66B0A, 0, "sound/vox/option.wav" },
+	{ 0xA849F010, 0, "models/player/ctf_barney/ctf_barney.mdl" },
+	{ 0x5B4E0B29, 0, "sound/fgrunt/gotit.wav" },
+	{ 0x2167CBE1, 0, "sound/barney/ba_iwish.wav" },
+	{ 0x95E82266, 0, "classes/long_sniper.txt" },
+	{ 0xBB6F1A85, 0, "sound/sentences/hg_quest1.wav" },
+	{ 0x67895557, 0, "models/w_mg42_box.mdl" },
+	{ 0x90640FA1, 0, "sound/fgrunt/of2a4_fg03.wav" },
+	{ 0x22F53B7C, 0, "servers/serverbrowser_korean.txt" },
+	{ 0x243082E1, 0, "sound/ichy/ichy_attack2.wav" },
+	{ 0xF05E69D8, 0, "gfx/env/jagdup.tga" },
+	{ 0x3692DB70, 0, "sound/zombie/claw_strike2.wav" },
+	{ 0x67822FD6, 0, "sound/vox/coded.wav" },
+	{ 0x0A741A9B, 0, "models/filecabinet.mdl" },
+	{ 0xC7D6F471, 0, "sprites/obj_icons/dod_glider/icon_obj_custom1_allies.spr" },
+	{ 0x2D7FFB6D, 0, "gfx/vgui/640_gordon.tga" },
+	{ 0xCFB56320, 0, "sound/scientist/c3a2_sci_portal.wav" },
+	{ 0x698336DE, 0, "models/hgrunt03.mdl" },
+	{ 0x7CACA46D, 0, "sound/hgrunt/zone!.wav" },
+	{ 0xE5304E15, 0, "sprites/bmp/fthrow04.bmp" },
+	{ 0xAEC770AB, 0, "sound/vox/locker.wav" },
+	{ 0x58B877C2, 0, "sound/sentences/na1.wav" },
+	{ 0xAEDA1C4D, 0, "sound/doors/doorstop8.wav" },
+	{ 0x420F9685, 0, "sound/ambience/britpointcaptured.wav" },
+	{ 0xB318C595, 0, "sprites/rifle_smoke2.spr" },
+	{ 0x01A7011E, 0, "sound/sentences/hg_answer4.wav" },
+	{ 0x981EBE29, 0, "media/launch_upmenu1.wav" },
+	{ 0xD86C7002, 0, "models/v_shotgun.mdl" },
+	{ 0xAF1F2829, 0, "sprites/bmp/fthrow08.bmp" },
+	{ 0x392D6EF1, 0, "sprites/particle.spr" },
+	{ 0x2FA4B27F, 0, "sound/plats/rackmove1.wav" },
+	{ 0x9CB11F9F, 0, "maps/cs_havana.txt" },
+	{ 0x92E55062, 0, "servers/icon_robotron_column.tga" },
+	{ 0xBC043AAF, 0, "sound/player/uscoverflanks.wav" },
+	{ 0x8B1A488E, 0, "sound/ambience/fd_flyby1.wav" },
+	{ 0x2ECF1ACA, 0, "maps/cz2.txt" },
+	{ 0x19F8C380, 0, "sound/weapons/mp5_slideback.wav" },
+	{ 0x66611295, 0, "sprites/hud7.spr" },
+	{ 0x0722BC7A, 0, "sound/voltigore/voltigore_pain3.wav" },
+	{ 0x23C551D0, 0, "gfx/vgui/fonts/640_primary button text.tga" },
+	{ 0x8EA6C49B, 0, "sound/vox/fourth.wav" },
+	{ 0x2B6040B7, 0, "sound/sentences/c1a0_9.wav" },
+	{ 0xD9934B8E, 0, "sound/scream2.wav" },
+	{ 0xB46C397E, 0, "gfx/vgui/fonts/800_scoreboard text.tga" },
+	{ 0x28436E9B, 0, "sound/barney/aintscared.wav" },
+	{ 0x53D04380, 0, "sound/roach/rch_walk.wav" },
+	{ 0x7BA96E6C, 0, "sound/scientist/slowingyou.wav" },
+	{ 0xCEA35C95, 0, "sound/hornet/ag_hornethit3.wav" },
+	{ 0x1251319D, 0, "gfx/vgui/fonts/1024_primary button text.tga" },
+	{ 0x8E6A3300, 0, "sound/fgrunt/mission.wav" },
+	{ 0x01730CD0, 0, "sound/vox/storage.wav" },
+	{ 0xD5803C2D, 0, "overviews/2fort.tga" },
+	{ 0x9BA63FBF, 0, "sprites/stmbal1.spr" },
+	{ 0xFA6B7606, 0, "sprites/mapsprites/fire.spr" },
+	{ 0xCFC3606D, 0, "sprites/xspark3.spr" },
+	{ 0xD881A9B7, 0, "sprites/documents_red_hud.spr" },
+	{ 0x9803D76A, 0, "models/houndeye.mdl" },
+	{ 0x76C00031, 0, "sound/scientist/needsleep.wav" },
+	{ 0x296F46FF, 0, "sound/fgrunt/intro_fg03.wav" },
+	{ 0x9F81A4D7, 0, "sound/doors/doorstop6.wav" },
+	{ 0xDC8D93B2, 0, "sound/bullchicken/bc_attackgrowl3.wav" },
+	{ 0x5E97687C, 0, "sprites/exp_a.spr" },
+	{ 0x653CABB1, 0, "sound/player/jump.wav" },
+	{ 0xDED5F0E4, 0, "sound/hgrunt/foxtrot.wav" },
+	{ 0x0368E4A4, 0, "sound/weapons/hegrenade-1.wav" },
+	{ 0x5A11BAF8, 0, "sound/scientist/sci_fear6.wav" },
+	{ 0xD372AB96, 0, "sprites/obj_icons/dod_escape/icon_obj_custom1_neutral.spr" },
+	{ 0x295CC574, 0, "sound/drill/dr2_add18.wav" },
+	{ 0x8E2D5A9E, 0, "sound/hgrunt/shit.wav" },
+	{ 0x091AE10B, 0, "sound/ambience/ratchant.wav" },
+	{ 0x3AF6F6A7, 0, "sound/sentences/hg_clear8.wav" },
+	{ 0xB204E511, 0, "models/headcrabt.mdl" },
+	{ 0x68B6FA2D, 0, "sound/fgrunt/chicken.wav" },
+	{ 0x82935EC2, 0, "models/in_teleport.mdl" },
+	{ 0x41B9A3C6, 0, "sound/hgrunt/zulu.wav" },
+	{ 0xF64AF0C1, 0, "models/gordon_scientistt.mdl" },
+	{ 0xDC1E6E63, 0, "models/arcticoranget.mdl" },
+	{ 0x0E2488E8, 0, "sprites/saveme.spr" },
+	{ 0x832F4429, 0, "models/g_shot2t.mdl" },
+	{ 0xF246448E, 0, "models/emp_grenade.mdl" },
+	{ 0x54C088E5, 0, "sound/hgrunt/gr_step3.wav" },
+	{ 0xD13789F0, 0, "models/player/hvyweapon/hvyweapon.mdl" },
+	{ 0xB732C5D9, 0, "maps/de_airstrip.txt" },
+	{ 0x65DFAB1E, 0, "models/player/arctic/arctic.mdl" },
+	{ 0x46B99067, 0, "sound/sentences/hg_monst0.wav" },
+	{ 0xF90157F0, 0, "models/p_bgrap.mdl" },
+	{ 0x7421499B, 0, "sound/sentences/ctr11.wav" },
+	{ 0x5F358821, 0, "sound/sentences/hg_gren5.wav" },
+	{ 0x3E38E265, 0, "sound/misc/splash_metal.wav" },
+	{ 0xB49D1DA9, 0, "sound/headcrab/hc_pain3.wav" },
+	{ 0x99E16389, 0, "sound/hgrunt/team.wav" },
+	{ 0x82918D7B, 0, "sound/ambience/littlemachine.wav" },
+	{ 0xCA15E326, 0, "overviews/de_prodigy.txt" },
+	{ 0xCCD41742, 0, "sprites/ibackpack.spr" },
+	{ 0xE648ABB4, 0, "models/player/gina/gina.mdl" },
+	{ 0xC8F711BA, 0, "sound/hgrunt/freeman.wav" },
+	{ 0x9AEBCBAC, 0, "sound/fvox/your.wav" },
+	{ 0xE10F9452, 0, "sprites/obj_icons/dod_zalec/icon_obj_custom2_allies.spr" },
+	{ 0xBE50A176, 0, "sound/vox/damage.wav" },
+	{ 0x80461A2F, 0, "models/mapmodels/jump_man.mdl" },
+	{ 0xAFAA4304, 0, "sound/common/wpn_moveselect.wav" },
+	{ 0x5ED66383, 0, "sound/scientist/of1a1_sc04.wav" },
+	{ 0xED9699BB, 0, "sound/otis/getanyworse.wav" },
+	{ 0xBFB48C24, 0, "models/barney06.mdl" },
+	{ 0xF1C7F501, 0, "models/v_bren.mdl" },
+	{ 0xE21AB3E8, 0, "sound/ambience/osprey_rotors.wav" },
+	{ 0x9044E741, 0, "sound/sentences/na11.wav" },
+	{ 0xB7D8E29C, 0, "models/p_fg42bu.mdl" },
+	{ 0x8C5D081C, 0, "models/v_binoculars.mdl" },
+	{ 0x52424C57, 0, "sound/radio/static.wav" },
+	{ 0x8E0983E9, 0, "sound/holo/tr_holo_leadguard.wav" },
+	{ 0x828C3C3B, 0, "sound/hgrunt/get!.wav" },
+	{ 0x5AC4A412, 0, "sound/vox/accepted.wav" },
+	{ 0x3A8F0A45, 0, "gfx/env/cliff2ft.tga" },
+	{ 0x96536E4F, 0, "sound/player/ususegrenades.wav" },
+	{ 0x6E89236D, 0, "sprites/obj_icons/icon_obj_axis.spr" },
+	{ 0x64D6BA56, 0, "resource/backgroundlayout.txt" },
+	{ 0x555A2978, 0, "sound/player/brittakeobj.wav" },
+	{ 0x31240970, 0, "sound/player/bhit_flesh-2.wav" },
+	{ 0x323014EE, 0, "models/hassault.mdl" },
+	{ 0xF654971F, 0, "models/w_usp.mdl" },
+	{ 0xE9C5DA64, 0, "sprites/obj_icons/dod_glider/icon_obj_custom3_axis.spr" },
+	{ 0x3033985D, 0, "sound/hgrunt/movement.wav" },
+	{ 0x3B0585D0, 0, "sound/vox/side.wav" },
+	{ 0x73684885, 0, "sound/vox/go.wav" },
+	{ 0x7BFBF863, 0, "sound/fgrunt/intro_fg10.wav" },
+	{ 0x42F5A277, 0, "sprites/bmp/1expl15.bmp" },
+	{ 0x738BAB11, 0, "logos/gshield.bmp" },
+	{ 0x11CADC1A, 0, "sound/fgrunt/disney.wav" },
+	{ 0x0F1B8869, 0, "gfx/vgui/clsimages/cls_fg42s.tga" },
+	{ 0x70E291A1, 0, "gfx/vgui/640_speaker2.tga" },
+	{ 0x3DECDDA4, 0, "gfx/env/de_stormdn.tga" },
+	{ 0x197FAD0B, 0, "models/p_fiveseven.mdl" },
+	{ 0x9DDE7977, 0, "sound/ambience/wren1.wav" },
+	{ 0xD6202D79, 0, "sound/barney/realbadwound.wav" },
+	{ 0x81CD6600, 0, "sound/scientist/c2a4_sci_arg4a.wav" },
+	{ 0xD227E13B, 0, "sprites/bazookapuff.spr" },
+	{ 0x8E2464F8, 0, "sound/weapons/enfield_shoot.wav" },
+	{ 0x7FCEF6B8, 0, "sound/shocktrooper/pur.wav" },
+	{ 0xF942C830, 0, "sound/scientist/c2a5_sci_boobie.wav" },
+	{ 0x13A7C5FE, 0, "cs_office.wad" },
+	{ 0x058BCB47, 0, "sound/weapons/whizz2.wav" },
+	{ 0x45F9AB8B, 0, "sound/vox/reached.wav" },
+	{ 0x8DD33A47, 0, "sound/de_torn/torn_mgun1.wav" },
+	{ 0x9DA2FAF1, 0, "gfx/vgui/640_medicred.tga" },
+	{ 0x2847DD45, 0, "sound/buttons/lightswitch2.wav" },
+	{ 0xD9B0E4C9, 0, "sound/ambience/burn_no_autostart.wav" },
+	{ 0x278306FE, 0, "sound/vox/supercooled.wav" },
+	{ 0xE73238D6, 0, "gfx/env/avaup.tga" },
+	{ 0xF7AEA5CA, 0, "resource/icon_down.tga" },
+	{ 0x41EB979F, 0, "sound/vox/clearance.wav" },
+	{ 0xA2C19DA3, 0, "models/mapmodels/ouitz_tree1.mdl" },
+	{ 0x34367C5F, 0, "sound/drill/dr2_add02.wav" },
+	{ 0x99B73AA4, 0, "sound/hgrunt/three.wav" },
+	{ 0x10953919, 0, "sound/sentences/hev_c11.wav" },
+	{ 0x2DEA3901, 0, "sound/weapons/p90_clipout.wav" },
+	{ 0x9E7081E9, 0, "models/xen_rockgib_med.mdl" },
+	{ 0xC660382C, 0, "sprites/scope_enfield_soft.spr" },
+	{ 0xCF483464, 0, "models/p_sg552.mdl" },
+	{ 0x755EFEA3, 0, "sound/fvox/deactivated.wav" },
+	{ 0xDCBF78C8, 0, "sound/sentences/tr_a.wav" },
+	{ 0x9441811F, 0, "gfx/detail/dt_ssteel1.tga" },
+	{ 0xA45C70BF, 0, "sound/sentences/hev_heal1.wav" },
+	{ 0xFC55982F, 0, "sound/sentences/hg_cover6.wav" },
+	{ 0x156A174A, 0, "sound/barney/bequiet.wav" },
+	{ 0x8CF0E949, 0, "sound/scientist/fellowscientist.wav" },
+	{ 0xF4846EC4, 0, "sound/pitworm/pit_worm_angry1.wav" },
+	{ 0xC12B3BF8, 0, "sound/sentences/c2a4_12.wav" },
+	{ 0xA237D74D, 0, "sound/ambience/mgun_burst3.wav" },
+	{ 0x1EF6DBC4, 0, "models/p_crossbow.mdl" },
+	{ 0x0BEC7EC3, 0, "sound/player/ususebazooka.wav" },
+	{ 0xAA797A63, 0, "sound/bullchicken/bc_bite3.wav" },
+	{ 0x3A1DFF70, 0, "sound/weapons/pwrench_miss1.wav" },
+	{ 0xA11D4DF9, 0, "sound/weapons/xbow_hit2.wav" },
+	{ 0x406D9184, 0, "sound/radio/moveout.wav" },
+	{ 0xFECAD6BF, 0, "sound/barney/ba_security2_desk2.wav" },
+	{ 0xF4B0E3A9, 0, "models/mapmodels/flofdir_gib.mdl" },
+	{ 0x00CFADD6, 0, "maps/rock2.txt" },
+	{ 0x5D56C38F, 0, "models/mini_osprey_enginegibs.mdl" },
+	{ 0x8B901FDC, 0, "sound/debris/zap2.wav" },
+	{ 0x063A4735, 0, "sound/sentences/c2a4_4.wav" },
+	{ 0x20326AC1, 0, "sound/barney/c1a4_ba_octo3.wav" },
+	{ 0x04C5BA5D, 0, "sound/sentences/hev_gr19.wav" },
+	{ 0x96EE0718, 0, "resource/icon_pause.tga" },
+	{ 0xFED397B1, 0, "sprites/mushroom.spr" },
+	{ 0xCD222094, 0, "sound/hgrunt/that!.wav" },
+	{ 0x839FE64C, 0, "sound/ba_holo/tr_holo_grenade.wav" },
+	{ 0xB44ED892, 0, "sound/shatter.wav" },
+	{ 0x81DDEE63, 0, "sound/bullchicken/bc_idle3.wav" },
+	{ 0x3B64F168, 0, "gfx/env/blacklf.tga" },
+	{ 0x258BDF1C, 0, "sound/vox/environment.wav" },
+	{ 0xD6E547CF, 0, "sound/vox/hydro.wav" },
+	{ 0x1D680943, 0, "sound/shocktrooper/mub.wav" },
+	{ 0x5D1339BD, 0, "models/conveyor1.mdl" },
+	{ 0x12C868A2, 0, "models/w_tmp.mdl" },
+	{ 0x73938808, 0, "sound/weapons/pwrench_hit2.wav" },
+	{ 0xF7765C8E, 0, "sound/sentences/c2a4_1.wav" },
+	{ 0x8B0DAABF, 0, "sound/scientist/whyaskme.wav" },
+	{ 0x442BDDD7, 0, "sound/scientist/cantbeworse.wav" },
+	{ 0xBB4F21AD, 0, "sound/player/britpanzerschreck.wav" },
+	{ 0x3FF37701, 0, "sound/debris/wood1.wav" },
+	{ 0xB6B2EF83, 0, "sound/hgrunt/hostiles.wav" },
+	{ 0x1527878A, 0, "sound/weapons/mp44_shoot.wav" },
+	{ 0x5A079A0C, 0, "models/mapmodels/bush_shrubv01.mdl" },
+	{ 0x15DB28AC, 0, "ctf manual/resources/pow_backpack.wav" },
+	{ 0xF6C210E1, 0, "sound/hgrunt/moves!.wav" },
+	{ 0xF5F56F15, 0, "sprites/mapmarkers/gerflag.spr" },
+	{ 0x1926729E, 0, "models/wire_blue32.mdl" },
+	{ 0x71477CA8, 0, "sound/ambience/thunder4.wav" },
+	{ 0xA49AAFC5, 0, "gfx/env/cliff2dn.tga" },
+	{ 0x61A845BD, 0, "sound/vox/one.wav" },
+	{ 0x55A70D3B, 0, "sound/common/bodydrop1.wav" },
+	{ 0x0893C619, 0, "sound/ambience/industrial2.wav" },
+	{ 0x2D5DA2E1, 0, "sound/hgrunt/am!.wav" },
+	{ 0x2ADE7F84, 0, "gfx/env/killertomatoft.tga" },
+	{ 0x3C1C3ECF, 0, "sound/sentences/c1a1_8.wav" },
+	{ 0x0BA87B2A, 0, "sound/vox/up.wav" },
+	{ 0x28DB9E16, 0, "sound/hgrunt/sir.wav" },
+	{ 0x618E0804, 0, "overviews/dod_jagd.txt" },
+	{ 0xD50A1399, 0, "models/w_colt.mdl" },
+	{ 0xBBB3640C, 0, "models/player/spy/spy.mdl" },
+	{ 0x15143F4E, 0, "sound/weapons/slideback1.wav" },
+	{ 0x523D57EE, 0, "sprites/mapmarkers/arrow_ne.spr" },
+	{ 0xC21A49DC, 0, "sound/pitdrone/pit_drone_communicate1.wav" },
+	{ 0xEA38D328, 0, "sound/ambience/truck1.wav" },
+	{ 0x8491491F, 0, "sound/gonome/gonome_idle2.wav" },
+	{ 0x92D37F3C, 0, "sound/scientist/sneeze.wav" },
+	{ 0x62567BEF, 0, "logos/2ndrangers.bmp" },
+	{ 0xA77FB689, 0, "gfx/env/morningdewrt.tga" },
+	{ 0x06B80116, 0, "sprites/bmp/fthrow12.bmp" },
+	{ 0x7DA96197, 0, "sound/vox/terminal.wav" },
+	{ 0x1F76C935, 0, "sound/sentences/hev_det0.wav" },
+	{ 0x23256046, 0, "models/v_bgrap.mdl" },
+	{ 0x22638CE9, 0, "models/p_k98_l.mdl" },
+	{ 0xA4F23200, 0, "sound/scientist/alientrick.wav" },
+	{ 0xAA79AE91, 0, "sound/otis/hello.wav" },
+	{ 0x68C8443C, 0, "models/shield/p_shield_flashbang.mdl" },
+	{ 0x483CD35C, 0, "models/pi_outlamp1.mdl" },
+	{ 0x2DFE932F, 0, "resource/platform_tchinese.txt" },
+	{ 0x40FFA293, 0, "maps/dod_saints.txt" },
+	{ 0xE705A513, 0, "gfx/env/avantibk.tga" },
+	{ 0x64713A57, 0, "models/islave.mdl" },
+	{ 0x5465559D, 0, "models/p_disc.mdl" },
+	{ 0xF1CCBEAB, 0, "sound/fvox/four.wav" },
+	{ 0xC18822FF, 0, "sprites/tf_weapon_ng.txt" },
+	{ 0xF7898988, 0, "models/pred_plant.mdl" },
+	{ 0x75A7911F, 0, "sound/vox/correct.wav" },
+	{ 0x469B0C16, 0, "sound/fgrunt/of5a1_fg04.wav" },
+	{ 0xC432D936, 0, "sound/vox/e.wav" },
+	{ 0xDDC4AEAB, 0, "sound/player/usneedammo.wav" },
+	{ 0x548E6C34, 0, "maps/op4ctf_xendance.txt" },
+	{ 0xF59EBD7D, 0, "overviews/boot_camp.bmp" },
+	{ 0x5F805991, 0, "sound/barney/somethingmoves.wav" },
+	{ 0x868F2BEE, 0, "sound/ichy/ichy_pain3.wav" },
+	{ 0x17D9F642, 0, "sound/player/usnegative.wav" },
+	{ 0xAD1CEBE5, 0, "sprites/xfire2.spr" },
+	{ 0xEB9F492B, 0, "sprites/rock_big.spr" },
+	{ 0x15D1AD63, 0, "sound/drill/add14.wav" },
+	{ 0xAA9AD1D4, 0, "models/mapmodels/by_statue_snow.mdl" },
+	{ 0x613371AD, 0, "sprites/obj_icons/icon_obj_radio_neutral.spr" },
+	{ 0xF65902B6, 0, "maps/dod_avalanche.txt" },
+	{ 0x71375051, 0, "gfx/env/dustbowllf.tga" },
+	{ 0x352BDEF0, 0, "sound/fvox/pm.wav" },
+	{ 0x1ECCDFDD, 0, "sound/vox/checkpoint.wav" },
+	{ 0xA143F91F, 0, "gfx/env/hacklf.bmp" },
+	{ 0xD7DE77C7, 0, "sound/debris/metal7.wav" },
+	{ 0xDF2FE811, 0, "sound/vox/magnetic.wav" },
+	{ 0x858F3ECD, 0, "sound/ambience/fire1.wav" },
+	{ 0xA12F86BE, 0, "gfx/env/dustbowlup.tga" },
+	{ 0x65EB8320, 0, "sound/vox/alarm.wav" },
+	{ 0x3526040E, 0, "sound/bullchicken/bc_spithit1.wav" },
+	{ 0xF0DD2C68, 0, "sprites/tf_weapon_pl.txt" },
+	{ 0xF457B1D8, 0, "sound/sentences/ctr9.wav" },
+	{ 0x0F7C8328, 0, "gfx/env/neb7lf.bmp" },
+	{ 0x68776891, 0, "sound/sentences/c1a0_18.wav" },
+	{ 0x91597BA6, 0, "gfx/env/dashnight256rt.tga" },
+	{ 0x7F7209F0, 0, "sound/fgrunt/backup.wav" },
+	{ 0x38DDCA12, 0, "servers/game_ready.wav" },
+	{ 0x57774468, 0, "servers/serverbrowser_spanish.txt" },
+	{ 0x858120BB, 0, "sprites/banglr.spr" },
+	{ 0x75288038, 0, "sound/pitworm/pit_worm_idle2.wav" },
+	{ 0x162D2907, 0, "sound/scientist/c1a2_sci_darkroom.wav" },
+	{ 0xCA46EE89, 0, "sound/vox/tunnel.wav" },
+	{ 0x07A1FCA9, 0, "sound/misc/machine_on.wav" },
+	{ 0x2C60F7B5, 0, "gfx/env/morningdewup.bmp" },
+	{ 0x3641AB2E, 0, "sound/hgrunt/alert.wav" },
+	{ 0x453BBFEB, 0, "overviews/dmc_dm4.bmp" },
+	{ 0x30EBBDED, 0, "gfx/env/alien2lf.bmp" },
+	{ 0x28A2022F, 0, "sound/player/ax1.wav" },
+	{ 0xA1873830, 0, "overviews/epicenter.bmp" },
+	{ 0x3CC10F13, 0, "sound/rosenberg/ro_tele_xen03a.wav" },
+	{ 0xF668A03E, 0, "sound/squeek/sqk_hunt1.wav" },
+	{ 0xF65B1FEF, 0, "sprites/obj_icons/dod_saints/icon_obj_custom3_axis.spr" },
+	{ 0x8D4BB16F, 0, "sound/hgrunt/shot!.wav" },
+	{ 0xD1D2F203, 0, "models/mapmodels/flo_bourderline.mdl" },
+	{ 0x63147A35, 0, "models/w_spore_launcher.mdl" },
+	{ 0x4F41BDA0, 0, "sound/ambience/screammachine.wav" },
+	{ 0xF3BB1296, 0, "gfx/env/cxdn.tga" },
+	{ 0x53D665A7, 0, "sound/scientist/scream22.wav" },
+	{ 0xE55A2AF1, 0, "sound/voltigore/voltigore_alert2.wav" },
+	{ 0x0D83E8AD, 0, "resource/background/800_1_b_loading.tga" },
+	{ 0x692D95CF, 0, "sprites/hud_icons.spr" },
+	{ 0x9721C35E, 0, "sound/vox/move.wav" },
+	{ 0x9CE4067C, 0, "sound/sentences/hev_c7.wav" },
+	{ 0xFC110753, 0, "gfx/vgui/1280_arrowup.tga" },
+	{ 0x757CF1CA, 0, "models/v_nail.mdl" },
+	{ 0x34D7E21D, 0, "models/mapmodels/uplant1.mdl" },
+	{ 0x309FEC8A, 0, "sprites/tree3.spr" },
+	{ 0xBD25943F, 0, "sound/ambience/rotormachine.wav" },
+	{ 0x4583E6DB, 0, "sound/ambience/squitch2.wav" },
+	{ 0x6C579DB3, 0, "sound/player/pain4.wav" },
+	{ 0x52B9A2C9, 0, "sprites/bmp/1expl04.bmp" },
+	{ 0x2B8D1E27, 0, "sound/de_torn/torn_bomb2.wav" },
+	{ 0xBDF618F3, 0, "gfx/vgui/800_timer.tga" },
+	{ 0xB4C5E8E8, 0, "models/p_shotgun2.mdl" },
+	{ 0xEFA14AC8, 0, "sprites/xbeam2.spr" },
+	{ 0xCAE50379, 0, "models/p_k98s.mdl" },
+	{ 0x09EB8DC9, 0, "sprites/obj_icons/dod_saints/icon_obj_custom1_axis.spr" },
+	{ 0x89701741, 0, "sound/weapons/hegrenade-2.wav" },
+	{ 0x1AC91E58, 0, "sprites/animglow01.spr" },
+	{ 0x72060216, 0, "sprites/scope_spring_soft.spr" },
+	{ 0x330F0781, 0, "gfx/vgui/defuser.tga" },
+	{ 0x13FC7973, 0, "sound/weapons/elite_twirl.wav" },
+	{ 0x0B50FC58, 0, "overviews/de_aztec.bmp" },
+	{ 0x104EB73A, 0, "resource/background/800_1_c_loading.tga" },
+	{ 0x10C24506, 0, "sound/otis/mom.wav" },
+	{ 0x08977159, 0, "sound/hgrunt/hg_civvies.wav" },
+	{ 0x844765AC, 0, "overviews/de_nuke.bmp" },
+	{ 0x64AE98A8, 0, "sound/vox/guard.wav" },
+	{ 0x9C15154F, 0, "sound/controller/con_pain2.wav" },
+	{ 0xB77FFD4A, 0, "models/w_shield.mdl" },
+	{ 0xB4E10E09, 0, "models/w_mg42.mdl" },
+	{ 0xA977F1FB, 0, "sound/nihilanth/nil_slaves.wav" },
+	{ 0x95635CC1, 0, "sprites/hud3.spr" },
+	{ 0x4B9E6F82, 0, "sound/holo/tr_holo_hitall.wav" },
+	{ 0x900E22E9, 0, "models/tool_box.mdl" },
+	{ 0xF3198975, 0, "1600_textscheme.txt" },
+	{ 0xA561C261, 0, "sprites/obj_icons/icon_obj_88_allies.spr" },
+	{ 0x430E599B, 0, "sound/vox/call.wav" },
+	{ 0xF0258C76, 0, "models/v_tfc_nailgun.mdl" },
+	{ 0x395154DD, 0, "models/w_hgunt.mdl" },
+	{ 0xF20EDF89, 0, "models/p_mini2.mdl" },
+	{ 0xEF029D0E, 0, "sprites/weapon_p90.txt" },
+	{ 0x7BC7387E, 0, "sound/weapons/hks1.wav" },
+	{ 0x2379E02F, 0, "sound/player/damage5.wav" },
+	{ 0x098CEA07, 0, "sound/vox/nerve_gas_released.wav" },
+	{ 0x9119145E, 0, "dod_zalec.wad" },
+	{ 0xB52D7819, 0, "gfx/env/cliff2rt.tga" },
+	{ 0x4162969D, 0, "sound/shocktrooper/ga.wav" },
+	{ 0x66F1A282, 0, "sound/vox/yes.wav" },
+	{ 0x8638A05F, 0, "sound/rosenberg/ro_tele_final03.wav" },
+	{ 0xB0C0A88E, 0, "models/pow_visual.mdl" },
+	{ 0xA59D2DBC, 0, "sound/sentences/dr0.wav" },
+	{ 0x99D7922C, 0, "sound/controller/con_idle5.wav" },
+	{ 0xDC234CF6, 0, "sprites/obj_icons/dod_falaise/icon_obj_custom1_neutral.spr" },
+	{ 0x69ECC23B, 0, "sound/sentences/hg_answer3.wav" },
+	{ 0xF8F48E2B, 0, "sound/doors/doorstop2.wav" },
+	{ 0x31C5B25E, 0, "sprites/customxhair.spr" },
+	{ 0x09767D75, 0, "sound/shockroach/shock_walk.wav" },
+	{ 0xCD76CC54, 0, "sound/fgrunt/of2a5_fg03.wav" },
+	{ 0x12174F7D, 0, "sound/vox/elevator.wav" },
+	{ 0xA901BDA4, 0, "sound/sentences/hev_gr3.wav" },
+	{ 0xAF6A87F2, 0, "models/v_tfc_shotgun.mdl" },
+	{ 0xB82019A2, 0, "sound/ba_holo/tr_holo_jumpdown.wav" },
+	{ 0x27771714, 0, "sprites/weapon_ak47.txt" },
+	{ 0x1F47CA6E, 0, "sprites/obj_icons/dod_vicenza/icon_obj_custom2_axis.spr" },
+	{ 0xF1751231, 0, "sound/sentences/hev_d01.wav" },
+	{ 0xDAEA635C, 0, "sound/ambience/distantmortar2.wav" },
+	{ 0xEC0AC91B, 0, "models/scientist08.mdl" },
+	{ 0x86B8A388, 0, "models/mapmodels/flo_grass2.mdl" },
+	{ 0xAB00D3E9, 0, "gfx/env/badlandsup.tga" },
+	{ 0x28917AED, 0, "sound/fgrunt/watchfire.wav" },
+	{ 0x8AD38879, 0, "sound/fvox/get_buckshot.wav" },
+	{ 0xDFFFD24A, 0, "overviews/crossfire.tga" },
+	{ 0x62075F97, 0, "sound/hgrunt/foxtrot!.wav" },
+	{ 0x8495EEF0, 0, "sound/vox/through.wav" },
+	{ 0xE60BEBEA, 0, "sound/fgrunt/tosee.wav" },
+	{ 0xA7F6122E, 0, "gfx/vgui/vip.tga" },
+	{ 0xB1B34F12, 0, "models/islave_gibs1.mdl" },
+	{ 0x9407589F, 0, "sound/voltigore/voltigore_footstep2.wav" },
+	{ 0x81F1B75D, 0, "sound/vox/zone.wav" },
+	{ 0xD583385F, 0, "models/w_oxygen.mdl" },
+	{ 0xFC737DE5, 0, "sound/vox/proper.wav" },
+	{ 0x441E16F4, 0, "models/player/ctf_gina/gina.bmp" },
+	{ 0xE7A6960D, 0, "sound/sentences/na8.wav" },
+	{ 0x43FB496F, 0, "sound/sentences/ctr4.wav" },
+	{ 0xC76E1BF5, 0, "sound/barney/c2a4_ba_5tau.wav" },
+	{ 0xB83C8B87, 0, "sprites/fexplo.spr" },
+	{ 0xA295C6B6, 0, "sound/scientist/c1a0_sci_gm.wav" },
+	{ 0x91979B2E, 0, "models/mapmodels/arc_xer_tree1.mdl" },
+	{ 0xCAE04523, 0, "models/w_stick.mdl" },
+	{ 0xDE8E0107, 0, "sound/vox/open.wav" },
+	{ 0x49D7620D, 0, "sound/player/ussticktogether.wav" },
+	{ 0x0D0CB689, 0, "sprites/tfchud06.spr" },
+	{ 0x39EF2A3B, 0, "sound/vox/voltage.wav" },
+	{ 0xF1C24319, 0, "gfx/vgui/1920_arrowright.tga" },
+	{ 0x5A59AA11, 0, "gfx/env/xen9bk.bmp" },
+	{ 0x1278B195, 0, "models/w_antidote.mdl" },
+	{ 0xB4DFC6BC, 0, "sound/hgrunt/checking.wav" },
+	{ 0xB295AC58, 0, "models/w_displacer.mdl" },
+	{ 0xCA37D4B7, 0, "sound/sentences/hg_taunt1.wav" },
+	{ 0x5550A13C, 0, "sound/player/pl_snow1.wav" },
+	{ 0x67DDFE5C, 0, "models/scientist09.mdl" },
+	{ 0x60189FE6, 0, "logos/british.bmp" },
+	{ 0xD5FAB6C4, 0, "sound/hgrunt/six.wav" },
+	{ 0xB89787DD, 0, "sound/sentences/hg_quest9.wav" },
+	{ 0xB235C9EA, 0, "resource/ricochet_italian.txt" },
+	{ 0xD06AD7F0, 0, "models/player/sniper/sniper.mdl" },
+	{ 0xD4BD5631, 0, "overviews/dod_kalt.bmp" },
+	{ 0xEC7E43E9, 0, "sprites/shot_smoke4.spr" },
+	{ 0x1C8B3673, 0, "sound/otis/watchit.wav" },
+	{ 0xC4DFD136, 0, "sound/sentences/hg_clear3.wav" },
+	{ 0x05886617, 0, "models/armour_g.mdl" },
+	{ 0x1FFD209D, 0, "sprites/radar640.spr" },
+	{ 0x54B2A90A, 0, "sound/geneworm/geneworm_final_pain4.wav" },
+	{ 0x9A5820C7, 0, "sound/otis/aliens.wav" },
+	{ 0xB6936DE4, 0, "sound/radio/of1a6_rd01.wav" },
+	{ 0xF4BD636C, 0, "gfx/detail/dt_stone1.tga" },
+	{ 0xC3022A3F, 0, "sound/sentences/hev_e0.wav" },
+	{ 0x307CC617, 0, "sound/scientist/sc_canals4.wav" },
+	{ 0x89DAEEB5, 0, "models/pi_shrub.mdl" },
+	{ 0xB6D49F5E, 0, "gfx/env/blueup.tga" },
+	{ 0x54F803F8, 0, "models/fleshgibs.mdl" },
+	{ 0xAA77B7FF, 0, "gfx/env/de_stormdn.bmp" },
+	{ 0xAB6BEDD1, 0, "sound/vox/violated.wav" },
+	{ 0xAD5213F6, 0, "sound/drill/rope05b.wav" },
+	{ 0xEC614B77, 0, "gfx/decals/hwshot3.bmp" },
+	{ 0xA8A61215, 0, "sound/hgrunt/shit!.wav" },
+	{ 0xCA8B48D7, 0, "sound/vox/officer.wav" },
+	{ 0x651C95EC, 0, "models/w_357ammo.mdl" },
+	{ 0x8B9EE337, 0, "sound/sentences/c1a1_11.wav" },
+	{ 0xCF4421AD, 0, "sound/drill/add16.wav" },
+	{ 0x53FC3C5E, 0, "sound/drill/fourthroom02.wav" },
+	{ 0x8809418F, 0, "models/mapmodels/dod_jagd_piece.mdl" },
+	{ 0x50F8BB84, 0, "sound/sentences/ctr14.wav" },
+	{ 0xF8EF3009, 0, "sound/drill/pistol03.wav" },
+	{ 0xE474DA1E, 0, "sound/sentences/hev_gr14.wav" },
+	{ 0xCC5B581D, 0, "gfx/env/grnplsntft.tga" },
+	{ 0xD0D3DBE9, 0, "resource/valve_german.txt" },
+	{ 0x78CD0D54, 0, "sound/fvox/weapon_pickup.wav" },
+	{ 0xBBF6EB39, 0, "models/p_knife2.mdl" },
+	{ 0xCA51F924, 0, "models/v_penguin.mdl" },
+	{ 0xF6A5CA5D, 0, "models/barney01.mdl" },
+	{ 0xF6A6B71D, 0, "sound/weapons/sniper_fire.wav" },
+	{ 0x684AE4B3, 0, "models/shield/p_shield_glock18.mdl" },
+	{ 0x71E8933B, 0, "sound/scientist/perhaps.wav" },
+	{ 0x72690AFA, 0, "maps/dod_falaise.txt" },
+	{ 0xF0758B7D, 0, "sound/player/axhit2.wav" },
+	{ 0x3094B961, 0, "gfx/vgui/mp5.tga" },
+	{ 0x408DB717, 0, "sound/weapons/mp5-1.wav" },
+	{ 0x6246C48B, 0, "sound/weapons/usp_clipin.wav" },
+	{ 0x04E9F158, 0, "sound/holo/tr_holo_retry.wav" },
+	{ 0x32B7E249, 0, "sound/ambience/c2amb.wav" },
+	{ 0x725DC25B, 0, "sound/drill/livefire06.wav" },
+	{ 0x526A9AA6, 0, "gfx/vgui/fonts/640_commandmenu text.tga" },
+	{ 0xC73849EB, 0, "spectatormenu.txt" },
+	{ 0x8B0760ED, 0, "gfx/env/tornskydn.tga" },
+	{ 0x36E3EB4C, 0, "sound/hgrunt/_comma.wav" },
+	{ 0x39DF836E, 0, "sound/vox/be.wav" },
+	{ 0x84D9DC88, 0, "sound/garg/gar_idle2.wav" },
+	{ 0x7B01643A, 0, "models/intro_commander.mdl" },
+	{ 0x6A414486, 0, "sound/fvox/eleven.wav" },
+	{ 0xF96806A8, 0, "models/player/demo/demo.mdl" },
+	{ 0x2AD6CA7F, 0, "sound/gonome/gonome_pain4.wav" },
+	{ 0xF5AE42F5, 0, "models/gordon_scientist.mdl" },
+	{ 0x50F6DEB4, 0, "gfx/env/hackdn.tga" },
+	{ 0xB1CE2719, 0, "sound/weapons/mac10-1.wav" },
+	{ 0xBEFDF318, 0, "gfx/env/spacebk.tga" },
+	{ 0x98D9B9A2, 0, "sound/buttons/button9.wav" },
+	{ 0x2349194F, 0, "sound/weapons/ak47_boltpull.wav" },
+	{ 0x5EA116FA, 0, "gfx/vgui/640_frozen.tga" },
+	{ 0xB3AB66D2, 0, "models/v_crossbow.mdl" },
+	{ 0xE368DDE9, 0, "gfx/env/sky_blu_dn.tga" },
+	{ 0xC49B4684, 0, "models/shield/v_shield_deagle.mdl" },
+	{ 0x33654A5A, 0, "sound/weapons/hit_metal2.wav" },
+	{ 0x23E15716, 0, "sound/ambience/des_wind3.wav" },
+	{ 0xD13FD1A1, 0, "sound/sentences/ctr17.wav" },
+	{ 0x0D1218C7, 0, "sound/tentacle/te_roar1.wav" },
+	{ 0x58DDCCBC, 0, "models/player/grunt/grunt.mdl" },
+	{ 0x64805A9D, 0, "sound/barney/nodrill.wav" },
+	{ 0x57E6B5EA, 0, "logos/chick1.bmp" },
+	{ 0xB6DFCB58, 0, "models/p_nailgun2.mdl" },
+	{ 0xBEF86A60, 0, "models/p_shot.mdl" },
+	{ 0x125B3DB9, 0, "sound/weapons/displacer_start.wav" },
+	{ 0xD3BEEDAC, 0, "models/mapmodels/streetlight_saints.mdl" },
+	{ 0xC1C9C8B9, 0, "sound/ambience/distantmortar1.wav" },
+	{ 0x526D6A5D, 0, "sprites/hud.txt" },
+	{ 0x006CCA6B, 0, "sound/materials.txt" },
+	{ 0xD3E45883, 0, "gfx/vgui/clsimages/cls_k43.tga" },
+	{ 0xF3665D07, 0, "sound/player/geiger3.wav" },
+	{ 0x02CFB349, 0, "sprites/hud_heart.spr" },
+	{ 0x48FDB423, 0, "models/scientist.mdl" },
+	{ 0xA25F2F95, 0, "models/mapmodels/flo_nebelwerfer.mdl" },
+	{ 0x70724AC5, 0, "models/hgrunt02.mdl" },
+	{ 0x2FEE37BF, 0, "sound/vox/contamination.wav" },
+	{ 0xCE35C12E, 0, "sprites/gexplo.spr" },
+	{ 0xC7C3F57B, 0, "sound/fgrunt/thanks.wav" },
+	{ 0x9E47802A, 0, "gfx/vgui/marker_arrow_n.tga" },
+	{ 0x970C0A63, 0, "sprites/weapon_mp5navy.txt" },
+	{ 0xCEC37206, 0, "sound/sentences/hg_clear12.wav" },
+	{ 0xC8C47E66, 0, "sound/player/udeath.wav" },
+	{ 0x3B7A9BC7, 0, "sound/fvox/five.wav" },
+	{ 0xC59FF6D9, 0, "models/cactusgibs.mdl" },
+	{ 0x4F0C37EA, 0, "sound/vox/force.wav" },
+	{ 0x9F6402CD, 0, "sound/player/ustakecover.wav" },
+	{ 0x5FE51D97, 0, "sprites/tf_weapon_supershotgun.txt" },
+	{ 0x087A56F9, 0, "sound/vox/experimental.wav" },
+	{ 0x07390690, 0, "sound/vox/plant.wav" },
+	{ 0xDE90A9D3, 0, "models/mapmodels/flo_churchlight.mdl" },
+	{ 0x013F66C4, 0, "sound/items/medshotno1.wav" },
+	{ 0x9CBEEF1D, 0, "sound/sentences/hg_check3.wav" },
+	{ 0x81DDABAF, 0, "sound/tentacle/te_search1.wav" },
+	{ 0x7545D6C2, 0, "gfx/env/alien1bk.tga" },
+	{ 0x6825BA7E, 0, "sprites/_tongue.spr" },
+	{ 0x6743AD2C, 0, "sprites/obj_icons/dod_flugplatz/icon_obj_custom1_neutral.spr" },
+	{ 0x31DA21C9, 0, "gfx/env/dmcprt.tga" },
+	{ 0xA028EAB2, 0, "sound/weapons/mine_deploy.wav" },
+	{ 0x658F7E09, 0, "sound/bootcamp/old_reveille.wav" },
+	{ 0x6B4232DA, 0, "sound/vox/scream.wav" },
+	{ 0x7136523D, 0, "sprites/ikgrass4.spr" },
+	{ 0xF36F708F, 0, "sound/ichy/ichy_die4.wav" },
+	{ 0xDB436D3F, 0, "sound/barney/c2a1_ba_again.wav" },
+	{ 0x0D3D5114, 0, "resource/ui/diagonal.tga" },
+	{ 0x0A32CFF5, 0, "gfx/env/desertbk.tga" },
+	{ 0x5841D52F, 0, "models/woodgibs.mdl" },
+	{ 0xA5BE4E23, 0, "sound/hgrunt/one!.wav" },
+	{ 0xF5E9C868, 0, "gfx/vgui/1600_arrowright.tga" },
+	{ 0xE628A881, 0, "sound/vox/ing.wav" },
+	{ 0xAAD5CA2A, 0, "sound/fgrunt/moveup.wav" },
+	{ 0x5BC14E8E, 0, "gfx/vgui/clsimages/class_random_brit.tga" },
+	{ 0x266A091B, 0, "sound/controller/con_attack2.wav" },
+	{ 0xD578758A, 0, "models/player/us-para/us-parat.mdl" },
+	{ 0x6B4E3D43, 0, "models/pow_hard.mdl" },
+	{ 0xAEA99ED4, 0, "classes/short_gina.txt" },
+	{ 0x694F9B42, 0, "overviews/datacore.bmp" },
+	{ 0x6D8C3378, 0, "sound/gonarch/gon_step3.wav" },
+	{ 0xE716D385, 0, "sound/ambience/arabmusic.wav" },
+	{ 0x71A39AB2, 0, "sound/hgrunt/am.wav" },
+	{ 0x5DCB046C, 0, "sound/weapons/c0wg42.wav" },
+	{ 0xDBB712E6, 0, "sound/scientist/c1a3_sci_silo1a.wav" },
+	{ 0x13832B1D, 0, "sound/drill/dr2_add04.wav" },
+	{ 0x92B7275F, 0, "sound/hgrunt/north.wav" },
+	{ 0xF510F26E, 0, "sprites/icon_obj_axis.spr" },
+	{ 0xE936BDF4, 0, "sound/shocktrooper/thirv.wav" },
+	{ 0x33FC9FFA, 0, "sprites/xbeam4.spr" },
+	{ 0xB0B75E6E, 0, "sound/weapons/mortar_hit2.wav" },
+	{ 0x4FCDB4F3, 0, "gfx/vgui/640_adrian.tga" },
+	{ 0xCCC5A770, 0, "models/w_shock_rifle.mdl" },
+	{ 0x4B2DB5DC, 0, "sound/ctf/pow_backpack.wav" },
+	{ 0xB2441D26, 0, "sound/debris/glass3.wav" },
+	{ 0x24E735F6, 0, "sound/sentences/hev_c5.wav" },
+	{ 0x9E25E63F, 0, "sound/sentences/hev_med1.wav" },
+	{ 0x6231E073, 0, "sprites/bmp/2expl01.bmp" },
+	{ 0xBD1069B7, 0, "sound/drill/add18.wav" },
+	{ 0x5768B1C8, 0, "sprites/tf_weapon_superng.txt" },
+	{ 0x4C8523C6, 0, "sound/barney/c1a0_ba_desk.wav" },
+	{ 0x212A1503, 0, "sound/otis/medic.wav" },
+	{ 0x3EA124CE, 0, "resource/platform_thai.txt" },
+	{ 0x4412510D, 0, "sound/hgrunt/c2a3_hg_1drag.wav" },
+	{ 0xD2824772, 0, "sprites/enter1.spr" },
+	{ 0x5322C8C2, 0, "sound/scientist/c2a4_sci_letout.wav" },
+	{ 0xF7976026, 0, "sprites/flare3.spr" },
+	{ 0x69E0D21E, 0, "sound/sentences/hev_f2.wav" },
+	{ 0x6546BDE2, 0, "sound/radio/ct_imhit.wav" },
+	{ 0x8C14EE47, 0, "sprites/xspark1.spr" },
+	{ 0xFC807473, 0, "commandmenu.txt" },
+	{ 0xB280AF9D, 0, "sound/vox/topside.wav" },
+	{ 0x44434E47, 0, "de_vertigo.wad" },
+	{ 0x5DBB21FE, 0, "models/pow_invuln.mdl" },
+	{ 0xBC6C0ECA, 0, "models/wetfloorsign_gibs.mdl" },
+	{ 0xB5380B2F, 0, "sound/weapons/hit_heavymetal2.wav" },
+	{ 0x8588FAED, 0, "models/mapmodels/k_bush1.mdl" },
+	{ 0x74C6AFA6, 0, "sound/scientist/c3a2_sci_fool.wav" },
+	{ 0x6B141636, 0, "sound/player/pl_gravel3.wav" },
+	{ 0xFD1C744C, 0, "sound/sentences/ctr5.wav" },
+	{ 0x58277982, 0, "sound/hgrunt/c2a3_hg_4drag.wav" },
+	{ 0x54753438, 0, "maps/dod_sturm_detail.txt" },
+	{ 0xA5A12C6D, 0, "sound/weapons/hit_grass2.wav" },
+	{ 0xC026F0FC, 0, "sound/misc/broken_tram4.wav" },
+	{ 0x906D7F9A, 0, "sprites/cp_hud.spr" },
+	{ 0x9CA0CFFA, 0, "gfx/env/neb1up.tga" },
+	{ 0x4F897F95, 0, "sound/misc/spark4.wav" },
+	{ 0x1CB00376, 0, "sound/vox/computer.wav" },
+	{ 0x7610D5E0, 0, "gfx/env/drkgbk.tga" },
+	{ 0xB0918360, 0, "sound/sentences/dr4.wav" },
+	{ 0xD36C5DB9, 0, "sound/weapons/whizz8.wav" },
+	{ 0x451EFBF5, 0, "sprites/bmp/2expl03.bmp" },
+	{ 0xF85EE88C, 0, "sound/voltigore/voltigore_idle3.wav" },
+	{ 0x039F52F4, 0, "resource/mic_meter_dead.tga" },
+	{ 0xEA351941, 0, "models/wire_red32.mdl" },
+	{ 0x1A044027, 0, "sound/barney/coldone.wav" },
+	{ 0xE5497184, 0, "sound/rosenberg/ro_fear3.wav" },
+	{ 0xF31DC752, 0, "sound/sentences/hev_gr5.wav" },
+	{ 0x04F42C56, 0, "sprites/hint_vert.spr" },
+	{ 0x9E1700A8, 0, "sprites/c-tele1.spr" },
+	{ 0x77B0CA8A, 0, "sound/barney/ba_pok1.wav" },
+	{ 0x757AF17E, 0, "sound/sentences/c2a1_4.wav" },
+	{ 0x2EEB5CD1, 0, "gfx/vgui/clsimages/axis.tga" },
+	{ 0xBC2354DE, 0, "sound/common/launch_select1.wav" },
+	{ 0xB77AB0BE, 0, "sound/fvox/eight.wav" },
+	{ 0x962286BD, 0, "sound/sentences/nf1.wav" },
+	{ 0x72AF76F1, 0, "models/mapmodels/zalec_2bulb1wire.mdl" },
+	{ 0xD0963CD0, 0, "resource/dod_spanish.txt" },
+	{ 0xFE6C82FE, 0, "sound/weapons/luger_draw_pullslide.wav" },
+	{ 0x73A54710, 0, "sound/weapons/bulletchain.wav" },
+	{ 0xB8D60C81, 0, "sound/weapons/airgun_1.wav" },
+	{ 0x35DBB9E7, 0, "sound/weapons/hit_water1.wav" },
+	{ 0x6F1A0DE4, 0, "sound/sentences/hg_clear9.wav" },
+	{ 0x57E7AB6B, 0, "gfx/env/discdn.bmp" },
+	{ 0x178D26A9, 0, "sound/weapons/ak47-2.wav" },
+	{ 0x87DCF9E0, 0, "sprites/weapon_quakegun.txt" },
+	{ 0xAD1BA6C6, 0, "sound/fgrunt/intro_fg17.wav" },
+	{ 0x8EC8A0A5, 0, "gfx/vgui/leet.tga" },
+	{ 0xF1B1D823, 0, "sprites/bmp/2expl12.bmp" },
+	{ 0x2BEFD1D0, 0, "sound/ui/buttonclick.wav" },
+	{ 0xBDDF2401, 0, "sound/vox/extreme.wav" },
+	{ 0x9DEAAE74, 0, "sprites/billow_01.spr" },
+	{ 0x5C53CEB2, 0, "overviews/dmc_dm6.tga" },
+	{ 0x3322D8ED, 0, "sound/vox/bailey.wav" },
+	{ 0xBF225B85, 0, "sound/gman/gman_offer.wav" },
+	{ 0x6A1B4196, 0, "sound/sentences/c1a3_10.wav" },
+	{ 0x65189B5A, 0, "sprites/xflare3.spr" },
+	{ 0x1DE9D12C, 0, "sound/tentacle/te_flies1.wav" },
+	{ 0x3C9E3B4F, 0, "overviews/de_aztec.txt" },
+	{ 0x4B1AC44D, 0, "sound/vox/talk.wav" },
+	{ 0x0A8A83A7, 0, "logos/victory.bmp" },
+	{ 0xF607DC36, 0, "models/v_shot.mdl" },
+	{ 0x9BA903CA, 0, "models/mapmodels/smoke_grenade.mdl" },
+	{ 0x8DA8EC15, 0, "sound/vox/sterile.wav" },
+	{ 0x55CC82D5, 0, "models/p_brenbd.mdl" },
+	{ 0x36425D7F, 0, "sound/player/pl_shell1.wav" },
+	{ 0xC826969A, 0, "sound/weapons/ric_conc-2.wav" },
+	{ 0x8262D6F8, 0, "sound/scientist/c1a4_sci_pwroff.wav" },
+	{ 0x46945E26, 0, "sprites/320hud3.spr" },
+	{ 0x7BC8CDE0, 0, "sound/debris/bustconcrete2.wav" },
+	{ 0x102E26A4, 0, "sound/vox/south.wav" },
+	{ 0x657F3E85, 0, "gfx/vgui/cs_logo.tga" },
+	{ 0xA406BF26, 0, "sound/vox/dirt.wav" },
+	{ 0xAC35F17E, 0, "sound/agrunt/ag_pain2.wav" },
+	{ 0x938E4809, 0, "sprites/ba_gun2.spr" },
+	{ 0xED544E62, 0, "sound/weapons/splauncher_pet.wav" },
+	{ 0xED032D8D, 0, "sprites/bmp/1expl13.bmp" },
+	{ 0x4FD60837, 0, "sprites/hltv_88flak_nobase.spr" },
+	{ 0xA48B198F, 0, "overviews/rapidcore.tga" },
+	{ 0x29F5A6C6, 0, "sound/weapons/hit_heavymetal1.wav" },
+	{ 0xC2238B26, 0, "sound/player/ussniper.wav" },
+	{ 0x550B1FBF, 0, "models/p_xm1014.mdl" },
+	{ 0x55B3FD6B, 0, "sound/barney/targetpractice.wav" },
+	{ 0x7A09BCF7, 0, "sound/scientist/sci_5thou.wav" },
+	{ 0x82107D72, 0, "logos/tiki.bmp" },
+	{ 0x9D9E85FD, 0, "sprites/obj_icons/dod_flugplatz/icon_obj_custom2_neutral.spr" },
+	{ 0x721FDE82, 0, "sound/barney/armedforces.wav" },
+	{ 0xA57D16B9, 0, "sound/fgrunt/no.wav" },
+	{ 0x33C563BE, 0, "gfx/env/nightft.bmp" },
+	{ 0x7F5644AE, 0, "models/zombie_soldier.mdl" },
+	{ 0xAA0E5A44, 0, "sound/player/brittigerahead.wav" },
+	{ 0x86841BA8, 0, "models/mapmodels/x_flag_allies.mdl" },
+	{ 0x0474FC7A, 0, "sound/vox/woop.wav" },
+	{ 0x8B5DDE1F, 0, "gfx/vgui/fonts/1600_hintmessage text.tga" },
+	{ 0xD25C29E9, 0, "sprites/black_smoke3.spr" },
+	{ 0x56F8D4D4, 0, "gfx/env/grnplsntbk.tga" },
+	{ 0xD450C6D9, 0, "sound/otis/close.wav" },
+	{ 0x70966CA3, 0, "sound/weapons/pkup.wav" },
+	{ 0x7989E239, 0, "sound/rosenberg/ro_calhoun.wav" },
+	{ 0xD45CF1C2, 0, "classes/short_sniper.txt" },
+	{ 0x33AA01B3, 0, "sound/rosenberg/ro_plfear2.wav" },
+	{ 0x2AC309FE, 0, "sprites/sprite_a_1.spr" },
+	{ 0xE3FF215F, 0, "sprites/640hudof06.spr" },
+	{ 0xB248BA41, 0, "sound/scientist/yes2.wav" },
+	{ 0x59B14081, 0, "sound/ambience/forestsparrow.wav" },
+	{ 0x438D51B1, 0, "sprites/iplayer.spr" },
+	{ 0xC3717F97, 0, "models/pi_treeb.mdl" },
+	{ 0x98A4939A, 0, "sound/sentences/c1a4_2.wav" },
+	{ 0xCFC52356, 0, "sound/decap.wav" },
+	{ 0x573A7671, 0, "sound/barney/ba_shot4.wav" },
+	{ 0x4A87598F, 0, "sound/common/wpn_hudon.wav" },
+	{ 0xFE3BFD2D, 0, "sound/vox/administration.wav" },
+	{ 0x1CF75607, 0, "sound/common/wpn_denyselect.wav" },
+	{ 0xFF15868C, 0, "models/player/axis-para/axis-para.mdl" },
+	{ 0xA874B5E5, 0, "sound/rosenberg/ro_fear4.wav" },
+	{ 0x1B15D099, 0, "sound/pitworm/pit_worm_attack_swipe2.wav" },
+	{ 0x467CE8D3, 0, "gfx/vgui/fonts/320_hintmessage text.tga" },
+	{ 0x6A115A16, 0, "sound/drill/sound4.wav" },
+	{ 0x03555681, 0, "overviews/dod_escape.txt" },
+	{ 0x3B2534BB, 0, "sound/fvox/get_gauss.wav" },
+	{ 0x4C327F24, 0, "sound/scientist/please.wav" },
+	{ 0xB645E6CF, 0, "sprites/mapsprites/chim.spr" },
+	{ 0xF8840DE0, 0, "models/player/scout/scout2.mdl" },
+	{ 0xCB37C123, 0, "sound/zombie/claw_strike3.wav" },
+	{ 0x4F3B4E24, 0, "sound/vox/scores.wav" },
+	{ 0xA0C19A45, 0, "sound/hgrunt/mister!.wav" },
+	{ 0xDEBC6D37, 0, "sound/radio/fallback.wav" },
+	{ 0x83715637, 0, "sound/items/airtank1.wav" },
+	{ 0xBC750F6B, 0, "sprites/smoke_ia.spr" },
+	{ 0xFFBFA6B8, 0, "models/player/sas/sas.mdl" },
+	{ 0xBFCE2223, 0, "sound/ambience/bell.wav" },
+	{ 0x73642D26, 0, "sound/player/heartbeat1.wav" },
+	{ 0x46CDDCEF, 0, "models/shell.mdl" },
+	{ 0xEB17C154, 0, "models/p_tommy.mdl" },
+	{ 0x438DD559, 0, "dod_jagd.wad" },
+	{ 0xB63BEC40, 0, "gfx/vgui/map_bflag.tga" },
+	{ 0xD18717F6, 0, "models/armour_rt.mdl" },
+	{ 0xC6BEF8CE, 0, "sound/weapons/cbar_hitbod2.wav" },
+	{ 0x2F07AD2A, 0, "maps/dod_avalanche_detail.txt" },
+	{ 0x1BA91111, 0, "sound/weapons/clipin1.wav" },
+	{ 0x51A9DAAB, 0, "models/v_tfc_rpg.mdl" },
+	{ 0xED9AE071, 0, "sound/scientist/fix.wav" },
+	{ 0x6A68ADFA, 0, "maps/dod_escape.txt" },
+	{ 0xCADFA28B, 0, "sound/scientist/perfectday.wav" },
+	{ 0xA3379759, 0, "sound/vox/loading.wav" },
+	{ 0xE78DAB7B, 0, "gfx/vgui/640_arrowdn.tga" },
+	{ 0xF55525B6, 0, "sound/player/pl_snow3.wav" },
+	{ 0x3E4C0356, 0, "sound/vox/propulsion.wav" },
+	{ 0x1AFB7AA3, 0, "sound/nihilanth/nil_die.wav" },
+	{ 0x2E487A22, 0, "gfx/env/alien2up.bmp" },
+	{ 0xA4F9CE14, 0, "sound/weapons/turrset.wav" },
+	{ 0xC175958F, 0, "sound/vox/fourteen.wav" },
+	{ 0x495B92A7, 0, "models/pi_tree2.mdl" },
+	{ 0x810285E6, 0, "sound/hgrunt/roger!.wav" },
+	{ 0xFEC86E40, 0, "models/v_mg42.mdl" },
+	{ 0xA6DF145A, 0, "sound/pitworm/clang1.wav" },
+	{ 0xD4CFA15B, 0, "sound/weapons/pl_gun3.wav" },
+	{ 0x3A3BF3B7, 0, "gfx/vgui/nightvision.tga" },
+	{ 0x9ACD8D50, 0, "models/v_spore_launcher.mdl" },
+	{ 0x449C0A68, 0, "models/player/recon/recon.bmp" },
+	{ 0x34D3A296, 0, "sound/fgrunt/of6a1_fg01.wav" },
+	{ 0x8B2B19DB, 0, "overviews/dod_charlie.bmp" },
+	{ 0xE043FB4D, 0, "sound/hgrunt/signs!.wav" },
+	{ 0xFAB228E7, 0, "sound/scientist/peculiarodor.wav" },
+	{ 0x7C8C94A3, 0, "models/mapmodels/dod_jagd_car.mdl" },
+	{ 0x3551B315, 0, "models/treet.mdl" },
+	{ 0xAC4E213E, 0, "sound/hgrunt/gr_idle2.wav" },
+	{ 0x4A4F6E1D, 0, "sound/sentences/hg_clear6.wav" },
+	{ 0x23DDA069, 0, "gfx/env/avaft.tga" },
+	{ 0x885EAC1A, 0, "sound/vox/atomic.wav" },
+	{ 0xD89D73F2, 0, "sprites/cexplo.spr" },
+	{ 0xA29C17E4, 0, "sound/vox/disposal.wav" },
+	{ 0x0D495CFD, 0, "sound/rosenberg/ro_xen_call2.wav" },
+	{ 0x40D8B3E5, 0, "sound/vox/hello.wav" },
+	{ 0x8537C71D, 0, "sprites/weapon_nailgun.txt" },
+	{ 0x1AADBD53, 0, "sound/vox/blast.wav" },
+	{ 0xAE622505, 0, "sound/sentences/hg_alert5.wav" },
+	{ 0x34A2A020, 0, "sound/scientist/bloodsample.wav" },
+	{ 0x59942008, 0, "sound/fvox/get_egonpower.wav" },
+	{ 0xD40F29A9, 0, "sprites/muzzleflash3.spr" },
+	{ 0x03720BDB, 0, "sound/player/pl_fallpain2.wav" },
+	{ 0x5260A204, 0, "models/mapmodels/furniture_group-hotel01.mdl" },
+	{ 0xE8796B68, 0, "sound/drill/barracks04.wav" },
+	{ 0x7C0A122C, 0, "sound/ambience/mgun_burst4.wav" },
+	{ 0x4345E188, 0, "sound/vox/relay.wav" },
+	{ 0xD7C50994, 0, "classes/long_civilian.txt" },
+	{ 0x0AD8FC15, 0, "sound/hgrunt/grenade!.wav" },
+	{ 0x4DF5BA38, 0, "maps/cs_estate.txt" },
+	{ 0x5E8A386D, 0, "sound/shockroach/shock_idle1.wav" },
+	{ 0xB4F079A1, 0, "sound/weapons/deagle-1.wav" },
+	{ 0xCDEE3C73, 0, "sound/vox/maximum.wav" },
+	{ 0xBC52911D, 0, "sound/scientist/c3a2_sci_forever.wav" },
+	{ 0x2568965E, 0, "sound/barney/bigplace.wav" },
+	{ 0x03B36DE1, 0, "sound/ambience/lv_neon.wav" },
+	{ 0x94B22329, 0, "sound/weapons/cbar_miss1.wav" },
+	{ 0x5D92B89A, 0, "sound/common/npc_step1.wav" },
+	{ 0x96E3DDEF, 0, "sprites/tree4.spr" },
+	{ 0x6C54FAB5, 0, "models/w_piat.mdl" },
+	{ 0x9833198D, 0, "sound/sentences/blip.wav" },
+	{ 0x62BA0AF7, 0, "sound/misc/dsbossit.wav" },
+	{ 0x943F4210, 0, "resource/dod_french.txt" },
+	{ 0x72ED5B8E, 0, "sound/doors/doorstop5.wav" },
+	{ 0x6B307462, 0, "sound/vox/authorize.wav" },
+	{ 0xA890B4B4, 0, "models/shield/v_shield_p228.mdl" },
+	{ 0xB8B56DE1, 0, "sound/rosenberg/ro_tele_xen04.wav" },
+	{ 0x19CC2442, 0, "sound/rosenberg/ro_tele_power5.wav" },
+	{ 0xD0E0E01C, 0, "sound/garg/gar_alert2.wav" },
+	{ 0xEAEF689A, 0, "overviews/casbah.txt" },
+	{ 0x3DD31639, 0, "sound/scientist/recalculate.wav" },
+	{ 0xD427785D, 0, "sound/player/pl_duct1.wav" },
+	{ 0x37A0F815, 0, "sound/fvox/remaining.wav" },
+	{ 0xDD11BBBA, 0, "sound/holo/tr_sci_nextstation.wav" },
+	{ 0xEEDF36DE, 0, "sound/fvox/east.wav" },
+	{ 0x08C5F4CB, 0, "sound/holo/tr_holo_spinbridge.wav" },
+	{ 0x74FD6B24, 0, "models/w_assault.mdl" },
+	{ 0xFD9B18F8, 0, "gfx/vgui/clsimages/cls_mp44.tga" },
+	{ 0x56FA6640, 0, "sound/scientist/analysis.wav" },
+	{ 0x3864A864, 0, "sound/fvox/innsuficient_medical.wav" },
+	{ 0x4331872B, 0, "sprites/hudcbsm.spr" },
+	{ 0xCEE4574E, 0, "sprites/null.spr" },
+	{ 0xD254AF86, 0, "sound/buttons/button5.wav" },
+	{ 0xC3ACF467, 0, "sound/common/menu3.wav" },
+	{ 0xE2D1C6BD, 0, "models/w_shotgun.mdl" },
+	{ 0x2A16B974, 0, "sound/weapons/ric3.wav" },
+	{ 0xF64B5DF5, 0, "sound/hgrunt/mission!.wav" },
+	{ 0xD3CC9675, 0, "gfx/detail/dt_stone2.tga" },
+	{ 0xEE12D0CD, 0, "game.tga" },
+	{ 0x79AAFEB6, 0, "gfx/env/desbk.tga" },
+	{ 0x052880EF, 0, "sound/sentences/c2a4_ster.wav" },
+	{ 0x2133087B, 0, "sound/ba_holo/tr_holo_fallshort.wav" },
+	{ 0xE3D95705, 0, "gfx/env/cliffdn.tga" },
+	{ 0x1904923C, 0, "sound/scientist/advance.wav" },
+	{ 0x9514DF7C, 0, "sound/barney/ba_friends.wav" },
+	{ 0x8774D3A8, 0, "sound/hornet/ag_buzz2.wav" },
+	{ 0x6DBD4523, 0, "sound/player/pl_grate4.wav" },
+	{ 0xCAAEE36D, 0, "sound/fvox/vitalsigns_on.wav" },
+	{ 0xFE4C283C, 0, "sound/scientist/hellothere.wav" },
+	{ 0x1851D2B3, 0, "sound/fgrunt/outof.wav" },
+	{ 0x2550F598, 0, "models/mapmodels/barber_chair.mdl" },
+	{ 0xE6E0BAA7, 0, "sound/vox/waste.wav" },
+	{ 0x6F8879AC, 0, "sound/weapons/sg552_boltpull.wav" },
+	{ 0x96BA112B, 0, "sound/sentences/hev_det2.wav" },
+	{ 0x1B4763FC, 0, "sprites/spore_exp_c_01.spr" },
+	{ 0x4F612CA9, 0, "gfx/detail/dt_grass1.tga" },
+	{ 0x1A22D647, 0, "sound/fgrunt/current.wav" },
+	{ 0x90AA7D04, 0, "sound/weapons/sg552-2.wav" },
+	{ 0x27C5DD66, 0, "gfx/vgui/1152_arrowright.tga" },
+	{ 0x7C991CA0, 0, "sound/otis/seeya.wav" },
+	{ 0x01F3683B, 0, "sound/vox/error.wav" },
+	{ 0x51898AAB, 0, "sound/weapons/bounce.wav" },
+	{ 0x2BAB449C, 0, "sound/weapons/30cal_shoot.wav" },
+	{ 0xDD650F23, 0, "models/snapbug.mdl" },
+	{ 0x25CCEE27, 0, "resource/cstrike_koreana.txt" },
+	{ 0x2D449DE2, 0, "sound/vox/usa.wav" },
+	{ 0x6F1BD011, 0, "sound/vox/cleanup.wav" },
+	{ 0x5E7D1C31, 0, "sound/hgrunt/anything!.wav" },
+	{ 0x97CC1497, 0, "sprites/pistol_smoke1.spr" },
+	{ 0xAA5259DF, 0, "sound/fvox/boop.wav" },
+	{ 0x6CE901CF, 0, "models/mapmodels/jed_kubelwagen_damaged.mdl" },
+	{ 0xF611468E, 0, "sound/fgrunt/fire.wav" },
+	{ 0x36602190, 0, "sound/hgrunt/beep.wav" },
+	{ 0x25BB84DF, 0, "resource/dmc_spanish.txt" },
+	{ 0x53217285, 0, "sound/player/usstartround.wav" },
+	{ 0x6BB029E8, 0, "sound/scientist/justasked.wav" },
+	{ 0xBC8BC60C, 0, "sound/vox/ninety.wav" },
+	{ 0x4C3CC701, 0, "gfx/detail/dt_wood.tga" },
+	{ 0x354D95EC, 0, "models/mortarshell.mdl" },
+	{ 0x071EBD17, 0, "sound/holo/tr_holo_move.wav" },
+	{ 0xBABF10CC, 0, "models/w_chainammo.mdl" },
+	{ 0x909CB243, 0, "sound/scientist/sc_outro1.wav" },
+	{ 0x781D01C5, 0, "sound/weapons/fiveseven_slidepull.wav" },
+	{ 0xB8F400A3, 0, "sprites/hudlg.spr" },
+	{ 0x419C9C27, 0, "sound/barnacle/bcl_die1.wav" },
+	{ 0xCBA2C7BF, 0, "sound/ambience/doorbell.wav" },
+	{ 0xA189FB40, 0, "models/player/urban/urban.mdl" },
+	{ 0xFB2143D3, 0, "sound/de_torn/torn_ambience.wav" },
+	{ 0x348BBB6E, 0, "gfx/env/snowlake_ft.tga" },
+	{ 0xF98D2261, 0, "sound/ambience/lv_fruitwin.wav" },
+	{ 0xF18EF9FD, 0, "sprites/320hud2.spr" },
+	{ 0xE322C3E0, 0, "sound/weapons/usp_clipout.wav" },
+	{ 0x7F15D23B, 0, "gfx/vgui/map_gflag.tga" },
+	{ 0x351CC045, 0, "models/v_tmp.mdl" },
+	{ 0xCF639513, 0, "sprites/bmp/fthrow06.bmp" },
+	{ 0x1213E842, 0, "sound/player/pl_organic1.wav" },
+	{ 0xA2EC2AB8, 0, "sprites/effects/debris_wood1.spr" },
+	{ 0x0AE502A1, 0, "sound/otis/of1a1_ot02.wav" },
+	{ 0xFDF50DA6, 0, "sound/sentences/db2.wav" },
+	{ 0x014F58AE, 0, "overviews/dmc_e1m2.tga" },
+	{ 0x6AE3A1C2, 0, "models/gib_lung.mdl" },
+	{ 0xEB9A0FB5, 0, "sound/fvox/weaponselect_on.wav" },
+	{ 0xD629B6B8, 0, "models/roach.mdl" },
+	{ 0x2319438F, 0, "sound/sentences/hev_5p.wav" },
+	{ 0xE77427CF, 0, "sound/sentences/c3a2_core.wav" },
+	{ 0x4DED1132, 0, "sound/hgrunt/two.wav" },
+	{ 0xF8E7A587, 0, "models/v_elite.mdl" },
+	{ 0x9B7FB7A8, 0, "sprites/stick_hltv.spr" },
+	{ 0x45FE2353, 0, "models/w_k43.mdl" },
+	{ 0x7CDE3E7E, 0, "logos/lambda.bmp" },
+	{ 0xA69510EC, 0, "sound/rosenberg/ro_tele_final15.wav" },
+	{ 0xF5D9DDC7, 0, "gfx/vgui/clsimages/cls_mg42.tga" },
+	{ 0x2607B6BA, 0, "gfx.wad" },
+	{ 0x30BAE103, 0, "resource/icon_password.tga" },
+	{ 0x054B7394, 0, "models/plant_cactus.mdl" },
+	{ 0xBD2E44B3, 0, "sprites/grass_01.spr" },
+	{ 0x7E5F22C7, 0, "sound/drill/oc101.wav" },
+	{ 0x4537A202, 0, "resource/vgui_french.txt" },
+	{ 0x0E91DE20, 0, "sound/scientist/c1a0_sci_getaway.wav" },
+	{ 0xA6B11871, 0, "sound/fvox/voice_on.wav" },
+	{ 0x4F5E6880, 0, "sound/weapons/usp_slideback.wav" },
+	{ 0x9FFF98EC, 0, "sound/vox/wanted.wav" },
+	{ 0x8C4A517E, 0, "sprites/tfc_dmsg.spr" },
+	{ 0x34E1510B, 0, "sound/fvox/health_dropping.wav" },
+	{ 0xD1119DBB, 0, "models/v_rock.mdl" },
+	{ 0xE995DF24, 0, "sound/barney/ba_pain3.wav" },
+	{ 0x01700331, 0, "gfx/vgui/640_engineerblue.tga" },
+	{ 0xECDA1141, 0, "sound/fvox/get_assault.wav" },
+	{ 0xC22CE3FE, 0, "models/w_aflag.mdl" },
+	{ 0xF79E769E, 0, "tfc.wad" },
+	{ 0xFF24489C, 0, "sound/ambience/turretrot1.wav" },
+	{ 0xE0FF9049, 0, "sound/ambience/cow.wav" },
+	{ 0x7B7E2A57, 0, "sound/scientist/scream08.wav" },
+	{ 0xC09A3B3E, 0, "sound/scientist/yesihope.wav" },
+	{ 0xED4D5B49, 0, "models/w_grenadet.mdl" },
+	{ 0x385E0B2F, 0, "sound/fgrunt/intro_fg14.wav" },
+	{ 0x542A9BFC, 0, "640_textscheme.txt" },
+	{ 0x8F7C0A80, 0, "sound/fvox/seven.wav" },
+	{ 0xE06C4830, 0, "sound/scientist/goodtoseeyou.wav" },
+	{ 0x65C4DC2A, 0, "models/mapmodels/88flak.mdl" },
+	{ 0x89E6EE33, 0, "sound/player/usbackup.wav" },
+	{ 0x35CE0B5D, 0, "sound/sentences/nd7.wav" },
+	{ 0xBFD8F11D, 0, "sound/vox/doop.wav" },
+	{ 0x29527538, 0, "models/scientist05.mdl" },
+	{ 0x7839C98E, 0, "models/player/pyro/pyro.mdl" },
+	{ 0x77293E48, 0, "dod_chemille.wad" },
+	{ 0x7A967040, 0, "sound/scientist/sc_tele_xen1.wav" },
+	{ 0x7F617E4E, 0, "models/p_piat.mdl" },
+	{ 0x273E3EF0, 0, "models/player/fassn/fassn.bmp" },
+	{ 0x43959706, 0, "sound/ambience/_comma.wav" },
+	{ 0x815BD643, 0, "sound/pitworm/clang2.wav" },
+	{ 0x0F43118C, 0, "sound/barney/whatgood.wav" },
+	{ 0x3EBEC142, 0, "sound/weapons/p228_clipout.wav" },
+	{ 0x980F0AF1, 0, "sprites/640_1bounce.spr" },
+	{ 0xEE405072, 0, "overviews/p_se_3.bmp" },
+	{ 0x2DBDA302, 0, "sound/player/die3.wav" },
+	{ 0x08E3B2DC, 0, "sound/rosenberg/ro_scared1.wav" },
+	{ 0x877509C1, 0, "gfx/vgui/fonts/1024_commandmenu text.tga" },
+	{ 0x20808F93, 0, "sound/hgrunt/heavy.wav" },
+	{ 0x6431955B, 0, "sound/fgrunt/of2a6_fg03.wav" },
+	{ 0x2DA187A3, 0, "sound/vox/observation.wav" },
+	{ 0xEAA4A5AF, 0, "sound/scientist/c1a4_sci_tent.wav" },
+	{ 0x10A9A4BD, 0, "sound/player/pain6.wav" },
+	{ 0xA35D2860, 0, "sound/rosenberg/ro_cure0.wav" },
+	{ 0xFD05FA2C, 0, "sprites/icon_obj.spr" },
+	{ 0x981D55D0, 0, "sound/vox/minutes.wav" },
+	{ 0x788610F7, 0, "models/out_teleport.mdl" },
+	{ 0x98CB32C9, 0, "sound/vox/guthrie.wav" },
+	{ 0x8A60A3B9, 0, "models/mapmodels/bookcase_green.mdl" },
+	{ 0xA015A8F6, 0, "sound/hgrunt/take!.wav" },
+	{ 0xE63E330E, 0, "sound/scientist/whoresponsible.wav" },
+	{ 0x4108DA1C, 0, "steam_appid.txt" },
+	{ 0x906CD122, 0, "sound/sentences/hev_f15.wav" },
+	{ 0x10F424A9, 0, "models/shield/v_shield_smokegrenade.mdl" },
+	{ 0xB11FBCDE, 0, "models/strooper01.mdl" },
+	{ 0xDC3A3BFC, 0, "models/bigrat.mdl" },
+	{ 0x197FB31C, 0, "maps/dod_glider_detail.txt" },
+	{ 0xBA77044F, 0, "sound/zombie/zo_pain1.wav" },
+	{ 0xED6A8114, 0, "gfx/env/desertft.tga" },
+	{ 0x21D020E4, 0, "sound/sentences/nfire0.wav" },
+	{ 0x29C5E9B6, 0, "resource/steam_menu.tga" },
+	{ 0x021986A8, 0, "overviews/dmc_dm4.tga" },
+	{ 0x19F4B7F6, 0, "sound/hgrunt/patrol.wav" },
+	{ 0x5531DE81, 0, "sprites/obj_icons/dod_glider/icon_obj_custom2_axis.spr" },
+	{ 0xF72F94B6, 0, "models/p_squeak.mdl" },
+	{ 0xCEEDD1FD, 0, "sound/fgrunt/of5a1_fg01.wav" },
+	{ 0x2B72AF87, 0, "sound/otis/letsgo.wav" },
+	{ 0x9CCA3CAE, 0, "sound/vox/medical.wav" },
+	{ 0xE6148D8C, 0, "sprites/obj_icons/dod_vicenza/icon_obj_custom3_allies.spr" },
+	{ 0x445C140E, 0, "sprites/bmp/tffire05.bmp" },
+	{ 0x888C7FD7, 0, "sound/doors/doormove7.wav" },
+	{ 0xFE3697CC, 0, "models/w_crossbow_clip.mdl" },
+	{ 0x2389C9BB, 0, "sprites/bmp/1expl02.bmp" },
+	{ 0x2CE6BCB8, 0, "sound/vox/help.wav" },
+	{ 0xE1382D39, 0, "sound/sentences/t1.wav" },
+	{ 0x945AAAD3, 0, "sound/sentences/nd5.wav" },
+	{ 0x75A22D22, 0, "resource/vac_shield.tga" },
+	{ 0x2B60D987, 0, "sound/fgrunt/stayalert.wav" },
+	{ 0x1885D4FB, 0, "overviews/cz2.tga" },
+	{ 0x8EA601C6, 0, "sound/vox/exposure.wav" },
+	{ 0xEF99EBAD, 0, "overviews/dmc_dm6.bmp" },
+	{ 0x80ABFF83, 0, "sound/radio/ct_point.wav" },
+	{ 0x4027DC3A, 0, "sprites/hudbmps/tfchud05.bmp" },
+	{ 0x2F3BFED7, 0, "overviews/cs_italy.bmp" },
+	{ 0xD46243A2, 0, "sound/vox/area.wav" },
+	{ 0x640B1716, 0, "sound/fvox/eighteen.wav" },
+	{ 0xEC59E6D7, 0, "models/xen_rockgibs.mdl" },
+	{ 0x3341548A, 0, "gfx/env/dmcpup.tga" },
+	{ 0x8B42B808, 0, "models/p_nail2.mdl" },
+	{ 0xB3596825, 0, "sprites/bmp/2expl10.bmp" },
+	{ 0x48609477, 0, "sound/vox/from.wav" },
+	{ 0xD383F45F, 0, "sound/otis/notalone.wav" },
+	{ 0x85717D80, 0, "gfx/env/havlf.tga" },
+	{ 0xCC6E5BA9, 0, "overviews/flagrun.txt" },
+	{ 0xCEED462E, 0, "sound/ambience/tree.wav" },
+	{ 0xFBE465B3, 0, "gfx/env/snowlake_bk.tga" },
+	{ 0xF147CABA, 0, "models/pit_worm_up.mdl" },
+	{ 0xAF3F7850, 0, "sound/player/headshot3.wav" },
+	{ 0x40112DBC, 0, "sound/rosenberg/ro_tele_final02.wav" },
+	{ 0x1C42099D, 0, "sound/pitdrone/pit_drone_idle1.wav" },
+	{ 0x1B3AB5F3, 0, "sound/vox/breached.wav" },
+	{ 0xA45749CC, 0, "sound/vox/tango.wav" },
+	{ 0x53D61A63, 0, "sound/fgrunt/guardduty.wav" },
+	{ 0xE6321FCB, 0, "sound/ambience/kajika.wav" },
+	{ 0x82E662B6, 0, "sound/ambience/dog2.wav" },
+	{ 0x1089BF05, 0, "sound/common/bodydrop3.wav" },
+	{ 0x2384220B, 0, "sound/barney/c2a4_ba_alive.wav" },
+	{ 0x3E01CF5C, 0, "sprites/hud8.spr" },
+	{ 0xAAD8AFE9, 0, "sound/barney/hayfella.wav" },
+	{ 0x32121AAE, 0, "sound/vox/coomer.wav" },
+	{ 0x0AEB23B5, 0, "sound/sentences/we1.wav" },
+	{ 0xE24A3737, 0, "sound/weapons/sbarrel1.wav" },
+	{ 0x6AFA351E, 0, "sound/vox/reports.wav" },
+	{ 0x46AA4926, 0, "sprites/iplayerred.spr" },
+	{ 0xD91BF2C6, 0, "sound/fgrunt/getsome.wav" },
+	{ 0xE5CCE10C, 0, "models/p_shock.mdl" },
+	{ 0xC94B3421, 0, "sound/sentences/econ0.wav" },
+	{ 0x151953C5, 0, "sound/vox/men.wav" },
+	{ 0x743C16FB, 0, "sound/vox/materials.wav" },
+	{ 0x0EEB3FF3, 0, "sound/ambience/aliencave1.wav" },
+	{ 0x25565929, 0, "sound/otis/of6a3_ot01.wav" },
+	{ 0xA25D6FB3, 0, "models/boid.mdl" },
+	{ 0x9E93A132, 0, "sound/fans/fan2off.wav" },
+	{ 0x822E6BAB, 0, "sound/sentences/we3.wav" },
+	{ 0x0AD32C95, 0, "sound/scientist/c3a2_sci_uphere.wav" },
+	{ 0xAC2A2E0E, 0, "sound/vox/crew.wav" },
+	{ 0x12FE7E22, 0, "sprites/icninvis.spr" },
+	{ 0xB677F06C, 0, "gfx/env/morningrt.bmp" },
+	{ 0xBA2BD65B, 0, "models/blkop_dead_osprey.mdl" },
+	{ 0x81060FDB, 0, "resource/icon_radiosel.tga" },
+	{ 0x93BB5950, 0, "sprites/tf_weapon_ic.txt" },
+	{ 0xF965B459, 0, "models/p_g3sg1.mdl" },
+	{ 0xE214F8E5, 0, "models/p_elite.mdl" },
+	{ 0xD9665F1C, 0, "sprites/british.spr" },
+	{ 0x8099E0F8, 0, "sound/scientist/scream12.wav" },
+	{ 0xB2CC0295, 0, "sound/scientist/stopasking.wav" },
+	{ 0x05EC911E, 0, "sprites/obj_icons/dod_zalec/icon_obj_custom1_brit.spr" },
+	{ 0x5F3EF069, 0, "sound/hgrunt/sector!.wav" },
+	{ 0x290A28AB, 0, "dod_kalt.wad" },
+	{ 0x8233EBD8, 0, "sprites/glow_blu.spr" },
+	{ 0x1D245309, 0, "sound/hgrunt/ok!.wav" },
+	{ 0x510E8A95, 0, "models/mini_osprey_bodygibs.mdl" },
+	{ 0x5372A750, 0, "sound/player/pl_wood3.wav" },
+	{ 0x113F8FFC, 0, "sound/aslave/slv_word8.wav" },
+	{ 0x5E0EC129, 0, "models/w_9mmar.mdl" },
+	{ 0xAF595E02, 0, "sound/radio/negative.wav" },
+	{ 0xDFB72163, 0, "sprites/obj_icons/dod_charlie/icon_obj_custom1_axis.spr" },
+	{ 0x237B3DC2, 0, "sound/scientist/scream10.wav" },
+	{ 0x44A8FC02, 0, "sound/fgrunt/of3a4_fg01.wav" },
+	{ 0xA88B078F, 0, "sprites/hudssgsm.spr" },
+	{ 0xE2098F66, 0, "models/p_barbu.mdl" },
+	{ 0x6B32D4FC, 0, "models/chromegibs.mdl" },
+	{ 0x30BF6E84, 0, "models/uplant1t.mdl" },
+	{ 0xC15B677E, 0, "models/pow_triple.mdl" },
+	{ 0xEFF4CAA2, 0, "sound/rosenberg/ro_tele_final22.wav" },
+	{ 0x26199993, 0, "gfx/env/sky_blu_bk.bmp" },
+	{ 0xA4B7B131, 0, "sound/scream3.wav" },
+	{ 0xA2F5CED8, 0, "sound/vox/birdwell.wav" },
+	{ 0xB75A882F, 0, "models/hgrunt.mdl" },
+	{ 0x8F169D72, 0, "sound/hgrunt/alien!.wav" },
+	{ 0x5804E3CF, 0, "sound/holo/holostn10a.wav" },
+	{ 0x1E6CF276, 0, "sound/vox/selected.wav" },
+	{ 0xDA74BD4B, 0, "sprites/bmp/shellchrome.bmp" },
+	{ 0x7B8FCC72, 0, "sound/drill/livefire05.wav" },
+	{ 0x8BFBBD3D, 0, "resource/vgui_japanese.txt" },
+	{ 0x0B48D8C8, 0, "sprites/icon_obj_neutral.spr" },
+	{ 0xB9C24F08, 0, "sound/vox/announcement.wav" },
+	{ 0x4FB44B4B, 0, "sprites/weapons5.spr" },
+	{ 0x5E0E0DEF, 0, "gfx/env/dashnight256bk.tga" },
+	{ 0x77141C51, 0, "sound/hgrunt/gr_mgun2.wav" },
+	{ 0x88D597EA, 0, "sound/sentences/hev_gr18.wav" },
+	{ 0x3B09EF79, 0, "sound/sentences/dc0.wav" },
+	{ 0x8F33BC77, 0, "sound/vox/rads.wav" },
+	{ 0x3A5D64A2, 0, "gfx/vgui/640_speaker3.tga" },
+	{ 0x89ECB98A, 0, "sprites/obj_icons/dod_flugplatz/icon_obj_custom2_allies.spr" },
+	{ 0x50EB4AC6, 0, "sound/sentences/c1a0_11.wav" },
+	{ 0x672935FA, 0, "overviews/dmc_dm2.txt" },
+	{ 0x8A18875D, 0, "sound/hgrunt/sir!.wav" },
+	{ 0x4E89539A, 0, "sound/player/headshot1.wav" },
+	{ 0xB5506011, 0, "sound/fgrunt/leave.wav" },
+	{ 0xEAA90E82, 0, "gfx/detail/dt_ground5.tga" },
+	{ 0x34582D1F, 0, "sound/fgrunt/situations.wav" },
+	{ 0x01FF4CDE, 0, "sound/vox/black.wav" },
+	{ 0x4D62934D, 0, "sound/player/pl_jump1.wav" },
+	{ 0x86E3B559, 0, "sound/misc/party1.wav" },
+	{ 0x27E4EABD, 0, "sound/gonome/gonome_pain2.wav" },
+	{ 0x5F064896, 0, "sound/vox/yourself.wav" },
+	{ 0xE632C466, 0, "sound/fgrunt/sweep.wav" },
+	{ 0x081E22BB, 0, "maps/dod_kraftstoff.txt" },
+	{ 0xC484B95C, 0, "resource/fake_microphone_meter.tga" },
+	{ 0x0F7F64D5, 0, "sound/radio/ct_backup.wav" },
+	{ 0x5856374D, 0, "models/bm_shell.mdl" },
+	{ 0xE1585C22, 0, "sound/vox/it.wav" },
+	{ 0xF68C4A88, 0, "sound/sentences/hg_quest11.wav" },
+	{ 0xD4309B18, 0, "sound/weapons/ric7.wav" },
+	{ 0xF2E34047, 0, "maps/de_cbble.txt" },
+	{ 0x0837EC0F, 0, "gfx/env/snowcliffup.tga" },
+	{ 0x696F80A5, 0, "sound/plats/vehicle1.wav" },
+	{ 0xF2C2A7D6, 0, "sound/shockroach/shock_bite.wav" },
+	{ 0x59F4AEA3, 0, "sound/vox/there.wav" },
+	{ 0xDBFA28D2, 0, "sound/ambience/deadsignal2.wav" },
+	{ 0xFD58CC0E, 0, "overviews/flagrun.bmp" },
+	{ 0xB88596C9, 0, "sound/radio/getout.wav" },
+	{ 0x6F8F0E1D, 0, "models/g_nail2.mdl" },
+	{ 0xDF0EE4A2, 0, "sound/weapons/ric10.wav" },
+	{ 0x82AB7F86, 0, "overviews/dod_sturm.bmp" },
+	{ 0xF947715E, 0, "sound/ambience/germanwin.wav" },
+	{ 0xD83050DA, 0, "sprites/mapsprites/ae_putsatchel2.spr" },
+	{ 0xA882A9B0, 0, "sound/weapons/sshell2.wav" },
+	{ 0x48A0F194, 0, "sound/player/gerfireinhole.wav" },
+	{ 0x9B964B45, 0, "sound/houndeye/he_die2.wav" },
+	{ 0x50576C43, 0, "sound/fgrunt/hurt.wav" },
+	{ 0xB76C067D, 0, "gfx/env/alien2dn.bmp" },
+	{ 0xAE26FDA9, 0, "maps/push.txt" },
+	{ 0x2AD052D9, 0, "models/intro_saw.mdl" },
+	{ 0xAD456C07, 0, "sprites/comp_a01.spr" },
+	{ 0x19E2E3B8, 0, "sound/weapons/bullet_hit1.wav" },
+	{ 0x83656D01, 0, "models/wire_blue24.mdl" },
+	{ 0xD6C6D973, 0, "sound/hgrunt/something!.wav" },
+	{ 0xF5FCFC33, 0, "sprites/hltv_88flak_destroyed_nobase.spr" },
+	{ 0x43DBF54B, 0, "models/mini_osprey.mdl" },
+	{ 0xAA50BF26, 0, "sound/ambience/wind2.wav" },
+	{ 0xC315047C, 0, "sprites/mapmarkers/redx.spr" },
+	{ 0xC99C9A3D, 0, "sound/scientist/tunedtoday.wav" },
+	{ 0x565E17C1, 0, "sound/sentences/hg_alert1.wav" },
+	{ 0xB125282D, 0, "sound/weapons/sniper_fire_last_round.wav" },
+	{ 0xBABAB6D2, 0, "sound/gonome/gonome_run.wav" },
+	{ 0x2B140882, 0, "sound/vox/handling.wav" },
+	{ 0xA0BEABFB, 0, "sprites/obj_icons/icon_obj_docs_neutral.spr" },
+	{ 0x7D05B52C, 0, "sound/player/usfireinhole.wav" },
+	{ 0x8824B8C1, 0, "models/p_glock18.mdl" },
+	{ 0x5E72F966, 0, "sound/barney/ba_dotoyou.wav" },
+	{ 0x529AFA2D, 0, "sound/sentences/hev_agrenade.wav" },
+	{ 0xDDCF5E33, 0, "sound/vox/train.wav" },
+	{ 0x7ED6309D, 0, "classes/long_scout.txt" },
+	{ 0x942355DA, 0, "models/shield/p_shield_deagle.mdl" },
+	{ 0x9CAB6E13, 0, "overviews/snark_pit.tga" },
+	{ 0xD181DA70, 0, "sound/vox/returned.wav" },
+	{ 0xE28C62E5, 0, "sound/ba_holo/tr_holo_leadguard.wav" },
+	{ 0xB5C200A1, 0, "sound/weapons/bazookareloadgetrocket.wav" },
+	{ 0x90EDAD41, 0, "sound/sentences/hg_charge3.wav" },
+	{ 0x5B15744D, 0, "gfx/env/morningbk.bmp" },
+	{ 0x853577A4, 0, "models/gasmask.mdl" },
+	{ 0xF12242EF, 0, "sound/ambience/warn3.wav" },
+	{ 0xD4261250, 0, "barney.wad" },
+	{ 0xCD394483, 0, "sound/player/pl_wood2.wav" },
+	{ 0x4049E7EC, 0, "servers/serverbrowser_schinese.txt" },
+	{ 0xEDDFA541, 0, "gfx/env/alien3dn.tga" },
+	{ 0x532CC5FB, 0, "sprites/obj_icons/dod_zalec/icon_obj_custom3_allies.spr" },
+	{ 0x229EF605, 0, "models/p_rock.mdl" },
+	{ 0x8EED3726, 0, "sound/debris/pushbox2.wav" },
+	{ 0xB36E4004, 0, "sound/drill/oc106b.wav" },
+	{ 0xA4B56A80, 0, "sound/otis/suppose.wav" },
+	{ 0xA2B52F3A, 0, "gfx/env/hackbk.bmp" },
+	{ 0xB1DEC1FA, 0, "sound/fgrunt/down.wav" },
+	{ 0xB947099E, 0, "sound/weapons/cbar_hit1.wav" },
+	{ 0x73A5980F, 0, "models/v_luger.mdl" },
+	{ 0x3721BD29, 0, "sound/barney/ba_security2_admin.wav" },
+	{ 0x39A6AEFD, 0, "models/p_barbd.mdl" },
+	{ 0x29E536EF, 0, "sound/garg/gar_attack1.wav" },
+	{ 0x6D784912, 0, "sound/hgrunt/in!.wav" },
+	{ 0xFDFCA643, 0, "sound/fvox/medical_repaired.wav" },
+	{ 0x32F8EBA5, 0, "gfx/env/neb1up.bmp" },
+	{ 0x50D0F304, 0, "overviews/frenzy.tga" },
+	{ 0x28743370, 0, "sound/shockroach/shock_idle2.wav" },
+	{ 0x92A003EF, 0, "sound/player/gerfallback.wav" },
+	{ 0xF47C16BD, 0, "sound/scientist/sc_pok2.wav" },
+	{ 0x0F191402, 0, "sound/weapons/asscan4.wav" },
+	{ 0xFBF20161, 0, "models/mapmodels/hk_mortar.mdl" },
+	{ 0x5A0DD24E, 0, "gfx/vgui/ct_random.tga" },
+	{ 0x41A749B2, 0, "sound/hgrunt/hole.wav" },
+	{ 0x05DF7B92, 0, "sound/radio/position.wav" },
+	{ 0x87956580, 0, "sound/misc/r_tele5.wav" },
+	{ 0x1FCA294F, 0, "gfx/env/hackdn.bmp" },
+	{ 0x30D6405A, 0, "gfx/vgui/hegrenade.tga" },
+	{ 0xCD24E477, 0, "sprites/320_pain.spr" },
+	{ 0xA71925BA, 0, "sound/weapons/mortar_shoot.wav" },
+	{ 0xB916B165, 0, "sprites/hexplo.spr" },
+	{ 0x3F503CF9, 0, "sprites/weapon_question.txt" },
+	{ 0x85EE932C, 0, "overviews/subtransit.bmp" },
+	{ 0xC2C2687C, 0, "sound/weapons/fiveseven_clipin.wav" },
+	{ 0x90CCB8BE, 0, "models/w_m40a1.mdl" },
+	{ 0x7578AA61, 0, "sound/hgrunt/left.wav" },
+	{ 0x83E3D8B6, 0, "sprites/hudsng.spr" },
+	{ 0x8FA3801B, 0, "dod_flash.wad" },
+	{ 0x398996F0, 0, "models/v_hgun.mdl" },
+	{ 0x803F376B, 0, "sound/turret/tu_die3.wav" },
+	{ 0x72600BD8, 0, "sound/vox/electric.wav" },
+	{ 0x7CEB4DC4, 0, "sound/player/usmoveout.wav" },
+	{ 0x77FAB394, 0, "sound/holo/tr_holo_intro.wav" },
+	{ 0xD111AFDE, 0, "sound/vox/but.wav" },
+	{ 0xCF68FF1D, 0, "models/hostage03.mdl" },
+	{ 0x2AC9B4EB, 0, "sprites/blood-narrow.spr" },
+	{ 0x51989FA1, 0, "sound/vox/surround.wav" },
+	{ 0x8A9DEC84, 0, "sound/otis/of1a1_ot01.wav" },
+	{ 0x92FB1AB9, 0, "models/p_bazooka.mdl" },
+	{ 0xF6B36B59, 0, "gfx/env/de_stormbk.tga" },
+	{ 0xFCDBAA9A, 0, "sound/vox/on.wav" },
+	{ 0x261A200E, 0, "sound/turret/tu_die.wav" },
+	{ 0x8DA234E6, 0, "sound/sentences/ed1.wav" },
+	{ 0x7E9194E5, 0, "models/hgrunt_opfor01.mdl" },
+	{ 0x34781252, 0, "sound/vox/kilo.wav" },
+	{ 0x370753FA, 0, "sound/radio/clear.wav" },
+	{ 0xD87646F4, 0, "sound/drill/add19.wav" },
+	{ 0x4495CF3C, 0, "sound/sentences/hev_c12.wav" },
+	{ 0x8868D445, 0, "sound/hgrunt/clear.wav" },
+	{ 0x80A30F29, 0, "sound/scientist/c1a2_sci_3zomb.wav" },
+	{ 0x76334315, 0, "sound/weapons/shock_recharge.wav" },
+	{ 0xBCC3B9AD, 0, "sound/scientist/sci_busy.wav" },
+	{ 0x206459F6, 0, "sound/scientist/evergetout.wav" },
+	{ 0xD88D3875, 0, "gfx/env/dmcpdn.tga" },
+	{ 0x590075D1, 0, "gfx/vgui/640_arrowdown.tga" },
+	{ 0x97E309FE, 0, "models/p_crowbar2.mdl" },
+	{ 0x640AAEC1, 0, "sound/rosenberg/ro_ok0.wav" },
+	{ 0x1C810F1F, 0, "resource/icon_up.tga" },
+	{ 0x384501C9, 0, "models/controller.mdl" },
+	{ 0x715E9F4F, 0, "sprites/tf_weapon_medikit.txt" },
+	{ 0x8C8318C9, 0, "sprites/clip_clips.spr" },
+	{ 0x44CCF4CF, 0, "models/v_flame.mdl" },
+	{ 0x23060F88, 0, "resource/platform_spanish.txt" },
+	{ 0x2D14EDEB, 0, "classes/short_cleansuit.txt" },
+	{ 0xDFCEB6A4, 0, "sound/common/menu2.wav" },
+	{ 0xDBC7AE41, 0, "sound/scientist/repeat.wav" },
+	{ 0xEF3CADAE, 0, "overviews/dod_caen.bmp" },
+	{ 0xD35846A0, 0, "gfx/vgui/marker_arrow_se.tga" },
+	{ 0x62EF7E47, 0, "sound/barney/ba_watchit.wav" },
+	{ 0x56EE47AB, 0, "models/w_isotopebox.mdl" },
+	{ 0x48AA152A, 0, "sound/fvox/hev_general_fail.wav" },
+	{ 0xE5EBD4D0, 0, "models/p_enfield_l.mdl" },
+	{ 0x0C6093D8, 0, "sound/hgrunt/clear!.wav" },
+	{ 0x05742D6D, 0, "sound/hgrunt/weapons.wav" },
+	{ 0x0C47B1CE, 0, "overviews/push.txt" },
+	{ 0xC458EC0A, 0, "models/mapmodels/glider_flight.mdl" },
+	{ 0x0845DB8E, 0, "resource/icon_stepb.tga" },
+	{ 0x80565205, 0, "sprites/weapons3.spr" },
+	{ 0xE368813E, 0, "models/p_flashbang.mdl" },
+	{ 0x333BB037, 0, "sound/ambience/fan2.wav" },
+	{ 0x7CFBE166, 0, "sound/weapons/tmp-1.wav" },
+	{ 0x887D228A, 0, "sprites/hud2.spr" },
+	{ 0x19778628, 0, "models/winebottle.mdl" },
+	{ 0x503C6A88, 0, "sound/sentences/hev_gr7.wav" },
+	{ 0xD78EB96F, 0, "sound/fgrunt/frosty.wav" },
+	{ 0x1A15D4BD, 0, "gfx/env/greenbk.tga" },
+	{ 0xD27F107C, 0, "sound/ambience/waves.wav" },
+	{ 0xBA5C7975, 0, "sound/barney/letsmoveit.wav" },
+	{ 0xAFF256B0, 0, "models/mil_crategibs.mdl" },
+	{ 0x3A25DA03, 0, "sound/player/gerpiat.wav" },
+	{ 0xB43522E7, 0, "sound/sentences/hg_alert3.wav" },
+	{ 0x0B30A207, 0, "sound/otis/yourside.wav" },
+	{ 0x516FC9C0, 0, "gfx/env/desertlf.tga" },
+	{ 0x8A698984, 0, "sound/weapons/ump45_boltslap.wav" },
+	{ 0xDBC8218E, 0, "models/mirv_grenade.mdl" },
+	{ 0xA66AC814, 0, "sound/radio/of2a5_rd01.wav" },
+	{ 0xA2671285, 0, "maps/well.txt" },
+	{ 0xE97A9286, 0, "sound/barney/ba_power2.wav" },
+	{ 0xB249DED9, 0, "gfx/vgui/icntlk_talking.tga" },
+	{ 0x2E19EAA1, 0, "sound/ambience/mgun_background_02.wav" },
+	{ 0x080840E8, 0, "sound/ambience/bee2.wav" },
+	{ 0xDB85FB83, 0, "sound/ba_holo/tr_holo_congrats.wav" },
+	{ 0x2C86D4B2, 0, "sound/rosenberg/ro_fear5.wav" },
+	{ 0x7F227AB0, 0, "sprites/hudbmps/tfchud07.bmp" },
+	{ 0x18379A8E, 0, "sprites/obj_icons/dod_vicenza/icon_obj_custom1_allies.spr" },
+	{ 0x267F634F, 0, "sound/radio/flankthem.wav" },
+	{ 0x8C45325A, 0, "sound/weapons/grenade_hit3.wav" },
+	{ 0x1CEDED43, 0, "models/bleachbones.mdl" },
+	{ 0x5232811E, 0, "gfx/env/cliff2lf.bmp" },
+	{ 0x86921C90, 0, "sound/ambience/dod_jagd_radio.wav" },
+	{ 0x339DC051, 0, "sound/hgrunt/those.wav" },
+	{ 0x9F4D423B, 0, "sound/vox/hide.wav" },
+	{ 0xC8BE271D, 0, "sound/player/pl_dirt4.wav" },
+	{ 0x9EC594FD, 0, "sound/vox/cap.wav" },
+	{ 0x0B6D3B5D, 0, "sprites/640hud1.spr" },
+	{ 0x93465A7E, 0, "models/w_silencert.mdl" },
+	{ 0xF9D7D3FC, 0, "sound/hgrunt/maintain!.wav" },
+	{ 0x9A9C3CCB, 0, "sound/fvox/thirty.wav" },
+	{ 0x1C7A00EF, 0, "sound/otis/illwait.wav" },
+	{ 0x3B407D10, 0, "models/mapmodels/arc_fern.mdl" },
+	{ 0xCE569401, 0, "classes/short_scientist.txt" },
+	{ 0x2BE68B61, 0, "gfx/env/alien3lf.tga" },
+	{ 0x75305310, 0, "resource/vgui_thai.txt" },
+	{ 0xCD174E3D, 0, "sound/weapons/electro6.wav" },
+	{ 0xE18816C7, 0, "gfx/env/cxbk.tga" },
+	{ 0x9E319A0C, 0, "sound/plats/heavystop1.wav" },
+	{ 0xB798E52B, 0, "sound/player/britprepare.wav" },
+	{ 0xCBBD0B97, 0, "sound/hassault/hw_spin.wav" },
+	{ 0xDA169D38, 0, "sound/player/britflankright.wav" },
+	{ 0x88AED66C, 0, "sound/player/usflankleft.wav" },
+	{ 0xF333C160, 0, "sound/hostage/hos3.wav" },
+	{ 0x2F08A892, 0, "sound/barney/dontreckon.wav" },
+	{ 0xB0126898, 0, "sound/ambience/3dmstart.wav" },
+	{ 0x37BBD196, 0, "sound/sentences/hev_e3.wav" },
+	{ 0x768C18CC, 0, "gfx/env/xen9lf.bmp" },
+	{ 0xDE395E73, 0, "models/tnt.mdl" },
+	{ 0x15D42C31, 0, "sound/hgrunt/stay.wav" },
+	{ 0xAAA75C3B, 0, "sound/barney/bigmess.wav" },
+	{ 0x0067F688, 0, "sound/radio/ctwin.wav" },
+	{ 0x4CED1728, 0, "sound/ambience/signalgear1.wav" },
+	{ 0xCBB55A1A, 0, "models/p_pipe_wrench.mdl" },
+	{ 0x38D1ECDA, 0, "sound/rosenberg/ro_tele_final13.wav" },
+	{ 0xEFA35BD8, 0, "sound/voltigore/voltigore_attack_shock.wav" },
+	{ 0x9FB70D72, 0, "resource/menu_hl_no_icon.tga" },
+	{ 0x999ED681, 0, "sound/weapons/piat_shoot.wav" },
+	{ 0x6FB15079, 0, "models/spore_ammo.mdl" },
+	{ 0xEA648249, 0, "sound/sentences/c1a4_7.wav" },
+	{ 0xAB514759, 0, "sprites/obj_icons/icon_obj_neutral.spr" },
+	{ 0x361A7E0D, 0, "sound/sentences/c1a2_9.wav" },
+	{ 0x98DACB00, 0, "sound/items/ammopickup2.wav" },
+	{ 0xCE2AD13C, 0, "sound/scientist/of2a2_sc01.wav" },
+	{ 0x4AC3BB66, 0, "sprites/effects/adrian/bazooka_fire.spr" },
+	{ 0x8843F036, 0, "sound/hostage/hos5.wav" },
+	{ 0x8A79513C, 0, "sound/hgrunt/onefiftymeters.wav" },
+	{ 0x71D49775, 0, "sound/buttons/bell1.wav" },
+	{ 0xD6BF782D, 0, "sound/weapons/p228-1.wav" },
+	{ 0xF04F81F5, 0, "cs_assault.wad" },
+	{ 0x9A747EAA, 0, "sound/drill/dr2_add05.wav" },
+	{ 0xBBEBA36E, 0, "overviews/well.tga" },
+	{ 0xFD4DA551, 0, "sound/player/pl_slosh2.wav" },
+	{ 0x2F0985D3, 0, "sound/misc/broken_tram1.wav" },
+	{ 0x98CA0C0D, 0, "sound/barney/somethingstinky.wav" },
+	{ 0x9D3D965E, 0, "models/shield/v_shield_usp.mdl" },
+	{ 0xBE94F63B, 0, "sound/ambience/siren.wav" },
+	{ 0x4A2EB0F9, 0, "sprites/opaqueexplode02.spr" },
+	{ 0xAB5AE646, 0, "sound/scientist/c2a4_sci_alldie.wav" },
+	{ 0x709D9056, 0, "sound/sentences/c3a2_6.wav" },
+	{ 0x8B569E0C, 0, "sound/drill/add11.wav" },
+	{ 0x6041AD06, 0, "models/v_grenade.mdl" },
+	{ 0xAD5134B7, 0, "sound/sentences/hev_egon.wav" },
+	{ 0x10DBB138, 0, "sound/turret/tu_spindown.wav" },
+	{ 0x4033345B, 0, "sprites/weapon_rocketl.txt" },
+	{ 0xAC3BE987, 0, "sound/radio/go.wav" },
+	{ 0xC123DEDE, 0, "gfx/env/neb6bk.bmp" },
+	{ 0xAACBC803, 0, "sprites/640_3bounce.spr" },
+	{ 0x50506542, 0, "sprites/effects/rain.spr" },
+	{ 0xF1686585, 0, "sound/player/usstartround2.wav" },
+	{ 0xF9BEDFC6, 0, "gfx/detail/sturm_dirt.tga" },
+	{ 0x117CD0E5, 0, "sound/weapons/c4_explode1.wav" },
+	{ 0x30D6328B, 0, "sound/ambience/water_flowing3.wav" },
+	{ 0x1510892E, 0, "gfx/env/cliffdn.bmp" },
+	{ 0x9381ABEF, 0, "gfx/vgui/640_both.tga" },
+	{ 0x729B1823, 0, "gfx/env/alien1rt.tga" },
+	{ 0xB837755C, 0, "gfx/env/alien1rt.bmp" },
+	{ 0x76B9B4F5, 0, "sound/scientist/sci_fear5.wav" },
+	{ 0xD83A13A9, 0, "sound/scientist/getoutofhere.wav" },
+	{ 0x95034DC6, 0, "sound/weapons/hit_wood2.wav" },
+	{ 0x6F538904, 0, "sound/vox/explode.wav" },
+	{ 0xE5ED4A41, 0, "sound/vox/sixteen.wav" },
+	{ 0x21832667, 0, "sound/rosenberg/ro_stop0.wav" },
+	{ 0x577EA4EF, 0, "resource/gearbox_english.txt" },
+	{ 0xDF546D50, 0, "sound/hgrunt/fiftymeters.wav" },
+	{ 0xB33EE735, 0, "sound/voltigore/voltigore_attack_melee1.wav" },
+	{ 0x87172644, 0, "sound/weapons/g_bounce5.wav" },
+	{ 0x9F324304, 0, "models/w_piat_rocket.mdl" },
+	{ 0xC6D204D5, 0, "overviews/dod_vicenza.bmp" },
+	{ 0xE5B0EFC6, 0, "models/scientist07.mdl" },
+	{ 0x1B28A680, 0, "sound/fgrunt/of5a3_fg04.wav" },
+	{ 0xC5FB9B15, 0, "sound/scientist/c1a0_sci_lock7a.wav" },
+	{ 0x83D3FFC1, 0, "gfx/env/alien3ft.tga" },
+	{ 0x22B77099, 0, "sound/hgrunt/target.wav" },
+	{ 0x15D6B430, 0, "autobuy.txt" },
+	{ 0x79257269, 0, "sound/ambience/warn1.wav" },
+	{ 0x476EDB6D, 0, "sound/hgrunt/zulu!.wav" },
+	{ 0x61A25E38, 0, "sound/scientist/sci_bother.wav" },
+	{ 0x7C879E3E, 0, "sound/pitworm/pit_worm_angry3.wav" },
+	{ 0x7C99AC9D, 0, "sound/barney/haybuddy.wav" },
+	{ 0xC5C1A07B, 0, "gfx/vgui/fonts/1152_commandmenu text.tga" },
+	{ 0xAB3C4E26, 0, "sound/x/x_attack3.wav" },
+	{ 0x91C0F513, 0, "sound/weapons/scock1.wav" },
+	{ 0x9453DCB8, 0, "sound/events/friend_died.wav" },
+	{ 0x13B55AD8, 0, "sound/vox/lockout.wav" },
+	{ 0x2BA7BC6B, 0, "sound/doors/doormove10.wav" },
+	{ 0xBE6E4AFF, 0, "sprites/smallspark.spr" },
+	{ 0x1473B538, 0, "models/p_srpg.mdl" },
+	{ 0xCC11076A, 0, "sound/hgrunt/west!.wav" },
+	{ 0xA20A59FC, 0, "sound/pitdrone/pit_drone_die2.wav" },
+	{ 0x3379C6E3, 0, "sound/otis/mmmm.wav" },
+	{ 0x6DDC0F3C, 0, "sound/misc/metal5.wav" },
+	{ 0xA8908EF1, 0, "sound/ambience/flybycrash.wav" },
+	{ 0x83231D77, 0, "sound/ambience/birds3.wav" },
+	{ 0x67F25E0F, 0, "sound/scientist/c3a1_sci_2sat.wav" },
+	{ 0xD4DB7AE3, 0, "sound/gman/gman_mumble2.wav" },
+	{ 0x953AA7B2, 0, "sound/fgrunt/charge.wav" },
+	{ 0x329B4E53, 0, "overviews/lambda_bunker.tga" },
+	{ 0x7A1411BD, 0, "sound/sentences/nrad0.wav" },
+	{ 0xE2288EB9, 0, "sound/fgrunt/intro_fg01.wav" },
+	{ 0x4B43C21D, 0, "sound/drill/rope02.wav" },
+	{ 0xF4EAEB8C, 0, "sound/player/germoveout.wav" },
+	{ 0xEB8C21A2, 0, "sound/ambience/birds4.wav" },
+	{ 0xDE137C56, 0, "sound/ambience/artyhit1.wav" },
+	{ 0x7D388E09, 0, "sprites/weapon_lightning.txt" },
+	{ 0x25F00AAA, 0, "models/player/robo/robo.mdl" },
+	{ 0xDB76C514, 0, "models/riblet1.mdl" },
+	{ 0xC5AC2ED9, 0, "overviews/dod_zalec.txt" },
+	{ 0x1A0D3917, 0, "gfx/env/duskrt.bmp" },
+	{ 0x45CA8338, 0, "sound/ambience/uswin.wav" },
+	{ 0xE7A00BDC, 0, "sound/squeek/sqk_deploy1.wav" },
+	{ 0x3BE2AA6B, 0, "sound/weapons/m249_boxout.wav" },
+	{ 0xEDF4B144, 0, "sprites/bplayer.spr" },
+	{ 0xD41F8281, 0, "1024_textscheme.txt" },
+	{ 0x0441F818, 0, "sprites/tree5.spr" },
+	{ 0x34818D05, 0, "sound/scientist/stench.wav" },
+	{ 0x726F8539, 0, "sound/debris/zap1.wav" },
+	{ 0x9541D369, 0, "sound/ambience/squeeks2.wav" },
+	{ 0x51B581D1, 0, "sound/hgrunt/orders.wav" },
+	{ 0x3E6FE747, 0, "models/p_c4.mdl" },
+	{ 0x03EC02A9, 0, "sound/barney/c3a1_ba_3sat.wav" },
+	{ 0xAACBBEDE, 0, "sound/scientist/c1a0_sci_lock4a.wav" },
+	{ 0xDB12B646, 0, "sound/weapons/famas_boltpull.wav" },
+	{ 0x4EC0F93E, 0, "sound/barney/c2a1_ba_hub1a.wav" },
+	{ 0x92DC42E7, 0, "sound/sentences/hev_f1.wav" },
+	{ 0xC5C9479E, 0, "sound/sentences/hg_charge2.wav" },
+	{ 0xEE734D7E, 0, "gfx/vgui/fonts/800_primary button text.tga" },
+	{ 0x70B99BC9, 0, "sprites/flare6.spr" },
+	{ 0x3ADA0E81, 0, "sound/events/tutor_msg.wav" },
+	{ 0xE60CF086, 0, "gfx/env/sky_blu_up.tga" },
+	{ 0xF536FC6D, 0, "sound/garg/gar_step1.wav" },
+	{ 0xC956FDFE, 0, "sound/drill/barracks0345_full.wav" },
+	{ 0x79370C6C, 0, "models/player/grunt/grunt.bmp" },
+	{ 0x5F961BCB, 0, "sound/scientist/sci_alone.wav" },
+	{ 0x616AB2EB, 0, "sound/sentences/c1a3_warn.wav" },
+	{ 0x2159D5B5, 0, "models/p_smokegrenade.mdl" },
+	{ 0xEFA3AD80, 0, "sound/gonome/gonome_pain1.wav" },
+	{ 0x114F1800, 0, "sound/drill/fifthroom01.wav" },
+	{ 0x473E7D88, 0, "sound/vox/radioactive.wav" },
+	{ 0x91CBBE71, 0, "sound/ambience/birds_outside1.wav" },
+	{ 0x0659253A, 0, "models/hgrunt_torch.mdl" },
+	{ 0x4AFE6131, 0, "sprites/obj_icons/dod_falaise/icon_obj_custom3_allies.spr" },
+	{ 0x9A3AF198, 0, "sound/holo/tr_holo_grenade.wav" },
+	{ 0xE0EB61DA, 0, "sound/holo/tr_holo_jumpgap.wav" },
+	{ 0xF3556466, 0, "gfx/env/kraftstoffbk.tga" },
+	{ 0x5E51814E, 0, "sprites/mapmarkers/sniper.spr" },
+	{ 0x5439CABA, 0, "models/mapmodels/by_boat_metal.mdl" },
+	{ 0x5592BFC9, 0, "models/tree.mdl" },
+	{ 0xC8001125, 0, "sound/scientist/rumourclean.wav" },
+	{ 0x309DB54E, 0, "media/launch_select2.wav" },
+	{ 0x1C153ED0, 0, "gfx/env/killertomatolf.tga" },
+	{ 0x3DD5E297, 0, "sound/tentacle/te_squirm2.wav" },
+	{ 0xBD800502, 0, "sound/scientist/sci_aftertest.wav" },
+	{ 0x0613CC46, 0, "sound/scientist/organicmatter.wav" },
+	{ 0x1C225852, 0, "sound/sentences/hev_c9.wav" },
+	{ 0xD9FCE679, 0, "models/shield/v_shield_hegrenade.mdl" },
+	{ 0xDDAC431B, 0, "overviews/subtransit.txt" },
+	{ 0x54D8E580, 0, "models/player/soldier/soldier2.mdl" },
+	{ 0xB2F9A818, 0, "models/mapmodels/forts.mdl" },
+	{ 0x085779B0, 0, "models/v_tfac.mdl" },
+	{ 0xCBCF2DBB, 0, "sprites/wep_smoke_01.spr" },
+	{ 0x1F8781DB, 0, "models/v_glock18.mdl" },
+	{ 0x9D0495FB, 0, "overviews/snark_pit.txt" },
+	{ 0xD041EBAA, 0, "sound/barney/ba_security2_range1.wav" },
+	{ 0xB31BBE0D, 0, "sound/sentences/hg_idle1.wav" },
+	{ 0x25FBE4BF, 0, "sound/ambience/xtal_down1.wav" },
+	{ 0xE5B10DE9, 0, "sound/scientist/whyleavehere.wav" },
+	{ 0x7686C20C, 0, "sound/bullchicken/bc_pain4.wav" },
+	{ 0x4303B3BD, 0, "sound/ambience/goal_1.wav" },
+	{ 0xCAEC1C4E, 0, "models/v_webley.mdl" },
+	{ 0x4B6074A6, 0, "sprites/pistol_smoke2.spr" },
+	{ 0xF13E2DDC, 0, "sound/drill/barracks08.wav" },
+	{ 0x4AB7FF6D, 0, "models/w_shotshellt.mdl" },
+	{ 0x36828F66, 0, "models/miniturrett.mdl" },
+	{ 0xDC2B6157, 0, "sprites/rain02.spr" },
+	{ 0x20F216E2, 0, "sound/hgrunt/there.wav" },
+	{ 0x0E90744E, 0, "sprites/bmp/fthrow09.bmp" },
+	{ 0x82F052F8, 0, "sound/rosenberg/ro_tele_final19.wav" },
+	{ 0x024D2AB9, 0, "sprites/grass_03.spr" },
+	{ 0x07953910, 0, "sound/pitworm/clang3.wav" },
+	{ 0x226213DE, 0, "models/p_brenbu.mdl" },
+	{ 0xD2026064, 0, "sound/ba_holo/tr_holo_retry.wav" },
+	{ 0xAD9C07DB, 0, "maps/dod_charlie_detail.txt" },
+	{ 0xF41E2E08, 0, "models/w_medkits.mdl" },
+	{ 0x94A69DDE, 0, "models/p_light.mdl" },
+	{ 0xDC05159B, 0, "overviews/de_nuke.txt" },
+	{ 0xBDAC185A, 0, "sprites/obj_icons/dod_glider/icon_obj_custom2_allies.spr" },
+	{ 0x68AF1E89, 0, "gfx/vgui/icntlk_pl.tga" },
+	{ 0x6F33A4DA, 0, "sound/shocktrooper/shock_trooper_attack.wav" },
+	{ 0x112B8C5E, 0, "sound/fvox/activated.wav" },
+	{ 0x1E31A49D, 0, "sound/dischit.wav" },
+	{ 0x3A3B4B5D, 0, "models/w_m1carb.mdl" },
+	{ 0xA9093FD5, 0, "gfx/vgui/fonts/1600_scoreboard text.tga" },
+	{ 0x2614EFA0, 0, "sound/ambience/rocket_groan4.wav" },
+	{ 0x557FD6A3, 0, "sound/vox/die.wav" },
+	{ 0x90B0B42F, 0, "sound/ambience/merderet-bridgeallie.wav" },
+	{ 0x7949BA40, 0, "gfx/vgui/640_hwguyblue.tga" },
+	{ 0x5C825E3F, 0, "gfx/env/forestup.tga" },
+	{ 0x77F02611, 0, "sound/scientist/c2a4_sci_scanner.wav" },
+	{ 0x7F878659, 0, "models/fungus(small)t.mdl" },
+	{ 0x9DBA6AE3, 0, "sound/vox/located.wav" },
+	{ 0x82AD31D5, 0, "sound/weapons/knife_hit1.wav" },
+	{ 0xB0E3F7FC, 0, "sprites/hudbmps/tfchud03.bmp" },
+	{ 0x25FD4FDA, 0, "gfx/env/badlandsrt.tga" },
+	{ 0xC72B90DD, 0, "sound/vox/has.wav" },
+	{ 0x3E3D25AC, 0, "models/mapmodels/rug_oriental-large3.mdl" },
+	{ 0x3E21CD80, 0, "models/mapmodels/fd_boxes.mdl" },
+	{ 0x3ECC6271, 0, "sound/scientist/cantbeserious.wav" },
+	{ 0xE4EFC8E2, 0, "sound/weapons/aug_boltslap.wav" },
+	{ 0xD2707F58, 0, "sound/hgrunt/out.wav" },
+	{ 0x54321AF4, 0, "sound/debris/bustceiling.wav" },
+	{ 0x0E6DECB2, 0, "gfx/vgui/ak47.tga" },
+	{ 0x2A6667C4, 0, "sound/player/geiger2.wav" },
+	{ 0x68863434, 0, "models/scientist01.mdl" },
+	{ 0x90B2BD4A, 0, "sound/vox/to.wav" },
+	{ 0x50171B87, 0, "sound/weapons/g_bounce4.wav" },
+	{ 0xBE43DE44, 0, "sound/plats/vehicle6.wav" },
+	{ 0x159638CE, 0, "sound/holo/tr_holo_commencing.wav" },
+	{ 0xC8392E13, 0, "sprites/sprite_b_1.spr" },
+	{ 0xA5EB7176, 0, "models/v_umbrella.mdl" },
+	{ 0x043A92DC, 0, "sound/pitworm/pit_worm_attack_eyeblast.wav" },
+	{ 0x4B7FD252, 0, "sound/intro/g7_copy_hq.wav" },
+	{ 0xE8E7BB32, 0, "maps/epicenter.txt" },
+	{ 0xACCD581F, 0, "gfx/env/rubbleft.tga" },
+	{ 0xDDF523F7, 0, "models/w_awp.mdl" },
+	{ 0x31247D42, 0, "gfx/vgui/round_corner_sw.tga" },
+	{ 0xB633BB9E, 0, "sprites/weapon_knife.txt" },
+	{ 0x126FBC8B, 0, "models/p_fg42bd.mdl" },
+	{ 0xF554B8D2, 0, "sound/intro/w6_cant_see.wav" },
+	{ 0x68985C4B, 0, "sound/ambience/alienflyby2.wav" },
+	{ 0x56923834, 0, "models/mapmodels/phone_pole1.mdl" },
+	{ 0x12F74601, 0, "models/v_tfc_supernailgun.mdl" },
+	{ 0x2DA43C75, 0, "gfx/env/neb6bk.tga" },
+	{ 0x4DB2B716, 0, "gfx/vgui/1280_arrowdown.tga" },
+	{ 0x20727567, 0, "sprites/playerflame.spr" },
+	{ 0xCB08D660, 0, "sound/fgrunt/flank.wav" },
+	{ 0x7E535239, 0, "sound/scientist/c3a1_sci_4sat.wav" },
+	{ 0x5E7F3C12, 0, "sound/misc/truck_stop.wav" },
+	{ 0x32481A3B, 0, "sprites/hudcb.spr" },
+	{ 0x65094C38, 0, "sound/doors/doorstop3.wav" },
+	{ 0x9642AE8A, 0, "maps/op4ctf_repent.txt" },
+	{ 0x0825C9C3, 0, "gfx/env/greenup.tga" },
+	{ 0x949A9192, 0, "sound/vox/decontamination.wav" },
+	{ 0x1DD47493, 0, "sound/player/pl_ladder3.wav" },
+	{ 0xD77B4B34, 0, "sound/weapons/sg550_clipout.wav" },
+	{ 0x60506325, 0, "sound/player/pl_tile5.wav" },
+	{ 0xBA5FE6BD, 0, "sprites/rain.spr" },
+	{ 0x9A203CFA, 0, "logos/101st.bmp" },
+	{ 0x332719AF, 0, "sound/scientist/reportflux.wav" },
+	{ 0x4806350B, 0, "models/grenade.mdl" },
+	{ 0x9B1907F5, 0, "gfx/env/nightdn.tga" },
+	{ 0xC69A0521, 0, "gfx/env/trainyarddn.tga" },
+	{ 0x418B4B4C, 0, "sound/plats/elevmove1.wav" },
+	{ 0x56EA7F02, 0, "sound/ambience/alarm1.wav" },
+	{ 0x776E4AD6, 0, "sound/radio/ct_inpos.wav" },
+	{ 0x3C6D15BF, 0, "sprites/hudbmps/tfchud02.bmp" },
+	{ 0xE8619054, 0, "sound/de_torn/torn_templewind.wav" },
+	{ 0x4B97D111, 0, "sound/player/gib.wav" },
+	{ 0xF54C88AF, 0, "resource/valve_french.txt" },
+	{ 0x73943F67, 0, "sound/fans/fan3on.wav" },
+	{ 0xB8810870, 0, "models/player/shephard/shephard.mdl" },
+	{ 0x95E9E7D8, 0, "sound/ba_holo/tr_holo_intro.wav" },
+	{ 0x28F5F424, 0, "sound/vox/power.wav" },
+	{ 0xB44A4BC5, 0, "sound/ambience/glider_axis_radio.wav" },
+	{ 0xDBC907DE, 0, "sound/fgrunt/checkfire.wav" },
+	{ 0x625D342E, 0, "sound/radio/elim.wav" },
+	{ 0x36FE8E89, 0, "sound/hgrunt/gr_pain1.wav" },
+	{ 0xEF7010DB, 0, "gfx/env/desdn.tga" },
+	{ 0x7B7DA6E1, 0, "sound/barney/ba_buttugly.wav" },
+	{ 0x3F765E51, 0, "sound/ambience/birds1.wav" },
+	{ 0xC1F4864B, 0, "models/osprey_tailgibs.mdl" },
+	{ 0xBEEDF9FA, 0, "models/player/terror/terror.mdl" },
+	{ 0x82D19D8D, 0, "sound/holo/tr_holo_radiation.wav" },
+	{ 0x0332C629, 0, "models/w_pschreck_rocket.mdl" },
+	{ 0x2B131671, 0, "models/v_gauss.mdl" },
+	{ 0xE0F8E7D8, 0, "models/player/soldier/soldier.mdl" },
+	{ 0x8EC68AF9, 0, "sound/weapons/m4a1_clipout.wav" },
+	{ 0x286B1D87, 0, "sound/ambience/alienwind2.wav" },
+	{ 0xED9E3249, 0, "models/renginet.mdl" },
+	{ 0xD2A73742, 0, "sound/weapons/m249_coverup.wav" },
+	{ 0xE5EAC70F, 0, "sound/barney/dontaskme.wav" },
+	{ 0xD35A4DD1, 0, "sound/scientist/simulation.wav" },
+	{ 0x7A0DA05B, 0, "sound/hassault/hw_spindown.wav" },
+	{ 0x262BD532, 0, "sound/sentences/hg_gren0.wav" },
+	{ 0xBA57E7D4, 0, "sound/ambience/flameburst1.wav" },
+	{ 0xBC821094, 0, "sound/hgrunt/ass!.wav" },
+	{ 0x7D281A8A, 0, "sound/vox/terminated.wav" },
+	{ 0x2816A36F, 0, "sound/hgrunt/objective.wav" },
+	{ 0x42AF4D04, 0, "sound/turret/tu_ping.wav" },
+	{ 0x8300B811, 0, "sound/hgrunt/everything.wav" },
+	{ 0x64762247, 0, "sound/vox/hostile.wav" },
+	{ 0xC15661B5, 0, "models/hair.mdl" },
+	{ 0x9F559A56, 0, "models/suitt.mdl" },
+	{ 0x80310755, 0, "sound/ambience/birds5.wav" },
+	{ 0x711333C6, 0, "sound/sentences/hg_cover5.wav" },
+	{ 0xFCC16895, 0, "sound/vox/final.wav" },
+	{ 0xB70D3B6E, 0, "sprites/mapmarkers/britflag.spr" },
+	{ 0x8B4C599A, 0, "sound/vox/anomalous.wav" },
+	{ 0x30567862, 0, "maps/op4ctf_repent .txt" },
+	{ 0x1688C538, 0, "gfx/env/trainyardbk.tga" },
+	{ 0xAABEAD93, 0, "sound/barney/ba_security2_range2.wav" },
+	{ 0xCF4211DF, 0, "models/mapmodels/arc_pine.mdl" },
+	{ 0x409F1BC5, 0, "models/w_shock.mdl" },
+	{ 0x0CF7BABC, 0, "gfx/vgui/clsimages/cls_mp40.tga" },
+	{ 0xBB66BF65, 0, "sound/fvox/munitionview_on.wav" },
+	{ 0xCF5472FD, 0, "sound/scientist/areyouthink.wav" },
+	{ 0x77D251AB, 0, "models/bm_leg.mdl" },
+	{ 0x5B27A005, 0, "sprites/hudngsm.spr" },
+	{ 0x674506DE, 0, "sound/player/britstartround2.wav" },
+	{ 0x9749E1C7, 0, "logos/american.bmp" },
+	{ 0x5425C000, 0, "models/p_p228.mdl" },
+	{ 0xFFBE7249, 0, "sound/vox/helium.wav" },
+	{ 0xACB57AA8, 0, "gfx/env/sildom2bk.tga" },
+	{ 0x4BB86BFF, 0, "sound/weapons/debris1.wav" },
+	{ 0x43433BA7, 0, "models/fungus.mdl" },
+	{ 0xEDF2E21F, 0, "sprites/mapsprites/soldier_tnt.spr" },
+	{ 0xBF2FE8DB, 0, "sound/ambience/alien_chatter.wav" },
+	{ 0xF8095884, 0, "sound/weapons/glauncher.wav" },
+	{ 0x44AB23A9, 0, "gfx/vgui/fonts/640_scoreboard small text.tga" },
+	{ 0x1DBE1F9E, 0, "sound/sentences/hg_monst3.wav" },
+	{ 0xF180E90C, 0, "sound/fgrunt/intro_fg15.wav" },
+	{ 0x1966FD53, 0, "fonts.wad" },
+	{ 0x01DDF00C, 0, "sound/vox/government.wav" },
+	{ 0x2E528C48, 0, "models/w_rpgammot.mdl" },
+	{ 0x2B993CB2, 0, "gfx/env/dustbowllf.bmp" },
+	{ 0x8E6E7DE5, 0, "sprites/obj_icons/dod_vicenza/icon_obj_custom2_allies.spr" },
+	{ 0x986AC6A2, 0, "sprites/bmp/1expl01.bmp" },
+	{ 0x4CBA9B3B, 0, "sound/sentences/hev_gr13.wav" },
+	{ 0x7AC7E906, 0, "sound/weapons/g3sg1_clipin.wav" },
+	{ 0x2E111CB2, 0, "models/player/zombie/zombie.mdl" },
+	{ 0xFD334B6A, 0, "sound/hgrunt/squad.wav" },
+	{ 0x832E8AD6, 0, "sound/player/pl_wade3.wav" },
+	{ 0xBE495E31, 0, "models/fungus(large).mdl" },
+	{ 0xAA72E67A, 0, "op4ctf_credits.txt" },
+	{ 0xD3B3EC1E, 0, "sound/vox/freezer.wav" },
+	{ 0x947F3E00, 0, "gfx/vgui/ump45.tga" },
+	{ 0xF40AF5C6, 0, "sound/scientist/sc_hello5.wav" },
+	{ 0x9846A79E, 0, "sound/sentences/hg_quest4.wav" },
+	{ 0xBD6A90B0, 0, "sound/vox/percent.wav" },
+	{ 0x5CC5970D, 0, "sound/weapons/headshot2.wav" },
+	{ 0x4AB7FF80, 0, "sound/hgrunt/movement!.wav" },
+	{ 0x4F4B5BBB, 0, "sound/drill/rifle08.wav" },
+	{ 0xBAED2F1F, 0, "maps/dod_vicenza.txt" },
+	{ 0x13A0FACD, 0, "gfx/vgui/gsg9.tga" },
+	{ 0x2BBD5688, 0, "sound/vox/fifteen.wav" },
+	{ 0x1CE994BD, 0, "sprites/mommaspout.spr" },
+	{ 0xCDF29908, 0, "models/player/gign/gign.mdl" },
+	{ 0xC3808408, 0, "sound/vox/danger.wav" },
+	{ 0x228C6BA2, 0, "sound/player/damage11.wav" },
+	{ 0xBF721C5B, 0, "sound/controller/con_die2.wav" },
+	{ 0x8CD8AB45, 0, "sprites/3dmflared.spr" },
+	{ 0xFBC42B1D, 0, "sound/player/ustakingfireright.wav" },
+	{ 0x7D9ECD93, 0, "sound/vox/vapor.wav" },
+	{ 0x24CA6492, 0, "sprites/icnquad.spr" },
+	{ 0xFD905D58, 0, "sound/scientist/sci_die2.wav" },
+	{ 0x2BAC8F86, 0, "sound/player/britright.wav" },
+	{ 0xD27F14F5, 0, "sound/sentences/na0.wav" },
+	{ 0xBB8E2994, 0, "models/player/gina/gina.bmp" },
+	{ 0x020481D9, 0, "sound/ambience/rocket_groan3.wav" },
+	{ 0x3E29034F, 0, "sound/plats/heavymove1.wav" },
+	{ 0x38DAA4D1, 0, "sound/ambience/lv_jubilee.wav" },
+	{ 0x5AA4FE83, 0, "gfx/vgui/sg552.tga" },
+	{ 0xD7EADA52, 0, "sprites/yelflare1.spr" },
+	{ 0x817C00C2, 0, "gfx/vgui/640_scoutblue.tga" },
+	{ 0xA31A8EFD, 0, "sound/hgrunt/hg_sucks.wav" },
+	{ 0x78C12414, 0, "gfx/env/desertup.bmp" },
+	{ 0xB003FDF6, 0, "sound/player/britgogogo.wav" },
+	{ 0xB465AB31, 0, "sprites/obj_icons/icon_obj_brit.spr" },
+	{ 0x23C574C9, 0, "sound/sentences/c3a1_8.wav" },
+	{ 0x907DE1D2, 0, "sound/aslave/slv_word6.wav" },
+	{ 0x556A637B, 0, "sound/garg/gar_flameoff1.wav" },
+	{ 0xD1CBC8A2, 0, "sound/weapons/shock_draw.wav" },
+	{ 0xB91AF8F8, 0, "sound/otis/of2a6_ot01.wav" },
+	{ 0xA5188EB8, 0, "sound/hgrunt/move!.wav" },
+	{ 0xBAA0D562, 0, "models/player/axis-inf/axis-inft.mdl" },
+	{ 0xA5202059, 0, "gfx/env/avalf.tga" },
+	{ 0x88BE90F1, 0, "sprites/hudgl.spr" },
+	{ 0xCE8FB7A6, 0, "sound/hgrunt/gr_reload1.wav" },
+	{ 0xBAA39661, 0, "models/armour_y.mdl" },
+	{ 0xD9B9BD2D, 0, "sound/hgrunt/creeps!.wav" },
+	{ 0x801D20AE, 0, "sound/fvox/major_lacerations.wav" },
+	{ 0x8328C1B5, 0, "sound/vox/exterminate.wav" },
+	{ 0xEA6BE9EA, 0, "sprites/hudsngsm.spr" },
+	{ 0x652FC876, 0, "sprites/640hud19.spr" },
+	{ 0xA055285C, 0, "sound/scientist/absolutely.wav" },
+	{ 0x4B1FDC71, 0, "sound/player/pl_organic4.wav" },
+	{ 0x61D3BFE8, 0, "gfx/vgui/clsimages/cls_mortar.tga" },
+	{ 0x755D785B, 0, "sound/fgrunt/secure.wav" },
+	{ 0x9200968C, 0, "sound/scientist/sc_yard_wound1.wav" },
+	{ 0xDEA79004, 0, "sound/weapons/hks3.wav" },
+	{ 0x3DA4E8A4, 0, "sound/rosenberg/ro_stop1.wav" },
+	{ 0x6E768999, 0, "sound/rosenberg/ro_yard_almost3.wav" },
+	{ 0x2A47773C, 0, "sound/weapons/glock18-1.wav" },
+	{ 0x52198AC3, 0, "models/big_mom.mdl" },
+	{ 0x62829AE7, 0, "sound/geneworm/geneworm_idle4.wav" },
+	{ 0xDBDD582D, 0, "sound/drill/squad06.wav" },
+	{ 0x282700E1, 0, "sound/ui/buttonclickrelease.wav" },
+	{ 0xBC0D237F, 0, "sprites/ledglow.spr" },
+	{ 0x6CEF0AEB, 0, "sound/vox/weapon.wav" },
+	{ 0xAE99008F, 0, "sound/vox/duct.wav" },
+	{ 0xC2B351D4, 0, "overviews/cs_italy.txt" },
+	{ 0x333CCD4C, 0, "models/player/cl_suit/cl_suit.mdl" },
+	{ 0x28C54733, 0, "sound/weapons/electro4.wav" },
+	{ 0xD78BE349, 0, "sound/vox/lever.wav" },
+	{ 0x0E00E864, 0, "resource/icon_blank.tga" },
+	{ 0x6E9006CC, 0, "sound/misc/talk.wav" },
+	{ 0xB9917FA1, 0, "gfx/vgui/640_randompcred.tga" },
+	{ 0x17F7AF50, 0, "sound/vox/core.wav" },
+	{ 0x77C121D1, 0, "sound/rosenberg/ro_tele_nocell.wav" },
+	{ 0x011D57D7, 0, "models/mapmodels/generator.mdl" },
+	{ 0x793A52A3, 0, "sound/weapons/knife_hit_wall2.wav" },
+	{ 0x46B1E9BA, 0, "classes/short_tower.txt" },
+	{ 0x3380EEDD, 0, "overviews/dustbowl.bmp" },
+	{ 0xA488C5B1, 0, "sound/hgrunt/sign.wav" },
+	{ 0x159A584E, 0, "sound/scientist/sc_yard_box1.wav" },
+	{ 0xA3972BBE, 0, "sound/fvox/twentyfive.wav" },
+	{ 0x48874814, 0, "sound/scientist/scream3.wav" },
+	{ 0xC9002DA6, 0, "sound/vox/lab.wav" },
+	{ 0xAA436DCC, 0, "sound/ambience/warn2.wav" },
+	{ 0x571448D7, 0, "gfx/vgui/p228.tga" },
+	{ 0x226AE3E3, 0, "sound/drill/squad04.wav" },
+	{ 0x8BE36BAC, 0, "sound/leech/leech_alert1.wav" },
+	{ 0x353BD7F2, 0, "sprites/mapmarkers/arrow_w.spr" },
+	{ 0x3149D96A, 0, "sound/sentences/hev_c1.wav" },
+	{ 0xA9F44E77, 0, "sound/sentences/fuzz.wav" },
+	{ 0x52F1BD49, 0, "models/icky.mdl" },
+	{ 0x56064E3A, 0, "sound/vox/safe.wav" },
+	{ 0x0EFCDA63, 0, "sprites/xsmoke1.spr" },
+	{ 0xB847825D, 0, "sound/player/britdefendobj.wav" },
+	{ 0x711947CA, 0, "sound/holo/tr_holo_breakbox.wav" },
+	{ 0xB0034110, 0, "sprites/wsplash3.spr" },
+	{ 0x0EC739EF, 0, "sound/weapons/carbine_shoot.wav" },
+	{ 0xDC36547D, 0, "sound/vox/enemy.wav" },
+	{ 0xEF1AEB36, 0, "sound/pitworm/pit_worm_attack_swipe3.wav" },
+	{ 0x7AC4C29D, 0, "sound/player/pl_snow6.wav" },
+	{ 0x92A09677, 0, "gfx/vgui/arctic.tga" },
+	{ 0x18ADB116, 0, "sprites/moths.spr" },
+	{ 0xC64A3597, 0, "gfx/vgui/clsimages/cls_enfields.tga" },
+	{ 0x34687617, 0, "gfx/env/alien1lf.tga" },
+	{ 0x2F08F041, 0, "sound/sentences/hev_gr0.wav" },
+	{ 0x77A01FEF, 0, "sound/barney/ba_power1.wav" },
+	{ 0x87A0C3E3, 0, "models/arcticorange.mdl" },
+	{ 0xA391BF3D, 0, "sound/barney/c3a2_ba_4surv.wav" },
+	{ 0xE76E57BE, 0, "sound/ambience/alienwind1.wav" },
+	{ 0x3893A029, 0, "sound/hgrunt/zero!.wav" },
+	{ 0xCDC80403, 0, "resource/gameui_german.txt" },
+	{ 0x1FCB9C63, 0, "sound/sentences/c1a0_16.wav" },
+	{ 0x9387BE67, 0, "sound/weapons/he_bounce-1.wav" },
+	{ 0x80E94FAA, 0, "models/v_shield_r.mdl" },
+	{ 0xB96EDE26, 0, "sprites/weapon_sporelauncher.txt" },
+	{ 0x81A2BF1A, 0, "sound/fvox/automedic_on.wav" },
+	{ 0xE12EF8BD, 0, "sound/otis/dontask.wav" },
+	{ 0x840F7246, 0, "sound/scientist/c1a2_sci_elevator.wav" },
+	{ 0x1B86C987, 0, "gfx/vgui/fonts/1600_briefing text.tga" },
+	{ 0x2E0B2ABC, 0, "sound/hgrunt/south!.wav" },
+	{ 0xABDAF491, 0, "sound/barney/luckwillturn.wav" },
+	{ 0xE6EF26D0, 0, "models/w_argrenade.mdl" },
+	{ 0x7AEAADBA, 0, "sound/drill/add08.wav" },
+	{ 0xB5E2E73D, 0, "sound/player/usflankright.wav" },
+	{ 0xFCBCAD5E, 0, "sprites/comp_b01.spr" },
+	{ 0x351BA127, 0, "overviews/epicenter.txt" },
+	{ 0xF2C7DC5A, 0, "models/w_357.mdl" },
+	{ 0x07D6E96C, 0, "sound/scientist/cascade.wav" },
+	{ 0x4D65CA57, 0, "sound/fvox/acquired.wav" },
+	{ 0x0A5F50E1, 0, "models/p_rpg.mdl" },
+	{ 0xFA58C7DC, 0, "sound/sentences/t2.wav" },
+	{ 0xE44F955B, 0, "sound/plats/vehicle3.wav" },
+	{ 0x26532B0B, 0, "sound/scientist/beverage.wav" },
+	{ 0x1E780305, 0, "sound/scientist/stimulating.wav" },
+	{ 0x7C47A4EB, 0, "sound/hgrunt/will!.wav" },
+	{ 0x0AE85320, 0, "sound/otis/janitor.wav" },
+	{ 0x2BAE3F0F, 0, "models/civ_paper_scientist.mdl" },
+	{ 0x60B799AE, 0, "sound/rosenberg/ro_tele_final26.wav" },
+	{ 0x6547EF58, 0, "sound/holo/tr_holo_drown.wav" },
+	{ 0x89AD383D, 0, "sound/barney/dontguess.wav" },
+	{ 0x0A2E8DB6, 0, "gfx/env/dustbowlrt.bmp" },
+	{ 0x548B1DFB, 0, "models/v_greasegun.mdl" },
+	{ 0x02619560, 0, "overviews/dmc_dm4.txt" },
+	{ 0xB6B8389D, 0, "sound/scientist/c3a2_sci_portopen.wav" },
+	{ 0xA25FB617, 0, "sound/scientist/completelywrong.wav" },
+	{ 0x397DB1E2, 0, "sound/ambience/hawk1.wav" },
+	{ 0x5796792A, 0, "models/blkop_apache.mdl" },
+	{ 0x524E044E, 0, "gfx/env/neb1dn.bmp" },
+	{ 0xDF7B0F88, 0, "sound/ambience/mill.wav" },
+	{ 0x21F49275, 0, "sound/fvox/radiation_detected.wav" },
+	{ 0x4F8759B0, 0, "models/hostage.mdl" },
+	{ 0xA4A4753E, 0, "sound/player/britneedammo.wav" },
+	{ 0x132BD556, 0, "models/uplant1.mdl" },
+	{ 0x1AA11A54, 0, "sound/vox/invallid.wav" },
+	{ 0x943888B5, 0, "sound/ambience/biggun1.wav" },
+	{ 0xFD3DE350, 0, "sound/scientist/rumorclean.wav" },
+	{ 0x8C3FC71B, 0, "models/v_rpg.mdl" },
+	{ 0x878EF365, 0, "sound/vox/life.wav" },
+	{ 0xCC1E4CC8, 0, "sound/gonarch/gon_attack1.wav" },
+	{ 0x33FA14DD, 0, "gfx/vgui/clsimages/cls_carbine.tga" },
+	{ 0x2F939BC6, 0, "models/garg.mdl" },
+	{ 0x775853EA, 0, "sound/holo/holostn7.wav" },
+	{ 0x0EFFDB16, 0, "sound/otis/dontmake.wav" },
+	{ 0x6ABC2135, 0, "sound/doors/doormove1.wav" },
+	{ 0x0781B280, 0, "sound/radio/of1a2_rd01.wav" },
+	{ 0xAD4247D6, 0, "sound/hgrunt/hot!.wav" },
+	{ 0xFC23D4BF, 0, "sound/garg/gar_alert3.wav" },
+	{ 0x74F02C06, 0, "sprites/bmp/fthrow01.bmp" },
+	{ 0x0EC5C6EE, 0, "sprites/target.spr" },
+	{ 0x1DEE3155, 0, "models/mapmodels/charlie_shingle.mdl" },
+	{ 0x1E31EE3C, 0, "sound/hgrunt/orders!.wav" },
+	{ 0xB46961F2, 0, "models/player/brit-inf/brit-inft.mdl" },
+	{ 0x9584C5DE, 0, "overviews/dod_vicenza.txt" },
+	{ 0xB9F0F082, 0, "sound/misc/b2.wav" },
+	{ 0x06E9C412, 0, "sound/debris/wood4.wav" },
+	{ 0x504F2E28, 0, "sound/weapons/p90_clipin.wav" },
+	{ 0x5174FD5E, 0, "sprites/640hud11.spr" },
+	{ 0x9E8A5FF3, 0, "sound/ichy/ichy_idle2.wav" },
+	{ 0x5890813D, 0, "models/conc_grenade.mdl" },
+	{ 0x2D346F01, 0, "models/w_medkitl.mdl" },
+	{ 0x8269819F, 0, "sound/barney/beertopside.wav" },
+	{ 0x438615D2, 0, "sound/player/gerspreadout.wav" },
+	{ 0x1195EAED, 0, "sound/player/gerstartround.wav" },
+	{ 0xB11F7033, 0, "sound/hgrunt/we've!.wav" },
+	{ 0x086AB32D, 0, "models/rengine.mdl" },
+	{ 0x0F351E60, 0, "sound/fgrunt/pain2.wav" },
+	{ 0xB72C5066, 0, "sound/hgrunt/level.wav" },
+	{ 0x903F5E40, 0, "maps/dod_zalec.txt" },
+	{ 0xC6F36493, 0, "sound/rosenberg/ro_tele_final07.wav" },
+	{ 0xE06B36D8, 0, "models/w_357t.mdl" },
+	{ 0x83CE6BF4, 0, "gfx/vgui/clsimages/cls_fg42.tga" },
+	{ 0xCF7886F8, 0, "maps/2fort.txt" },
+	{ 0x91D07A35, 0, "sound/pitworm/pit_worm_idle1.wav" },
+	{ 0x8FD8BA20, 0, "sound/sentences/hev_c3.wav" },
+	{ 0x4113664C, 0, "sound/boid/boid_idle1.wav" },
+	{ 0x74F7DE71, 0, "models/mapmodels/pi_tree3.mdl" },
+	{ 0x0252FBD5, 0, "sprites/mapmarkers/number_two.spr" },
+	{ 0x2153DA34, 0, "sound/hgrunt/command!.wav" },
+	{ 0x93866D7F, 0, "sound/drill/oc109.wav" },
+	{ 0x6CA18303, 0, "sprites/poison.spr" },
+	{ 0x898DB082, 0, "sound/shocktrooper/shock_trooper_pain4.wav" },
+	{ 0xA544C8F9, 0, "gfx/vgui/640_timer.tga" },
+	{ 0x6DCE566B, 0, "gfx/detail/dt_snow2.tga" },
+	{ 0x463B476F, 0, "sound/barney/soundsright.wav" },
+	{ 0xC84BBDDC, 0, "sound/player/pl_wade1.wav" },
+	{ 0xDFE0C8BE, 0, "overviews/crossfire.txt" },
+	{ 0x56BA8189, 0, "sound/fgrunt/marines.wav" },
+	{ 0xE5BC92AB, 0, "sound/sentences/c1a2_10.wav" },
+	{ 0x2F1054EB, 0, "sound/scientist/youinsane.wav" },
+	{ 0x168C7907, 0, "sound/rosenberg/ro_tele_xen06.wav" },
+	{ 0x71723090, 0, "sound/scientist/stop2.wav" },
+	{ 0xF5E2215F, 0, "sound/vox/deactivated.wav" },
+	{ 0x16C8E845, 0, "sound/otis/cantfigure.wav" },
+	{ 0x24B1FBC9, 0, "sound/scientist/c1a0_sci_dis13a.wav" },
+	{ 0xAB108B93, 0, "sound/vox/b.wav" },
+	{ 0x7ED0DEEE, 0, "overviews/bounce.tga" },
+	{ 0x3FB1F742, 0, "sprites/weapon_c4.txt" },
+	{ 0xB7315155, 0, "sound/player/damage10.wav" },
+	{ 0xFC9E5B8F, 0, "sound/scientist/sci_fear10.wav" },
+	{ 0xF01B0BF3, 0, "sound/ambience/loader_step1.wav" },
+	{ 0xBFB2D0AF, 0, "models/apachet.mdl" },
+	{ 0x04C40AAC, 0, "sound/weapons/concgren_blast1.wav" },
+	{ 0x27B079CA, 0, "gfx/env/snowdn.tga" },
+	{ 0x9BB81CAC, 0, "gfx/env/desup.tga" },
+	{ 0x33D57D26, 0, "models/player/robo/robo.bmp" },
+	{ 0x348AB3EB, 0, "models/p_357.mdl" },
+	{ 0xB0F420AC, 0, "sound/sentences/ncon0.wav" },
+	{ 0xB5BD5886, 0, "sound/vox/good.wav" },
+	{ 0x0371C8AB, 0, "sound/hgrunt/c2a2_hg_chat5a.wav" },
+	{ 0x913A4791, 0, "sound/player/breathe1.wav" },
+	{ 0x9ACFA32E, 0, "sound/rosenberg/ro_yard_access2.wav" },
+	{ 0x0A260916, 0, "sound/vox/destroyed.wav" },
+	{ 0xB4481CFA, 0, "sound/vox/silo.wav" },
+	{ 0x57E81B9A, 0, "gfx/env/rubblebk.tga" },
+	{ 0xBB0476A0, 0, "gfx/vgui/clsimages/cls_k98s.tga" },
+	{ 0x9BDA7B2D, 0, "sound/ambience/lv3.wav" },
+	{ 0x371DDF49, 0, "sprites/obj_icons/icon_obj_truck_neutral.spr" },
+	{ 0xB49BB331, 0, "sound/vox/corridor.wav" },
+	{ 0xCD9B0415, 0, "models/pow_freeze.mdl" },
+	{ 0x6CA78DAE, 0, "models/abone_template1.mdl" },
+	{ 0x19306A61, 0, "sound/weapons/displacer_impact.wav" },
+	{ 0x6C625E81, 0, "sound/scientist/c1a4_sci_trainend.wav" },
+	{ 0xD8484BEA, 0, "sound/hgrunt/right.wav" },
+	{ 0xE87D6C69, 0, "sound/buttons/button4.wav" },
+	{ 0x6D030DF1, 0, "sound/pitdrone/pit_drone_alert1.wav" },
+	{ 0xD5401DA5, 0, "sound/houndeye/he_alert2.wav" },
+	{ 0x9ACA4DFE, 0, "models/presentsm.mdl" },
+	{ 0xB7AF2A56, 0, "sound/plats/train2.wav" },
+	{ 0x4834C1D7, 0, "sound/fvox/get_rpgammo.wav" },
+	{ 0x4B8E82AF, 0, "resource/background/800_3_b_loading.tga" },
+	{ 0x032B8FBB, 0, "sound/fvox/minor_fracture.wav" },
+	{ 0x208A41AD, 0, "sound/player/damage3.wav" },
+	{ 0x95CF13DB, 0, "sound/barney/c3a2_ba_2surv.wav" },
+	{ 0x84D41D11, 0, "models/w_flashlight.mdl" },
+	{ 0x849F70C8, 0, "sound/vox/fifth.wav" },
+	{ 0x3ECBA12D, 0, "sound/player/gergrenade.wav" },
+	{ 0xBFA31056, 0, "sound/hgrunt/have.wav" },
+	{ 0x8550C916, 0, "sound/rosenberg/ro_pain3.wav" },
+	{ 0x2AFB793A, 0, "sound/vox/east.wav" },
+	{ 0xCADE4E23, 0, "sound/hgrunt/blip.wav" },
+	{ 0xC463D9B4, 0, "sound/tram/ba_tram4.wav" },
+	{ 0xB04817D1, 0, "models/mapmodels/sandbags.mdl" },
+	{ 0x9D5AE7C5, 0, "overviews/cs_havana.bmp" },
+	{ 0x87D51F08, 0, "sprites/bmp/1expl10.bmp" },
+	{ 0xEF4307AD, 0, "models/v_xm1014.mdl" },
+	{ 0x3C2AFC6F, 0, "sprites/mapmarkers/usflag.spr" },
+	{ 0xD009F2BA, 0, "sound/hgrunt/going.wav" },
+	{ 0xE0FC0759, 0, "sound/hgrunt/ass.wav" },
+	{ 0xCA489CBD, 0, "gfx/env/blackbk.tga" },
+	{ 0x15F7E8F7, 0, "sound/ambience/alien_humongo.wav" },
+	{ 0x875C2D32, 0, "sound/scientist/inconclusive.wav" },
+	{ 0xC97280A0, 0, "sound/weapons/usp1.wav" },
+	{ 0x9552E878, 0, "gfx/env/hackft.tga" },
+	{ 0x30E22450, 0, "models/player/demo/demo2.mdl" },
+	{ 0x6D19EFEF, 0, "sound/scientist/delayagain.wav" },
+	{ 0x90F78E9C, 0, "models/v_famas.mdl" },
+	{ 0x90CF6B4A, 0, "models/w_rpgammo.mdl" },
+	{ 0xE53FF5A3, 0, "sound/vox/second.wav" },
+	{ 0x92C6538C, 0, "sound/player/death1.wav" },
+	{ 0x31981DC5, 0, "sound/vox/close.wav" },
+	{ 0x24E23139, 0, "models/intro_barneyt.mdl" },
+	{ 0xC1F2FD50, 0, "models/mapmodels/flo_grass.mdl" },
+	{ 0xCE5F395B, 0, "sound/weapons/fiveseven_sliderelease.wav" },
+	{ 0x814573D0, 0, "sound/ambience/alien_blipper.wav" },
+	{ 0x22EF612C, 0, "gfx/env/snowclifflf.tga" },
+	{ 0x37BFEBBD, 0, "sound/hgrunt/patrol!.wav" },
+	{ 0x41F3D235, 0, "overviews/undertow.bmp" },
+	{ 0xCF6E296A, 0, "sound/ba_holo/tr_holo_button.wav" },
+	{ 0xF582D571, 0, "sound/hgrunt/tango.wav" },
+	{ 0x37E112B3, 0, "sound/sentences/nh1.wav" },
+	{ 0xF2FB3980, 0, "sound/weapons/m4a1_clipin.wav" },
+	{ 0x9A5A954E, 0, "sound/ba_holo/tr_holo_pullbox.wav" },
+	{ 0xAF48DC23, 0, "models/stretcher.mdl" },
+	{ 0xD5143D9B, 0, "sound/scientist/sc_tele_work2.wav" },
+	{ 0x892AFDA7, 0, "gfx/env/alien1dn.tga" },
+	{ 0x2C99DB88, 0, "sound/weapons/knife_slash2.wav" },
+	{ 0x335E8495, 0, "models/shotgunshell.mdl" },
+	{ 0x42485BB6, 0, "sound/vox/presence.wav" },
+	{ 0x466A6910, 0, "sound/rosenberg/ro_letstrythis.wav" },
+	{ 0x4CF008B6, 0, "sound/vox/subsurface.wav" },
+	{ 0xAD7B4576, 0, "sound/sentences/nd2.wav" },
+	{ 0x6CDAA0A4, 0, "gfx/vgui/640_civ_random.tga" },
+	{ 0xBFFF2610, 0, "sound/otis/dejavu.wav" },
+	{ 0xFB021D00, 0, "sprites/black_smoke4.spr" },
+	{ 0x1922CEFC, 0, "sound/vox/quit.wav" },
+	{ 0x5C843983, 0, "sound/sentences/ed6.wav" },
+	{ 0xA360037B, 0, "overviews/warpath.txt" },
+	{ 0x10675085, 0, "sound/shocktrooper/ras.wav" },
+	{ 0xCD42858D, 0, "sound/scientist/of4a1_sc01.wav" },
+	{ 0x33C26794, 0, "overviews/dod_falaise.bmp" },
+	{ 0xFC81CE91, 0, "sprites/sshrap3.spr" },
+	{ 0x8F0F866A, 0, "sound/scientist/overhere.wav" },
+	{ 0x7BEC882E, 0, "models/w_ak47.mdl" },
+	{ 0x6B9DEF79, 0, "sound/vox/bust.wav" },
+	{ 0x19B0A241, 0, "overviews/stalkyard.txt" },
+	{ 0xDEF68368, 0, "sound/ambience/rocket_steam1.wav" },
+	{ 0x221524F8, 0, "sound/holo/tr_holo_charger.wav" },
+	{ 0xB6714304, 0, "sprites/bmp/1expl07.bmp" },
+	{ 0xC2EB4763, 0, "sound/scientist/sc_hello2.wav" },
+	{ 0x9C329094, 0, "gfx/env/neb6up.bmp" },
+	{ 0xDB8FCB50, 0, "sound/otis/chili.wav" },
+	{ 0xAD586C3C, 0, "sound/vox/sargeant.wav" },
+	{ 0x773442CC, 0, "sound/barney/of6a4_ba01.wav" },
+	{ 0x853E2908, 0, "sound/rosenberg/ro_ok7.wav" },
+	{ 0x47A053A3, 0, "models/scientistt.mdl" },
+	{ 0x68A1E050, 0, "sound/weapons/butt_hit.wav" },
+	{ 0x49860D2A, 0, "sprites/tracers01.spr" },
+	{ 0xF6DA29FF, 0, "models/w_crowbar.mdl" },
+	{ 0x2A1D22FC, 0, "gfx/vgui/1152_timer.tga" },
+	{ 0x56393B9E, 0, "sound/holo/tr_holo_jumpdown.wav" },
+	{ 0xC1160D9F, 0, "sound/apache/ap_rotor3.wav" },
+	{ 0x08C2B88F, 0, "models/mapmodels/hk_busted_mortar.mdl" },
+	{ 0x362DB4AA, 0, "sprites/640hud15.spr" },
+	{ 0xADA5430C, 0, "models/p_glock.mdl" },
+	{ 0x95847275, 0, "sound/sentences/hev_44pistol.wav" },
+	{ 0x59EF8CA5, 0, "sound/weapons/pl_gun1.wav" },
+	{ 0xE182CDAE, 0, "sound/controller/con_alert1.wav" },
+	{ 0x3C83AD6F, 0, "sound/otis/yup.wav" },
+	{ 0xFC0D10DD, 0, "sound/player/gerstartround2.wav" },
+	{ 0xBDA84AEA, 0, "sprites/weapon_fiveseven.txt" },
+	{ 0x397ABBF5, 0, "sound/scientist/sc_yard_box4.wav" },
+	{ 0x49F8AC4E, 0, "sound/vox/accelerator.wav" },
+	{ 0xBD4AA8FD, 0, "sound/misc/intro_seq3.wav" },
+	{ 0x605034AA, 0, "gfx/env/doom1bk.tga" },
+	{ 0xB454BF88, 0, "sound/weapons/sniper.wav" },
+	{ 0x1A874CBF, 0, "sound/weapons/desert_eagle_reload.wav" },
+	{ 0x1881DF7E, 0, "resource/gameui_tchinese.txt" },
+	{ 0x6CC62F15, 0, "sound/otis/breath.wav" },
+	{ 0x139F1A91, 0, "overviews/well.bmp" },
+	{ 0x2CA7A270, 0, "gfx/vgui/map_2flag.tga" },
+	{ 0x4E485CD1, 0, "gfx/vgui/marker_arrow_w.tga" },
+	{ 0x62D73873, 0, "sound/player/pl_fallpain.wav" },
+	{ 0x181E51CE, 0, "sound/hgrunt/cover!.wav" },
+	{ 0xB116B95B, 0, "sound/weapons/pwrench_big_hitbod1.wav" },
+	{ 0x70AF7A09, 0, "models/mapmodels/freya_radar1.mdl" },
+	{ 0x50F97042, 0, "models/w_adrenalinet.mdl" },
+	{ 0x3BAAB0BE, 0, "sound/ba_holo/tr_holo_breakbox.wav" },
+	{ 0x240C9EA0, 0, "sound/vox/protective.wav" },
+	{ 0x642633C2, 0, "sound/fvox/sixty.wav" },
+	{ 0x0B7BD0AB, 0, "sound/ambience/biggun3.wav" },
+	{ 0x8221EAD6, 0, "models/archer.mdl" },
+	{ 0xF9184E88, 0, "titles.txt" },
+	{ 0x9BFA1725, 0, "sound/fvox/get_alien_wpn.wav" },
+	{ 0xCC969B9D, 0, "sound/sentences/c1a0_21.wav" },
+	{ 0xC85C5D75, 0, "sprites/hudbmps/tfchud04.bmp" },
+	{ 0xE3B4250E, 0, "models/w_spade.mdl" },
+	{ 0x30A3478D, 0, "models/g_shot2.mdl" },
+	{ 0x88F38813, 0, "sound/player/britbringuppiat.wav" },
+	{ 0x769D56CB, 0, "sound/scientist/sci_die3.wav" },
+	{ 0x3FA2A21A, 0, "sound/sentences/hev_hlth0.wav" },
+	{ 0x7FA53FB2, 0, "sound/weapons/whizz10.wav" },
+	{ 0xE262070F, 0, "sound/triggerjump.wav" },
+	{ 0x78B058FE, 0, "sound/debris/zap8.wav" },
+	{ 0x431A9D00, 0, "sound/vox/yards.wav" },
+	{ 0xED8A00F5, 0, "sound/player/pl_step3.wav" },
+	{ 0xF9BEFBA7, 0, "sound/fvox/major_fracture.wav" },
+	{ 0x8C4B8DEA, 0, "sound/vox/activate.wav" },
+	{ 0x5A4A6ED7, 0, "sound/items/r_item1.wav" },
+	{ 0xD7C04FE6, 0, "sprites/bmp/2expl06.bmp" },
+	{ 0x6C30023F, 0, "gfx/env/duskdn.bmp" },
+	{ 0x88ECD670, 0, "sound/sentences/c1a0_start.wav" },
+	{ 0xC5C34FC6, 0, "gfx/env/drkgup.tga" },
+	{ 0x05442C51, 0, "sound/items/rope3.wav" },
+	{ 0xE2F0E905, 0, "sound/hgrunt/our!.wav" },
+	{ 0x123A1C40, 0, "sound/vox/deploy.wav" },
+	{ 0xDC6609A1, 0, "sound/scientist/iwounded2.wav" },
+	{ 0xF0B74717, 0, "sound/scientist/sorryimleaving.wav" },
+	{ 0xD46819D1, 0, "sound/hgrunt/post!.wav" },
+	{ 0xC8643ADA, 0, "resource/vgui_italian.txt" },
+	{ 0x61F0C5F1, 0, "gfx/env/sildom2ft.tga" },
+	{ 0xA42485E1, 0, "sound/vox/eighty.wav" },
+	{ 0x60CD76BB, 0, "sound/rosenberg/ro_stop4.wav" },
+	{ 0x30B18928, 0, "servers/icon_password_column.tga" },
+	{ 0xB6A0BF41, 0, "sound/weapons/sniper_reload_first_seq.wav" },
+	{ 0x1FF33AA3, 0, "sound/vox/delta.wav" },
+	{ 0x38663463, 0, "models/v_g3sg1.mdl" },
+	{ 0x69A844F0, 0, "gfx/env/dmcwdn.tga" },
+	{ 0xC7AE56B0, 0, "models/construction.mdl" },
+	{ 0xFE9CE295, 0, "models/p_spanner2.mdl" },
+	{ 0x1C48E5A3, 0, "gfx/env/discup.tga" },
+	{ 0xF0D2E777, 0, "models/turret.mdl" },
+	{ 0x5272C2EE, 0, "sprites/effects/snowflake.spr" },
+	{ 0xF8C1E421, 0, "sound/hgrunt/echo.wav" },
+	{ 0x8E30E6E9, 0, "sound/ambience/squirm2.wav" },
+	{ 0xA1EA3A61, 0, "models/hgrunt_medic01.mdl" },
+	{ 0x2CA9A663, 0, "sprites/hudngammo.spr" },
+	{ 0x4C96CA89, 0, "sound/scientist/sci_fear9.wav" },
+	{ 0x3EDD82C4, 0, "sound/weapons/m249-2.wav" },
+	{ 0x69D21AF8, 0, "classes/short_civilian.txt" },
+	{ 0xC88401FB, 0, "models/mil_crate.mdl" },
+	{ 0xEC78A738, 0, "sound/sentences/c1a1_5.wav" },
+	{ 0x7CFD16D6, 0, "sound/pitdrone/pit_drone_communicate3.wav" },
+	{ 0x4031EEFF, 0, "gfx/vgui/1600_arrowup.tga" },
+	{ 0x1EB4264B, 0, "sound/fgrunt/damage.wav" },
+	{ 0xA5BE57A6, 0, "sound/scientist/canttakemore.wav" },
+	{ 0xFFA06BC1, 0, "gfx/detail/dt_wood2.tga" },
+	{ 0x2175ED8D, 0, "sound/otis/gotone.wav" },
+	{ 0xCF797BD0, 0, "sound/hgrunt/guard!.wav" },
+	{ 0x540EEBA9, 0, "sound/hgrunt/casualties!.wav" },
+	{ 0x44AA8E58, 0, "sound/ambience/mgun1.wav" },
+	{ 0x1E8B7806, 0, "sound/scientist/dontknow.wav" },
+	{ 0x25DC80A3, 0, "sprites/iplayerdead.spr" },
+	{ 0x63890D58, 0, "sound/ambience/birds6.wav" },
+	{ 0x22E67F9C, 0, "sound/tentacle/te_swing2.wav" },
+	{ 0xDAB96A18, 0, "sound/gman/gman_stepin.wav" },
+	{ 0x28335744, 0, "sound/fgrunt/rapidfire.wav" },
+	{ 0x724E7797, 0, "media/launch_select1.wav" },
+	{ 0x924F1021, 0, "sound/player/germedic.wav" },
+	{ 0x43DF0751, 0, "sound/rosenberg/ro_tele_final27.wav" },
+	{ 0x4754CC12, 0, "sound/turret/tu_active.wav" },
+	{ 0x7DA0AFBA, 0, "sound/vox/radiation.wav" },
+	{ 0xC5517BAC, 0, "sprites/mapmarkers/greencheck.spr" },
+	{ 0x36478A1A, 0, "sound/ba_holo/tr_holo_ladder.wav" },
+	{ 0x2B6823E5, 0, "sound/hgrunt/got!.wav" },
+	{ 0xBB123997, 0, "sound/scientist/scream17.wav" },
+	{ 0xFB590C47, 0, "sound/sentences/hev_a4.wav" },
+	{ 0xA5534F30, 0, "sound/player/slimbrn2.wav" },
+	{ 0x9524E330, 0, "sound/fvox/morphine_shot.wav" },
+	{ 0x7922B3F1, 0, "models/v_fiveseven.mdl" },
+	{ 0xF9C8D65A, 0, "classes/short_barney.txt" },
+	{ 0xD118BFB4, 0, "models/intro_regular.mdl" },
+	{ 0x680FC82D, 0, "sound/barney/ba_heeey.wav" },
+	{ 0xE3C57DB3, 0, "models/zombie04.mdl" },
+	{ 0x09A44641, 0, "models/mapmodels/repunzel_bott.mdl" },
+	{ 0xB976FB3E, 0, "sound/barney/ba_endline.wav" },
+	{ 0x2A7F9F3A, 0, "sound/rosenberg/ro_wait2.wav" },
+	{ 0x3C4B0BFA, 0, "sprites/iplayervip.spr" },
+	{ 0x7DD4734E, 0, "models/mapmodels/bunny.mdl" },
+	{ 0xD8D2A7B2, 0, "sound/hgrunt/gr_step2.wav" },
+	{ 0xEE5C6F9D, 0, "gfx/vgui/fonts/1024_scoreboard text.tga" },
+	{ 0x36E48E94, 0, "sound/player/bhit_helmet-1.wav" },
+	{ 0x34063CE0, 0, "models/v_tfc_crowbar.mdl" },
+	{ 0xCE530C93, 0, "sound/otis/noise.wav" },
+	{ 0x4788B1E0, 0, "sound/ambience/industrial5.wav" },
+	{ 0x4ACF32EB, 0, "sound/weapons/c4_click.wav" },
+	{ 0x142BDCBC, 0, "models/testsphere.mdl" },
+	{ 0x6AE5D207, 0, "overviews/cs_siege.bmp" },
+	{ 0x2C447289, 0, "sound/hgrunt/are!.wav" },
+	{ 0x4691BF4E, 0, "sound/barney/c1a2_ba_bullsquid.wav" },
+	{ 0x5A905A38, 0, "gfx/env/neb7dn.bmp" },
+	{ 0xCA093DDD, 0, "classes/short_recruit.txt" },
+	{ 0x700F8F76, 0, "sound/vox/violation.wav" },
+	{ 0x2C695E70, 0, "models/w_hegrenade.mdl" },
+	{ 0x0EF4B439, 0, "models/lightt.mdl" },
+	{ 0xCB1DD6A5, 0, "sound/items/damage2.wav" },
+	{ 0x198D0C9E, 0, "models/w_rpgt.mdl" },
+	{ 0x6372810C, 0, "sound/garg/gar_stomp1.wav" },
+	{ 0xF763C486, 0, "sprites/interlace.spr" },
+	{ 0x37DD5CB9, 0, "dod_vicenza.wad" },
+	{ 0x9912668A, 0, "cstrike.wad" },
+	{ 0x5C005377, 0, "sound/player/usfallback.wav" },
+	{ 0x72D96A6B, 0, "sound/vox/reactor.wav" },
+	{ 0x795E1B0A, 0, "sound/rosenberg/ro_xen_call3.wav" },
+	{ 0x51E1C739, 0, "sound/vox/someone.wav" },
+	{ 0x80F594E8, 0, "models/ribcage.mdl" },
+	{ 0x1C342511, 0, "sound/barney/ba_post.wav" },
+	{ 0xB5D5BC06, 0, "sound/sentences/ctr7.wav" },
+	{ 0xC74D99FD, 0, "sound/vox/operations.wav" },
+	{ 0xE9924D38, 0, "sound/sentences/c2a4_7.wav" },
+	{ 0x56130A65, 0, "models/p_aug.mdl" },
+	{ 0x63FD4665, 0, "sound/hgrunt/go!.wav" },
+	{ 0xFC656341, 0, "models/mapmodels/bed_empty-wood.mdl" },
+	{ 0x1022D658, 0, "models/base.mdl" },
+	{ 0xE747F9C2, 0, "models/w_fiveseven.mdl" },
+	{ 0xE5665B72, 0, "models/p_desert_eagle.mdl" },
+	{ 0xB505B069, 0, "sound/player/pl_grate2.wav" },
+	{ 0xB339FD37, 0, "sound/weapons/lstart.wav" },
+	{ 0x66BE9630, 0, "sound/radio/bootcamp0.wav" },
+	{ 0x372232B8, 0, "models/barney_helmet.mdl" },
+	{ 0x03A38632, 0, "gfx/env/city1up.tga" },
+	{ 0x44D304D0, 0, "sound/weapons/splauncher_altfire.wav" },
+	{ 0x13181ED8, 0, "sound/vox/engage.wav" },
+	{ 0x0E8FC1D2, 0, "sound/agrunt/ag_idle4.wav" },
+	{ 0xD41FEAF9, 0, "models/w_satchel.mdl" },
+	{ 0x0348F7F0, 0, "gfx/env/morningup.tga" },
+	{ 0x9C71A60F, 0, "sprites/640hud12.spr" },
+	{ 0x0A3DB4A4, 0, "sound/sentences/na12.wav" },
+	{ 0xE0C8578B, 0, "overviews/de_cbble.bmp" },
+	{ 0x2EE327C9, 0, "sound/x/x_pain2.wav" },
+	{ 0x516515FA, 0, "sound/shockroach/shock_flinch.wav" },
+	{ 0x6CD0D46E, 0, "sprites/obj_icons/icon_obj_allies.spr" },
+	{ 0x245110D4, 0, "gfx/env/havft.tga" },
+	{ 0x311EAC68, 0, "models/w_suitt.mdl" },
+	{ 0x59BB513B, 0, "sound/fgrunt/death5.wav" },
+	{ 0x1F7F33C1, 0, "gfx/env/trainyardlf.tga" },
+	{ 0x4B07DB3E, 0, "sound/otis/nosir.wav" },
+	{ 0x2B6F5D74, 0, "gfx/env/xen8rt.tga" },
+	{ 0xA05833D6, 0, "sound/player/pain3.wav" },
+	{ 0x672E2B3E, 0, "sound/ambience/thunder2.wav" },
+	{ 0xDDB9F1D5, 0, "gfx/env/dmcpft.tga" },
+	{ 0x8BB8EBD9, 0, "sound/vox/man.wav" },
+	{ 0xFFA34F69, 0, "sound/barney/ba_power3.wav" },
+	{ 0x25CF5449, 0, "sound/vox/communication.wav" },
+	{ 0x505ADB15, 0, "gfx/vgui/fonts/1280_commandmenu text.tga" },
+	{ 0xF5860E65, 0, "sound/sentences/hev_a2.wav" },
+	{ 0xD7461A58, 0, "sound/weapons/sliderelease1.wav" },
+	{ 0x08793806, 0, "sound/vox/called.wav" },
+	{ 0x15F147AE, 0, "sound/scientist/sc_sec2_admin2.wav" },
+	{ 0xFA46ABDE, 0, "sprites/rock_small.spr" },
+	{ 0x0E24CC39, 0, "sound/drill/intro02.wav" },
+	{ 0xA3D68EE1, 0, "sound/scientist/okihope.wav" },
+	{ 0xFE47CD89, 0, "servers/serverbrowser_russian.txt" },
+	{ 0x32283098, 0, "sound/houndeye/he_idle3.wav" },
+	{ 0xF904C3F3, 0, "sound/fvox/heat_damage.wav" },
+	{ 0x673C7A96, 0, "gfx/vgui/640_scoreboardtracker.tga" },
+	{ 0x8A62F1C9, 0, "servers/icon_bots_column.tga" },
+	{ 0x656D61D0, 0, "models/mapmodels/sign_shop.mdl" },
+	{ 0x6C83DA15, 0, "sound/scientist/nodoubt.wav" },
+	{ 0x9881FC9E, 0, "sound/garg/gar_idle4.wav" },
+	{ 0x5BD3189F, 0, "sound/items/protect.wav" },
+	{ 0x41E66A7C, 0, "sound/holo/tr_holo_flashlight.wav" },
+	{ 0x019E2B4C, 0, "sprites/mapsprites/water1.spr" },
+	{ 0x99CD680E, 0, "sound/ambience/gerobjectivesecure.wav" },
+	{ 0x25B03671, 0, "sprites/weapon_hornetgun.txt" },
+	{ 0x65EF7F9E, 0, "models/mapmodels/rockgibs.mdl" },
+	{ 0x375C7D32, 0, "sound/vox/null.wav" },
+	{ 0x0408D8DA, 0, "sound/pitworm/pit_worm_alert.wav" },
+	{ 0xD9F0A887, 0, "sound/scientist/beenaburden.wav" },
+	{ 0x9E43A999, 0, "models/w_shotgunt.mdl" },
+	{ 0x2A07FB8E, 0, "sound/sentences/c3a1_1.wav" },
+	{ 0x6A4A8489, 0, "sound/vox/captain.wav" },
+	{ 0x91068D99, 0, "sound/ambience/electrical_hum2.wav" },
+	{ 0x66B82BE3, 0, "sound/drill/dr2_add15.wav" },
+	{ 0x3F3C0AAF, 0, "sound/voltigore/voltigore_idle2.wav" },
+	{ 0x63DB4175, 0, "sound/fgrunt/help.wav" },
+	{ 0xFA5B18DA, 0, "sound/hgrunt/gr_pain4.wav" },
+	{ 0xB4E15539, 0, "sound/fvox/get_rpg.wav" },
+	{ 0x8188AA8B, 0, "sound/weapons/awp_clipin.wav" },
+	{ 0xA720ED83, 0, "maps/dod_jagd.txt" },
+	{ 0x4C520B44, 0, "sound/drill/livefire03.wav" },
+	{ 0xD95CF2D4, 0, "sound/scientist/scream16.wav" },
+	{ 0xD7C49438, 0, "sound/scientist/scream7.wav" },
+	{ 0xF40C8786, 0, "sound/buttons/button10.wav" },
+	{ 0xCC2A4BBB, 0, "sound/sentences/hev_gr6.wav" },
+	{ 0xB8D6F27C, 0, "models/w_c4.mdl" },
+	{ 0x497FCFE5, 0, "sound/vox/over.wav" },
+	{ 0x6D64AB4B, 0, "sound/sentences/ctr8.wav" },
+	{ 0xF1C2DCF9, 0, "sound/tentacle/te_swing1.wav" },
+	{ 0xA0807EEE, 0, "sound/sentences/hg_taunt2.wav" },
+	{ 0x70E10C19, 0, "sound/sentences/hev_aim_off.wav" },
+	{ 0x7A406107, 0, "sound/weapons/elite_fire.wav" },
+	{ 0xEFCDEAC3, 0, "models/w_flashbang.mdl" },
+	{ 0xDD0139E6, 0, "sound/debris/bustglass1.wav" },
+	{ 0x8D9F0488, 0, "sprites/mapsprites/dog1splash08.spr" },
+	{ 0xA852AB8E, 0, "models/otis.mdl" },
+	{ 0xAE9CBF2B, 0, "sound/debris/flesh2.wav" },
+	{ 0xA170D3D2, 0, "sound/ambience/rocketrumble1.wav" },
+	{ 0xDAB92E8F, 0, "gfx/env/jagdft.tga" },
+	{ 0x31A144BF, 0, "models/mapmodels/bulb.mdl" },
+	{ 0x4D6CD653, 0, "sound/sentences/ctr20.wav" },
+	{ 0x72F59DE2, 0, "sound/ambience/zapmachine.wav" },
+	{ 0xF3831CA6, 0, "sound/rosenberg/ro_mortal0.wav" },
+	{ 0xCE6856CD, 0, "sound/fgrunt/yes.wav" },
+	{ 0x3691ACED, 0, "overviews/avanti.tga" },
+	{ 0xEA73751E, 0, "sound/otis/virgin.wav" },
+	{ 0x22B4A272, 0, "sound/weapons/saw_reload2.wav" },
+	{ 0xE03E7440, 0, "sound/vox/juliet.wav" },
+	{ 0x1A640B65, 0, "gfx/env/sky_blu_rt.tga" },
+	{ 0x3210E1B2, 0, "sound/rosenberg/ro_tele_almost2.wav" },
+	{ 0xCFBC922D, 0, "sound/barney/youbet.wav" },
+	{ 0x2A15DFDE, 0, "sprites/effects/ripple.spr" },
+	{ 0x78A76F5D, 0, "models/armour_yt.mdl" },
+	{ 0x02A632EE, 0, "gfx/env/xen9bk.tga" },
+	{ 0x41AD285E, 0, "sound/gonome/gonome_melee1.wav" },
+	{ 0x569C44D7, 0, "sound/sentences/c3a1_2.wav" },
+	{ 0xC6BDE7AC, 0, "models/player/tower/tower.bmp" },
+	{ 0xF5443F27, 0, "resource/background/800_2_c_loading.tga" },
+	{ 0x78E23D29, 0, "sound/scientist/sc_yard_wound2.wav" },
+	{ 0x5C3FD9F4, 0, "sprites/weapons4.spr" },
+	{ 0xA13F089F, 0, "sound/speech/saveme2.wav" },
+	{ 0x822C0829, 0, "sound/fgrunt/killer.wav" },
+	{ 0x7ACE4F9B, 0, "sprites/spark_particle.spr" },
+	{ 0xF4459EC6, 0, "classes/short_random.txt" },
+	{ 0x1BD997C3, 0, "sound/houndeye/he_pain4.wav" },
+	{ 0x83179A14, 0, "gfx/vgui/checked.tga" },
+	{ 0x53B505D2, 0, "sound/weapons/pwrench_hitbod1.wav" },
+	{ 0x80DFA3E3, 0, "sound/vox/hotel.wav" },
+	{ 0xA1EAF1BE, 0, "sound/otis/scar.wav" },
+	{ 0xF65640AE, 0, "sound/scientist/sci_die4.wav" },
+	{ 0x6DEE3335, 0, "sprites/bmp/1expl08.bmp" },
+	{ 0x745C9DAD, 0, "resource/dmc_french.txt" },
+	{ 0x2D996B76, 0, "gfx/env/discbk.bmp" },
+	{ 0x9B4FE437, 0, "sprites/xffloor.spr" },
+	{ 0x06719926, 0, "sound/scientist/sci_fear8.wav" },
+	{ 0x1135AEE4, 0, "sprites/320_logo.spr" },
+	{ 0x665662EB, 0, "sound/scientist/c3a2_sci_3surv.wav" },
+	{ 0x1283DD73, 0, "models/v_fg42.mdl" },
+	{ 0xFA1BEE6B, 0, "sound/barney/ba_shot2.wav" },
+	{ 0x95B3484F, 0, "sound/debris/beamstart9.wav" },
+	{ 0xE4602B8D, 0, "sound/gman/gman_potential.wav" },
+	{ 0xCC4401E8, 0, "models/mapmodels/fireplace_logs1.mdl" },
+	{ 0x25071786, 0, "sound/ambience/birds8.wav" },
+	{ 0xA3BED98C, 0, "overviews/de_train.txt" },
+	{ 0xFCACE0EE, 0, "sound/barney/guyresponsible.wav" },
+	{ 0x2CD72AC4, 0, "sound/garg/gar_die2.wav" },
+	{ 0xB037C1EC, 0, "gfx/env/duskrt.tga" },
+	{ 0xAC926AFF, 0, "sound/squeek/sqk_blast1.wav" },
+	{ 0xDE6CA7F6, 0, "sound/gonome/gonome_idle1.wav" },
+	{ 0x39F3189F, 0, "sprites/glow_ylo.spr" },
+	{ 0xE6AE7FA8, 0, "sound/headcrab/hc_die2.wav" },
+	{ 0xA5B1F8E7, 0, "gfx/env/neb7lf.tga" },
+	{ 0x158DDC70, 0, "models/w_luger.mdl" },
+	{ 0xBD72405F, 0, "sound/sentences/hg_check5.wav" },
+	{ 0xA2CFAD91, 0, "models/w_backpack.mdl" },
+	{ 0xC5B0EB84, 0, "resource/gameui_koreana.txt" },
+	{ 0x640C98C2, 0, "sound/sentences/c2a4_10.wav" },
+	{ 0xA3803BCF, 0, "models/mapmodels/arc_xer_tree2.mdl" },
+	{ 0x46470DBE, 0, "sound/plats/vehicle4.wav" },
+	{ 0xD6BD5271, 0, "sound/scientist/c3a2_sci_1surv.wav" },
+	{ 0xCFF97C29, 0, "models/teleporter.mdl" },
+	{ 0xC5D9C678, 0, "sound/vox/intruder.wav" },
+	{ 0x09BF95F6, 0, "sprites/weapon_tmp.txt" },
+	{ 0x93D002A5, 0, "sound/sentences/c3a2_target.wav" },
+	{ 0x7D739D9D, 0, "classes/long_soldier.txt" },
+	{ 0x696156A2, 0, "models/bullsquidt.mdl" },
+	{ 0xB252CCB8, 0, "sound/otis/ass.wav" },
+	{ 0xAD7BF28C, 0, "sprites/weapon_smokegrenade.txt" },
+	{ 0x94D3750D, 0, "gfx/vgui/crosshair.tga" },
+	{ 0x2F7C5769, 0, "sound/fgrunt/retreat.wav" },
+	{ 0x3C3B9C75, 0, "sprites/effects/adrian/dirt_puff.spr" },
+	{ 0xF8D4821F, 0, "sound/vox/under.wav" },
+	{ 0x0A354469, 0, "sound/buttons/button11.wav" },
+	{ 0x7595D3D4, 0, "sound/scientist/sc_yard_box3.wav" },
+	{ 0x68DA8CE1, 0, "sound/otis/of3a2_ot01.wav" },
+	{ 0x3CAD105C, 0, "sound/ambience/radio_morse.wav" },
+	{ 0x9C34929C, 0, "sprites/mapmarkers/arrow_e.spr" },
+	{ 0x12D96326, 0, "sound/voltigore/voltigore_die3.wav" },
+	{ 0xBAF15ED1, 0, "sound/scientist/sc_power1.wav" },
+	{ 0x1FBE29A2, 0, "sound/hgrunt/heavy!.wav" },
+	{ 0x794E70C7, 0, "sound/ambience/merderet-bridgeaxis.wav" },
+	{ 0xD9236E5D, 0, "gfx/env/dustbowlrt.tga" },
+	{ 0xD02F501C, 0, "resource/icon_slower.tga" },
+	{ 0x5DABF60C, 0, "models/player/helmet/helmet.mdl" },
+	{ 0xB785808C, 0, "sound/scientist/reconsider.wav" },
+	{ 0x5DA2EC5C, 0, "sound/vox/detain.wav" },
+	{ 0xBCFB36DE, 0, "resource/icon_steam.tga" },
+	{ 0xDCFBFB77, 0, "sound/doors/aliendoor3.wav" },
+	{ 0xCA62D567, 0, "models/metalplategibs.mdl" },
+	{ 0xB58A0689, 0, "models/hltv_w_afolder.mdl" },
+	{ 0xF1B08930, 0, "models/player/ctf_barney/ctf_barney.bmp" },
+	{ 0xE2808959, 0, "sprites/dirt_clod.spr" },
+	{ 0x1F375C10, 0, "models/v_desert_eagle.mdl" },
+	{ 0xC900082B, 0, "sound/vox/inside.wav" },
+	{ 0x023FFF73, 0, "models/mapmodels/car021.mdl" },
+	{ 0x44F4C857, 0, "sound/hgrunt/yes.wav" },
+	{ 0xF8694E89, 0, "sound/debris/glass2.wav" },
+	{ 0xD4B00DD7, 0, "gfx/env/alien1ft.tga" },
+	{ 0x43B97DA5, 0, "sound/sentences/power_on.wav" },
+	{ 0x6A373170, 0, "sound/tram/ba_tram8.wav" },
+	{ 0x11EE5C0E, 0, "sprites/bloodspray.spr" },
+	{ 0xDEB4542B, 0, "sound/fvox/administering_medical.wav" },
+	{ 0x31B6085E, 0, "sound/sentences/hev_c18.wav" },
+	{ 0x69210BE4, 0, "sound/hgrunt/team!.wav" },
+	{ 0x5669787C, 0, "sound/gonome/gonome_idle3.wav" },
+	{ 0xBBAA57DE, 0, "models/g_rock.mdl" },
+	{ 0x0F9528A5, 0, "gfx/vgui/t_random.tga" },
+	{ 0x3DC8153D, 0, "servers/serverbrowser_polish.txt" },
+	{ 0xD6E5A881, 0, "gfx/env/alien2up.tga" },
+	{ 0x4479BBE1, 0, "sound/weapons/p90_boltpull.wav" },
+	{ 0xB7B3AA0C, 0, "sprites/hudbmps/tfc_dmsg.bmp" },
+	{ 0xE49EBD5E, 0, "models/w_bar.mdl" },
+	{ 0x231F6FEF, 0, "sound/vox/fire.wav" },
+	{ 0x61480C9F, 0, "sound/ambience/rocket_groan1.wav" },
+	{ 0x43FF1FF4, 0, "sound/hgrunt/some.wav" },
+	{ 0xE05A60A0, 0, "resource/icon_down_default.tga" },
+	{ 0xA4E21E31, 0, "decals.wad" },
+	{ 0xE44E2AC7, 0, "sound/weapons/spike2.wav" },
+	{ 0x18F8F3DC, 0, "models/hassassin.mdl" },
+	{ 0x3BDC52A4, 0, "gfx/vgui/not_available.tga" },
+	{ 0x03683052, 0, "sound/sentences/hev_c21.wav" },
+	{ 0xBD0A8D78, 0, "sound/vox/milli.wav" },
+	{ 0xA22B6EDE, 0, "sound/ambience/alienfazzle1.wav" },
+	{ 0xE67B4607, 0, "sound/barney/noway.wav" },
+	{ 0xA2A35883, 0, "sound/weapons/ric_conc-1.wav" },
+	{ 0x64B9296E, 0, "sprites/640hud8.spr" },
+	{ 0x3EA1DAFF, 0, "sound/vox/illegal.wav" },
+	{ 0xC1BB75A8, 0, "sprites/bmp/tffire10.bmp" },
+	{ 0x824D9F3C, 0, "sound/gonarch/gon_die1.wav" },
+	{ 0x79197C1C, 0, "sound/sentences/hev_heal0.wav" },
+	{ 0xE97313A7, 0, "models/mapmodels/repunzel_sign.mdl" },
+	{ 0x71D659CA, 0, "sound/fgrunt/gr_pain6.wav" },
+	{ 0xC6E9B14E, 0, "gfx/env/alien3up.tga" },
+	{ 0x7AE9E197, 0, "sound/scientist/c3a2_sci_7surv.wav" },
+	{ 0x7755A127, 0, "sound/vox/some.wav" },
+	{ 0x8F274BA1, 0, "sound/debris/metal5.wav" },
+	{ 0x3BF274AD, 0, "sprites/brush2.spr" },
+	{ 0xCA86CB86, 0, "models/p_stick.mdl" },
+	{ 0xAC24A0C5, 0, "gfx/vgui/fonts/1600_primary button text.tga" },
+	{ 0x6D3B08BF, 0, "sound/otis/firepl.wav" },
+	{ 0x1CA1AE33, 0, "gfx/env/neb6lf.bmp" },
+	{ 0xA9C0E884, 0, "sound/barney/imwithyou.wav" },
+	{ 0x0CE0491E, 0, "sound/weapons/hit_water2.wav" },
+	{ 0x076675C3, 0, "sprites/bm1.spr" },
+	{ 0x94B739E5, 0, "sound/sentences/c1a3_8.wav" },
+	{ 0xE78408F2, 0, "sound/player/sprintgrunts.wav" },
+	{ 0xA76FC556, 0, "sound/weapons/whizz9.wav" },
+	{ 0x67BA0B16, 0, "sprites/muz7.spr" },
+	{ 0x290950DF, 0, "sound/ambience/dog1.wav" },
+	{ 0x6CA8E06D, 0, "sound/zombie/claw_strike1.wav" },
+	{ 0x667D519F, 0, "sound/scientist/whatissound.wav" },
+	{ 0x55C17B9C, 0, "models/player/cl_suit/cl_suit.bmp" },
+	{ 0x14DD7601, 0, "sound/sentences/hev_c19.wav" },
+	{ 0xBA664CF3, 0, "sound/barney/ba_die2.wav" },
+	{ 0x4C6E2198, 0, "models/floater.mdl" },
+	{ 0x4458BFBF, 0, "sound/fvox/fifty.wav" },
+	{ 0x1495B3AE, 0, "sound/hgrunt/you!.wav" },
+	{ 0x272BEF14, 0, "models/suit.mdl" },
+	{ 0x255028ED, 0, "sound/sentences/hev_3p.wav" },
+	{ 0x311724F4, 0, "sound/vox/centi.wav" },
+	{ 0x83E4BB1C, 0, "sound/ambience/des_wind1.wav" },
+	{ 0xC369E46F, 0, "sound/ambience/breather.wav" },
+	{ 0x813956D0, 0, "models/p_nail.mdl" },
+	{ 0x3419780D, 0, "sound/weapons/ammopickup.wav" },
+	{ 0x5D1E9BF6, 0, "sound/sentences/na18.wav" },
+	{ 0xCB90D021, 0, "sound/fgrunt/intro_fg09.wav" },
+	{ 0x1F2CBC58, 0, "sound/weapons/bazookareloadrocketin.wav" },
+	{ 0x6D34DB77, 0, "models/uplant2.mdl" },
+	{ 0x6B649131, 0, "sound/weapons/sniper_reload3.wav" },
+	{ 0x56D6192C, 0, "maps/cs_office.txt" },
+	{ 0x48D6C416, 0, "sprites/comp_a02.spr" },
+	{ 0x67E1CB55, 0, "sound/barney/ba_canal_wound1.wav" },
+	{ 0x121BBE2E, 0, "gfx/env/neb2bdn.tga" },
+	{ 0x32B417D3, 0, "sound/player/pl_duct3.wav" },
+	{ 0xA508A094, 0, "gfx/env/city1bk.tga" },
+	{ 0xC5C8EF23, 0, "sound/player/bhit_flesh-3.wav" },
+	{ 0xED925692, 0, "gfx/env/dustbowldn.bmp" },
+	{ 0x3EB6F51B, 0, "sound/vox/override.wav" },
+	{ 0xB95B3875, 0, "sound/barney/c2a1_ba_hub2a.wav" },
+	{ 0x0B8025FE, 0, "sound/fvox/get_tripmine.wav" },
+	{ 0x7D010631, 0, "sound/vox/uniform.wav" },
+	{ 0xA43CBEFA, 0, "sound/drill/dr2_add16.wav" },
+	{ 0xEA4C26E8, 0, "sound/hgrunt/boop.wav" },
+	{ 0x085B843B, 0, "sound/player/brityessir.wav" },
+	{ 0xC0BF76CD, 0, "gfx/vgui/awp.tga" },
+	{ 0x3469E78D, 0, "gfx/env/grnplsntdn.tga" },
+	{ 0x0C93D0E5, 0, "sound/ambience/fd_factory.wav" },
+	{ 0xF6B6F2B6, 0, "sound/scientist/tr _sci_use.wav" },
+	{ 0xDF12314B, 0, "sound/weapons/knife_hit3.wav" },
+	{ 0xE0291A7E, 0, "servers/icon_bots.tga" },
+	{ 0xE8431C25, 0, "resource/gameui_schinese.txt" },
+	{ 0xDF33A671, 0, "gfx/detail/merd_dirt.tga" },
+	{ 0x810EDA6D, 0, "models/scientist06.mdl" },
+	{ 0x0D03378F, 0, "sprites/defuser.spr" },
+	{ 0xEA8F9CD3, 0, "models/mapmodels/railing_turoko.mdl" },
+	{ 0x18A969F7, 0, "sound/sentences/hev_v1.wav" },
+	{ 0xEB77EA2A, 0, "resource/logo_game.tga" },
+	{ 0xF02DBE99, 0, "sound/vox/d.wav" },
+	{ 0xA758F780, 0, "sprites/camera.spr" },
+	{ 0xDD86CC8B, 0, "models/presentlg.mdl" },
+	{ 0xE9C1CDAD, 0, "sprites/mapsprites/tracers01.spr" },
+	{ 0xF26636C6, 0, "sound/hgrunt/zone.wav" },
+	{ 0xA4086480, 0, "gfx/env/dmcwrt.tga" },
+	{ 0xCDE97AD6, 0, "sound/ambience/creak.wav" },
+	{ 0x1EB6CE7F, 0, "sound/scientist/donuteater.wav" },
+	{ 0x8A052774, 0, "sound/turret/tu_active2.wav" },
+	{ 0x8D071257, 0, "models/w_crossbow.mdl" },
+	{ 0xEDE2B776, 0, "sound/voltigore/voltigore_footstep1.wav" },
+	{ 0xF13D13A9, 0, "sound/scientist/c3a2_sci_1glu.wav" },
+	{ 0xF133D5C9, 0, "sound/sentences/c2a4_8.wav" },
+	{ 0x9F7E527A, 0, "models/w_egon.mdl" },
+	{ 0x81D09DAA, 0, "resource/warning.wav" },
+	{ 0x069CF139, 0, "sound/otis/leavealone.wav" },
+	{ 0x422F858A, 0, "sprites/explode2.spr" },
+	{ 0x3953D0FA, 0, "models/mapmodels/big_water_tower.mdl" },
+};
+
+static const char* const manifest_dirs[] = {
+	NULL,
+};
\ No newline at end of file
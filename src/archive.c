@@ -2,21 +2,95 @@
 #include <stdio.h>
 #include <assert.h>
 #include <stdlib.h>
+#include <ctype.h>
 
 #include "common.h"
 #include "bsp.h"
 #include "token.h"
 #include "archive.h"
+#include "compress.h"
+#include "depcache.h"
+#include "diskcache.h"
+#include "exclude.h"
+#include "fileindex.h"
+#include "mdl.h"
+#include "wad.h"
 
 #pragma warning(push, 0)  
 #include "tinydir.h"
 #include "miniz.h"
 #pragma warning(pop)
 
-extern hash_table* exclude_table;
-static char** dependency_list = NULL;
+typedef struct archive_job {
+	char bspname[MAX_PATH];
+	const char** dependency_list;
+	string_set dependency_set;
+	arena dependency_arena;
+	size_t base_dependencies;
+	const char** inputs;
+	const char** wads;
+	char* textures;
+	size_t textures_len;
+	char* log;
+} archive_job;
 
-static char bspname[MAX_PATH] = {0};
+// per-map output is buffered and printed once the map is done
+#define job_printf(job, ...) buf_printf((job)->log, __VA_ARGS__)
+
+// the files a model names, parsed once per run however many maps use it
+typedef struct model_deps {
+	char* name;
+	char** deps;
+} model_deps;
+
+static mutex_t print_lock;
+static mutex_t map_lock;
+static mutex_t model_lock;
+static hash_map model_cache;
+static model_deps** model_list = NULL;
+
+// the textures a wad provides, read once per run, names are upper case
+typedef struct wad_textures {
+	char* name;
+	string_set textures;
+	arena names;
+} wad_textures;
+
+static mutex_t wad_lock;
+static hash_map wad_cache;
+static wad_textures** wad_list = NULL;
+
+// which of a map's wads supply the textures it doesn't embed
+typedef struct wad_selection {
+	const wad_textures** wads;
+	bool* used;
+	bool keep_all;
+} wad_selection;
+
+// the lumps a trimmed wad keeps, wads are the map's in the order they're searched
+typedef struct wad_trim {
+	const wad_textures** wads;
+	const wad_textures* wad;
+	string_set textures;
+	string_set kept;
+	arena names;
+	wadlump* lumps;
+} wad_trim;
+// sentences.txt, read once per run the first time a map names a sentence,
+// names are lower case to match normalized entity values
+#define SENTENCES_PATH "sound/sentences.txt"
+
+static mutex_t sentence_lock;
+// names are interned so names whose hashes collide each keep their own words,
+// the words are keyed by the address of the interned name
+static string_set sentence_set;
+static hash_map sentence_map;
+static arena sentence_names;
+static bool sentences_loaded = false;
+
+static char** map_list = NULL;
+static size_t next_map = 0;
+static size_t maps_done = 0;
 
 static const char* const formats[] = {
 	".mdl",
@@ -65,13 +139,21 @@ bool is_speak_key(const char* key) {
 	return false;
 }
 
-bool normalize_value(char* value) {
+static void job_flush(archive_job* job) {
+	if (buf_len(job->log)) {
+		fwrite(job->log, sizeof(char), buf_len(job->log), stdout);
+		fflush(stdout);
+		buf_clear(job->log);
+	}
+}
+
+bool normalize_value(archive_job* job, char* value) {
 	assert(value != NULL);
 
 	while (*value) {
 		if(*value & 0x80) {
 			if (g_verbose) {
-				printf("Unsupported character found in entity %c - skipping dependency check\n", *value);
+				job_printf(job, "Unsupported character found in entity %c - skipping dependency check\n", *value);
 			}
 			return false;
 		}
@@ -84,38 +166,176 @@ bool normalize_value(char* value) {
 	return true;
 }
 
-void add_dependency(const char* value) {
-	for (size_t i = 0; i < buf_len(dependency_list); ++i) {
-		if (strcmp(dependency_list[i], value) == 0)
+void add_dependency(archive_job* job, const char* value) {
+	bool added;
+	const char* dependency = strset_intern(&job->dependency_set, &job->dependency_arena, value, &added);
+	if (!added)
+		return;
+
+	buf_push(job->dependency_list, dependency);
+	if (g_verbose) {
+		job_printf(job, "[%s.bsp] dependency: %s\n", job->bspname, value);
+	}
+}
+
+// a file read to find more dependencies, the cached list is invalid once it changes
+void add_input(archive_job* job, const char* name) {
+	for (size_t i = 0; i < buf_len(job->inputs); ++i) {
+		if (path_equal(job->inputs[i], name))
 			return;
 	}
-	buf_push(dependency_list, strdup(value));
-	if (g_verbose) {
-		printf("[%s.bsp] dependency: %s\n", bspname, value);
+	size_t len = strlen(name) + 1;
+	char* input = arena_alloc(&job->dependency_arena, len);
+	memcpy(input, name, len);
+	buf_push(job->inputs, input);
+}
+
+// the wads of the wad key are held back until the textures show which are needed
+static void add_wad(archive_job* job, const char* name) {
+	for (size_t i = 0; i < buf_len(job->wads); ++i) {
+		if (path_equal(job->wads[i], name))
+			return;
 	}
+	size_t len = strlen(name) + 1;
+	char* wad = arena_alloc(&job->dependency_arena, len);
+	memcpy(wad, name, len);
+	buf_push(job->wads, wad);
 }
 
-void free_dependency_list() {
-	if (dependency_list) {
-		size_t ndeps = buf_len(dependency_list);
-		for (size_t i = 0; i < ndeps; ++i) {
-			if (dependency_list[i]) {
-				free(dependency_list[i]);
-				dependency_list[i] = NULL;
-			}
+void free_dependency_list(archive_job* job) {
+	buf_clear(job->dependency_list);
+	buf_clear(job->inputs);
+	buf_clear(job->wads);
+	free(job->textures);
+	job->textures = NULL;
+	job->textures_len = 0;
+	strset_clear(&job->dependency_set);
+	arena_reset(&job->dependency_arena);
+}
+
+// files in a pak are already mapped, anything else is mapped until its entry is written
+bool read_dependency(archive_job* job, const index_entry* entry, mapped_file* file, const void** data, size_t* len) {
+	if (entry->pak) {
+		*data = pak_data(entry->pak, entry->offset);
+		*len = (size_t)entry->info.size;
+		return true;
+	}
+	if (!map_file(entry->path, file)) {
+		job_printf(job, "Error reading file %s\n", entry->path);
+		return false;
+	}
+	*data = file->data;
+	*len = file->size;
+	return true;
+}
+
+static char* copy_name(arena* names, const char* str, size_t len) {
+	char* copy = arena_alloc(names, len + 1);
+	memcpy(copy, str, len);
+	copy[len] = 0;
+	return copy;
+}
+
+// one sentence per line, its name and then its words, the first of a name wins
+static void load_sentences(archive_job* job) {
+	const index_entry* entry = fileindex_find(SENTENCES_PATH);
+	mapped_file file = { 0 };
+	const void* data;
+	size_t len;
+	if (!entry || !read_dependency(job, entry, &file, &data, &len))
+		return;
+
+	const char* next = (const char*)data;
+	const char* end = next + len;
+	while (next < end) {
+		const char* line = next;
+		const char* eol = memchr(line, '\n', end - line);
+		if (!eol) {
+			eol = end;
+		}
+		next = eol + 1;
+
+		while (line < eol && isspace((unsigned char)*line)) {
+			line++;
+		}
+		while (eol > line && isspace((unsigned char)eol[-1])) {
+			eol--;
+		}
+		if (line == eol || (eol - line >= 2 && line[0] == '/' && line[1] == '/'))
+			continue;
+
+		const char* words = line;
+		while (words < eol && !isspace((unsigned char)*words)) {
+			words++;
 		}
-		buf_clear(dependency_list);
+		size_t name_len = words - line;
+		while (words < eol && isspace((unsigned char)*words)) {
+			words++;
+		}
+		if (words == eol)
+			continue;
+
+		char name[MAX_PATH];
+		if (name_len >= MAX_PATH)
+			continue;
+		for (size_t i = 0; i < name_len; ++i) {
+			name[i] = (char)tolower((unsigned char)line[i]);
+		}
+		name[name_len] = 0;
+
+		bool added;
+		const char* interned = strset_intern(&sentence_set, &sentence_names, name, &added);
+		if (!added)
+			continue;
+		hashmap_put(&sentence_map, (uint64_t)(uintptr_t)interned, copy_name(&sentence_names, words, eol - words));
+	}
+	unmap_file(&file);
+}
+
+static const char* find_sentence(archive_job* job, const char* name) {
+	mutex_lock(&sentence_lock);
+	if (!sentences_loaded) {
+		load_sentences(job);
+		sentences_loaded = true;
 	}
+	mutex_unlock(&sentence_lock);
+
+	const char* interned = strset_find(&sentence_set, name);
+	return interned ? hashmap_get(&sentence_map, (uint64_t)(uintptr_t)interned) : NULL;
 }
 
-void parse_sentence(const char* sentence) {
+static void free_sentences(void) {
+	strset_free(&sentence_set);
+	hashmap_free(&sentence_map);
+	arena_free(&sentence_names);
+	sentences_loaded = false;
+}
+
+void parse_sentence(archive_job* job, char* sentence) {
 	assert(sentence != NULL);
-	if (sentence && sentence[0] != '!' && sentence[0] != '#') {
+	// a named sentence is parsed as the words sentences.txt gives it
+	if (sentence[0] == '!') {
+		add_input(job, SENTENCES_PATH);
+		const char* words = find_sentence(job, sentence + 1);
+		if (!words || words[0] == '!') {
+			if (g_verbose) {
+				job_printf(job, "[%s.bsp] unknown sentence: %s\n", job->bspname, sentence + 1);
+			}
+			return;
+		}
+		char* copy = strdup(words);
+		if (normalize_value(job, copy)) {
+			parse_sentence(job, copy);
+		}
+		free(copy);
+		return;
+	}
+	if (sentence[0] != '#') {
 		char dep_path[MAX_PATH] = "sound/";
 
 		size_t sentence_len = strlen(sentence);
 		if (strstr(sentence, ".wav") - sentence == sentence_len - 4) {
-			add_dependency(sentence);
+			add_dependency(job, sentence);
 			return;
 		}
 
@@ -146,28 +366,31 @@ void parse_sentence(const char* sentence) {
 
 		size_t end_dep_len = strlen(dep_path);
 
-		char* token = strtok(start, " ");
+		char* context = NULL;
+		char* token = strtok_r(start, " ", &context);
 		while (token) {
 			dep_path[end_dep_len] = 0;
 			strcat(dep_path, token);
 			strcat(dep_path, ".wav");
-			add_dependency(dep_path);
-			token = strtok(NULL, " ");
+			add_dependency(job, dep_path);
+			token = strtok_r(NULL, " ", &context);
 		}
 	}
 }
 
-void parse_bsp_ent_value(char* key, char* value) {
-	static char temp[ENT_MAX_VALUE];
+void parse_bsp_ent_value(void* user, char* key, char* value) {
+	archive_job* job = (archive_job*)user;
+	char temp[ENT_MAX_VALUE];
 	temp[0] = 0;
 
+	assert(job != NULL);
 	assert(key != NULL);
 	assert(value != NULL);
 	if (!value[0]) return;
 
-	if (!normalize_value(value)) {
+	if (!normalize_value(job, value)) {
 		if(g_verbose) {
-			printf("Error normalizing value with key '%s'\n", key);
+			job_printf(job, "Error normalizing value with key '%s'\n", key);
 		}
 		return;
 	}
@@ -181,7 +404,7 @@ void parse_bsp_ent_value(char* key, char* value) {
 		while (side_len--) {
 			temp[len] = 0;
 			strcat(temp, gfx_sides[side_len]);
-			add_dependency(temp);
+			add_dependency(job, temp);
 		}
 	}
 	else if (strcasecmp(key, "wad") == 0) {
@@ -190,59 +413,218 @@ void parse_bsp_ent_value(char* key, char* value) {
 			last_path++;
 			extension = strrchr(last_path, '.');
 			if (valid_resource_format(extension)) {
-				add_dependency(last_path);
+				add_wad(job, last_path);
 			}
 		}
 	}
 	else if (is_speak_key(key)) {
-		parse_sentence(value);
+		parse_sentence(job, value);
+	}
+	// entities don't come with their class, but only ambient_generic plays a sentence from its message
+	else if (strcasecmp(key, "message") == 0 && value[0] == '!') {
+		parse_sentence(job, value);
 	}
 	else if (extension) {
 		if (valid_resource_format(extension)) {
 			if (strcmp(extension, ".wav") == 0) {
 				strcat(temp, "sound/");
 				strcat(temp, value);
-				add_dependency(temp);
+				add_dependency(job, temp);
 			}
 			else {
-				add_dependency(value);
+				add_dependency(job, value);
 			}
 		}
 	}
 }
 
-bool read_dependency(const char* path, void** data, size_t* data_len) {
-	bool success = true;
-	FILE* fp = fopen(path, "rb");
-	if (fp == NULL) {
-		if (g_verbose) {
-			printf("[%s.bsp] missing dependency: %s\n", bspname, path);
+static void free_model(model_deps* model) {
+	for (size_t i = 0; i < buf_len(model->deps); ++i) {
+		free(model->deps[i]);
+	}
+	buf_free(model->deps);
+	free(model->name);
+	free(model);
+}
+
+static void add_model_dependency(void* user, const char* dependency) {
+	model_deps* model = (model_deps*)user;
+	buf_push(model->deps, strdup(dependency));
+}
+
+static const model_deps* read_model(archive_job* job, const char* name) {
+	uint64_t key = hash_path(name);
+	mutex_lock(&model_lock);
+	model_deps* model = hashmap_get(&model_cache, key);
+	mutex_unlock(&model_lock);
+	if (model && path_equal(model->name, name))
+		return model;
+
+	model = xmalloc(sizeof(model_deps));
+	model->name = strdup(name);
+	model->deps = NULL;
+	const index_entry* entry = fileindex_find(name);
+	mapped_file file = { 0 };
+	const void* data;
+	size_t len;
+	if (entry && read_dependency(job, entry, &file, &data, &len)) {
+		mdl_read_dependencies(data, len, name, add_model_dependency, model);
+		unmap_file(&file);
+	}
+
+	// another map may have parsed it meanwhile, the first one in is kept
+	mutex_lock(&model_lock);
+	model_deps* existing = hashmap_get(&model_cache, key);
+	if (existing && path_equal(existing->name, name)) {
+		free_model(model);
+		model = existing;
+	}
+	else {
+		if (!existing) {
+			hashmap_put(&model_cache, key, model);
 		}
-		success = false;
-		goto exit;
+		buf_push(model_list, model);
 	}
-	
-	fseek(fp, 0, SEEK_END);
-	const size_t size = ftell(fp);
-	fseek(fp, 0, SEEK_SET);
-	
-	*data = (void*)xmalloc(size + 1);
-	*data_len = size;
+	mutex_unlock(&model_lock);
+	return model;
+}
 
-	if(fread((void*)*data, sizeof(char), size, fp) != size) {
-		printf("Error reading file %s\n", path);
-		*data = NULL;
-		*data_len = 0;
-		success = false;
-		goto exit;
+// models name more files, so the list grows while it's walked
+static void add_model_dependencies(archive_job* job) {
+	for (size_t i = job->base_dependencies; i < buf_len(job->dependency_list); ++i) {
+		const char* dep = job->dependency_list[i];
+		size_t len = strlen(dep);
+		if (len < 4 || strcasecmp(dep + len - 4, ".mdl") != 0)
+			continue;
+
+		add_input(job, dep);
+		const model_deps* model = read_model(job, dep);
+		for (size_t j = 0; j < buf_len(model->deps); ++j) {
+			add_dependency(job, model->deps[j]);
+		}
 	}
-exit:
-	if (fp) fclose(fp);
-	return success;
 }
 
-char* get_full_path(const char* dependency, const char* gamedir) {
-	static char full_path[MAX_PATH];
+static void upper_name(char* dest, const char* name) {
+	size_t i = 0;
+	for (; name[i] && i < WAD_NAME_LENGTH; ++i) {
+		dest[i] = (char)toupper((unsigned char)name[i]);
+	}
+	dest[i] = 0;
+}
+
+static void add_wad_texture(void* user, const wadlump* lump, const char* name) {
+	wad_textures* wad = (wad_textures*)user;
+	char upper[WAD_NAME_LENGTH + 1];
+	if (lump->type == WAD_TYPE_MIPTEX) {
+		upper_name(upper, name);
+		strset_intern(&wad->textures, &wad->names, upper, NULL);
+	}
+}
+
+static void free_wad(wad_textures* wad) {
+	strset_free(&wad->textures);
+	arena_free(&wad->names);
+	free(wad->name);
+	free(wad);
+}
+
+static const wad_textures* read_wad(archive_job* job, const char* name) {
+	uint64_t key = hash_path(name);
+	mutex_lock(&wad_lock);
+	wad_textures* wad = hashmap_get(&wad_cache, key);
+	mutex_unlock(&wad_lock);
+	if (wad && path_equal(wad->name, name))
+		return wad;
+
+	wad = xmalloc(sizeof(wad_textures));
+	memset(wad, 0, sizeof(wad_textures));
+	wad->name = strdup(name);
+	const index_entry* entry = fileindex_find(name);
+	mapped_file file = { 0 };
+	const void* data;
+	size_t len;
+	if (entry && read_dependency(job, entry, &file, &data, &len)) {
+		wad_read_lumps(data, len, add_wad_texture, wad);
+		unmap_file(&file);
+	}
+
+	mutex_lock(&wad_lock);
+	wad_textures* existing = hashmap_get(&wad_cache, key);
+	if (existing && path_equal(existing->name, name)) {
+		free_wad(wad);
+		wad = existing;
+	}
+	else {
+		if (!existing) {
+			hashmap_put(&wad_cache, key, wad);
+		}
+		buf_push(wad_list, wad);
+	}
+	mutex_unlock(&wad_lock);
+	return wad;
+}
+
+// like the engine, a texture comes from the first listed wad that has it
+static void use_texture(void* user, const char* name) {
+	wad_selection* selection = (wad_selection*)user;
+	char upper[WAD_NAME_LENGTH + 1];
+	upper_name(upper, name);
+	for (size_t i = 0; i < buf_len(selection->wads); ++i) {
+		if (strset_find(&selection->wads[i]->textures, upper)) {
+			selection->used[i] = true;
+			return;
+		}
+	}
+	selection->keep_all = true;
+}
+
+// a wad is only archived if the map takes a texture from it, all of them are if any texture isn't found
+static void add_wad_dependencies(archive_job* job, const char* textures, size_t textures_len) {
+	size_t nwads = buf_len(job->wads);
+	if (nwads == 0)
+		return;
+
+	wad_selection selection = { 0 };
+	selection.used = xcalloc(nwads, sizeof(bool));
+	for (size_t i = 0; i < nwads; ++i) {
+		add_input(job, job->wads[i]);
+		buf_push(selection.wads, read_wad(job, job->wads[i]));
+	}
+	if (fileindex_count() == 0 || !textures ||
+		!bsp_read_external_textures(textures, textures_len, use_texture, &selection)) {
+		selection.keep_all = true;
+	}
+
+	for (size_t i = 0; i < nwads; ++i) {
+		if (selection.keep_all || selection.used[i]) {
+			add_dependency(job, job->wads[i]);
+		}
+		else if (g_verbose) {
+			job_printf(job, "[%s.bsp] unused wad: %s\n", job->bspname, job->wads[i]);
+		}
+	}
+	buf_free(selection.wads);
+	free(selection.used);
+}
+
+static void free_wads(void) {
+	for (size_t i = 0; i < buf_len(wad_list); ++i) {
+		free_wad(wad_list[i]);
+	}
+	buf_free(wad_list);
+	hashmap_free(&wad_cache);
+}
+
+static void free_models(void) {
+	for (size_t i = 0; i < buf_len(model_list); ++i) {
+		free_model(model_list[i]);
+	}
+	buf_free(model_list);
+	hashmap_free(&model_cache);
+}
+
+char* get_full_path(char* full_path, const char* dependency, const char* gamedir) {
 	full_path[0] = 0;
 	
 	strcat(full_path, gamedir);
@@ -256,38 +638,380 @@ char* get_full_path(const char* dependency, const char* gamedir) {
 	return full_path;
 }
 
-char* get_full_dl_path(const char* dependency, const char* gamedir) {
-	static char dl_path[MAX_PATH];
-	dl_path[0] = 0;
+// the search paths are indexed once per run so only dependencies that exist touch the disk
+const index_entry* resolve_dependency(archive_job* job, const char* dependency) {
+	const index_entry* entry = fileindex_find(dependency);
+	if (!entry && g_verbose) {
+		job_printf(job, "[%s.bsp] missing dependency: %s\n", job->bspname, dependency);
+	}
+	return entry;
+}
 
-	strcat(dl_path, gamedir);
-	strcat(dl_path, "_downloads");
-	if (*dependency != '/' && *dependency != '\\') {
-		strcat(dl_path, "/");
+// a stock name only counts as stock when the bytes match too, if the rule has a hash
+static bool is_stock_file(archive_job* job, const char* dependency, uint64_t stock_content) {
+	if (!stock_content)
+		return true;
+
+	uint64_t content;
+	const index_entry* entry = fileindex_find(dependency);
+	if (!entry || (fileindex_content(entry, &content) && content == stock_content))
+		return true;
+
+	if (g_verbose) {
+		job_printf(job, "[%s.bsp] keeping modified stock file: %s\n", job->bspname, dependency);
+	}
+	return false;
+}
+
+// the manifest is printed as an exclusion list, errors go in it as comments
+static const char* index_error_prefix = "";
+
+// the files the index couldn't read, printed once its threads are done
+static void print_index_errors(void) {
+	char** errors = fileindex_take_errors();
+	for (size_t i = 0; i < buf_len(errors); ++i) {
+		printf("%sError reading file %s\n", index_error_prefix, errors[i]);
+		free(errors[i]);
+	}
+	buf_free(errors);
+}
+
+static bool scan_gamedir(const char* gamedir) {
+	bool found = fileindex_mount(gamedir, g_threads);
+	print_index_errors();
+	if (!found) {
+		printf("No files found in game directory: %s\n", gamedir);
+		return false;
+	}
+	if (g_snapshot) {
+		fileindex_hash_all(g_threads);
+		print_index_errors();
+		if (!fileindex_save(g_snapshot)) {
+			printf("Error writing snapshot: %s\n", g_snapshot);
+		}
+	}
+	return true;
+}
+
+// a snapshot stands in for the scan, it's written on the first run and whenever a pak changed
+static bool index_gamedir(const char* gamedir) {
+	double start = time_now();
+	bool loaded = false;
+	if (g_snapshot && is_valid_file(g_snapshot)) {
+		loaded = fileindex_load(g_snapshot, gamedir);
+		if (!loaded) {
+			printf("Snapshot is out of date, rescanning: %s\n", g_snapshot);
+		}
+	}
+	if (!loaded && !scan_gamedir(gamedir))
+		return false;
+
+	if (g_verbose) {
+		for (int i = 0; i < fileindex_root_count(); ++i) {
+			printf("Search path: %s\n", fileindex_root(i));
+		}
+		for (size_t i = 0; i < fileindex_pak_count(); ++i) {
+			const pak_archive* pak = fileindex_pak(i);
+			printf("Mounted pak: %s (%llu files)\n", pak->path, (unsigned long long)pak->count);
+		}
+		printf("%s %llu files in %.2fs\n", loaded ? "Loaded snapshot of" : "Indexed", (unsigned long long)fileindex_count(), time_now() - start);
+	}
+	return true;
+}
+
+// the resolved files with their hashes, in the format of the exclusion manifest
+int archive_print_manifest(const char* gamedir) {
+	index_error_prefix = "// ";
+	if (!index_gamedir(gamedir))
+		return EXIT_FAILURE;
+	fileindex_hash_all(g_threads);
+	print_index_errors();
+
+	const index_entry** entries = fileindex_resolved();
+	printf("// %s manifest generated by bsparchive (https://github.com/clintonbale/bsparchive)\n", gamedir);
+	for (size_t i = 0; i < buf_len(entries); ++i) {
+		const index_entry* entry = entries[i];
+		if (!entry->hashed)
+			continue;
+		printf("\"");
+		for (const char* c = entry->name; *c; ++c) {
+			putchar(*c == '\\' ? '/' : *c);
+		}
+		printf("\", 0x%016llX,\n", (unsigned long long)entry->content);
+	}
+	buf_free(entries);
+	fileindex_free();
+	free_models();
+	free_wads();
+	free_sentences();
+	return EXIT_SUCCESS;
+}
+
+// the archive comment holds a fingerprint of everything that went into the archive
+#define FINGERPRINT_PREFIX "bsparchive:"
+#define FINGERPRINT_LENGTH (sizeof(FINGERPRINT_PREFIX) - 1 + 16)
+
+static void format_fingerprint(char* text, uint64_t fingerprint) {
+	snprintf(text, FINGERPRINT_LENGTH + 1, FINGERPRINT_PREFIX "%016llx", (unsigned long long)fingerprint);
+}
+
+// each entry's comment fingerprints where its file was read from and how it was compressed
+static void format_source(char* text, const index_entry* entry, int level, bool trimmed) {
+	uint64_t hash = hash_bytes(entry->path, strlen(entry->path) + 1, HASH_SEED);
+	hash = hash_bytes(&entry->offset, sizeof(entry->offset), hash);
+	hash = hash_bytes(&level, sizeof(level), hash);
+	hash = hash_bytes(&trimmed, sizeof(trimmed), hash);
+	format_fingerprint(text, hash);
+}
+
+// entries are stamped with their file's mtime so a later update can tell whether it changed
+static bool zip_add_blob(mz_zip_archive* archive, const char* name, const zip_blob* blob, const void* data, const file_info* info, const char* source) {
+	MZ_TIME_T mtime = (MZ_TIME_T)info->mtime;
+	mz_uint16 source_len = (mz_uint16)strlen(source);
+	if (blob->level == 0) {
+		return mz_zip_writer_add_mem_ex_v2(archive, name, data, (size_t)blob->uncomp_size, source, source_len, 0, 0, 0, &mtime, NULL, 0, NULL, 0);
+	}
+	return mz_zip_writer_add_mem_ex_v2(archive, name, blob->data, blob->size, source, source_len, blob->level | MZ_ZIP_FLAG_COMPRESSED_DATA, blob->uncomp_size, blob->crc, &mtime, NULL, 0, NULL, 0);
+}
+
+// dos times only keep every other second, and an entry read from another file or compressed
+// under another policy is never reused
+static bool is_unchanged(mz_zip_archive* previous, int index, const char* dep_name, const index_entry* entry) {
+	mz_zip_archive_file_stat stat;
+	if (!mz_zip_reader_file_stat(previous, (mz_uint)index, &stat) || stat.m_is_directory)
+		return false;
+	char source[FINGERPRINT_LENGTH + 1];
+	format_source(source, entry, compress_level(dep_name), false);
+	if (stat.m_comment_size != strlen(source) || memcmp(stat.m_comment, source, stat.m_comment_size) != 0)
+		return false;
+	int64_t delta = entry->info.mtime - (int64_t)stat.m_time;
+	return stat.m_uncomp_size == entry->info.size && delta >= 0 && delta <= 1;
+}
+
+// huge files are deflated from disk a chunk at a time so memory stays bounded regardless of their size
+static bool archive_streamed(archive_job* job, mz_zip_archive* archive, const char* dep_name, const index_entry* entry) {
+	// files in a pak are streamed from their offset in it
+	const char* path = entry->pak ? entry->pak->path : entry->path;
+	FILE* fp = fopen(path, "rb");
+	if (!fp) {
+		job_printf(job, "Error reading file %s\n", path);
+		return false;
+	}
+
+	bool success = false;
+	zip_blob blob = { 0 };
+	char source[FINGERPRINT_LENGTH + 1];
+	format_source(source, entry, compress_level(dep_name), false);
+	blob.level = compress_file_level(fp, entry->offset, entry->info.size, compress_level(dep_name));
+	if (fseeko(fp, (int64_t)entry->offset, SEEK_SET) != 0) {
+		job_printf(job, "Error reading file %s\n", path);
+		goto exit;
+	}
+	double start = time_now();
+	MZ_TIME_T mtime = (MZ_TIME_T)entry->info.mtime;
+	if (!mz_zip_writer_add_cfile(archive, dep_name, fp, entry->info.size, &mtime, source, (mz_uint16)strlen(source), (mz_uint)blob.level, NULL, 0, NULL, 0)) {
+		job_printf(job, "Error adding file to archive: %s, %s\n", dep_name, mz_zip_get_error_string(archive->m_last_error));
+		goto exit;
+	}
+
+	mz_zip_archive_file_stat stat;
+	if (mz_zip_reader_file_stat(archive, archive->m_total_files - 1, &stat)) {
+		blob.size = (size_t)stat.m_comp_size;
+		blob.uncomp_size = stat.m_uncomp_size;
+		compress_record(dep_name, &blob, time_now() - start, false);
+	}
+	success = true;
+exit:
+	fclose(fp);
+	return success;
+}
+
+// files are deflated once and reused from the disk cache, files shared between maps from the run cache too
+bool archive_dependency(archive_job* job, mz_zip_archive* archive, const char* dep_name, const index_entry* entry, bool shared) {
+	if (compress_streamed(entry->info.size))
+		return archive_streamed(job, archive, dep_name, entry);
+
+	const char* path = entry->path;
+	const file_info* info = &entry->info;
+	const int level = compress_level(dep_name);
+	const uint64_t key = blob_key(path, info, level);
+	const zip_blob* cached = NULL;
+	zip_blob blob = { 0 };
+	bool have_blob = false;
+	bool compressed = false;
+	double seconds = 0.0;
+	mapped_file file = { 0 };
+	const void* data = NULL;
+	size_t data_len = 0;
+	bool success = false;
+	bool cacheable = true;
+
+	if (shared) {
+		cached = blobcache_get(key);
+	}
+	if (!cached) {
+		have_blob = diskcache_find(key, info, level, &blob);
+	}
+
+	// stored entries still need the file contents
+	const zip_blob* found = cached ? cached : (have_blob ? &blob : NULL);
+	if (!found || found->level == 0) {
+		if (!read_dependency(job, entry, &file, &data, &data_len))
+			goto exit;
+		// a changed file between the stat and the read must not be cached under the old key
+		cacheable = data_len == info->size;
+	}
+
+	if (!found) {
+		uint64_t content = 0;
+		if (cacheable && diskcache_enabled()) {
+			content = hash_content(data, data_len);
+			have_blob = diskcache_find_content(key, info, content, level, &blob);
+		}
+		if (!have_blob) {
+			double start = time_now();
+			if (!compress_blob(data, data_len, level, &blob)) {
+				job_printf(job, "Error compressing file: %s\n", dep_name);
+				goto exit;
+			}
+			seconds = time_now() - start;
+			have_blob = compressed = true;
+			if (cacheable && diskcache_enabled()) {
+				diskcache_store(key, info, content, level, &blob);
+			}
+		}
+	}
+	if (have_blob && shared && cacheable) {
+		cached = blobcache_put(key, &blob);
+	}
+
+	char source[FINGERPRINT_LENGTH + 1];
+	format_source(source, entry, level, false);
+	found = cached ? cached : &blob;
+	if (!zip_add_blob(archive, dep_name, found, data, info, source)) {
+		job_printf(job, "Error adding file to archive: %s, %s\n", dep_name, mz_zip_get_error_string(archive->m_last_error));
+		goto exit;
+	}
+	compress_record(dep_name, found, seconds, !compressed);
+	success = true;
+exit:
+	free_blob(&blob);
+	unmap_file(&file);
+	return success;
+}
+
+static bool is_wad(const char* name) {
+	size_t len = strlen(name);
+	return len >= 4 && strcasecmp(name + len - 4, ".wad") == 0;
+}
+
+static void take_texture(void* user, const char* name) {
+	wad_trim* trim = (wad_trim*)user;
+	char upper[WAD_NAME_LENGTH + 1];
+	upper_name(upper, name);
+	for (size_t i = 0; i < buf_len(trim->wads); ++i) {
+		if (strset_find(&trim->wads[i]->textures, upper)) {
+			if (trim->wads[i] == trim->wad) {
+				strset_intern(&trim->textures, &trim->names, upper, NULL);
+			}
+			return;
+		}
+	}
+}
+
+// the first lump of a name is the one the engine loads
+static void keep_lump(void* user, const wadlump* lump, const char* name) {
+	wad_trim* trim = (wad_trim*)user;
+	char upper[WAD_NAME_LENGTH + 1];
+	bool added;
+	upper_name(upper, name);
+	if (lump->type == WAD_TYPE_MIPTEX && strset_find(&trim->textures, upper)) {
+		strset_intern(&trim->kept, &trim->names, upper, &added);
+		if (added) {
+			buf_push(trim->lumps, *lump);
+		}
 	}
-	strcat(dl_path, dependency);
+}
 
-	assert(strlen(dl_path) < MAX_PATH);
+// a new wad with only the textures the map takes from this one, a wad that can't be read is archived whole
+static bool archive_trimmed_wad(archive_job* job, mz_zip_archive* archive, const char* dep_name, const index_entry* entry, bool shared) {
+	wad_trim trim = { 0 };
+	zip_blob blob = { 0 };
+	mapped_file file = { 0 };
+	const void* data;
+	size_t data_len;
+	void* wad = NULL;
+	size_t wad_len;
+	bool success = false;
+
+	for (size_t i = 0; i < buf_len(job->dependency_list); ++i) {
+		const char* dep = job->dependency_list[i];
+		if (!is_wad(dep))
+			continue;
+		const wad_textures* textures = read_wad(job, dep);
+		buf_push(trim.wads, textures);
+		if (path_equal(dep, dep_name)) {
+			trim.wad = textures;
+		}
+	}
+	bsp_read_external_textures(job->textures, job->textures_len, take_texture, &trim);
 
-	return dl_path;
+	if (!read_dependency(job, entry, &file, &data, &data_len))
+		goto exit;
+	if (!wad_read_lumps(data, data_len, keep_lump, &trim)) {
+		success = archive_dependency(job, archive, dep_name, entry, shared);
+		goto exit;
+	}
+
+	wad = wad_build(data, trim.lumps, buf_len(trim.lumps), &wad_len);
+	double start = time_now();
+	if (!compress_blob(wad, wad_len, compress_level(dep_name), &blob)) {
+		job_printf(job, "Error compressing file: %s\n", dep_name);
+		goto exit;
+	}
+	char source[FINGERPRINT_LENGTH + 1];
+	format_source(source, entry, compress_level(dep_name), true);
+	if (!zip_add_blob(archive, dep_name, &blob, wad, &entry->info, source)) {
+		job_printf(job, "Error adding file to archive: %s, %s\n", dep_name, mz_zip_get_error_string(archive->m_last_error));
+		goto exit;
+	}
+	compress_record(dep_name, &blob, time_now() - start, false);
+	if (g_verbose) {
+		job_printf(job, "[%s.bsp] trimmed %s to %llu textures, %llu of %llu bytes\n", job->bspname, dep_name,
+			(unsigned long long)buf_len(trim.lumps), (unsigned long long)wad_len, (unsigned long long)data_len);
+	}
+	success = true;
+exit:
+	free(wad);
+	free_blob(&blob);
+	unmap_file(&file);
+	buf_free(trim.wads);
+	buf_free(trim.lumps);
+	strset_free(&trim.textures);
+	strset_free(&trim.kept);
+	arena_free(&trim.names);
+	return success;
 }
 
-void add_base_dependencies(const char* bspname) {
+void add_base_dependencies(archive_job* job) {
+	const char* bspname = job->bspname;
 	char temp[MAX_PATH];
 
 	sprintf(temp, "maps/%s.bsp", bspname);
-	add_dependency(temp);
+	add_dependency(job, temp);
 	sprintf(temp, "maps/%s.txt", bspname);
-	add_dependency(temp);
+	add_dependency(job, temp);
 	sprintf(temp, "maps/%s.res", bspname);
-	add_dependency(temp);
+	add_dependency(job, temp);
 
 	sprintf(temp, "overviews/%s.bmp", bspname);
-	add_dependency(temp);
+	add_dependency(job, temp);
 	sprintf(temp, "overviews/%s.tga", bspname);
-	add_dependency(temp);
+	add_dependency(job, temp);
 	sprintf(temp, "overviews/%s.txt", bspname);
-	add_dependency(temp);
+	add_dependency(job, temp);
+
+	job->base_dependencies = buf_len(job->dependency_list);
 }
 
 bool get_bsp_name(const char* bsp_path, char* bspname) {
@@ -310,44 +1034,148 @@ bool get_bsp_name(const char* bsp_path, char* bspname) {
 	return true;
 }
 
-int bsp_get_deps(const char* bsp_path, const char* bspname) {
-	free_dependency_list();
-	int rc = EXIT_SUCCESS;
-	add_base_dependencies(bspname);
+static void add_cached_deps(archive_job* job, depcache_list* list) {
+	if (g_verbose) {
+		job_printf(job, "[%s.bsp] dependencies found in cache\n", job->bspname);
+	}
+	for (size_t i = 0; i < buf_len(list->deps); ++i) {
+		add_dependency(job, list->deps[i]);
+	}
+	depcache_free(list);
+}
+
+// wads are trimmed to the textures this read found rather than reading the lump again
+static void keep_textures(archive_job* job, char* textures, size_t textures_len) {
+	if (!g_trim_wads) {
+		free(textures);
+		return;
+	}
+	job->textures = textures;
+	job->textures_len = textures_len;
+}
+
+// the base dependencies follow from the map's name, only what the entities add is cached
+int bsp_get_deps(archive_job* job, const char* bsp_path) {
+	free_dependency_list(job);
+	add_base_dependencies(job);
+
+	file_info info = { 0 };
+	depcache_list cached;
+	bsp_error error;
+	bool have_info = get_file_info(bsp_path, &info);
+	// without the game directory models can't be followed, such a list isn't complete
+	bool cacheable = have_info && fileindex_count() > 0;
+	if (have_info && depcache_find(bsp_path, &info, &cached)) {
+		add_cached_deps(job, &cached);
+		if (g_trim_wads) {
+			job->textures = bsp_open_lump(bsp_path, LUMP_TEXTURES, &job->textures_len, &error);
+			if (!job->textures && g_verbose) {
+				job_printf(job, "[%s.bsp] wads are archived whole, textures can't be read: %s\n", job->bspname, bsp_error_string(error));
+			}
+		}
+		return EXIT_SUCCESS;
+	}
 
-	char* ents = bsp_open_entities(bsp_path);
+	size_t ents_len;
+	char* ents = bsp_open_entities(bsp_path, &ents_len, &error);
 	if (!ents) {
-		rc = EXIT_FAILURE;
-		goto exit;
+		job_printf(job, "Error reading bsp %s: %s\n", bsp_path, bsp_error_string(error));
+		return EXIT_FAILURE;
 	}
-	stream = ents;
-	if (!bsp_read_entities(parse_bsp_ent_value)) {
-		rc = EXIT_FAILURE;
-		goto exit;
+
+	// a touched or copied map still has the same entities and textures
+	size_t textures_len = 0;
+	char* textures = bsp_open_lump(bsp_path, LUMP_TEXTURES, &textures_len, &error);
+	if (!textures) {
+		job_printf(job, "Error reading textures of bsp %s: %s\n", bsp_path, bsp_error_string(error));
 	}
-exit:
-	stream = NULL;
-	if(ents) free(ents);
-	return rc;
+	uint64_t lump_hash = hash_content(ents, ents_len);
+	if (textures) {
+		uint64_t textures_hash = hash_content(textures, textures_len);
+		lump_hash = hash_bytes(&textures_hash, sizeof(textures_hash), lump_hash);
+	}
+	if (depcache_find_lump(lump_hash, &cached)) {
+		if (cacheable) {
+			depcache_link(bsp_path, &info, &cached);
+		}
+		add_cached_deps(job, &cached);
+		free(ents);
+		keep_textures(job, textures, textures_len);
+		return EXIT_SUCCESS;
+	}
+
+	EntityLexer lexer;
+	lexer_init(&lexer, ents);
+	bool parsed = bsp_read_entities(&lexer, parse_bsp_ent_value, job);
+	if (!parsed && lexer.error) {
+		job_printf(job, "Error: failed parsing entity token near:\n\n%.200s\n\n", lexer.error);
+	}
+	free(ents);
+	if (parsed) {
+		add_wad_dependencies(job, textures, textures_len);
+	}
+	keep_textures(job, textures, textures_len);
+	if (!parsed)
+		return EXIT_FAILURE;
+
+	add_model_dependencies(job);
+	if (cacheable) {
+		depcache_store(bsp_path, &info, lump_hash, job->dependency_list + job->base_dependencies,
+			buf_len(job->dependency_list) - job->base_dependencies, job->inputs);
+	}
+	return EXIT_SUCCESS;
+}
+
+static void free_job(archive_job* job) {
+	free(job->textures);
+	buf_free(job->dependency_list);
+	buf_free(job->inputs);
+	buf_free(job->wads);
+	strset_free(&job->dependency_set);
+	arena_free(&job->dependency_arena);
+	buf_free(job->log);
+}
+
+void archive_init(void) {
+	mutex_init(&print_lock);
+	mutex_init(&map_lock);
+	mutex_init(&model_lock);
+	mutex_init(&wad_lock);
+	mutex_init(&sentence_lock);
+	compress_init(BLOBCACHE_BUDGET);
 }
 
-int archive_print_deps(const char* bsp_path) {
-	if(!get_bsp_name(bsp_path, bspname)) {
+// models are only followed when there is a game directory to find them in
+int archive_print_deps(const char* bsp_path, const char* gamedir) {
+	archive_job job = { 0 };
+	const char* bspname = job.bspname;
+
+	if(!get_bsp_name(bsp_path, job.bspname)) {
 		printf("Error getting bsp name from path %s", bsp_path);
 		return EXIT_FAILURE;
 	}
-	if (bsp_get_deps(bsp_path, bspname)) {
+	if (gamedir) {
+		index_gamedir(gamedir);
+	}
+	if (bsp_get_deps(&job, bsp_path)) {
+		job_flush(&job);
 		printf("Skipping '%s': Dependencies could not be read.", bspname);
+		free_job(&job);
+		fileindex_free();
+		free_models();
+		free_wads();
+		free_sentences();
 		return EXIT_FAILURE;
 	}
+	job_flush(&job);
 
 	printf("// %s.res generated by bsparchive (https://github.com/clintonbale/bsparchive)\n", bspname);
 
-	const size_t ndeps = (size_t)buf_len(dependency_list);
+	const size_t ndeps = (size_t)buf_len(job.dependency_list);
 	for (size_t i = 0; i < ndeps; ++i) {
-		const char* dep = dependency_list[i];
+		const char* dep = job.dependency_list[i];
 
-		if(!g_noexclude && hashtable_contains(exclude_table, dep)) {
+		if(exclude_contains(dep)) {
 			printf("// %s\n", dep);
 		}
 		else {
@@ -357,10 +1185,137 @@ int archive_print_deps(const char* bsp_path) {
 
 	printf("// %s.bsp - %llu total dependencies", bspname, ndeps);
 
-	free_dependency_list();
+	free_job(&job);
+	fileindex_free();
+	free_models();
+	free_wads();
+	free_sentences();
 	return EXIT_SUCCESS;
 }
 
+#define ZIP_EOCD_SIZE 22
+#define ZIP_EOCD_SIGNATURE 0x06054B50
+#define ZIP_MAX_COMMENT 0xFFFF
+
+static uint32_t read_le32(const uint8_t* p) {
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// the bsp, every dependency's name, where it resolved to and that file's size and mtime,
+// and whether it's excluded; nothing has to be read beyond the entity lump
+static uint64_t dependency_fingerprint(archive_job* job, const char* bsp_path) {
+	file_info info = { 0 };
+	get_file_info(bsp_path, &info);
+	uint64_t hash = hash_bytes(&info, sizeof(info), HASH_SEED);
+	hash = hash_bytes(&g_trim_wads, sizeof(g_trim_wads), hash);
+
+	for (size_t i = 0; i < buf_len(job->dependency_list); ++i) {
+		const char* dep_name = job->dependency_list[i];
+		uint64_t stock_content = 0;
+		bool excluded = exclude_lookup(dep_name, &stock_content);
+		hash = hash_bytes(dep_name, strlen(dep_name) + 1, hash);
+		hash = hash_bytes(&excluded, sizeof(excluded), hash);
+		hash = hash_bytes(&stock_content, sizeof(stock_content), hash);
+
+		// a hashed exclusion depends on the file too, its hash follows from its size and mtime
+		const index_entry* entry = excluded && !stock_content ? NULL : fileindex_find(dep_name);
+		if (entry) {
+			hash = hash_bytes(entry->path, strlen(entry->path) + 1, hash);
+			hash = hash_bytes(&entry->info.size, sizeof(entry->info.size), hash);
+			hash = hash_bytes(&entry->info.mtime, sizeof(entry->info.mtime), hash);
+		}
+	}
+	return hash;
+}
+
+// miniz can't write an archive comment, so it's patched into the end of central directory record
+static bool write_archive_comment(const char* path, const char* comment) {
+	FILE* fp = fopen(path, "r+b");
+	if (!fp)
+		return false;
+
+	bool success = false;
+	uint8_t eocd[ZIP_EOCD_SIZE];
+	size_t len = strlen(comment);
+	if (fseeko(fp, -ZIP_EOCD_SIZE, SEEK_END) != 0 || fread(eocd, 1, ZIP_EOCD_SIZE, fp) != ZIP_EOCD_SIZE ||
+		read_le32(eocd) != ZIP_EOCD_SIGNATURE || eocd[20] != 0 || eocd[21] != 0) {
+		goto exit;
+	}
+	uint8_t comment_len[2] = { (uint8_t)len, (uint8_t)(len >> 8) };
+	success = fseeko(fp, -2, SEEK_END) == 0 &&
+		fwrite(comment_len, 1, 2, fp) == 2 &&
+		fwrite(comment, 1, len, fp) == len;
+exit:
+	success = (fclose(fp) == 0) && success;
+	return success;
+}
+
+// only the tail of the archive is read, the record is found by its signature and comment length
+static bool read_archive_comment(const char* path, char* comment, size_t size) {
+	FILE* fp = fopen(path, "rb");
+	if (!fp)
+		return false;
+
+	bool found = false;
+	uint8_t* tail = NULL;
+	if (fseeko(fp, 0, SEEK_END) != 0)
+		goto exit;
+	int64_t file_size = ftello(fp);
+	size_t tail_len = (size_t)min(file_size, (int64_t)(ZIP_EOCD_SIZE + ZIP_MAX_COMMENT));
+	if (tail_len < ZIP_EOCD_SIZE || fseeko(fp, -(int64_t)tail_len, SEEK_END) != 0)
+		goto exit;
+	tail = xmalloc(tail_len);
+	if (fread(tail, 1, tail_len, fp) != tail_len)
+		goto exit;
+
+	for (size_t i = tail_len - ZIP_EOCD_SIZE + 1; i-- > 0;) {
+		size_t len = tail[i + 20] | ((size_t)tail[i + 21] << 8);
+		if (read_le32(tail + i) == ZIP_EOCD_SIGNATURE && i + ZIP_EOCD_SIZE + len == tail_len) {
+			if (len < size) {
+				memcpy(comment, tail + i + ZIP_EOCD_SIZE, len);
+				comment[len] = 0;
+				found = true;
+			}
+			break;
+		}
+	}
+exit:
+	free(tail);
+	fclose(fp);
+	return found;
+}
+
+static int archive_map(archive_job* job, const char* bsp_path, const char* output_path);
+
+static void archive_worker(void* arg) {
+	const char* output_path = (const char*)arg;
+	archive_job job = { 0 };
+	compress_worker_begin();
+
+	for (;;) {
+		mutex_lock(&map_lock);
+		size_t index = next_map++;
+		mutex_unlock(&map_lock);
+
+		if (index >= buf_len(map_list))
+			break;
+
+		archive_map(&job, map_list[index], output_path);
+
+		mutex_lock(&map_lock);
+		size_t done = ++maps_done;
+		mutex_unlock(&map_lock);
+		compress_progress(done, buf_len(map_list));
+
+		// each map's output is written in one piece so concurrent maps don't interleave
+		mutex_lock(&print_lock);
+		job_flush(&job);
+		mutex_unlock(&print_lock);
+	}
+	compress_worker_end();
+	free_job(&job);
+}
+
 int archive_bsp_dir(const char* input_dir, const char* output_path, const char* gamedir) {
 	//TODO: enum on exit statuses
 	tinydir_dir dir;
@@ -369,113 +1324,223 @@ int archive_bsp_dir(const char* input_dir, const char* output_path, const char*
 		printf("Error opening directory %s\n", input_dir);
 		return EXIT_FAILURE;
 	}
+	if (!index_gamedir(gamedir)) {
+		tinydir_close(&dir);
+		return EXIT_FAILURE;
+	}
 
 	assert(dir.has_next > 0);
 
-	printf("Archiving map directory %s\n", input_dir);
-
 	while (dir.has_next) {
 		tinydir_readfile(&dir, &file);
 		if (strncasecmp(file.extension, "bsp", 3) == 0) {
-			archive_bsp(file.path, output_path, gamedir);
+			buf_push(map_list, strdup(file.path));
 		}
 		tinydir_next(&dir);
 	}
 	tinydir_close(&dir);
 
+	size_t nmaps = buf_len(map_list);
+	int nthreads = (int)min((size_t)max(g_threads, 1), max(nmaps, 1));
+
+	printf("Archiving map directory %s\n", input_dir);
+	if (g_verbose) {
+		printf("Archiving %llu maps using %d threads\n", (unsigned long long)nmaps, nthreads);
+	}
+
+	next_map = 0;
+	maps_done = 0;
+	compress_progress(0, nmaps);
+
+	thread_t* threads = NULL;
+	for (int i = 1; i < nthreads; ++i) {
+		thread_t thread;
+		if (!thread_create(&thread, archive_worker, (void*)output_path)) {
+			printf("Error creating worker thread, continuing with %d threads\n", i);
+			break;
+		}
+		buf_push(threads, thread);
+	}
+
+	// the calling thread is a worker too
+	archive_worker((void*)output_path);
+
+	for (size_t i = 0; i < buf_len(threads); ++i) {
+		thread_join(threads[i]);
+	}
+	buf_free(threads);
+
+	if (g_verbose) {
+		size_t hits, misses, bytes;
+		blobcache_stats(&hits, &misses, &bytes);
+		printf("Compression cache: %llu hits, %llu misses, %llu bytes cached\n", (unsigned long long)hits, (unsigned long long)misses, (unsigned long long)bytes);
+	}
+
+	for (size_t i = 0; i < nmaps; ++i) {
+		free(map_list[i]);
+	}
+	buf_free(map_list);
+	fileindex_free();
+	free_models();
+	free_wads();
+	free_sentences();
+
 	return EXIT_SUCCESS;
 }
 
 int archive_bsp(const char* bsp_path, const char* output_path, const char* gamedir) {
+	if (!index_gamedir(gamedir))
+		return EXIT_FAILURE;
+
+	archive_job job = { 0 };
+	compress_worker_begin();
+	int rc = archive_map(&job, bsp_path, output_path);
+	compress_worker_end();
+	job_flush(&job);
+	free_job(&job);
+	fileindex_free();
+	free_models();
+	free_wads();
+	free_sentences();
+	return rc;
+}
+
+static int archive_map(archive_job* job, const char* bsp_path, const char* output_path) {
 	//TODO: enum on exit statuses
 	int rc = EXIT_SUCCESS;
+	const char* bspname = job->bspname;
 	char archivename[MAX_PATH];
+	char archivepath[MAX_PATH];
+	char temppath[MAX_PATH];
 
-	if(!get_bsp_name(bsp_path, bspname)) {
-		printf("Error getting bsp name from path %s", bsp_path);
+	if(!get_bsp_name(bsp_path, job->bspname)) {
+		job_printf(job, "Error getting bsp name from path %s", bsp_path);
 		rc = EXIT_FAILURE;
 		goto exit;
 	}
 	if(g_verbose) {
-		printf("Processing map: %s\n", bsp_path);
+		job_printf(job, "Processing map: %s\n", bsp_path);
 	}
 	else {
-		printf("Processing map: %s.bsp\n", bspname);
+		job_printf(job, "Processing map: %s.bsp\n", bspname);
 	}
 	
 	strcpy(archivename, bspname);
 	strcat(archivename, ".zip");
 
-	chdir(output_path);
+	get_full_path(archivepath, archivename, output_path);
 
-	if (!g_overwrite && is_valid_file(archivename)) {
-		printf("Skipping overwrite of existing archive: '%s'\n", archivename);
+	if (!g_overwrite && !g_update && !g_changed && is_valid_file(archivepath)) {
+		job_printf(job, "Skipping overwrite of existing archive: '%s'\n", archivename);
 		rc = EXIT_SUCCESS;
 		goto exit;
 	}
 
-	if (bsp_get_deps(bsp_path, bspname)) {
-		printf("Skipping '%s.bsp': Dependencies could not be read.\n", bspname);
+	if (bsp_get_deps(job, bsp_path)) {
+		job_printf(job, "Skipping '%s.bsp': Dependencies could not be read.\n", bspname);
 		rc = EXIT_FAILURE;
 		goto exit;
 	}
 
-	remove(archivename);
+	char fingerprint[FINGERPRINT_LENGTH + 1], previous_fingerprint[FINGERPRINT_LENGTH + 1];
+	format_fingerprint(fingerprint, dependency_fingerprint(job, bsp_path));
+	if (g_changed && read_archive_comment(archivepath, previous_fingerprint, sizeof(previous_fingerprint)) &&
+		strcmp(fingerprint, previous_fingerprint) == 0) {
+		job_printf(job, "Skipping unchanged archive: '%s'\n", archivename);
+		rc = EXIT_SUCCESS;
+		goto exit;
+	}
+
+	// written next to the old archive and renamed over it once complete
+	if (snprintf(temppath, MAX_PATH, "%s.tmp", archivepath) >= MAX_PATH) {
+		job_printf(job, "Archive path is too long: %s\n", archivepath);
+		rc = EXIT_FAILURE;
+		goto exit;
+	}
 
 	mz_zip_archive archive = { 0 };
 	// create the archive
-	if(!mz_zip_writer_init_file_v2(&archive, archivename, 0, MZ_BEST_COMPRESSION)) {
-		printf("Failed to create zip archive: %s, %s\n", archivename, mz_zip_get_error_string(archive.m_last_error));
+	if(!mz_zip_writer_init_file_v2(&archive, temppath, 0, MZ_BEST_COMPRESSION)) {
+		job_printf(job, "Failed to create zip archive: %s, %s\n", archivename, mz_zip_get_error_string(archive.m_last_error));
 		rc = EXIT_FAILURE;
 		goto exit;
 	}	
 
-	size_t ndeps = buf_len(dependency_list);
-	size_t dep_success = 0, dep_missing = 0, dep_skipped = 0;
+	mz_zip_archive previous = { 0 };
+	bool updating = g_update && is_valid_file(archivepath) && mz_zip_reader_init_file(&previous, archivepath, 0);
 
+	size_t ndeps = buf_len(job->dependency_list);
+	size_t dep_success = 0, dep_missing = 0, dep_skipped = 0, dep_unchanged = 0;
+	const index_entry* entry;
+	uint64_t stock_content;
+	int index;
 	for (size_t i = 0; i < ndeps; ++i) {
-		char* dep_name = dependency_list[i];
-		char* fullpath = get_full_path(dep_name, gamedir);
-		char* dlpath = get_full_dl_path(dep_name, gamedir);
-		
-		void* data = NULL;
-		size_t data_len = 0;
+		const char* dep_name = job->dependency_list[i];
+		// base dependencies belong to this map alone, keeping them in memory for other maps is wasted
+		bool shared = i >= job->base_dependencies;
 		
-		if(!g_noexclude && hashtable_contains(exclude_table, dep_name)) {
-			if(g_verbose) printf("Skipping: %s\n", dep_name);
+		if(exclude_lookup(dep_name, &stock_content) && is_stock_file(job, dep_name, stock_content)) {
+			if(g_verbose) job_printf(job, "Skipping: %s\n", dep_name);
 			dep_skipped++;
 		}
-		else if (read_dependency(fullpath, &data, &data_len) || read_dependency(dlpath, &data, &data_len)) {
-			if(!mz_zip_writer_add_mem_ex(&archive, dep_name, data, data_len, NULL, 0, MZ_BEST_COMPRESSION, 0, 0)) {
-				printf("Error adding file to archive: %s, %s\n", dep_name, mz_zip_get_error_string(archive.m_last_error));
+		else if ((entry = resolve_dependency(job, dep_name)) != NULL) {
+			// a trimmed wad differs from its source, so it's never copied over
+			if (job->textures && is_wad(dep_name)) {
+				if (archive_trimmed_wad(job, &archive, dep_name, entry, shared)) {
+					dep_success++;
+				}
 			}
-			else {
+			// unchanged files are copied over still compressed
+			else if (updating && (index = mz_zip_reader_locate_file(&previous, dep_name, NULL, 0)) >= 0 && is_unchanged(&previous, index, dep_name, entry)) {
+				if (mz_zip_writer_add_from_zip_reader(&archive, &previous, (mz_uint)index)) {
+					dep_unchanged++;
+				}
+				else {
+					job_printf(job, "Error copying file from archive: %s, %s\n", dep_name, mz_zip_get_error_string(archive.m_last_error));
+				}
+			}
+			else if (archive_dependency(job, &archive, dep_name, entry, shared)) {
 				dep_success++;
 			}
 		}
 		else {
 			dep_missing++;
 		}
-		if (data) free(data);
 	}
 	
 	mz_bool success;
 	if(!(success = mz_zip_writer_finalize_archive(&archive))) {
-		printf("Error finalizing archive: %s, %s\n", archivename, mz_zip_get_error_string(archive.m_last_error));
+		job_printf(job, "Error finalizing archive: %s, %s\n", archivename, mz_zip_get_error_string(archive.m_last_error));
+	}
+	if(!mz_zip_writer_end(&archive)) {
+		job_printf(job, "Error closing archive: %s, %s\n", archivename, mz_zip_get_error_string(archive.m_last_error));				
+		success = false;
 	}
-	if(!(success = mz_zip_writer_end(&archive))) {
-		printf("Error closing archive: %s, %s\n", archivename, mz_zip_get_error_string(archive.m_last_error));				
+	// the old archive has to be closed before it can be replaced
+	if (updating) {
+		mz_zip_reader_end(&previous);
+	}
+	if (success && !write_archive_comment(temppath, fingerprint)) {
+		job_printf(job, "Error writing archive comment: %s\n", archivename);
+		success = false;
+	}
+	if (success && !rename_file(temppath, archivepath)) {
+		job_printf(job, "Error replacing archive: %s\n", archivename);
+		success = false;
 	}
 
-	if (success) {
-		printf("Archived map '%s' successfully: %u files added, %u skipped, %u could not be found.\n", bspname, dep_success, dep_skipped, dep_missing);
+	if (success && updating) {
+		job_printf(job, "Updated map '%s' successfully: %u files added, %u unchanged, %u skipped, %u could not be found.\n", bspname, dep_success, dep_unchanged, dep_skipped, dep_missing);
+	}
+	else if (success) {
+		job_printf(job, "Archived map '%s' successfully: %u files added, %u skipped, %u could not be found.\n", bspname, dep_success, dep_skipped, dep_missing);
 	}
 	else {
-		printf("Failed archiving map '%s'\n", bspname);
-		remove(archivename);
+		job_printf(job, "Failed archiving map '%s'\n", bspname);
+		remove(temppath);
 		rc = EXIT_FAILURE;
 	}	
 exit:
-	free_dependency_list();
+	free_dependency_list(job);
 	return rc;
 }
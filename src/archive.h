@@ -3,7 +3,15 @@
 extern bool g_verbose;
 extern bool g_noexclude;
 extern bool g_overwrite;
+extern bool g_update;
+extern bool g_changed;
+extern bool g_trim_wads;
+extern int g_threads;
+extern const char* g_snapshot;
 
-int archive_print_deps(const char* input);
+void archive_init(void);
+
+int archive_print_deps(const char* input, const char* gamedir);
+int archive_print_manifest(const char* gamedir);
 int archive_bsp_dir(const char* input, const char* output, const char* gamedir);
 int archive_bsp(const char* input, const char* output, const char* gamedir);
\ No newline at end of file
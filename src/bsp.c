@@ -8,46 +8,101 @@
 #include "common.h"
 #include "token.h"
 
-char* bsp_open_entities(const char* path) {
+const char* bsp_error_string(bsp_error error) {
+	switch (error) {
+	case BSP_OK: return "no error";
+	case BSP_ERROR_OPEN: return "can't open the file";
+	case BSP_ERROR_HEADER: return "can't read the header";
+	case BSP_ERROR_VERSION: return "unsupported map type, expected 30";
+	case BSP_ERROR_LUMP: return "invalid lump";
+	case BSP_ERROR_READ: return "can't read the lump";
+	}
+	return "unknown error";
+}
+
+// the lump's contents with a terminator after them, NULL if the map can't be read
+// errors are returned rather than printed, maps are read on several threads
+char* bsp_open_lump(const char* path, int index, size_t* length, bsp_error* error) {
 	assert(path != NULL);
-	char* entities = NULL;
+	assert(error != NULL);
+	assert(index >= 0 && index < BSP_LUMP_COUNT);
+	char* data = NULL;
+	*error = BSP_OK;
 
 	FILE* fp = fopen(path, "rb");
 	if (fp == NULL) {
-		perror("Error opening bsp");
+		*error = BSP_ERROR_OPEN;
 		goto exit;
 	}
 
 	bspheader header;
 	if(fread(&header, sizeof(bspheader), 1, fp) != 1) {
-		perror("Error reading bsp header");
+		*error = BSP_ERROR_HEADER;
 		goto exit;
 	};
 	// only gold source supported
 	if(header.version != 30) {
-		printf("Unsupported map type %d, expected 30\n", header.version);
+		*error = BSP_ERROR_VERSION;
 		goto exit;
 	}
 
-	bsplump entities_lump = header.lump[LUMP_ENTITIES];
-	assert(entities_lump.offset > 0);
-	assert(entities_lump.length > 0);
+	bsplump lump = header.lump[index];
+	if (lump.offset < 0 || lump.length < 0) {
+		*error = BSP_ERROR_LUMP;
+		goto exit;
+	}
 
-	entities = (char*)xmalloc(entities_lump.length);
+	data = (char*)xmalloc((size_t)lump.length + 1);
+	data[lump.length] = 0;
+	*length = (size_t)lump.length;
 
-	fseek(fp, entities_lump.offset, SEEK_SET);
-	if (fread(entities, sizeof(char), entities_lump.length, fp) != (size_t)entities_lump.length) {
-		perror("Error reading bsp file");
-		free(entities);
-		entities = NULL;	
+	fseek(fp, lump.offset, SEEK_SET);
+	if (fread(data, sizeof(char), lump.length, fp) != (size_t)lump.length) {
+		*error = BSP_ERROR_READ;
+		free(data);
+		data = NULL;	
 	}
 	
 exit:
 	if(fp) fclose(fp);
-	return entities;
+	return data;
+}
+
+char* bsp_open_entities(const char* path, size_t* length, bsp_error* error) {
+	return bsp_open_lump(path, LUMP_ENTITIES, length, error);
+}
+
+bool bsp_read_external_textures(const void* lump, size_t len, bsp_texture_reader reader, void* user) {
+	assert(reader != NULL);
+	const uint8_t* data = (const uint8_t*)lump;
+	int32_t count;
+	if (len < sizeof(count))
+		return false;
+	memcpy(&count, data, sizeof(count));
+	if (count < 0 || (size_t)count > (len - sizeof(count)) / sizeof(int32_t))
+		return false;
+
+	for (int32_t i = 0; i < count; ++i) {
+		int32_t offset;
+		memcpy(&offset, data + sizeof(count) + i * sizeof(int32_t), sizeof(offset));
+		// -1 marks a texture the compiler couldn't find
+		if (offset < 0 || len < sizeof(bspmiptex) || (size_t)offset > len - sizeof(bspmiptex))
+			continue;
+
+		bspmiptex texture;
+		memcpy(&texture, data + offset, sizeof(texture));
+		// textures without mip data in the map are loaded from a wad
+		if (texture.offsets[0] == 0 && texture.name[0]) {
+			char name[MIPTEX_NAME_LENGTH + 1];
+			memcpy(name, texture.name, MIPTEX_NAME_LENGTH);
+			name[MIPTEX_NAME_LENGTH] = 0;
+			reader(user, name);
+		}
+	}
+	return true;
 }
 
-static void bsp_read_ent_values(const bsp_entity_reader reader, char* key, char* value) {
+static void bsp_read_ent_values(const bsp_entity_reader reader, void* user, char* key, char* value) {
 	char* last = value;
 	char* end = strchr(value, ';');
 	if (end) {
@@ -55,48 +110,50 @@ static void bsp_read_ent_values(const bsp_entity_reader reader, char* key, char*
 		do {
 			size_t len = end - last;
 			last[len] = 0;
-			bsp_read_ent_values(reader, key, last);
+			bsp_read_ent_values(reader, user, key, last);
 
 			last = last + len + 1;
 			end = strchr(last, ';');
 		} while (end);
 
-		reader(key, last);
+		reader(user, key, last);
 	}
 	else {
 		// a single value
-		reader(key, value);
+		reader(user, key, value);
 	}
 }
 
-bool bsp_read_entities(bsp_entity_reader reader) {
+bool bsp_read_entities(EntityLexer* lexer, bsp_entity_reader reader, void* user) {
+	assert(lexer != NULL);
 	assert(reader != NULL);
 
 	char key[ENT_MAX_KEY + 1];
 	char value[ENT_MAX_VALUE + 1];
+	const EntityToken* token = &lexer->token;
 
-	next_token();
-	while (match_token(TOKEN_BEGIN_ENT)) {
-		while (is_token(TOKEN_STR)) {
-			size_t key_len = min(token.end - token.start, ENT_MAX_KEY);
+	next_token(lexer);
+	while (match_token(lexer, TOKEN_BEGIN_ENT)) {
+		while (is_token(lexer, TOKEN_STR)) {
+			size_t key_len = min(token->end - token->start, ENT_MAX_KEY);
 			assert(key_len >= 0);
 
-			strncpy(key, token.start, key_len);
+			strncpy(key, token->start, key_len);
 			key[key_len] = 0;
 			
-			if (!expect_token(TOKEN_STR))
+			if (!expect_token(lexer, TOKEN_STR))
 				return false;
 			
-			size_t value_len = min(token.end - token.start, ENT_MAX_VALUE);
+			size_t value_len = min(token->end - token->start, ENT_MAX_VALUE);
 			assert(value_len >= 0);
 
-			strncpy(value, token.start, value_len);
+			strncpy(value, token->start, value_len);
 			value[value_len] = 0;
 
-			bsp_read_ent_values(reader, key, value);
-			next_token();
+			bsp_read_ent_values(reader, user, key, value);
+			next_token(lexer);
 		}
-		if(!expect_token(TOKEN_END_ENT))
+		if(!expect_token(lexer, TOKEN_END_ENT))
 			return false;
 	}
 	return true;
@@ -1,22 +1,50 @@
 #pragma once
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include "token.h"
 
 typedef struct bsplump {
 	int32_t offset;
 	int32_t length;
 } bsplump;
 
+#define BSP_LUMP_COUNT 15
+
 typedef struct bspheader {
 	int32_t version;
-	bsplump lump[15];
+	bsplump lump[BSP_LUMP_COUNT];
 } bspheader;
 
+#define MIPTEX_NAME_LENGTH 16
+
+typedef struct bspmiptex {
+	char name[MIPTEX_NAME_LENGTH];
+	uint32_t width;
+	uint32_t height;
+	uint32_t offsets[4];
+} bspmiptex;
+
 #define LUMP_ENTITIES 0
+#define LUMP_TEXTURES 2
 #define ENT_MAX_KEY 32
 #define ENT_MAX_VALUE 1024
 
-typedef void(*bsp_entity_reader)(char*, char*);
+typedef enum bsp_error {
+	BSP_OK,
+	BSP_ERROR_OPEN,
+	BSP_ERROR_HEADER,
+	BSP_ERROR_VERSION,
+	BSP_ERROR_LUMP,
+	BSP_ERROR_READ,
+} bsp_error;
+
+typedef void(*bsp_entity_reader)(void* user, char* key, char* value);
+typedef void(*bsp_texture_reader)(void* user, const char* name);
 
-char* bsp_open_entities(const char* path);
-bool bsp_read_entities(bsp_entity_reader reader);
\ No newline at end of file
+const char* bsp_error_string(bsp_error error);
+char* bsp_open_lump(const char* path, int index, size_t* length, bsp_error* error);
+char* bsp_open_entities(const char* path, size_t* length, bsp_error* error);
+// calls reader with the name of each texture the map leaves to its wads
+bool bsp_read_external_textures(const void* lump, size_t len, bsp_texture_reader reader, void* user);
+bool bsp_read_entities(EntityLexer* lexer, bsp_entity_reader reader, void* user);
\ No newline at end of file
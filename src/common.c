@@ -4,7 +4,24 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <assert.h>
+#include <ctype.h>
 #include <stdint.h>
+#include <string.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#include <sys/utime.h>
+#else
+#include <unistd.h>
+#include <utime.h>
+#include <time.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#endif
 
 #pragma warning(push, 0)  
 #include "tinydir.h"
@@ -65,59 +82,602 @@ void *buf__grow(const void *buf, size_t new_len, size_t elem_size) {
 	return new_hdr->buf;
 }
 
-//FNV-1
-static uint64_t hash(const char* data) {
-	uint64_t hash = 0xCBF29CE484222325;
-	for(size_t i = 0; data[i]; ++i) {
+char *buf__printf(char *buf, const char *fmt, ...) {
+	va_list args;
+	va_start(args, fmt);
+	size_t cap = buf_cap(buf) - buf_len(buf);
+	size_t n = 1 + vsnprintf(buf_end(buf), cap, fmt, args);
+	va_end(args);
+	if (n > cap) {
+		buf_fit(buf, n + buf_len(buf));
+		va_start(args, fmt);
+		size_t new_cap = buf_cap(buf) - buf_len(buf);
+		n = 1 + vsnprintf(buf_end(buf), new_cap, fmt, args);
+		assert(n <= new_cap);
+		va_end(args);
+	}
+	buf__hdr(buf)->len += n - 1;
+	return buf;
+}
+
+typedef struct thread_start {
+	thread_func func;
+	void* arg;
+} thread_start;
+
+#ifdef _WIN32
+static DWORD WINAPI thread_entry(LPVOID param) {
+#else
+static void* thread_entry(void* param) {
+#endif
+	thread_start start = *(thread_start*)param;
+	free(param);
+	start.func(start.arg);
+	return 0;
+}
+
+bool thread_create(thread_t* thread, thread_func func, void* arg) {
+	assert(thread != NULL);
+	assert(func != NULL);
+
+	thread_start* start = xmalloc(sizeof(thread_start));
+	start->func = func;
+	start->arg = arg;
+#ifdef _WIN32
+	*thread = CreateThread(NULL, 0, thread_entry, start, 0, NULL);
+	if (*thread == NULL) {
+#else
+	if (pthread_create(thread, NULL, thread_entry, start) != 0) {
+#endif
+		free(start);
+		return false;
+	}
+	return true;
+}
+
+void thread_join(thread_t thread) {
+#ifdef _WIN32
+	WaitForSingleObject(thread, INFINITE);
+	CloseHandle(thread);
+#else
+	pthread_join(thread, NULL);
+#endif
+}
+
+int cpu_count(void) {
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	int count = (int)info.dwNumberOfProcessors;
+#else
+	int count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+	return max(count, 1);
+}
+
+void mutex_init(mutex_t* mutex) {
+#ifdef _WIN32
+	InitializeCriticalSection(mutex);
+#else
+	pthread_mutex_init(mutex, NULL);
+#endif
+}
+
+void mutex_destroy(mutex_t* mutex) {
+#ifdef _WIN32
+	DeleteCriticalSection(mutex);
+#else
+	pthread_mutex_destroy(mutex);
+#endif
+}
+
+void mutex_lock(mutex_t* mutex) {
+#ifdef _WIN32
+	EnterCriticalSection(mutex);
+#else
+	pthread_mutex_lock(mutex);
+#endif
+}
+
+void mutex_unlock(mutex_t* mutex) {
+#ifdef _WIN32
+	LeaveCriticalSection(mutex);
+#else
+	pthread_mutex_unlock(mutex);
+#endif
+}
+
+static void arena_grow(arena* arena, size_t min_size) {
+	size_t size = max(ARENA_BLOCK_SIZE, min_size);
+	arena->ptr = xmalloc(size);
+	arena->end = arena->ptr + size;
+	buf_push(arena->blocks, arena->ptr);
+}
+
+void* arena_alloc(arena* arena, size_t size) {
+	assert(arena != NULL);
+	if (size > (size_t)(arena->end - arena->ptr)) {
+		arena_grow(arena, size);
+	}
+	void* ptr = arena->ptr;
+	size_t aligned = (size + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+	arena->ptr += min(aligned, (size_t)(arena->end - arena->ptr));
+	return ptr;
+}
+
+// keeps the first block around so a reused arena doesn't go back to malloc
+void arena_reset(arena* arena) {
+	assert(arena != NULL);
+	if (buf_len(arena->blocks) == 0)
+		return;
+
+	for (size_t i = 1; i < buf_len(arena->blocks); ++i) {
+		free(arena->blocks[i]);
+	}
+	buf__hdr(arena->blocks)->len = 1;
+	// the first block is at least this big
+	arena->ptr = arena->blocks[0];
+	arena->end = arena->ptr + ARENA_BLOCK_SIZE;
+}
+
+void arena_free(arena* arena) {
+	assert(arena != NULL);
+	for (size_t i = 0; i < buf_len(arena->blocks); ++i) {
+		free(arena->blocks[i]);
+	}
+	buf_free(arena->blocks);
+	arena->ptr = arena->end = NULL;
+}
+
+static void strset_grow(string_set* set, size_t new_cap) {
+	string_set new_set = { 0 };
+	new_set.hashes = xcalloc(new_cap, sizeof(uint64_t));
+	new_set.strs = xcalloc(new_cap, sizeof(const char*));
+	new_set.cap = new_cap;
+
+	for (size_t i = 0; i < set->cap; ++i) {
+		if (set->strs[i]) {
+			size_t index = (size_t)set->hashes[i] & (new_cap - 1);
+			while (new_set.strs[index]) {
+				index = (index + 1) & (new_cap - 1);
+			}
+			new_set.hashes[index] = set->hashes[i];
+			new_set.strs[index] = set->strs[i];
+		}
+	}
+	new_set.len = set->len;
+	free(set->hashes);
+	free(set->strs);
+	*set = new_set;
+}
+
+// returns the copy of str held by the set, adding it to the set and arena if it wasn't there
+const char* strset_intern(string_set* set, arena* arena, const char* str, bool* added) {
+	assert(set != NULL);
+	assert(str != NULL);
+
+	// keep the load factor under 1/2, cap is always a power of two
+	if (2 * set->len >= set->cap) {
+		strset_grow(set, max(64, 2 * set->cap));
+	}
+
+	size_t len = strlen(str);
+	uint64_t hash = hash_bytes(str, len, HASH_SEED);
+	size_t index = (size_t)hash & (set->cap - 1);
+	while (set->strs[index]) {
+		if (set->hashes[index] == hash && strcmp(set->strs[index], str) == 0) {
+			if (added) *added = false;
+			return set->strs[index];
+		}
+		index = (index + 1) & (set->cap - 1);
+	}
+
+	char* copy = arena_alloc(arena, len + 1);
+	memcpy(copy, str, len + 1);
+	set->hashes[index] = hash;
+	set->strs[index] = copy;
+	set->len++;
+	if (added) *added = true;
+	return copy;
+}
+
+// the copy of str held by the set, NULL if it isn't in it
+const char* strset_find(const string_set* set, const char* str) {
+	assert(set != NULL);
+	assert(str != NULL);
+	if (!set->cap)
+		return NULL;
+
+	uint64_t hash = hash_bytes(str, strlen(str), HASH_SEED);
+	size_t index = (size_t)hash & (set->cap - 1);
+	while (set->strs[index]) {
+		if (set->hashes[index] == hash && strcmp(set->strs[index], str) == 0)
+			return set->strs[index];
+		index = (index + 1) & (set->cap - 1);
+	}
+	return NULL;
+}
+
+void strset_clear(string_set* set) {
+	assert(set != NULL);
+	if (set->cap) {
+		memset(set->strs, 0, set->cap * sizeof(const char*));
+	}
+	set->len = 0;
+}
+
+void strset_free(string_set* set) {
+	assert(set != NULL);
+	free(set->hashes);
+	free(set->strs);
+	memset(set, 0, sizeof(string_set));
+}
+
+//FNV-1a
+uint64_t hash_bytes(const void* data, size_t len, uint64_t seed) {
+	const uint8_t* bytes = (const uint8_t*)data;
+	uint64_t hash = seed;
+	for (size_t i = 0; i < len; ++i) {
+		hash = hash ^ bytes[i];
+		hash = hash * 0x100000001B3;
+	}
+	return hash;
+}
+
+static inline char fold_path_char(char c) {
+	return c == '\\' ? '/' : (char)tolower((unsigned char)c);
+}
+
+uint64_t hash_path(const char* path) {
+	assert(path != NULL);
+	uint64_t hash = HASH_SEED;
+	for (; *path; ++path) {
+		hash = hash ^ (uint8_t)fold_path_char(*path);
 		hash = hash * 0x100000001B3;
-		hash = hash ^ data[i];
 	}
 	return hash;
 }
 
-hash_table* hashtable_create(size_t items) {
-	hash_table* map = xcalloc(1, sizeof(hash_table));
+bool path_equal(const char* a, const char* b) {
+	assert(a != NULL && b != NULL);
+	while (*a && fold_path_char(*a) == fold_path_char(*b)) {
+		a++;
+		b++;
+	}
+	return fold_path_char(*a) == fold_path_char(*b);
+}
+
+#define XXH_PRIME1 0x9E3779B185EBCA87ULL
+#define XXH_PRIME2 0xC2B2AE3D27D4EB4FULL
+#define XXH_PRIME3 0x165667B19E3779F9ULL
+#define XXH_PRIME4 0x85EBCA77C2B2AE63ULL
+#define XXH_PRIME5 0x27D4EB2F165667C5ULL
+
+static uint64_t rotl64(uint64_t x, int r) {
+	return (x << r) | (x >> (64 - r));
+}
+
+static uint64_t read64(const uint8_t* p) {
+	uint64_t v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static uint32_t read32(const uint8_t* p) {
+	uint32_t v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static uint64_t xxh_round(uint64_t acc, uint64_t input) {
+	acc += input * XXH_PRIME2;
+	acc = rotl64(acc, 31);
+	return acc * XXH_PRIME1;
+}
+
+static uint64_t xxh_merge(uint64_t acc, uint64_t val) {
+	acc ^= xxh_round(0, val);
+	return acc * XXH_PRIME1 + XXH_PRIME4;
+}
+
+//XXH64, used for file contents where FNV is too slow
+uint64_t hash_content(const void* data, size_t len) {
+	const uint8_t* p = (const uint8_t*)data;
+	const uint8_t* end = p + len;
+	uint64_t h;
+
+	if (len >= 32) {
+		uint64_t v1 = XXH_PRIME1 + XXH_PRIME2;
+		uint64_t v2 = XXH_PRIME2;
+		uint64_t v3 = 0;
+		uint64_t v4 = 0 - XXH_PRIME1;
+		do {
+			v1 = xxh_round(v1, read64(p));
+			v2 = xxh_round(v2, read64(p + 8));
+			v3 = xxh_round(v3, read64(p + 16));
+			v4 = xxh_round(v4, read64(p + 24));
+			p += 32;
+		} while (p + 32 <= end);
+
+		h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+		h = xxh_merge(h, v1);
+		h = xxh_merge(h, v2);
+		h = xxh_merge(h, v3);
+		h = xxh_merge(h, v4);
+	}
+	else {
+		h = XXH_PRIME5;
+	}
 
-	items = (max(items*2, 16) + 0x1F) & ~0x1F;
+	h += (uint64_t)len;
 
-	map->vals = xcalloc(items, sizeof(const char*));
-	map->cap = items;
+	while (p + 8 <= end) {
+		h ^= xxh_round(0, read64(p));
+		h = rotl64(h, 27) * XXH_PRIME1 + XXH_PRIME4;
+		p += 8;
+	}
+	if (p + 4 <= end) {
+		h ^= (uint64_t)read32(p) * XXH_PRIME1;
+		h = rotl64(h, 23) * XXH_PRIME2 + XXH_PRIME3;
+		p += 4;
+	}
+	while (p < end) {
+		h ^= (*p) * XXH_PRIME5;
+		h = rotl64(h, 11) * XXH_PRIME1;
+		p++;
+	}
+
+	h ^= h >> 33;
+	h *= XXH_PRIME2;
+	h ^= h >> 29;
+	h *= XXH_PRIME3;
+	h ^= h >> 32;
+	return h;
+}
 
-	return map;
+static uint64_t hash_mix(uint64_t x) {
+	x ^= x >> 33;
+	x *= 0xFF51AFD7ED558CCD;
+	x ^= x >> 33;
+	return x;
 }
 
-void hashtable_add(hash_table* ht, const char* data) {
-	assert(ht != NULL);
-	assert(data);
-	assert(ht->len < ht->cap);
+void* hashmap_get(const hash_map* map, uint64_t key) {
+	assert(map != NULL);
+	if (map->len == 0)
+		return NULL;
 
-	uint64_t index = hash(data) % ht->cap;
-	
-	while (ht->vals[index] != NULL) {
-		++index;
+	size_t index = (size_t)hash_mix(key) & (map->cap - 1);
+	while (map->vals[index] != NULL) {
+		if (map->keys[index] == key)
+			return map->vals[index];
 
-		index %= ht->cap;
+		index = (index + 1) & (map->cap - 1);
 	}
+	return NULL;
+}
 
-	ht->vals[index] = data;
-	ht->len++;
+static void hashmap_grow(hash_map* map, size_t new_cap) {
+	hash_map new_map = { 0 };
+	new_map.keys = xcalloc(new_cap, sizeof(uint64_t));
+	new_map.vals = xcalloc(new_cap, sizeof(void*));
+	new_map.cap = new_cap;
+
+	for (size_t i = 0; i < map->cap; ++i) {
+		if (map->vals[i]) {
+			hashmap_put(&new_map, map->keys[i], map->vals[i]);
+		}
+	}
+	free(map->keys);
+	free(map->vals);
+	*map = new_map;
 }
 
-bool hashtable_contains(hash_table* ht, const char* data) {
-	assert(ht != NULL);
-	assert(data);
+void hashmap_put(hash_map* map, uint64_t key, void* val) {
+	assert(map != NULL);
+	assert(val != NULL);
+
+	// keep the load factor under 1/2, cap is always a power of two
+	if (2 * map->len >= map->cap) {
+		hashmap_grow(map, max(16, 2 * map->cap));
+	}
+
+	size_t index = (size_t)hash_mix(key) & (map->cap - 1);
+	while (map->vals[index] != NULL) {
+		if (map->keys[index] == key) {
+			map->vals[index] = val;
+			return;
+		}
+		index = (index + 1) & (map->cap - 1);
+	}
+	map->keys[index] = key;
+	map->vals[index] = val;
+	map->len++;
+}
 
-	uint64_t index = hash(data) % ht->cap;
-	
-	while (ht->vals[index] != NULL) {
-		if (strcmp(ht->vals[index], data) == 0)
+void hashmap_free(hash_map* map) {
+	assert(map != NULL);
+	free(map->keys);
+	free(map->vals);
+	map->keys = NULL;
+	map->vals = NULL;
+	map->len = map->cap = 0;
+}
+
+bool get_file_info(const char* path, file_info* info) {
+	assert(path != NULL);
+	assert(info != NULL);
+#ifdef _WIN32
+	struct _stat64 st;
+	if (_stat64(path, &st) != 0 || (st.st_mode & _S_IFREG) == 0)
+		return false;
+#else
+	struct stat st;
+	if (stat(path, &st) != 0 || !S_ISREG(st.st_mode))
+		return false;
+#endif
+	info->size = (uint64_t)st.st_size;
+	info->mtime = (int64_t)st.st_mtime;
+	return true;
+}
+
+// a directory's mtime changes when files are added to it, removed or renamed
+bool get_dir_mtime(const char* path, int64_t* mtime) {
+	assert(path != NULL);
+	assert(mtime != NULL);
+#ifdef _WIN32
+	struct _stat64 st;
+	if (_stat64(path, &st) != 0 || (st.st_mode & _S_IFDIR) == 0)
+		return false;
+#else
+	struct stat st;
+	if (stat(path, &st) != 0 || !S_ISDIR(st.st_mode))
+		return false;
+#endif
+	*mtime = (int64_t)st.st_mtime;
+	return true;
+}
+
+static bool read_file(const char* path, mapped_file* file) {
+	FILE* fp = fopen(path, "rb");
+	if (!fp)
+		return false;
+
+	file_info info;
+	bool success = get_file_info(path, &info) && info.size <= SIZE_MAX;
+	if (success) {
+		file->size = (size_t)info.size;
+		file->data = xmalloc(file->size + 1);
+		success = fread(file->data, 1, file->size, fp) == file->size;
+		if (!success) {
+			free(file->data);
+			file->data = NULL;
+		}
+	}
+	fclose(fp);
+	return success;
+}
+
+bool map_file(const char* path, mapped_file* file) {
+	assert(path != NULL);
+	assert(file != NULL);
+	memset(file, 0, sizeof(mapped_file));
+
+#ifdef _WIN32
+	HANDLE handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (handle == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER size;
+	if (GetFileSizeEx(handle, &size) && (uint64_t)size.QuadPart <= SIZE_MAX) {
+		file->size = (size_t)size.QuadPart;
+		// empty files can't be mapped, and don't need to be
+		if (file->size == 0) {
+			CloseHandle(handle);
 			return true;
+		}
+		file->mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (file->mapping) {
+			file->data = MapViewOfFile(file->mapping, FILE_MAP_READ, 0, 0, 0);
+			if (!file->data) {
+				CloseHandle(file->mapping);
+				file->mapping = NULL;
+			}
+		}
+	}
+	CloseHandle(handle);
+#else
+	int fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return false;
 
-		++index;
-		index %= ht->cap;
+	struct stat st;
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && (uint64_t)st.st_size <= SIZE_MAX) {
+		file->size = (size_t)st.st_size;
+		if (file->size == 0) {
+			close(fd);
+			return true;
+		}
+		void* data = mmap(NULL, file->size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (data != MAP_FAILED) {
+			madvise(data, file->size, MADV_SEQUENTIAL);
+			file->data = data;
+		}
 	}
+	close(fd);
+#endif
 
-	return false;
+	if (file->data) {
+		file->mapped = true;
+		return true;
+	}
+	return read_file(path, file);
+}
+
+void unmap_file(mapped_file* file) {
+	assert(file != NULL);
+	if (file->data) {
+		if (file->mapped) {
+#ifdef _WIN32
+			UnmapViewOfFile(file->data);
+			CloseHandle(file->mapping);
+#else
+			munmap(file->data, file->size);
+#endif
+		}
+		else {
+			free(file->data);
+		}
+	}
+	memset(file, 0, sizeof(mapped_file));
+}
+
+bool touch_file(const char* path) {
+#ifdef _WIN32
+	return _utime(path, NULL) == 0;
+#else
+	return utime(path, NULL) == 0;
+#endif
+}
+
+bool rename_file(const char* from, const char* to) {
+#ifdef _WIN32
+	return MoveFileExA(from, to, MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+	return rename(from, to) == 0;
+#endif
+}
+
+bool make_dir(const char* path) {
+	if (is_valid_dir(path))
+		return true;
+#ifdef _WIN32
+	return _mkdir(path) == 0;
+#else
+	return mkdir(path, 0777) == 0;
+#endif
+}
+
+int process_id(void) {
+#ifdef _WIN32
+	return _getpid();
+#else
+	return (int)getpid();
+#endif
+}
+
+// monotonic time in seconds
+double time_now(void) {
+#ifdef _WIN32
+	LARGE_INTEGER freq, counter;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&counter);
+	return (double)counter.QuadPart / (double)freq.QuadPart;
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+#endif
 }
 
 bool is_valid_file(const char* filepath) {
@@ -1,5 +1,7 @@
 #pragma once
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #define COUNT_OF(x) ((sizeof(x)/sizeof(0[x])) / ((size_t)(!(sizeof(x) % sizeof(0[x])))))
 
@@ -8,7 +10,30 @@
 #define strcasecmp _stricmp
 #define strncasecmp _strnicmp
 #define strdup _strdup
-#define chdir SetCurrentDirectory
+#define strtok_r strtok_s
+#define fseeko _fseeki64
+#define ftello _ftelli64
+
+typedef HANDLE thread_t;
+typedef CRITICAL_SECTION mutex_t;
+#else
+#include <limits.h>
+#include <strings.h>
+#include <pthread.h>
+
+#define MAX_PATH 260
+#define TRUE 1
+#define FALSE 0
+
+#ifndef min
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#endif
+#ifndef max
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
+typedef pthread_t thread_t;
+typedef pthread_mutex_t mutex_t;
 #endif
 
 void fatal(char* fmt, ...);
@@ -33,18 +58,94 @@ typedef struct BufHdr {
 #define buf_fit(b, n) ((n) <= buf_cap(b) ? 0 : ((b) = buf__grow((b), (n), sizeof(*(b)))))
 #define buf_push(b, ...) (buf_fit((b), 1 + buf_len(b)), (b)[buf__hdr(b)->len++] = (__VA_ARGS__))
 #define buf_clear(b) ((b) ? buf__hdr(b)->len = 0 : 0)
+#define buf_printf(b, ...) ((b) = buf__printf((b), __VA_ARGS__))
 
 void *buf__grow(const void* buf, size_t new_len, size_t elem_size);
+char *buf__printf(char *buf, const char *fmt, ...);
+
+typedef void(*thread_func)(void*);
+
+bool thread_create(thread_t* thread, thread_func func, void* arg);
+void thread_join(thread_t thread);
+int cpu_count(void);
+
+void mutex_init(mutex_t* mutex);
+void mutex_destroy(mutex_t* mutex);
+void mutex_lock(mutex_t* mutex);
+void mutex_unlock(mutex_t* mutex);
+
+// open addressing map from 64-bit keys to non-NULL pointers, grows as needed
+typedef struct hash_map {
+	uint64_t* keys;
+	void** vals;
+	size_t len;
+	size_t cap;
+} hash_map;
 
-typedef struct map {
-	const char** vals;
+void* hashmap_get(const hash_map* map, uint64_t key);
+void hashmap_put(hash_map* map, uint64_t key, void* val);
+void hashmap_free(hash_map* map);
+
+// bump allocator, everything in it is released at once by a reset
+typedef struct arena {
+	char* ptr;
+	char* end;
+	char** blocks;
+} arena;
+
+#define ARENA_ALIGNMENT 8
+#define ARENA_BLOCK_SIZE (64 * 1024)
+
+void* arena_alloc(arena* arena, size_t size);
+void arena_reset(arena* arena);
+void arena_free(arena* arena);
+
+// open addressing set of strings, the strings themselves live in an arena
+typedef struct string_set {
+	uint64_t* hashes;
+	const char** strs;
 	size_t len;
 	size_t cap;
-} hash_table;
+} string_set;
+
+const char* strset_intern(string_set* set, arena* arena, const char* str, bool* added);
+const char* strset_find(const string_set* set, const char* str);
+void strset_clear(string_set* set);
+void strset_free(string_set* set);
+
+uint64_t hash_bytes(const void* data, size_t len, uint64_t seed);
+uint64_t hash_content(const void* data, size_t len);
+#define HASH_SEED 0xCBF29CE484222325
+
+// resource paths compare case insensitively with either slash, like the engine does
+uint64_t hash_path(const char* path);
+bool path_equal(const char* a, const char* b);
+
+typedef struct file_info {
+	uint64_t size;
+	int64_t mtime;
+} file_info;
+
+bool get_file_info(const char* path, file_info* info);
+bool get_dir_mtime(const char* path, int64_t* mtime);
+
+// read only view of a whole file, memory mapped when possible, otherwise read into memory
+typedef struct mapped_file {
+	void* data;
+	size_t size;
+	bool mapped;
+#ifdef _WIN32
+	HANDLE mapping;
+#endif
+} mapped_file;
 
-hash_table* hashtable_create(size_t initial_size);
-void hashtable_add(hash_table* ht, const char* data);
-bool hashtable_contains(hash_table* ht, const char* data);
+bool map_file(const char* path, mapped_file* file);
+void unmap_file(mapped_file* file);
+bool touch_file(const char* path);
+bool rename_file(const char* from, const char* to);
+bool make_dir(const char* path);
+int process_id(void);
+double time_now(void);
 
 bool is_valid_file(const char* filepath);
 bool is_valid_dir(const char* path);
\ No newline at end of file
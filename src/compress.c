@@ -0,0 +1,607 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "compress.h"
+
+#pragma warning(push, 0)
+#include "miniz.h"
+#pragma warning(pop)
+
+typedef struct blob_cache {
+	mutex_t lock;
+	hash_map blobs;
+	size_t budget;
+	size_t bytes;
+	size_t hits;
+	size_t misses;
+} blob_cache;
+
+static blob_cache cache;
+
+typedef struct compress_policy {
+	const char* ext;
+	int level;
+	bool fixed;
+	size_t files;
+	size_t cached;
+	uint64_t in_bytes;
+	uint64_t out_bytes;
+	double seconds;
+} compress_policy;
+
+// every resource format archived, the last entry covers anything else
+static compress_policy policies[] = {
+	{ ".bsp", COMPRESS_DEFAULT_LEVEL },
+	{ ".mdl", COMPRESS_DEFAULT_LEVEL },
+	{ ".wav", COMPRESS_DEFAULT_LEVEL },
+	{ ".spr", COMPRESS_DEFAULT_LEVEL },
+	{ ".wad", COMPRESS_DEFAULT_LEVEL },
+	{ ".tga", COMPRESS_DEFAULT_LEVEL },
+	{ ".bmp", COMPRESS_DEFAULT_LEVEL },
+	{ ".txt", COMPRESS_DEFAULT_LEVEL },
+	{ ".res", COMPRESS_DEFAULT_LEVEL },
+	{ "other", COMPRESS_DEFAULT_LEVEL },
+};
+
+// picks the level for files without a fixed policy from the measured throughput
+typedef struct adaptive_level {
+	bool enabled;
+	double target_rate;
+	double deadline;
+	int level;
+	int min_level;
+	int max_level;
+	uint64_t total_bytes;
+	uint64_t window_bytes;
+	double window_start;
+	size_t maps_done;
+	size_t maps_total;
+} adaptive_level;
+
+static adaptive_level adaptive = { false, 0.0, 0.0, COMPRESS_DEFAULT_LEVEL, COMPRESS_DEFAULT_LEVEL, COMPRESS_DEFAULT_LEVEL };
+
+static mutex_t stats_lock;
+// cores no map worker or deflate thread holds, parallel deflate only borrows from these
+static mutex_t cores_lock;
+static int spare_cores = 0;
+static uint64_t stream_size = COMPRESS_STREAM_MIN;
+
+typedef struct deflate_block {
+	const uint8_t* data;
+	size_t len;
+	bool last;
+	uint8_t* out;
+	uint32_t crc;
+	bool success;
+} deflate_block;
+
+typedef struct parallel_deflate {
+	deflate_block* blocks;
+	size_t count;
+	size_t next;
+	mz_uint flags;
+	mutex_t lock;
+} parallel_deflate;
+
+static compress_policy* find_policy(const char* name) {
+	const char* ext = strrchr(name, '.');
+	if (ext) {
+		for (size_t i = 0; i < COUNT_OF(policies) - 1; ++i) {
+			if (strcasecmp(ext, policies[i].ext) == 0)
+				return &policies[i];
+		}
+	}
+	return &policies[COUNT_OF(policies) - 1];
+}
+
+// spec is <ext>=<level>, level being 0-10, store or auto
+bool compress_set_policy(const char* spec) {
+	char ext[16] = ".";
+	const char* value = strchr(spec, '=');
+	if (!value || value == spec || (size_t)(value - spec) >= sizeof(ext) - 1)
+		return false;
+
+	// accept both wav and .wav
+	if (*spec == '.') spec++;
+	strncat(ext, spec, value - spec);
+	value++;
+
+	int level;
+	if (strcasecmp(value, "store") == 0) {
+		level = 0;
+	}
+	else if (strcasecmp(value, "auto") == 0) {
+		level = COMPRESS_AUTO;
+	}
+	else {
+		char* end;
+		level = (int)strtol(value, &end, 10);
+		if (*value == 0 || *end != 0 || level < 0 || level > MZ_UBER_COMPRESSION)
+			return false;
+	}
+
+	for (size_t i = 0; i < COUNT_OF(policies); ++i) {
+		if (strcasecmp(ext, policies[i].ext) == 0 || strcasecmp(ext + 1, policies[i].ext) == 0) {
+			policies[i].level = level;
+			policies[i].fixed = true;
+			return true;
+		}
+	}
+	return false;
+}
+
+int compress_level(const char* name) {
+	const compress_policy* policy = find_policy(name);
+	if (adaptive.enabled && !policy->fixed)
+		return COMPRESS_ADAPTIVE;
+	return policy->level;
+}
+
+// a rate of 0 and no deadline turns the adaptive level off
+void compress_set_target(double mbps, double deadline_seconds) {
+	adaptive.enabled = mbps > 0.0 || deadline_seconds > 0.0;
+	adaptive.target_rate = mbps * 1024.0 * 1024.0;
+	adaptive.deadline = deadline_seconds > 0.0 ? time_now() + deadline_seconds : 0.0;
+	adaptive.level = adaptive.min_level = adaptive.max_level = COMPRESS_ADAPTIVE_START;
+	adaptive.window_start = time_now();
+}
+
+// set before any worker starts
+void compress_set_cores(int cores) {
+	spare_cores = cores;
+}
+
+// a map worker holds a core while it runs, it can go negative with more workers than cores
+void compress_worker_begin(void) {
+	mutex_lock(&cores_lock);
+	spare_cores--;
+	mutex_unlock(&cores_lock);
+}
+
+void compress_worker_end(void) {
+	mutex_lock(&cores_lock);
+	spare_cores++;
+	mutex_unlock(&cores_lock);
+}
+
+static int borrow_cores(int wanted) {
+	mutex_lock(&cores_lock);
+	int cores = max(min(wanted, spare_cores), 0);
+	spare_cores -= cores;
+	mutex_unlock(&cores_lock);
+	return cores;
+}
+
+static void return_cores(int cores) {
+	mutex_lock(&cores_lock);
+	spare_cores += cores;
+	mutex_unlock(&cores_lock);
+}
+
+void compress_set_stream_size(uint64_t bytes) {
+	stream_size = bytes;
+}
+
+bool compress_streamed(uint64_t size) {
+	return stream_size > 0 && size >= stream_size;
+}
+
+void compress_progress(size_t maps_done, size_t maps_total) {
+	mutex_lock(&stats_lock);
+	adaptive.maps_done = maps_done;
+	adaptive.maps_total = maps_total;
+	mutex_unlock(&stats_lock);
+}
+
+static int current_level(void) {
+	if (!adaptive.enabled)
+		return COMPRESS_DEFAULT_LEVEL;
+
+	mutex_lock(&stats_lock);
+	int level = adaptive.level;
+	mutex_unlock(&stats_lock);
+	return level;
+}
+
+// called with stats_lock held, steps the level once per window
+static void adapt_level(uint64_t bytes) {
+	adaptive.total_bytes += bytes;
+	adaptive.window_bytes += bytes;
+
+	double now = time_now();
+	double elapsed = now - adaptive.window_start;
+	if (elapsed < COMPRESS_ADAPTIVE_WINDOW)
+		return;
+
+	double rate = adaptive.window_bytes / elapsed;
+	double target = adaptive.target_rate;
+
+	if (adaptive.deadline > 0.0 && adaptive.maps_done > 0 && adaptive.maps_total > adaptive.maps_done) {
+		// estimate what is left from the average size of the maps done so far
+		double remaining_bytes = (double)adaptive.total_bytes / adaptive.maps_done * (adaptive.maps_total - adaptive.maps_done);
+		double remaining_time = max(adaptive.deadline - now, COMPRESS_ADAPTIVE_WINDOW);
+		target = max(target, remaining_bytes / remaining_time);
+	}
+
+	if (target > 0.0) {
+		if (rate < target && adaptive.level > COMPRESS_ADAPTIVE_MIN) {
+			adaptive.level--;
+		}
+		else if (rate > target * 1.25 && adaptive.level < COMPRESS_DEFAULT_LEVEL) {
+			adaptive.level++;
+		}
+		adaptive.min_level = min(adaptive.min_level, adaptive.level);
+		adaptive.max_level = max(adaptive.max_level, adaptive.level);
+	}
+
+	adaptive.window_bytes = 0;
+	adaptive.window_start = now;
+}
+
+void compress_record(const char* name, const zip_blob* blob, double seconds, bool cached) {
+	compress_policy* policy = find_policy(name);
+
+	mutex_lock(&stats_lock);
+	policy->files++;
+	if (cached) {
+		policy->cached++;
+	}
+	policy->in_bytes += blob->uncomp_size;
+	policy->out_bytes += blob->level ? blob->size : blob->uncomp_size;
+	policy->seconds += seconds;
+	// cached and stored files took no deflating, counting them would overstate the rate
+	if (adaptive.enabled && !cached && blob->level) {
+		adapt_level(blob->uncomp_size);
+	}
+	mutex_unlock(&stats_lock);
+}
+
+static void print_level(int level) {
+	if (level == COMPRESS_AUTO) {
+		printf("%-6s", "auto");
+	}
+	else if (level == COMPRESS_ADAPTIVE) {
+		printf("%-6s", "adapt");
+	}
+	else if (level == 0) {
+		printf("%-6s", "store");
+	}
+	else {
+		printf("%-6d", level);
+	}
+}
+
+void compress_print_stats(void) {
+	printf("%-6s %-6s %8s %8s %12s %12s %6s %9s\n", "type", "level", "files", "cached", "in (KB)", "out (KB)", "ratio", "time (s)");
+	for (size_t i = 0; i < COUNT_OF(policies); ++i) {
+		const compress_policy* p = &policies[i];
+		if (!p->files)
+			continue;
+
+		double ratio = p->out_bytes ? (double)p->in_bytes / (double)p->out_bytes : 0.0;
+		printf("%-6s ", p->ext);
+		print_level(adaptive.enabled && !p->fixed ? COMPRESS_ADAPTIVE : p->level);
+		printf(" %8llu %8llu %12.1f %12.1f %6.2f %9.2f\n", (unsigned long long)p->files, (unsigned long long)p->cached,
+			p->in_bytes / 1024.0, p->out_bytes / 1024.0, ratio, p->seconds);
+	}
+	if (adaptive.enabled) {
+		printf("adaptive level %d to %d, finished at %d\n", adaptive.min_level, adaptive.max_level, adaptive.level);
+	}
+}
+
+static size_t deflated_sample(const uint8_t* data, size_t len) {
+	uint8_t out[COMPRESS_AUTO_SAMPLE];
+	mz_uint flags = tdefl_create_comp_flags_from_zip_params(MZ_BEST_SPEED, -15, MZ_DEFAULT_STRATEGY);
+	size_t out_len = tdefl_compress_mem_to_mem(out, sizeof(out), data, len, (int)flags);
+	// 0 means it didn't fit in the output buffer, so it grew
+	return out_len ? out_len : len;
+}
+
+// trial compress a few spread out samples at the fastest level
+static bool is_compressible(const uint8_t* data, size_t len) {
+	size_t sample_len = min(len, (size_t)COMPRESS_AUTO_SAMPLE);
+	size_t samples = len <= COMPRESS_AUTO_SAMPLE * COMPRESS_AUTO_SAMPLES ? (len + COMPRESS_AUTO_SAMPLE - 1) / COMPRESS_AUTO_SAMPLE : COMPRESS_AUTO_SAMPLES;
+	size_t step = samples > 1 ? (len - sample_len) / (samples - 1) : 0;
+	uint64_t in_total = 0, out_total = 0;
+
+	for (size_t i = 0; i < samples; ++i) {
+		size_t offset = i * step;
+		size_t n = min(sample_len, len - offset);
+		in_total += n;
+		out_total += deflated_sample(data + offset, n);
+	}
+	return out_total < in_total * COMPRESS_AUTO_RATIO;
+}
+
+// resolves auto and adaptive levels for a streamed file, sampling its data at offset from disk
+int compress_file_level(FILE* fp, uint64_t offset, uint64_t size, int level) {
+	if (level == COMPRESS_ADAPTIVE)
+		return current_level();
+	if (level != COMPRESS_AUTO)
+		return level;
+
+	uint8_t sample[COMPRESS_AUTO_SAMPLE];
+	uint64_t step = (size - COMPRESS_AUTO_SAMPLE) / (COMPRESS_AUTO_SAMPLES - 1);
+	uint64_t in_total = 0, out_total = 0;
+
+	// only used for files far bigger than the samples
+	assert(size >= COMPRESS_AUTO_SAMPLE * COMPRESS_AUTO_SAMPLES);
+	for (size_t i = 0; i < COMPRESS_AUTO_SAMPLES; ++i) {
+		if (fseeko(fp, (int64_t)(offset + i * step), SEEK_SET) != 0)
+			break;
+		size_t n = fread(sample, 1, sizeof(sample), fp);
+		in_total += n;
+		out_total += deflated_sample(sample, n);
+	}
+	return out_total < in_total * COMPRESS_AUTO_RATIO ? current_level() : 0;
+}
+
+#define GF2_DIM 32
+
+static uint32_t gf2_matrix_times(const uint32_t* mat, uint32_t vec) {
+	uint32_t sum = 0;
+	while (vec) {
+		if (vec & 1)
+			sum ^= *mat;
+		vec >>= 1;
+		mat++;
+	}
+	return sum;
+}
+
+static void gf2_matrix_square(uint32_t* square, const uint32_t* mat) {
+	for (int n = 0; n < GF2_DIM; n++) {
+		square[n] = gf2_matrix_times(mat, mat[n]);
+	}
+}
+
+// crc of two concatenated buffers from their crcs, same as zlib's crc32_combine
+static uint32_t crc32_combine(uint32_t crc1, uint32_t crc2, uint64_t len2) {
+	uint32_t even[GF2_DIM];
+	uint32_t odd[GF2_DIM];
+
+	if (len2 == 0)
+		return crc1;
+
+	// operator for one zero bit in odd
+	odd[0] = 0xEDB88320;
+	uint32_t row = 1;
+	for (int n = 1; n < GF2_DIM; n++) {
+		odd[n] = row;
+		row <<= 1;
+	}
+
+	gf2_matrix_square(even, odd);
+	gf2_matrix_square(odd, even);
+
+	// apply len2 zeros to crc1, the first square puts the operator for one zero byte in even
+	do {
+		gf2_matrix_square(even, odd);
+		if (len2 & 1)
+			crc1 = gf2_matrix_times(even, crc1);
+		len2 >>= 1;
+		if (len2 == 0)
+			break;
+
+		gf2_matrix_square(odd, even);
+		if (len2 & 1)
+			crc1 = gf2_matrix_times(odd, crc1);
+		len2 >>= 1;
+	} while (len2 != 0);
+
+	return crc1 ^ crc2;
+}
+
+static mz_bool block_put_buf(const void* buf, int len, void* user) {
+	deflate_block* block = (deflate_block*)user;
+	buf_fit(block->out, buf_len(block->out) + len);
+	memcpy(buf_end(block->out), buf, len);
+	buf__hdr(block->out)->len += len;
+	return MZ_TRUE;
+}
+
+static void deflate_worker(void* arg) {
+	parallel_deflate* job = (parallel_deflate*)arg;
+	tdefl_compressor* comp = xmalloc(sizeof(tdefl_compressor));
+
+	for (;;) {
+		mutex_lock(&job->lock);
+		size_t index = job->next++;
+		mutex_unlock(&job->lock);
+
+		if (index >= job->count)
+			break;
+
+		// every block but the last ends in a sync flush so they can be joined byte aligned
+		deflate_block* block = &job->blocks[index];
+		tdefl_flush flush = block->last ? TDEFL_FINISH : TDEFL_SYNC_FLUSH;
+		tdefl_status expected = block->last ? TDEFL_STATUS_DONE : TDEFL_STATUS_OKAY;
+
+		block->crc = (uint32_t)mz_crc32(MZ_CRC32_INIT, block->data, block->len);
+		block->success = tdefl_init(comp, block_put_buf, block, (int)job->flags) == TDEFL_STATUS_OKAY &&
+			tdefl_compress_buffer(comp, block->data, block->len, flush) == expected;
+	}
+	free(comp);
+}
+
+// deflates independent blocks on the calling thread and helpers more, like pigz without a shared dictionary
+static bool parallel_compress(const uint8_t* data, size_t len, mz_uint flags, int helpers, zip_blob* blob) {
+	parallel_deflate job = { 0 };
+	job.count = (len + COMPRESS_BLOCK_SIZE - 1) / COMPRESS_BLOCK_SIZE;
+	job.blocks = xcalloc(job.count, sizeof(deflate_block));
+	job.flags = flags;
+	mutex_init(&job.lock);
+
+	for (size_t i = 0; i < job.count; ++i) {
+		job.blocks[i].data = data + i * COMPRESS_BLOCK_SIZE;
+		job.blocks[i].len = min((size_t)COMPRESS_BLOCK_SIZE, len - i * COMPRESS_BLOCK_SIZE);
+		job.blocks[i].last = i == job.count - 1;
+	}
+
+	thread_t* threads = NULL;
+	for (int i = 0; i < helpers; ++i) {
+		thread_t thread;
+		if (!thread_create(&thread, deflate_worker, &job))
+			break;
+		buf_push(threads, thread);
+	}
+	deflate_worker(&job);
+	for (size_t i = 0; i < buf_len(threads); ++i) {
+		thread_join(threads[i]);
+	}
+	buf_free(threads);
+	mutex_destroy(&job.lock);
+
+	bool success = true;
+	size_t comp_len = 0;
+	uint32_t crc = MZ_CRC32_INIT;
+	for (size_t i = 0; i < job.count; ++i) {
+		success = success && job.blocks[i].success;
+		comp_len += buf_len(job.blocks[i].out);
+		crc = crc32_combine(crc, job.blocks[i].crc, job.blocks[i].len);
+	}
+	blob->crc = crc;
+
+	if (success && comp_len < len) {
+		uint8_t* out = malloc(comp_len);
+		success = out != NULL;
+		if (out) {
+			size_t offset = 0;
+			for (size_t i = 0; i < job.count; ++i) {
+				memcpy(out + offset, job.blocks[i].out, buf_len(job.blocks[i].out));
+				offset += buf_len(job.blocks[i].out);
+			}
+			blob->data = out;
+			blob->size = comp_len;
+		}
+	}
+
+	for (size_t i = 0; i < job.count; ++i) {
+		buf_free(job.blocks[i].out);
+	}
+	free(job.blocks);
+	return success;
+}
+
+bool compress_blob(const void* data, size_t len, int level, zip_blob* blob) {
+	assert(blob != NULL);
+	assert(data != NULL || len == 0);
+
+	memset(blob, 0, sizeof(zip_blob));
+	blob->uncomp_size = len;
+
+	// same limit miniz uses before it refuses to deflate
+	if (level == 0 || len <= 3) {
+		blob->crc = (uint32_t)mz_crc32(MZ_CRC32_INIT, (const mz_uint8*)data, len);
+		return true;
+	}
+
+	if (level == COMPRESS_AUTO) {
+		if (!is_compressible((const uint8_t*)data, len)) {
+			blob->crc = (uint32_t)mz_crc32(MZ_CRC32_INIT, (const mz_uint8*)data, len);
+			return true;
+		}
+		level = current_level();
+	}
+	else if (level == COMPRESS_ADAPTIVE) {
+		level = current_level();
+	}
+
+	size_t comp_len = 0;
+	mz_uint flags = tdefl_create_comp_flags_from_zip_params(level, -15, MZ_DEFAULT_STRATEGY);
+	// blocks get their crc while they're deflated
+	size_t blocks = (len + COMPRESS_BLOCK_SIZE - 1) / COMPRESS_BLOCK_SIZE;
+	int helpers = len >= COMPRESS_PARALLEL_MIN ? borrow_cores((int)(blocks - 1)) : 0;
+	if (helpers > 0) {
+		bool success = parallel_compress((const uint8_t*)data, len, flags, helpers, blob);
+		return_cores(helpers);
+		// still stored if the blocks didn't shrink
+		if (success && blob->data) {
+			blob->level = level;
+		}
+		return success;
+	}
+
+	blob->crc = (uint32_t)mz_crc32(MZ_CRC32_INIT, (const mz_uint8*)data, len);
+
+	void* comp = tdefl_compress_mem_to_heap(data, len, &comp_len, (int)flags);
+	if (!comp)
+		return false;
+
+	if (comp_len >= len) {
+		// incompressible, store it instead
+		mz_free(comp);
+		return true;
+	}
+
+	blob->data = comp;
+	blob->size = comp_len;
+	blob->level = level;
+	return true;
+}
+
+void free_blob(zip_blob* blob) {
+	assert(blob != NULL);
+	if (blob->data) {
+		mz_free(blob->data);
+		blob->data = NULL;
+	}
+}
+
+uint64_t blob_key(const char* path, const file_info* info, int level) {
+	uint64_t key = hash_bytes(path, strlen(path), HASH_SEED);
+	key = hash_bytes(&info->size, sizeof(info->size), key);
+	key = hash_bytes(&info->mtime, sizeof(info->mtime), key);
+	return hash_bytes(&level, sizeof(level), key);
+}
+
+void compress_init(size_t cache_budget) {
+	mutex_init(&cache.lock);
+	cache.budget = cache_budget;
+	mutex_init(&stats_lock);
+	mutex_init(&cores_lock);
+}
+
+const zip_blob* blobcache_get(uint64_t key) {
+	mutex_lock(&cache.lock);
+	const zip_blob* blob = hashmap_get(&cache.blobs, key);
+	if (blob) {
+		cache.hits++;
+	}
+	else {
+		cache.misses++;
+	}
+	mutex_unlock(&cache.lock);
+	return blob;
+}
+
+const zip_blob* blobcache_put(uint64_t key, zip_blob* blob) {
+	assert(blob != NULL);
+
+	mutex_lock(&cache.lock);
+	zip_blob* cached = hashmap_get(&cache.blobs, key);
+	if (cached) {
+		// another worker compressed the same file first
+		free_blob(blob);
+	}
+	else if (cache.bytes + blob->size <= cache.budget) {
+		cached = xmalloc(sizeof(zip_blob));
+		*cached = *blob;
+		blob->data = NULL;
+		cache.bytes += cached->size;
+		hashmap_put(&cache.blobs, key, cached);
+	}
+	mutex_unlock(&cache.lock);
+	return cached;
+}
+
+void blobcache_stats(size_t* hits, size_t* misses, size_t* bytes) {
+	mutex_lock(&cache.lock);
+	*hits = cache.hits;
+	*misses = cache.misses;
+	*bytes = cache.bytes;
+	mutex_unlock(&cache.lock);
+}
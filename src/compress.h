@@ -0,0 +1,60 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include "common.h"
+
+// a zip entry payload ready to be written, level 0 means the data is stored
+typedef struct zip_blob {
+	void* data;
+	size_t size;
+	uint64_t uncomp_size;
+	uint32_t crc;
+	int level;
+} zip_blob;
+
+#define BLOBCACHE_BUDGET (256 * 1024 * 1024)
+
+// compress levels are 0 (store) to 10, auto stores files a trial compression shows won't shrink
+// and adaptive follows the level picked to meet the throughput target
+#define COMPRESS_AUTO -1
+#define COMPRESS_ADAPTIVE -2
+#define COMPRESS_DEFAULT_LEVEL 9
+#define COMPRESS_ADAPTIVE_MIN 1
+#define COMPRESS_ADAPTIVE_START 6
+#define COMPRESS_ADAPTIVE_WINDOW 0.5
+
+// files at least this big are split into blocks deflated on several threads
+#define COMPRESS_PARALLEL_MIN (4 * 1024 * 1024)
+#define COMPRESS_BLOCK_SIZE (1024 * 1024)
+// files at least this big skip the caches and are deflated straight from disk into the archive
+#define COMPRESS_STREAM_MIN (64 * 1024 * 1024)
+#define COMPRESS_AUTO_SAMPLE (16 * 1024)
+#define COMPRESS_AUTO_SAMPLES 4
+#define COMPRESS_AUTO_RATIO 0.95
+
+void compress_init(size_t cache_budget);
+bool compress_set_policy(const char* spec);
+void compress_set_target(double mbps, double deadline_seconds);
+void compress_progress(size_t maps_done, size_t maps_total);
+// parallel deflate only uses the cores that map workers don't hold
+void compress_set_cores(int cores);
+void compress_worker_begin(void);
+void compress_worker_end(void);
+void compress_set_stream_size(uint64_t bytes);
+bool compress_streamed(uint64_t size);
+int compress_file_level(FILE* fp, uint64_t offset, uint64_t size, int level);
+int compress_level(const char* name);
+void compress_record(const char* name, const zip_blob* blob, double seconds, bool cached);
+void compress_print_stats(void);
+
+bool compress_blob(const void* data, size_t len, int level, zip_blob* blob);
+void free_blob(zip_blob* blob);
+
+uint64_t blob_key(const char* path, const file_info* info, int level);
+
+const zip_blob* blobcache_get(uint64_t key);
+const zip_blob* blobcache_put(uint64_t key, zip_blob* blob);
+void blobcache_stats(size_t* hits, size_t* misses, size_t* bytes);
@@ -0,0 +1,169 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "depcache.h"
+#include "diskcache.h"
+#include "fileindex.h"
+
+// A record is the header, an input_info per input and then the strings:
+// each input's name and path followed by the dependencies, all nul terminated.
+// The same record is written under the path key and the lump key.
+
+#define DEPCACHE_MAGIC 0x44505342 // BSPD
+#define DEPCACHE_EXTENSION "deps"
+
+typedef struct depcache_header {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t lump_hash;
+	uint32_t dep_count;
+	uint32_t input_count;
+} depcache_header;
+
+typedef struct input_info {
+	uint64_t size;
+	int64_t mtime;
+	uint32_t found;
+	uint32_t reserved;
+} input_info;
+
+static uint64_t path_key(const char* bsp_path, const file_info* info) {
+	uint32_t version = DEPCACHE_VERSION;
+	uint64_t key = hash_bytes(bsp_path, strlen(bsp_path), HASH_SEED);
+	key = hash_bytes(info, sizeof(file_info), key);
+	return hash_bytes(&version, sizeof(version), key);
+}
+
+static uint64_t lump_key(uint64_t lump_hash) {
+	uint32_t version = DEPCACHE_VERSION;
+	return hash_bytes(&version, sizeof(version), lump_hash);
+}
+
+static const char* next_string(const char** p, const char* end) {
+	const char* str = *p;
+	const char* nul = memchr(str, 0, end - str);
+	if (!nul)
+		return NULL;
+	*p = nul + 1;
+	return str;
+}
+
+// an input is unchanged when it still resolves to the same file, or is still missing
+static bool input_unchanged(const char* name, const char* path, const input_info* input) {
+	// without an index, as with -d, the recorded file is checked directly
+	if (fileindex_count() == 0) {
+		file_info info;
+		return !input->found || (get_file_info(path, &info) && info.size == input->size && info.mtime == input->mtime);
+	}
+	const index_entry* entry = fileindex_find(name);
+	if (!entry || !input->found)
+		return !entry && !input->found;
+	return strcmp(entry->path, path) == 0 && entry->info.size == input->size && entry->info.mtime == input->mtime;
+}
+
+static bool load_list(uint64_t key, uint64_t lump_hash, bool check_lump, depcache_list* list) {
+	memset(list, 0, sizeof(depcache_list));
+	if (!diskcache_read_record(key, DEPCACHE_EXTENSION, &list->file))
+		return false;
+
+	const char* data = (const char*)list->file.data;
+	const char* end = data + list->file.size;
+	depcache_header header;
+	if (list->file.size < sizeof(header))
+		goto error;
+	memcpy(&header, data, sizeof(header));
+	if (header.magic != DEPCACHE_MAGIC || header.version != DEPCACHE_VERSION ||
+		(check_lump && header.lump_hash != lump_hash) ||
+		header.input_count > (list->file.size - sizeof(header)) / sizeof(input_info)) {
+		goto error;
+	}
+
+	const input_info* inputs = (const input_info*)(data + sizeof(header));
+	const char* p = (const char*)(inputs + header.input_count);
+	for (uint32_t i = 0; i < header.input_count; ++i) {
+		const char* name = next_string(&p, end);
+		const char* path = name ? next_string(&p, end) : NULL;
+		if (!path || !input_unchanged(name, path, &inputs[i]))
+			goto error;
+	}
+	for (uint32_t i = 0; i < header.dep_count; ++i) {
+		const char* dep = next_string(&p, end);
+		if (!dep)
+			goto error;
+		buf_push(list->deps, dep);
+	}
+	return true;
+error:
+	depcache_free(list);
+	return false;
+}
+
+bool depcache_find(const char* bsp_path, const file_info* info, depcache_list* list) {
+	assert(bsp_path != NULL);
+	return load_list(path_key(bsp_path, info), 0, false, list);
+}
+
+bool depcache_find_lump(uint64_t lump_hash, depcache_list* list) {
+	return load_list(lump_key(lump_hash), lump_hash, true, list);
+}
+
+static void append(char** record, const void* data, size_t len) {
+	buf_fit(*record, buf_len(*record) + len);
+	memcpy(*record + buf_len(*record), data, len);
+	buf__hdr(*record)->len += len;
+}
+
+static void push_string(char** record, const char* str) {
+	append(record, str, strlen(str) + 1);
+}
+
+void depcache_store(const char* bsp_path, const file_info* info, uint64_t lump_hash, const char** deps, size_t ndeps, const char** inputs) {
+	assert(bsp_path != NULL);
+	if (!diskcache_enabled())
+		return;
+
+	depcache_header header = { 0 };
+	header.magic = DEPCACHE_MAGIC;
+	header.version = DEPCACHE_VERSION;
+	header.lump_hash = lump_hash;
+	header.dep_count = (uint32_t)ndeps;
+	header.input_count = (uint32_t)buf_len(inputs);
+
+	char* record = NULL;
+	append(&record, &header, sizeof(header));
+	for (size_t i = 0; i < buf_len(inputs); ++i) {
+		const index_entry* entry = fileindex_find(inputs[i]);
+		input_info input = { 0 };
+		if (entry) {
+			input.size = entry->info.size;
+			input.mtime = entry->info.mtime;
+			input.found = 1;
+		}
+		append(&record, &input, sizeof(input));
+	}
+	for (size_t i = 0; i < buf_len(inputs); ++i) {
+		const index_entry* entry = fileindex_find(inputs[i]);
+		push_string(&record, inputs[i]);
+		push_string(&record, entry ? entry->path : "");
+	}
+	for (size_t i = 0; i < ndeps; ++i) {
+		push_string(&record, deps[i]);
+	}
+
+	diskcache_write_record(path_key(bsp_path, info), DEPCACHE_EXTENSION, record, buf_len(record));
+	diskcache_write_record(lump_key(lump_hash), DEPCACHE_EXTENSION, record, buf_len(record));
+	buf_free(record);
+}
+
+void depcache_link(const char* bsp_path, const file_info* info, const depcache_list* list) {
+	assert(bsp_path != NULL);
+	diskcache_write_record(path_key(bsp_path, info), DEPCACHE_EXTENSION, list->file.data, list->file.size);
+}
+
+void depcache_free(depcache_list* list) {
+	buf_free(list->deps);
+	unmap_file(&list->file);
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "common.h"
+
+// Dependency lists of maps, kept in the disk cache between runs. A list is
+// found by the bsp's path, size and mtime, or failing that by the hash of its
+// entity and texture lumps, so a touched or copied map isn't parsed again
+// either. Files read while resolving, like models, wads and sentences, are
+// recorded with the list and a change to any of them invalidates it.
+
+// bump whenever parsing changes what it finds
+#define DEPCACHE_VERSION 4
+
+typedef struct depcache_list {
+	const char** deps;
+	mapped_file file;
+} depcache_list;
+
+bool depcache_find(const char* bsp_path, const file_info* info, depcache_list* list);
+bool depcache_find_lump(uint64_t lump_hash, depcache_list* list);
+// inputs are names looked up in the file index, missing ones are recorded too
+void depcache_store(const char* bsp_path, const file_info* info, uint64_t lump_hash, const char** deps, size_t ndeps, const char** inputs);
+// stores a list found by its lump under the bsp's path too, inputs and all
+void depcache_link(const char* bsp_path, const file_info* info, const depcache_list* list);
+void depcache_free(depcache_list* list);
\ No newline at end of file
@@ -0,0 +1,362 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "common.h"
+#include "diskcache.h"
+
+#pragma warning(push, 0)
+#include "tinydir.h"
+#pragma warning(pop)
+
+// The cache directory holds two kinds of files:
+//   <content>-<level>.blob  deflated payload of a file, keyed by content hash
+//   <key>.ref               maps a path/size/mtime key to a content hash
+// so unchanged files are found without reading them and renamed or copied
+// files still share one blob. Refs with DISKCACHE_HASH_LEVEL have no blob,
+// they only save rehashing files checked against the exclusion hashes.
+//   <key>.deps              a map's dependency list, written by depcache.c
+// Files are written to a temp name and renamed
+// into place, which makes them safe to share between processes. Blob mtimes
+// are bumped on use and the oldest files are evicted once over the size cap.
+
+#define DISKCACHE_MAGIC 0x5A505342 // BSPZ
+#define DISKCACHE_VERSION 2
+#define DISKCACHE_TEMP_MAX_AGE (60 * 60)
+#define DISKCACHE_HASH_LEVEL -16
+
+typedef struct diskcache_ref {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t size;
+	int64_t mtime;
+	uint64_t content;
+	int32_t level;
+	int32_t reserved;
+} diskcache_ref;
+
+typedef struct diskcache_header {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t content;
+	uint64_t uncomp_size;
+	uint64_t comp_size;
+	uint32_t crc;
+	int32_t level;
+	int32_t blob_level;
+	int32_t reserved;
+} diskcache_header;
+
+typedef struct diskcache_file {
+	char name[MAX_PATH];
+	uint64_t size;
+	int64_t mtime;
+} diskcache_file;
+
+typedef struct disk_cache {
+	char dir[MAX_PATH];
+	uint64_t max_bytes;
+	mutex_t lock;
+	unsigned temp_counter;
+	bool enabled;
+} disk_cache;
+
+static disk_cache cache;
+
+// a path that doesn't fit fails the cache operation rather than using a truncated one
+static bool path_fits(int len) {
+	return len >= 0 && len < MAX_PATH;
+}
+
+static bool ref_path(char* path, uint64_t key) {
+	return path_fits(snprintf(path, MAX_PATH, "%s/%016llx.ref", cache.dir, (unsigned long long)key));
+}
+
+static bool blob_path(char* path, uint64_t content, int level) {
+	return path_fits(snprintf(path, MAX_PATH, "%s/%016llx-%d.blob", cache.dir, (unsigned long long)content, level));
+}
+
+static bool record_path(char* path, uint64_t key, const char* extension) {
+	return path_fits(snprintf(path, MAX_PATH, "%s/%016llx.%s", cache.dir, (unsigned long long)key, extension));
+}
+
+static bool temp_path(char* path) {
+	mutex_lock(&cache.lock);
+	unsigned counter = cache.temp_counter++;
+	mutex_unlock(&cache.lock);
+	return path_fits(snprintf(path, MAX_PATH, "%s/%d-%u.tmp", cache.dir, process_id(), counter));
+}
+
+static bool write_atomic(const char* path, const void* header, size_t header_size, const void* data, size_t size) {
+	char temp[MAX_PATH];
+	if (!temp_path(temp))
+		return false;
+
+	FILE* fp = fopen(temp, "wb");
+	if (!fp)
+		return false;
+
+	bool success = fwrite(header, 1, header_size, fp) == header_size;
+	if (success && size) {
+		success = fwrite(data, 1, size, fp) == size;
+	}
+	success = (fclose(fp) == 0) && success;
+
+	if (!success || !rename_file(temp, path)) {
+		remove(temp);
+		return false;
+	}
+	return true;
+}
+
+bool diskcache_open(const char* dir, uint64_t max_bytes) {
+	assert(dir != NULL);
+
+	if (strlen(dir) + 32 >= MAX_PATH || !make_dir(dir))
+		return false;
+
+	strcpy(cache.dir, dir);
+	cache.max_bytes = max_bytes;
+	mutex_init(&cache.lock);
+	cache.enabled = true;
+	return true;
+}
+
+bool diskcache_enabled(void) {
+	return cache.enabled;
+}
+
+static bool load_blob(uint64_t content, const file_info* info, int level, zip_blob* blob) {
+	char path[MAX_PATH];
+	if (!blob_path(path, content, level))
+		return false;
+
+	FILE* fp = fopen(path, "rb");
+	if (!fp)
+		return false;
+
+	bool success = false;
+	diskcache_header header;
+	if (fread(&header, sizeof(header), 1, fp) != 1 ||
+		header.magic != DISKCACHE_MAGIC || header.version != DISKCACHE_VERSION ||
+		header.content != content || header.uncomp_size != info->size || header.level != level ||
+		(header.comp_size && (header.blob_level < 1 || header.blob_level > 10))) {
+		goto exit;
+	}
+
+	memset(blob, 0, sizeof(zip_blob));
+	blob->uncomp_size = header.uncomp_size;
+	blob->crc = header.crc;
+
+	// a stored blob only records that the file doesn't compress
+	if (header.comp_size) {
+		blob->data = xmalloc((size_t)header.comp_size);
+		if (fread(blob->data, 1, (size_t)header.comp_size, fp) != header.comp_size) {
+			free_blob(blob);
+			goto exit;
+		}
+		blob->size = (size_t)header.comp_size;
+		blob->level = header.blob_level;
+	}
+	success = true;
+exit:
+	fclose(fp);
+	if (success) {
+		touch_file(path);
+	}
+	return success;
+}
+
+bool diskcache_find(uint64_t key, const file_info* info, int level, zip_blob* blob) {
+	if (!cache.enabled)
+		return false;
+
+	char path[MAX_PATH];
+	if (!ref_path(path, key))
+		return false;
+
+	FILE* fp = fopen(path, "rb");
+	if (!fp)
+		return false;
+
+	diskcache_ref ref;
+	bool valid = fread(&ref, sizeof(ref), 1, fp) == 1 &&
+		ref.magic == DISKCACHE_MAGIC && ref.version == DISKCACHE_VERSION &&
+		ref.size == info->size && ref.mtime == info->mtime && ref.level == level;
+	fclose(fp);
+
+	if (valid && load_blob(ref.content, info, level, blob)) {
+		touch_file(path);
+		return true;
+	}
+	return false;
+}
+
+static void store_ref(uint64_t key, const file_info* info, uint64_t content, int level) {
+	char path[MAX_PATH];
+	if (!ref_path(path, key))
+		return;
+
+	diskcache_ref ref = { 0 };
+	ref.magic = DISKCACHE_MAGIC;
+	ref.version = DISKCACHE_VERSION;
+	ref.size = info->size;
+	ref.mtime = info->mtime;
+	ref.content = content;
+	ref.level = level;
+	write_atomic(path, &ref, sizeof(ref), NULL, 0);
+}
+
+bool diskcache_find_content(uint64_t key, const file_info* info, uint64_t content, int level, zip_blob* blob) {
+	if (!cache.enabled)
+		return false;
+
+	if (load_blob(content, info, level, blob)) {
+		store_ref(key, info, content, level);
+		return true;
+	}
+	return false;
+}
+
+void diskcache_store(uint64_t key, const file_info* info, uint64_t content, int level, const zip_blob* blob) {
+	if (!cache.enabled)
+		return;
+
+	char path[MAX_PATH];
+	if (!blob_path(path, content, level))
+		return;
+
+	diskcache_header header = { 0 };
+	header.magic = DISKCACHE_MAGIC;
+	header.version = DISKCACHE_VERSION;
+	header.content = content;
+	header.uncomp_size = blob->uncomp_size;
+	header.comp_size = blob->level ? blob->size : 0;
+	header.crc = blob->crc;
+	header.level = level;
+	header.blob_level = blob->level;
+
+	if (write_atomic(path, &header, sizeof(header), blob->data, (size_t)header.comp_size)) {
+		store_ref(key, info, content, level);
+	}
+}
+
+bool diskcache_find_hash(const char* path, const file_info* info, uint64_t* content) {
+	if (!cache.enabled)
+		return false;
+
+	char ref_name[MAX_PATH];
+	if (!ref_path(ref_name, blob_key(path, info, DISKCACHE_HASH_LEVEL)))
+		return false;
+
+	FILE* fp = fopen(ref_name, "rb");
+	if (!fp)
+		return false;
+
+	diskcache_ref ref;
+	bool valid = fread(&ref, sizeof(ref), 1, fp) == 1 &&
+		ref.magic == DISKCACHE_MAGIC && ref.version == DISKCACHE_VERSION &&
+		ref.size == info->size && ref.mtime == info->mtime && ref.level == DISKCACHE_HASH_LEVEL;
+	fclose(fp);
+
+	if (valid) {
+		touch_file(ref_name);
+		*content = ref.content;
+	}
+	return valid;
+}
+
+void diskcache_store_hash(const char* path, const file_info* info, uint64_t content) {
+	if (!cache.enabled)
+		return;
+
+	store_ref(blob_key(path, info, DISKCACHE_HASH_LEVEL), info, content, DISKCACHE_HASH_LEVEL);
+}
+
+bool diskcache_read_record(uint64_t key, const char* extension, mapped_file* file) {
+	if (!cache.enabled)
+		return false;
+
+	char path[MAX_PATH];
+	if (!record_path(path, key, extension) || !is_valid_file(path) || !map_file(path, file))
+		return false;
+	touch_file(path);
+	return true;
+}
+
+bool diskcache_write_record(uint64_t key, const char* extension, const void* data, size_t size) {
+	if (!cache.enabled)
+		return false;
+
+	char path[MAX_PATH];
+	return record_path(path, key, extension) && write_atomic(path, data, size, NULL, 0);
+}
+
+static int compare_mtime(const void* a, const void* b) {
+	const diskcache_file* fa = (const diskcache_file*)a;
+	const diskcache_file* fb = (const diskcache_file*)b;
+	return (fa->mtime > fb->mtime) - (fa->mtime < fb->mtime);
+}
+
+// evicts the least recently used files until the cache fits its size cap
+static void diskcache_evict(void) {
+	tinydir_dir dir;
+	if (tinydir_open(&dir, cache.dir) != 0)
+		return;
+
+	diskcache_file* files = NULL;
+	uint64_t total = 0;
+	int64_t now = (int64_t)time(NULL);
+
+	while (dir.has_next) {
+		tinydir_file file;
+		tinydir_readfile(&dir, &file);
+		tinydir_next(&dir);
+
+		file_info info;
+		if (file.is_dir || !get_file_info(file.path, &info))
+			continue;
+
+		if (strcmp(file.extension, "tmp") == 0) {
+			// left behind by a process that died mid write
+			if (now - info.mtime > DISKCACHE_TEMP_MAX_AGE) {
+				remove(file.path);
+			}
+			continue;
+		}
+		if (strcmp(file.extension, "blob") != 0 && strcmp(file.extension, "ref") != 0 && strcmp(file.extension, "deps") != 0)
+			continue;
+
+		diskcache_file entry;
+		if (!path_fits(snprintf(entry.name, MAX_PATH, "%s", file.path)))
+			continue;
+		entry.size = info.size;
+		entry.mtime = info.mtime;
+		buf_push(files, entry);
+		total += info.size;
+	}
+	tinydir_close(&dir);
+
+	if (total > cache.max_bytes) {
+		qsort(files, buf_len(files), sizeof(diskcache_file), compare_mtime);
+
+		for (size_t i = 0; i < buf_len(files) && total > cache.max_bytes; ++i) {
+			// another process may have removed or be using it, either way skip it
+			if (remove(files[i].name) == 0) {
+				total -= files[i].size;
+			}
+		}
+	}
+	buf_free(files);
+}
+
+void diskcache_close(void) {
+	if (!cache.enabled)
+		return;
+
+	diskcache_evict();
+	mutex_destroy(&cache.lock);
+	cache.enabled = false;
+}
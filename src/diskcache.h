@@ -0,0 +1,22 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "common.h"
+#include "compress.h"
+
+#define DISKCACHE_DEFAULT_SIZE_MB 1024
+
+bool diskcache_open(const char* dir, uint64_t max_bytes);
+void diskcache_close(void);
+bool diskcache_enabled(void);
+
+bool diskcache_find(uint64_t key, const file_info* info, int level, zip_blob* blob);
+bool diskcache_find_content(uint64_t key, const file_info* info, uint64_t content, int level, zip_blob* blob);
+void diskcache_store(uint64_t key, const file_info* info, uint64_t content, int level, const zip_blob* blob);
+// content hashes by path, size and mtime, so unchanged files aren't read again to be hashed
+bool diskcache_find_hash(const char* path, const file_info* info, uint64_t* content);
+void diskcache_store_hash(const char* path, const file_info* info, uint64_t content);
+// other small files kept under the same eviction, read from a mapping
+bool diskcache_read_record(uint64_t key, const char* extension, mapped_file* file);
+bool diskcache_write_record(uint64_t key, const char* extension, const void* data, size_t size);
\ No newline at end of file
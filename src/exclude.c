@@ -0,0 +1,233 @@
+#include <assert.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "exclude.h"
+
+// content is the hash_content of the stock file, 0 when any file by that name is excluded
+typedef struct manifest_slot {
+	uint32_t fingerprint;
+	uint64_t content;
+	const char* name;
+} manifest_slot;
+
+#include "../res/goldsrc-manifest.h"
+
+#define EXCLUDE_MAX_LINE 1024
+
+// one node per path component, names are case folded and live in the arena
+typedef struct exclude_node {
+	const char* name;
+	size_t len;
+	struct exclude_node** children;
+	uint64_t content;
+	bool exact;
+	bool subtree;
+} exclude_node;
+
+typedef struct exclude_rules {
+	exclude_node manifest;
+	exclude_node user;
+	arena names;
+	bool use_manifest;
+} exclude_rules;
+
+static exclude_rules rules = { .use_manifest = true };
+
+// must match tools/mkmanifest.c
+static uint64_t manifest_mix(uint64_t x) {
+	x ^= x >> 33;
+	x *= 0xFF51AFD7ED558CCD;
+	x ^= x >> 33;
+	x *= 0xC4CEB9FE1A85EC53;
+	x ^= x >> 33;
+	return x;
+}
+
+static bool manifest_contains(const char* name, uint64_t* content) {
+	uint64_t hash = hash_path(name);
+	uint32_t seed = manifest_seeds[(uint32_t)(hash >> 32) % MANIFEST_BUCKETS];
+	const manifest_slot* slot = &manifest_slots[manifest_mix(hash ^ seed) % MANIFEST_COUNT];
+	if (slot->fingerprint != (uint32_t)hash || !path_equal(slot->name, name))
+		return false;
+	*content = slot->content;
+	return true;
+}
+
+static bool is_separator(char c) {
+	return c == '/' || c == '\\';
+}
+
+// the component starting at path, returns its length
+static size_t next_component(const char* path) {
+	size_t len = 0;
+	while (path[len] && !is_separator(path[len])) {
+		len++;
+	}
+	return len;
+}
+
+static exclude_node* find_child(const exclude_node* node, const char* name, size_t len) {
+	for (size_t i = 0; i < buf_len(node->children); ++i) {
+		exclude_node* child = node->children[i];
+		if (child->len == len && strncasecmp(child->name, name, len) == 0)
+			return child;
+	}
+	return NULL;
+}
+
+static void add_rule(exclude_node* node, const char* rule, uint64_t content) {
+	bool subtree = false;
+	while (*rule) {
+		while (is_separator(*rule)) {
+			rule++;
+		}
+		size_t len = next_component(rule);
+		if (len == 0) {
+			// a trailing separator
+			subtree = true;
+			break;
+		}
+		if (len == 1 && rule[0] == '*' && !rule[1]) {
+			subtree = true;
+			break;
+		}
+
+		exclude_node* child = find_child(node, rule, len);
+		if (!child) {
+			child = arena_alloc(&rules.names, sizeof(exclude_node));
+			memset(child, 0, sizeof(exclude_node));
+			char* name = arena_alloc(&rules.names, len + 1);
+			for (size_t i = 0; i < len; ++i) {
+				name[i] = (char)tolower((unsigned char)rule[i]);
+			}
+			name[len] = 0;
+			child->name = name;
+			child->len = len;
+			buf_push(node->children, child);
+		}
+		node = child;
+		rule += len;
+	}
+
+	if (node == &rules.manifest || node == &rules.user)
+		return;
+	if (subtree) {
+		node->subtree = true;
+	}
+	else {
+		node->exact = true;
+		node->content = content;
+	}
+}
+
+static bool trie_contains(const exclude_node* node, const char* name, uint64_t* content) {
+	while (*name) {
+		size_t len = next_component(name);
+		node = find_child(node, name, len);
+		if (!node)
+			return false;
+
+		name += len;
+		while (is_separator(*name)) {
+			name++;
+		}
+		// anything below a subtree rule, but not the directory itself
+		if (node->subtree && *name) {
+			*content = 0;
+			return true;
+		}
+	}
+	*content = node->content;
+	return node->exact;
+}
+
+static void free_node(exclude_node* node) {
+	for (size_t i = 0; i < buf_len(node->children); ++i) {
+		free_node(node->children[i]);
+	}
+	buf_free(node->children);
+}
+
+void exclude_init(void) {
+	for (size_t i = 0; manifest_dirs[i]; ++i) {
+		add_rule(&rules.manifest, manifest_dirs[i], 0);
+	}
+}
+
+// -s turns off the built in lists, user rules still apply
+void exclude_use_manifest(bool use) {
+	rules.use_manifest = use;
+}
+
+// a quoted rule may be followed by a content hash in hex, "path", 0x0123456789ABCDEF
+static uint64_t parse_content(char** rule) {
+	char* end = strchr(*rule + 1, '"');
+	if (**rule != '"' || !end)
+		return 0;
+
+	*end = 0;
+	char* hex = end + 1;
+	while (isspace((unsigned char)*hex) || *hex == ',') {
+		hex++;
+	}
+	(*rule)++;
+	return strtoull(hex, NULL, 16);
+}
+
+// also reads the manifest's own "path", format so lists can be copied from it
+bool exclude_load(const char* path) {
+	FILE* fp = fopen(path, "r");
+	if (!fp)
+		return false;
+
+	char line[EXCLUDE_MAX_LINE];
+	while (fgets(line, sizeof(line), fp)) {
+		char* rule = line;
+		while (isspace((unsigned char)*rule)) {
+			rule++;
+		}
+		if (!*rule || *rule == '#' || (rule[0] == '/' && rule[1] == '/'))
+			continue;
+
+		char* end = rule + strlen(rule);
+		while (end > rule && (isspace((unsigned char)end[-1]) || end[-1] == ',')) {
+			*--end = 0;
+		}
+		uint64_t content = parse_content(&rule);
+		if (*rule) {
+			add_rule(&rules.user, rule, content);
+		}
+	}
+	fclose(fp);
+	return true;
+}
+
+// names match regardless of case and slash direction
+bool exclude_lookup(const char* name, uint64_t* content) {
+	assert(name != NULL);
+	assert(content != NULL);
+	while (is_separator(*name)) {
+		name++;
+	}
+	if (rules.use_manifest && (manifest_contains(name, content) || trie_contains(&rules.manifest, name, content)))
+		return true;
+	return trie_contains(&rules.user, name, content);
+}
+
+bool exclude_contains(const char* name) {
+	uint64_t content;
+	return exclude_lookup(name, &content);
+}
+
+void exclude_free(void) {
+	free_node(&rules.manifest);
+	free_node(&rules.user);
+	arena_free(&rules.names);
+	memset(&rules.manifest, 0, sizeof(exclude_node));
+	memset(&rules.user, 0, sizeof(exclude_node));
+}
\ No newline at end of file
@@ -0,0 +1,19 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// Files that are left out of archives. The files shipped with the games are
+// looked up in a perfect hash generated at build time, directory rules and
+// user rule files go in a trie over path components. Everything is loaded
+// before archiving starts and only read afterwards, so any thread can look up.
+// Rules can carry the content hash of the stock file, then only a file with
+// those exact bytes is stock and a modified copy is still archived.
+
+void exclude_init(void);
+void exclude_use_manifest(bool use);
+// one rule per line, a trailing slash or /* excludes everything under a directory
+bool exclude_load(const char* path);
+// content is the hash the file must have to be excluded, 0 when the name alone is enough
+bool exclude_lookup(const char* name, uint64_t* content);
+bool exclude_contains(const char* name);
+void exclude_free(void);
\ No newline at end of file
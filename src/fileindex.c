@@ -0,0 +1,749 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "diskcache.h"
+#include "fileindex.h"
+
+#pragma warning(push, 0)
+#include "tinydir.h"
+#pragma warning(pop)
+
+// guards against symlinked directory loops
+#define INDEX_MAX_DEPTH 32
+
+// A snapshot is the header, the string offsets of the roots, the paks, the
+// directories, the entries and then the string table. Names are stored relative to
+// their root or pak so the full paths are rebuilt on load the same way the scan builds them.
+#define SNAPSHOT_MAGIC 0x49505342 // BSPI
+#define SNAPSHOT_VERSION 2
+
+typedef struct snapshot_header {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t root_count;
+	uint32_t pak_count;
+	uint64_t entry_count;
+	uint64_t strings_size;
+	uint64_t dir_count;
+} snapshot_header;
+
+// a pak that changed since the snapshot invalidates it, the offsets point into it
+typedef struct snapshot_pak {
+	uint64_t size;
+	int64_t mtime;
+	uint32_t path;
+	int32_t number;
+} snapshot_pak;
+
+// files added to or removed from a directory change its mtime, the root itself has an empty name
+typedef struct snapshot_dir {
+	int64_t mtime;
+	uint32_t name;
+	int32_t root;
+} snapshot_dir;
+
+typedef struct snapshot_entry {
+	uint64_t size;
+	int64_t mtime;
+	uint64_t offset;
+	uint64_t content;
+	uint32_t name;
+	int32_t root;
+	int32_t pak; // -1 for loose files
+	int32_t hashed;
+} snapshot_entry;
+
+// a top level directory of a root, each is walked by a single thread
+typedef struct index_dir {
+	char* path;
+	size_t name_offset;
+	int root;
+} index_dir;
+
+// every directory walked, kept for the snapshot
+typedef struct scanned_dir {
+	char* path;
+	const char* name;
+	int64_t mtime;
+	int root;
+} scanned_dir;
+
+typedef struct pending_pak {
+	char* path;
+	int root;
+	int number;
+} pending_pak;
+
+typedef struct file_index {
+	char roots[FILEINDEX_MAX_ROOTS][MAX_PATH];
+	int root_count;
+	hash_map entries;
+	index_entry* list;
+	index_dir* dirs;
+	scanned_dir* scanned;
+	pending_pak* pending;
+	pak_archive** paks;
+	char** errors;
+	size_t next_dir;
+	size_t next_hash;
+	mutex_t lock;
+	bool locked;
+} file_index;
+
+static file_index files;
+
+static void read_entry_info(const tinydir_dir* dir, const tinydir_file* file, file_info* info) {
+#ifdef _MSC_VER
+	// the find data already has what we need, no need to stat every file
+	(void)file;
+	info->size = ((uint64_t)dir->_f.nFileSizeHigh << 32) | dir->_f.nFileSizeLow;
+	// 100ns ticks since 1601 to seconds since 1970
+	uint64_t ticks = ((uint64_t)dir->_f.ftLastWriteTime.dwHighDateTime << 32) | dir->_f.ftLastWriteTime.dwLowDateTime;
+	info->mtime = (int64_t)(ticks / 10000000) - 11644473600LL;
+#else
+	(void)dir;
+	info->size = (uint64_t)file->_s.st_size;
+	info->mtime = (int64_t)file->_s.st_mtime;
+#endif
+}
+
+static void push_entry(index_entry** found, const tinydir_dir* dir, const tinydir_file* file, size_t name_offset, int root) {
+	index_entry entry = { 0 };
+	entry.path = strdup(file->path);
+	entry.name = entry.path + name_offset;
+	entry.root = root;
+	read_entry_info(dir, file, &entry.info);
+	buf_push(*found, entry);
+}
+
+static bool is_dot_dir(const tinydir_file* file) {
+	return strcmp(file->name, ".") == 0 || strcmp(file->name, "..") == 0;
+}
+
+static void push_dir(scanned_dir** scanned, const tinydir_dir* dir, const tinydir_file* file, size_t name_offset, int root) {
+	scanned_dir entry = { 0 };
+	file_info info;
+	read_entry_info(dir, file, &info);
+	entry.path = strdup(file->path);
+	entry.name = entry.path + name_offset;
+	entry.mtime = info.mtime;
+	entry.root = root;
+	buf_push(*scanned, entry);
+}
+
+static void scan_dir(const char* path, size_t name_offset, int root, int depth, index_entry** found, scanned_dir** scanned) {
+	tinydir_dir dir;
+	if (depth > INDEX_MAX_DEPTH || tinydir_open(&dir, path) != 0)
+		return;
+
+	while (dir.has_next) {
+		tinydir_file file;
+		if (tinydir_readfile(&dir, &file) == 0 && !is_dot_dir(&file)) {
+			if (file.is_dir) {
+				push_dir(scanned, &dir, &file, name_offset, root);
+				scan_dir(file.path, name_offset, root, depth + 1, found, scanned);
+			}
+			else if (file.is_reg) {
+				push_entry(found, &dir, &file, name_offset, root);
+			}
+		}
+		tinydir_next(&dir);
+	}
+	tinydir_close(&dir);
+}
+
+static void scan_worker(void* arg) {
+	(void)arg;
+	index_entry* found = NULL;
+	scanned_dir* scanned = NULL;
+
+	for (;;) {
+		mutex_lock(&files.lock);
+		size_t i = files.next_dir++;
+		mutex_unlock(&files.lock);
+		if (i >= buf_len(files.dirs))
+			break;
+
+		const index_dir* dir = &files.dirs[i];
+		scan_dir(dir->path, dir->name_offset, dir->root, 1, &found, &scanned);
+	}
+
+	mutex_lock(&files.lock);
+	for (size_t i = 0; i < buf_len(found); ++i) {
+		buf_push(files.list, found[i]);
+	}
+	for (size_t i = 0; i < buf_len(scanned); ++i) {
+		buf_push(files.scanned, scanned[i]);
+	}
+	mutex_unlock(&files.lock);
+	buf_free(found);
+	buf_free(scanned);
+}
+
+// files at the top of a root are indexed right away, directories are queued for the workers
+static void scan_root(const char* root_path, int root) {
+	tinydir_dir dir;
+	scanned_dir self = { strdup(root_path), NULL, 0, root };
+	self.name = self.path + strlen(self.path);
+	if (!get_dir_mtime(root_path, &self.mtime) || tinydir_open(&dir, root_path) != 0) {
+		free(self.path);
+		return;
+	}
+	buf_push(files.scanned, self);
+
+	while (dir.has_next) {
+		tinydir_file file;
+		if (tinydir_readfile(&dir, &file) == 0 && !is_dot_dir(&file)) {
+			size_t name_offset = strlen(file.path) - strlen(file.name);
+			int number;
+			if (file.is_dir) {
+				index_dir entry = { strdup(file.path), name_offset, root };
+				buf_push(files.dirs, entry);
+				push_dir(&files.scanned, &dir, &file, name_offset, root);
+			}
+			else if (file.is_reg && pak_is_archive_name(file.name, &number)) {
+				pending_pak pak = { strdup(file.path), root, number };
+				buf_push(files.pending, pak);
+			}
+			else if (file.is_reg) {
+				push_entry(&files.list, &dir, &file, name_offset, root);
+			}
+		}
+		tinydir_next(&dir);
+	}
+	tinydir_close(&dir);
+}
+
+static void mount_pak(const pending_pak* pending) {
+	pak_archive* pak = xmalloc(sizeof(pak_archive));
+	if (!pak_open(pending->path, pak)) {
+		buf_push(files.errors, strdup(pending->path));
+		free(pak);
+		return;
+	}
+	pak->number = pending->number;
+	buf_push(files.paks, pak);
+
+	size_t path_len = strlen(pak->path);
+	char name[PAK_NAME_LENGTH + 1];
+	for (size_t i = 0; i < pak->count; ++i) {
+		index_entry entry = { 0 };
+		if (!pak_entry(pak, i, name, &entry.offset, &entry.info.size))
+			continue;
+
+		// shown as <pak>/<name> and keyed on that by the compression caches
+		entry.path = xmalloc(path_len + strlen(name) + 2);
+		sprintf(entry.path, "%s/%s", pak->path, name);
+		entry.name = entry.path + path_len + 1;
+		entry.info.mtime = pak->info.mtime;
+		entry.root = pending->root;
+		entry.pak = pak;
+		buf_push(files.list, entry);
+	}
+}
+
+// loose files come before paks in the same root, and later paks before earlier ones
+static bool entry_precedes(const index_entry* a, const index_entry* b) {
+	if (a->root != b->root)
+		return a->root < b->root;
+	if (!a->pak || !b->pak)
+		return !a->pak && b->pak;
+	return a->pak->number > b->pak->number;
+}
+
+// the list is done growing, so entries can be referenced now
+static void resolve_entries(void) {
+	for (size_t i = 0; i < buf_len(files.list); ++i) {
+		index_entry* entry = &files.list[i];
+		uint64_t key = hash_path(entry->name);
+		const index_entry* existing = hashmap_get(&files.entries, key);
+		if (!existing || entry_precedes(entry, existing)) {
+			hashmap_put(&files.entries, key, entry);
+		}
+	}
+}
+
+bool fileindex_build(const char** roots, int count, int threads) {
+	assert(roots != NULL);
+	fileindex_free();
+	mutex_init(&files.lock);
+	files.locked = true;
+
+	files.root_count = min(count, FILEINDEX_MAX_ROOTS);
+	for (int i = 0; i < files.root_count; ++i) {
+		snprintf(files.roots[i], MAX_PATH, "%s", roots[i]);
+		scan_root(roots[i], i);
+	}
+
+	int nthreads = (int)min((size_t)max(threads, 1), buf_len(files.dirs));
+	thread_t* workers = NULL;
+	for (int i = 1; i < nthreads; ++i) {
+		thread_t thread;
+		if (!thread_create(&thread, scan_worker, NULL))
+			break;
+		buf_push(workers, thread);
+	}
+	scan_worker(NULL);
+	for (size_t i = 0; i < buf_len(workers); ++i) {
+		thread_join(workers[i]);
+	}
+	buf_free(workers);
+
+	for (size_t i = 0; i < buf_len(files.dirs); ++i) {
+		free(files.dirs[i].path);
+	}
+	buf_free(files.dirs);
+	files.next_dir = 0;
+
+	for (size_t i = 0; i < buf_len(files.pending); ++i) {
+		mount_pak(&files.pending[i]);
+		free(files.pending[i].path);
+	}
+	buf_free(files.pending);
+
+	resolve_entries();
+	return buf_len(files.list) > 0;
+}
+
+static int add_search_paths(char roots[][MAX_PATH], int count, const char* mod_dir) {
+	static const char* suffixes[] = { "_addon", "_hd", "", "_downloads" };
+	for (int i = 0; i < COUNT_OF(suffixes) && count < FILEINDEX_MAX_ROOTS; ++i) {
+		snprintf(roots[count], MAX_PATH, "%s%s", mod_dir, suffixes[i]);
+		if (is_valid_dir(roots[count])) {
+			count++;
+		}
+	}
+	return count;
+}
+
+// the roots fileindex_mount indexes for a gamedir, returns how many there are
+static int search_paths(const char* gamedir, char roots[][MAX_PATH]) {
+	char mod_dir[MAX_PATH];
+	snprintf(mod_dir, MAX_PATH, "%s", gamedir);
+	size_t len = strlen(mod_dir);
+	while (len > 1 && (mod_dir[len - 1] == '/' || mod_dir[len - 1] == '\\')) {
+		mod_dir[--len] = 0;
+	}
+	int count = add_search_paths(roots, 0, mod_dir);
+
+	// mods fall back to the base game next to them
+	char* mod_name = mod_dir + len;
+	while (mod_name != mod_dir && mod_name[-1] != '/' && mod_name[-1] != '\\') {
+		mod_name--;
+	}
+	if (strcasecmp(mod_name, FILEINDEX_FALLBACK_MOD) != 0) {
+		strcpy(mod_name, FILEINDEX_FALLBACK_MOD);
+		count = add_search_paths(roots, count, mod_dir);
+	}
+	return count;
+}
+
+bool fileindex_mount(const char* gamedir, int threads) {
+	assert(gamedir != NULL);
+	char roots[FILEINDEX_MAX_ROOTS][MAX_PATH];
+	const char* root_list[FILEINDEX_MAX_ROOTS];
+
+	int count = search_paths(gamedir, roots);
+	for (int i = 0; i < count; ++i) {
+		root_list[i] = roots[i];
+	}
+	return fileindex_build(root_list, count, threads);
+}
+
+int fileindex_root_count(void) {
+	return files.root_count;
+}
+
+const char* fileindex_root(int root) {
+	assert(root >= 0 && root < files.root_count);
+	return files.roots[root];
+}
+
+// a loose file from a snapshot may have been edited or deleted since, its hash goes with the old bytes
+static bool check_entry(const index_entry* entry) {
+	mutex_lock(&files.lock);
+	bool stale = entry->stale;
+	mutex_unlock(&files.lock);
+	if (stale) {
+		file_info info;
+		bool found = get_file_info(entry->path, &info);
+		mutex_lock(&files.lock);
+		index_entry* owned = (index_entry*)entry;
+		if (owned->stale) {
+			owned->missing = !found;
+			if (found && (info.size != owned->info.size || info.mtime != owned->info.mtime)) {
+				owned->info = info;
+				owned->content = 0;
+				owned->hashed = false;
+			}
+			owned->stale = false;
+		}
+		mutex_unlock(&files.lock);
+	}
+	return !entry->missing;
+}
+
+const index_entry* fileindex_find(const char* name) {
+	assert(name != NULL);
+	while (*name == '/' || *name == '\\') {
+		name++;
+	}
+	const index_entry* entry = hashmap_get(&files.entries, hash_path(name));
+	if (entry && (!path_equal(entry->name, name) || !check_entry(entry)))
+		return NULL;
+	return entry;
+}
+
+bool fileindex_content(const index_entry* entry, uint64_t* content) {
+	assert(entry != NULL);
+	mutex_lock(&files.lock);
+	bool hashed = entry->hashed;
+	*content = entry->content;
+	mutex_unlock(&files.lock);
+	if (hashed)
+		return true;
+
+	if (!diskcache_find_hash(entry->path, &entry->info, content)) {
+		if (entry->pak) {
+			*content = hash_content(pak_data(entry->pak, entry->offset), (size_t)entry->info.size);
+		}
+		else {
+			mapped_file file;
+			if (!map_file(entry->path, &file))
+				return false;
+			*content = hash_content(file.data, file.size);
+			unmap_file(&file);
+		}
+		diskcache_store_hash(entry->path, &entry->info, *content);
+	}
+
+	// two threads may hash the same file, both get the same answer
+	mutex_lock(&files.lock);
+	index_entry* owned = (index_entry*)entry;
+	owned->content = *content;
+	owned->hashed = true;
+	mutex_unlock(&files.lock);
+	return true;
+}
+
+static void hash_worker(void* arg) {
+	(void)arg;
+	for (;;) {
+		mutex_lock(&files.lock);
+		size_t i = files.next_hash++;
+		mutex_unlock(&files.lock);
+		if (i >= buf_len(files.list))
+			break;
+
+		uint64_t content;
+		if (!fileindex_content(&files.list[i], &content)) {
+			mutex_lock(&files.lock);
+			buf_push(files.errors, strdup(files.list[i].path));
+			mutex_unlock(&files.lock);
+		}
+	}
+}
+
+void fileindex_hash_all(int threads) {
+	files.next_hash = 0;
+	int nthreads = (int)min((size_t)max(threads, 1), buf_len(files.list));
+	thread_t* workers = NULL;
+	for (int i = 1; i < nthreads; ++i) {
+		thread_t thread;
+		if (!thread_create(&thread, hash_worker, NULL))
+			break;
+		buf_push(workers, thread);
+	}
+	hash_worker(NULL);
+	for (size_t i = 0; i < buf_len(workers); ++i) {
+		thread_join(workers[i]);
+	}
+	buf_free(workers);
+}
+
+static uint32_t push_string(char** strings, const char* str) {
+	uint32_t offset = (uint32_t)buf_len(*strings);
+	for (; *str; ++str) {
+		buf_push(*strings, *str == '\\' ? '/' : *str);
+	}
+	buf_push(*strings, 0);
+	return offset;
+}
+
+static int32_t pak_number(const pak_archive* pak) {
+	for (size_t i = 0; i < buf_len(files.paks); ++i) {
+		if (files.paks[i] == pak)
+			return (int32_t)i;
+	}
+	return -1;
+}
+
+// an empty table is a NULL buf, which fwrite mustn't be given
+static bool write_table(FILE* fp, const void* table, size_t size, size_t count) {
+	return count == 0 || fwrite(table, size, count, fp) == count;
+}
+
+bool fileindex_save(const char* path) {
+	assert(path != NULL);
+	char* strings = NULL;
+	uint64_t* roots = NULL;
+	snapshot_pak* paks = NULL;
+	snapshot_dir* dirs = NULL;
+	snapshot_entry* entries = NULL;
+
+	for (int i = 0; i < files.root_count; ++i) {
+		buf_push(roots, push_string(&strings, files.roots[i]));
+	}
+	for (size_t i = 0; i < buf_len(files.paks); ++i) {
+		const pak_archive* pak = files.paks[i];
+		snapshot_pak saved = { pak->info.size, pak->info.mtime, push_string(&strings, pak->path), pak->number };
+		buf_push(paks, saved);
+	}
+	for (size_t i = 0; i < buf_len(files.scanned); ++i) {
+		const scanned_dir* dir = &files.scanned[i];
+		snapshot_dir saved = { dir->mtime, push_string(&strings, dir->name), dir->root };
+		buf_push(dirs, saved);
+	}
+	for (size_t i = 0; i < buf_len(files.list); ++i) {
+		const index_entry* entry = &files.list[i];
+		snapshot_entry saved = { 0 };
+		saved.size = entry->info.size;
+		saved.mtime = entry->info.mtime;
+		saved.offset = entry->offset;
+		saved.content = entry->content;
+		saved.name = push_string(&strings, entry->name);
+		saved.root = entry->root;
+		saved.pak = entry->pak ? pak_number(entry->pak) : -1;
+		saved.hashed = entry->hashed;
+		buf_push(entries, saved);
+	}
+
+	snapshot_header header = { 0 };
+	header.magic = SNAPSHOT_MAGIC;
+	header.version = SNAPSHOT_VERSION;
+	header.root_count = (uint32_t)buf_len(roots);
+	header.pak_count = (uint32_t)buf_len(paks);
+	header.entry_count = buf_len(entries);
+	header.strings_size = buf_len(strings);
+	header.dir_count = buf_len(dirs);
+
+	char temp[MAX_PATH];
+	bool success = false;
+	FILE* fp = NULL;
+	if (snprintf(temp, MAX_PATH, "%s.tmp", path) >= MAX_PATH || (fp = fopen(temp, "wb")) == NULL)
+		goto exit;
+
+	success = write_table(fp, &header, sizeof(header), 1) &&
+		write_table(fp, roots, sizeof(uint64_t), buf_len(roots)) &&
+		write_table(fp, paks, sizeof(snapshot_pak), buf_len(paks)) &&
+		write_table(fp, dirs, sizeof(snapshot_dir), buf_len(dirs)) &&
+		write_table(fp, entries, sizeof(snapshot_entry), buf_len(entries)) &&
+		write_table(fp, strings, 1, buf_len(strings));
+	success = (fclose(fp) == 0) && success;
+
+	if (!success || !rename_file(temp, path)) {
+		remove(temp);
+		success = false;
+	}
+exit:
+	buf_free(strings);
+	buf_free(roots);
+	buf_free(paks);
+	buf_free(dirs);
+	buf_free(entries);
+	return success;
+}
+
+static char* join_path(const char* dir, const char* name, const char** relative) {
+	size_t len = strlen(dir);
+	char* path = xmalloc(len + strlen(name) + 2);
+	sprintf(path, "%s/%s", dir, name);
+	*relative = path + len + 1;
+	return path;
+}
+
+// fails if the file isn't a snapshot of gamedir's search paths or a pak or directory it lists has changed since
+bool fileindex_load(const char* path, const char* gamedir) {
+	assert(path != NULL);
+	assert(gamedir != NULL);
+	char expected[FILEINDEX_MAX_ROOTS][MAX_PATH];
+	int expected_count = search_paths(gamedir, expected);
+	fileindex_free();
+	mutex_init(&files.lock);
+	files.locked = true;
+
+	mapped_file file;
+	if (!map_file(path, &file))
+		return false;
+
+	bool success = false;
+	const uint8_t* data = (const uint8_t*)file.data;
+	snapshot_header header;
+	if (file.size < sizeof(header))
+		goto exit;
+	memcpy(&header, data, sizeof(header));
+
+	uint64_t tables_size = header.root_count * sizeof(uint64_t) + (uint64_t)header.pak_count * sizeof(snapshot_pak);
+	if (header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION ||
+		header.root_count > FILEINDEX_MAX_ROOTS || header.entry_count > file.size / sizeof(snapshot_entry) ||
+		header.dir_count > file.size / sizeof(snapshot_dir) ||
+		sizeof(header) + tables_size + header.dir_count * sizeof(snapshot_dir) +
+		header.entry_count * sizeof(snapshot_entry) + header.strings_size != file.size) {
+		goto exit;
+	}
+
+	const uint64_t* roots = (const uint64_t*)(data + sizeof(header));
+	const snapshot_pak* paks = (const snapshot_pak*)(roots + header.root_count);
+	const snapshot_dir* dirs = (const snapshot_dir*)(paks + header.pak_count);
+	const snapshot_entry* entries = (const snapshot_entry*)(dirs + header.dir_count);
+	const char* strings = (const char*)(entries + header.entry_count);
+	if (header.strings_size == 0 || strings[header.strings_size - 1] != 0)
+		goto exit;
+
+	if ((int)header.root_count != expected_count)
+		goto exit;
+	for (uint32_t i = 0; i < header.root_count; ++i) {
+		if (roots[i] >= header.strings_size || !path_equal(strings + roots[i], expected[i]))
+			goto exit;
+		snprintf(files.roots[i], MAX_PATH, "%s", strings + roots[i]);
+	}
+	files.root_count = (int)header.root_count;
+
+	for (uint32_t i = 0; i < header.pak_count; ++i) {
+		if (paks[i].path >= header.strings_size)
+			goto exit;
+		pak_archive* pak = xmalloc(sizeof(pak_archive));
+		if (!pak_open(strings + paks[i].path, pak)) {
+			free(pak);
+			goto exit;
+		}
+		pak->number = paks[i].number;
+		buf_push(files.paks, pak);
+		if (pak->info.size != paks[i].size || pak->info.mtime != paks[i].mtime)
+			goto exit;
+	}
+
+	// one stat per directory is still far cheaper than listing them all again
+	for (uint64_t i = 0; i < header.dir_count; ++i) {
+		const snapshot_dir* saved = &dirs[i];
+		if (saved->name >= header.strings_size || saved->root < 0 || saved->root >= files.root_count)
+			goto exit;
+
+		const char* name = strings + saved->name;
+		const char* relative;
+		char* dir_path = *name ? join_path(files.roots[saved->root], name, &relative) : strdup(files.roots[saved->root]);
+		int64_t mtime;
+		bool unchanged = get_dir_mtime(dir_path, &mtime) && mtime == saved->mtime;
+		free(dir_path);
+		if (!unchanged)
+			goto exit;
+	}
+
+	for (uint64_t i = 0; i < header.entry_count; ++i) {
+		const snapshot_entry* saved = &entries[i];
+		if (saved->name >= header.strings_size || saved->root < 0 || saved->root >= files.root_count ||
+			saved->pak < -1 || saved->pak >= (int32_t)header.pak_count) {
+			goto exit;
+		}
+
+		index_entry entry = { 0 };
+		const char* name = strings + saved->name;
+		if (saved->pak >= 0) {
+			entry.pak = files.paks[saved->pak];
+			if (saved->offset > entry.pak->file.size || saved->size > entry.pak->file.size - saved->offset)
+				goto exit;
+			entry.path = join_path(entry.pak->path, name, &entry.name);
+		}
+		else {
+			entry.path = join_path(files.roots[saved->root], name, &entry.name);
+			entry.stale = true;
+		}
+		entry.info.size = saved->size;
+		entry.info.mtime = saved->mtime;
+		entry.root = saved->root;
+		entry.offset = saved->offset;
+		entry.content = saved->content;
+		entry.hashed = saved->hashed != 0;
+		buf_push(files.list, entry);
+	}
+
+	resolve_entries();
+	success = true;
+exit:
+	unmap_file(&file);
+	if (!success) {
+		fileindex_free();
+	}
+	return success;
+}
+
+static int compare_entry_names(const void* a, const void* b) {
+	const index_entry* x = *(const index_entry* const*)a;
+	const index_entry* y = *(const index_entry* const*)b;
+	return strcasecmp(x->name, y->name);
+}
+
+const index_entry** fileindex_resolved(void) {
+	const index_entry** resolved = NULL;
+	for (size_t i = 0; i < buf_len(files.list); ++i) {
+		const index_entry* entry = &files.list[i];
+		if (hashmap_get(&files.entries, hash_path(entry->name)) == entry && check_entry(entry)) {
+			buf_push(resolved, entry);
+		}
+	}
+	if (resolved) {
+		qsort((void*)resolved, buf_len(resolved), sizeof(index_entry*), compare_entry_names);
+	}
+	return resolved;
+}
+
+size_t fileindex_pak_count(void) {
+	return buf_len(files.paks);
+}
+
+const pak_archive* fileindex_pak(size_t index) {
+	assert(index < buf_len(files.paks));
+	return files.paks[index];
+}
+
+size_t fileindex_count(void) {
+	return files.entries.len;
+}
+
+char** fileindex_take_errors(void) {
+	char** errors = files.errors;
+	files.errors = NULL;
+	return errors;
+}
+
+void fileindex_free(void) {
+	for (size_t i = 0; i < buf_len(files.list); ++i) {
+		free(files.list[i].path);
+	}
+	buf_free(files.list);
+	hashmap_free(&files.entries);
+	for (size_t i = 0; i < buf_len(files.scanned); ++i) {
+		free(files.scanned[i].path);
+	}
+	buf_free(files.scanned);
+
+	for (size_t i = 0; i < buf_len(files.paks); ++i) {
+		pak_close(files.paks[i]);
+		free(files.paks[i]);
+	}
+	buf_free(files.paks);
+	files.root_count = 0;
+
+	for (size_t i = 0; i < buf_len(files.errors); ++i) {
+		free(files.errors[i]);
+	}
+	buf_free(files.errors);
+
+	if (files.locked) {
+		mutex_destroy(&files.lock);
+		files.locked = false;
+	}
+}
\ No newline at end of file
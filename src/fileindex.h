@@ -0,0 +1,57 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "common.h"
+#include "pak.h"
+
+// a file found under one of the indexed roots, name is relative to the root
+// files inside a pak have the pak set and are read from its mapping at offset
+// content is filled in the first time fileindex_content hashes the entry
+// loose files loaded from a snapshot are stale until fileindex_find checks them again
+typedef struct index_entry {
+	char* path;
+	const char* name;
+	file_info info;
+	int root;
+	const pak_archive* pak;
+	uint64_t offset;
+	uint64_t content;
+	bool hashed;
+	bool stale;
+	bool missing;
+} index_entry;
+
+#define FILEINDEX_MAX_ROOTS 8
+#define FILEINDEX_FALLBACK_MOD "valve"
+
+// scans the roots once with a pool of threads, earlier roots win when a file is in more than one
+// pakN.pak files at the top of a root are mounted too, loose files win over their contents
+bool fileindex_build(const char** roots, int count, int threads);
+// indexes a mod's search paths in the order the engine uses them:
+// <mod>_addon, <mod>_hd, <mod>, <mod>_downloads, then the same for valve
+bool fileindex_mount(const char* gamedir, int threads);
+int fileindex_root_count(void);
+const char* fileindex_root(int root);
+size_t fileindex_pak_count(void);
+const pak_archive* fileindex_pak(size_t index);
+const index_entry* fileindex_find(const char* name);
+// hash_content of the entry's bytes, each file is read at most once per run and
+// not at all when the disk cache has a hash for its size and mtime
+bool fileindex_content(const index_entry* entry, uint64_t* content);
+// hashes every indexed file with a pool of threads
+void fileindex_hash_all(int threads);
+// a snapshot holds the roots, paks, directories and every file with its size, mtime and hash,
+// loading one stands in for scanning the roots again. It fails when gamedir's search paths
+// differ or once a pak or directory changed, and loose files are checked with a stat when
+// they're first looked up
+bool fileindex_save(const char* path);
+bool fileindex_load(const char* path, const char* gamedir);
+// the files that win their name, sorted by name, free with buf_free
+const index_entry** fileindex_resolved(void);
+size_t fileindex_count(void);
+// the paths of files that couldn't be read while indexing or hashing, the caller
+// prints and frees them; workers don't print so their output can't interleave
+char** fileindex_take_errors(void);
+void fileindex_free(void);
\ No newline at end of file
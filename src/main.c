@@ -6,6 +6,9 @@
 
 #include "archive.h"
 #include "common.h"
+#include "diskcache.h"
+#include "compress.h"
+#include "exclude.h"
 
 #pragma warning(push, 0)  
 #include "argtable3.h"
@@ -16,17 +19,19 @@
 bool g_verbose;
 bool g_noexclude;
 bool g_overwrite;
-
-hash_table* exclude_table;
-
-static struct arg_lit *a_verbose, *a_help, *a_version, *a_depsonly, *a_noexclude, *a_overwrite;
-static struct arg_file *a_gamedir, *a_file, *a_output;
+bool g_update;
+bool g_changed;
+bool g_trim_wads;
+int g_threads;
+const char* g_snapshot;
+
+static struct arg_lit *a_verbose, *a_help, *a_version, *a_depsonly, *a_noexclude, *a_overwrite, *a_update, *a_changed, *a_trimwads, *a_stats, *a_printmanifest;
+static struct arg_int *a_jobs, *a_cachesize, *a_streamsize;
+static struct arg_str *a_compress, *a_deadline;
+static struct arg_dbl *a_targetmbps;
+static struct arg_file *a_gamedir, *a_file, *a_output, *a_cache, *a_excludelist, *a_snapshot;
 static struct arg_end *end;
 
-static const char* const exclude_list[] = {
-	#include "../res/goldsrc-manifest.lst"
-};
-
 static const char* gamedir_folders[] = {
 	"sound",
 	"gfx",
@@ -84,19 +89,22 @@ static const char* find_gamedir(const char* input, bool is_input_dir) {
 	return gamedir;
 }
 
-void load_exclude_manifest() {
-	size_t items = COUNT_OF(exclude_list);
-
-	exclude_table = hashtable_create(items);
-	assert(exclude_table != NULL);
-	
-	for(size_t i = 0; i < items; ++i) {
-		hashtable_add(exclude_table, exclude_list[i]);
+// a number followed by s, m or h, minutes if there is no unit
+static double parse_duration(const char* text) {
+	char* end;
+	double value = strtod(text, &end);
+	if (end == text || value <= 0.0)
+		return -1.0;
+
+	switch (*end) {
+	case 's': case 'S': break;
+	case 0: case 'm': case 'M': value *= 60.0; break;
+	case 'h': case 'H': value *= 60.0 * 60.0; break;
+	default: return -1.0;
 	}
-
-	assert(hashtable_contains(exclude_table, "sound/hgrunt/fire!.wav"));
-	assert(hashtable_contains(exclude_table, "sprites/fog5.spr"));
-	assert(hashtable_contains(exclude_table, "gfx/vgui/fonts/800_title font.tga"));
+	if (*end && end[1])
+		return -1.0;
+	return value;
 }
 
 int main(int argc, char* argv[]) {
@@ -109,9 +117,23 @@ int main(int argc, char* argv[]) {
 		a_version = arg_litn("V", "version", 0, 1, "print version information and exit"),
 		a_depsonly = arg_litn("d", "justdeps", 0, 1, "output only the list of dependencies for the input bsp"),
 		a_overwrite = arg_litn("f", "overwrite", 0, 1, "overwrite zip files in the output directory"),
-		a_noexclude = arg_litn("s", "noexclude", 0, 1, "files in exclusion list are included"),
+		a_update = arg_litn("u", "update", 0, 1, "update zip files in the output directory, unchanged files are copied without compressing them again"),
+		a_changed = arg_litn(NULL, "changed", 0, 1, "rebuild only zip files whose map or dependencies changed since they were written"),
+		a_trimwads = arg_litn(NULL, "trim-wads", 0, 1, "archive wads with only the textures the map uses from them, extracting one replaces the full wad"),
+		a_noexclude = arg_litn("s", "noexclude", 0, 1, "files in the built-in exclusion list are included"),
+		a_jobs = arg_intn("j", "jobs", "<N>", 0, 1, "number of maps to archive at once (default: cpu count)"),
 		a_gamedir = arg_filen("g", "gamedir", "<PATH>", 0, 1, "the game directory"),
 		a_output = arg_filen("o", "output", "<PATH>", 0, 1, "where to output the zip files"),
+		a_excludelist = arg_filen(NULL, "exclude-list", "<FILE>", 0, 8, "also exclude the files or directories (ending in /) listed in FILE"),
+		a_cache = arg_filen(NULL, "cache", "<DIR>", 0, 1, "keep compressed files in DIR to reuse on later runs"),
+		a_cachesize = arg_intn(NULL, "cache-size", "<MB>", 0, 1, "size limit of the cache directory (default: 1024)"),
+		a_compress = arg_strn(NULL, "compress", "<EXT=LEVEL>", 0, 32, "compression for a file type: 0-10, store or auto"),
+		a_stats = arg_litn(NULL, "stats", 0, 1, "print compression time and ratio per file type"),
+		a_targetmbps = arg_dbln(NULL, "target-mbps", "<MB/s>", 0, 1, "adjust compression level to archive at least this fast"),
+		a_deadline = arg_strn(NULL, "deadline", "<TIME>", 0, 1, "adjust compression level to finish a map directory within TIME (e.g. 90s, 20m, 2h)"),
+		a_streamsize = arg_intn(NULL, "stream-size", "<MB>", 0, 1, "deflate files this big straight from disk, 0 to disable (default: 64)"),
+		a_snapshot = arg_filen(NULL, "snapshot", "<FILE>", 0, 1, "read the game directory from FILE instead of scanning it, FILE is written when missing"),
+		a_printmanifest = arg_litn(NULL, "print-manifest", 0, 1, "print PATH as an exclusion list with content hashes and exit"),
 		a_file = arg_filen(NULL, NULL, "<PATH>", 1, 1, "bsp file or map directories"),
 		end = arg_end(20),
 	};
@@ -146,6 +168,44 @@ int main(int argc, char* argv[]) {
 	g_verbose = a_verbose->count > 0;
 	g_noexclude = a_noexclude->count > 0;
 	g_overwrite = a_overwrite->count > 0;
+	g_update = a_update->count > 0;
+	g_changed = a_changed->count > 0;
+	g_trim_wads = a_trimwads->count > 0;
+	g_threads = a_jobs->count > 0 ? a_jobs->ival[0] : cpu_count();
+	g_snapshot = a_snapshot->count > 0 ? a_snapshot->filename[0] : NULL;
+
+	if (g_threads < 1) {
+		printf("Invalid number of jobs: %d\n", g_threads);
+		rc = EXIT_FAILURE;
+		goto exit;
+	}
+
+	double target_mbps = a_targetmbps->count > 0 ? a_targetmbps->dval[0] : 0.0;
+	double deadline = a_deadline->count > 0 ? parse_duration(a_deadline->sval[0]) : 0.0;
+	if (target_mbps < 0.0 || deadline < 0.0) {
+		printf("Invalid throughput target or deadline\n");
+		rc = EXIT_FAILURE;
+		goto exit;
+	}
+	compress_set_target(target_mbps, deadline);
+	compress_set_cores(cpu_count());
+
+	if (a_streamsize->count > 0) {
+		if (a_streamsize->ival[0] < 0) {
+			printf("Invalid stream size: %d\n", a_streamsize->ival[0]);
+			rc = EXIT_FAILURE;
+			goto exit;
+		}
+		compress_set_stream_size((uint64_t)a_streamsize->ival[0] * 1024 * 1024);
+	}
+
+	for (int i = 0; i < a_compress->count; ++i) {
+		if (!compress_set_policy(a_compress->sval[i])) {
+			printf("Invalid compression setting: %s\n", a_compress->sval[i]);
+			rc = EXIT_FAILURE;
+			goto exit;
+		}
+	}
 	
 	assert(a_file->count == 1);
 	assert(a_gamedir->count <= 1);
@@ -155,9 +215,26 @@ int main(int argc, char* argv[]) {
 	
 	bool is_input_dir = false;
 
+	if (a_printmanifest->count > 0) {
+		if (!is_valid_dir(input)) {
+			printf("Game directory could not be found %s\n", input);
+			rc = EXIT_FAILURE;
+			goto exit;
+		}
+		archive_init();
+		rc = archive_print_manifest(input);
+		goto exit;
+	}
+
 	if (is_valid_dir(input)) {
 		is_input_dir = true;
 	} else {
+		// the deadline's target comes from the maps left to archive
+		if (deadline > 0.0) {
+			printf("--deadline needs a directory of maps\n");
+			rc = EXIT_FAILURE;
+			goto exit;
+		}
 		if(strncasecmp(a_file->extension[0], ".bsp", 3) != 0) {
 			printf("Invalid file: %s\nOnly .bsp files supported for archival.", input);
 			rc = EXIT_FAILURE;
@@ -170,7 +247,26 @@ int main(int argc, char* argv[]) {
 		}
 	}
 	
-	load_exclude_manifest();
+	exclude_init();
+	exclude_use_manifest(!g_noexclude);
+	for (int i = 0; i < a_excludelist->count; ++i) {
+		if (!exclude_load(a_excludelist->filename[i])) {
+			printf("Exclusion list could not be read: %s\n", a_excludelist->filename[i]);
+			rc = EXIT_FAILURE;
+			goto exit;
+		}
+	}
+	archive_init();
+
+	// -d reuses cached dependency lists too
+	if (a_cache->count > 0) {
+		int cache_size = a_cachesize->count > 0 ? a_cachesize->ival[0] : DISKCACHE_DEFAULT_SIZE_MB;
+		if (cache_size < 1 || !diskcache_open(a_cache->filename[0], (uint64_t)cache_size * 1024 * 1024)) {
+			printf("Invalid cache directory or size: %s\n", a_cache->filename[0]);
+			rc = EXIT_FAILURE;
+			goto exit;
+		}
+	}
 
 	if(a_depsonly->count > 0) {
 		if(is_input_dir) {
@@ -178,7 +274,9 @@ int main(int argc, char* argv[]) {
 			rc = EXIT_FAILURE;
 			goto exit;
 		}
-		rc = archive_print_deps(input);
+		gamedir = a_gamedir->count == 1 ? a_gamedir->filename[0] : find_gamedir(input, false);
+		rc = archive_print_deps(input, is_valid_gamedir(gamedir) ? gamedir : NULL);
+		diskcache_close();
 		goto exit;
 	}
 	
@@ -222,14 +320,20 @@ int main(int argc, char* argv[]) {
 	if(g_verbose) {
 		printf("Game directory: %s\n", gamedir);
 	}
-	
+
 	if(is_input_dir) {
 		rc = archive_bsp_dir(input, output, gamedir);
 	}
 	else {
 		rc = archive_bsp(input, output, gamedir);
 	}
+	diskcache_close();
+
+	if (a_stats->count > 0) {
+		compress_print_stats();
+	}
 exit:
+	exclude_free();
 	arg_freetable(argtable, COUNT_OF(argtable));
 	return rc;
 }
@@ -0,0 +1,80 @@
+#include <assert.h>
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "common.h"
+#include "mdl.h"
+
+// offsets and counts come from the file, a table is only read if it lies inside it
+static bool table_in_file(size_t len, int32_t offset, int32_t count, size_t size) {
+	return offset >= 0 && count >= 0 && (size_t)offset <= len && (size_t)count <= (len - (size_t)offset) / size;
+}
+
+static void read_event_sound(const mdlevent* event, mdl_dependency_reader reader, void* user) {
+	char sound[sizeof("sound/") + sizeof(event->options)];
+	char* out = sound + strlen(strcpy(sound, "sound/"));
+	const char* options = event->options;
+	// a leading * marks a streamed sound
+	if (*options == '*') {
+		options++;
+	}
+	for (size_t i = 0; options + i < event->options + sizeof(event->options) && options[i]; ++i) {
+		char c = options[i];
+		*out++ = c == '\\' ? '/' : (char)tolower((unsigned char)c);
+	}
+	*out = 0;
+
+	size_t len = strlen(sound);
+	if (len > 4 && strcmp(sound + len - 4, ".wav") == 0) {
+		reader(user, sound);
+	}
+}
+
+bool mdl_read_dependencies(const void* data, size_t len, const char* name, mdl_dependency_reader reader, void* user) {
+	assert(name != NULL);
+	assert(reader != NULL);
+
+	mdlheader header;
+	if (len < sizeof(header))
+		return false;
+	memcpy(&header, data, sizeof(header));
+	// sequence group and texture files have their own magic and nothing to follow
+	if (memcmp(header.magic, MDL_MAGIC, 4) != 0 || header.version != MDL_VERSION)
+		return false;
+
+	size_t name_len = strlen(name);
+	if (name_len < 4 || name_len + 8 > MAX_PATH)
+		return false;
+	char path[MAX_PATH];
+	memcpy(path, name, name_len - 4);
+
+	if (header.numtextures == 0) {
+		strcpy(path + name_len - 4, "T.mdl");
+		reader(user, path);
+	}
+	for (int32_t i = 1; i < min(header.numseqgroups, MDL_MAX_GROUPS); ++i) {
+		sprintf(path + name_len - 4, "%02d.mdl", i);
+		reader(user, path);
+	}
+
+	const uint8_t* bytes = (const uint8_t*)data;
+	if (!table_in_file(len, header.seqindex, header.numseq, sizeof(mdlseqdesc)))
+		return false;
+	for (int32_t i = 0; i < header.numseq; ++i) {
+		mdlseqdesc seq;
+		memcpy(&seq, bytes + header.seqindex + i * sizeof(mdlseqdesc), sizeof(seq));
+		if (!table_in_file(len, seq.eventindex, seq.numevents, sizeof(mdlevent)))
+			continue;
+
+		for (int32_t j = 0; j < seq.numevents; ++j) {
+			mdlevent event;
+			memcpy(&event, bytes + seq.eventindex + j * sizeof(mdlevent), sizeof(event));
+			if (event.event == MDL_EVENT_CLIENT_SOUND || event.event == MDL_EVENT_SCRIPT_SOUND ||
+				event.event == MDL_EVENT_SCRIPT_SOUND_VOICE) {
+				read_event_sound(&event, reader, user);
+			}
+		}
+	}
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// GoldSrc studio models, only the parts that name other files are read:
+// a model without textures loads them from <name>T.mdl, sequence groups past
+// the first are in <name>01.mdl and up, and animation events can play sounds.
+
+#define MDL_MAGIC "IDST"
+#define MDL_VERSION 10
+#define MDL_MAX_GROUPS 100
+
+// events that play the sound named in their options
+#define MDL_EVENT_SCRIPT_SOUND 1004
+#define MDL_EVENT_SCRIPT_SOUND_VOICE 1008
+#define MDL_EVENT_CLIENT_SOUND 5004
+
+typedef struct mdlheader {
+	char magic[4];
+	int32_t version;
+	char name[64];
+	int32_t length;
+	float eyeposition[3];
+	float min[3];
+	float max[3];
+	float bbmin[3];
+	float bbmax[3];
+	int32_t flags;
+	int32_t numbones;
+	int32_t boneindex;
+	int32_t numbonecontrollers;
+	int32_t bonecontrollerindex;
+	int32_t numhitboxes;
+	int32_t hitboxindex;
+	int32_t numseq;
+	int32_t seqindex;
+	int32_t numseqgroups;
+	int32_t seqgroupindex;
+	int32_t numtextures;
+	int32_t textureindex;
+	int32_t texturedataindex;
+} mdlheader;
+
+typedef struct mdlseqdesc {
+	char label[32];
+	float fps;
+	int32_t flags;
+	int32_t activity;
+	int32_t actweight;
+	int32_t numevents;
+	int32_t eventindex;
+	uint8_t unused[120];
+} mdlseqdesc;
+
+typedef struct mdlevent {
+	int32_t frame;
+	int32_t event;
+	int32_t type;
+	char options[64];
+} mdlevent;
+
+typedef void(*mdl_dependency_reader)(void* user, const char* dependency);
+
+// name is the model's own path, models/foo.mdl, the others are named after it
+bool mdl_read_dependencies(const void* data, size_t len, const char* name, mdl_dependency_reader reader, void* user);
\ No newline at end of file
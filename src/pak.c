@@ -0,0 +1,83 @@
+#include <assert.h>
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "pak.h"
+
+bool pak_is_archive_name(const char* name, int* number) {
+	assert(name != NULL);
+	if (strncasecmp(name, "pak", 3) != 0 || !isdigit((unsigned char)name[3]))
+		return false;
+
+	char* end;
+	long n = strtol(name + 3, &end, 10);
+	if (strcasecmp(end, ".pak") != 0 || n > 99)
+		return false;
+
+	if (number) *number = (int)n;
+	return true;
+}
+
+// the whole pak stays mapped, entries are read straight out of it
+bool pak_open(const char* path, pak_archive* pak) {
+	assert(path != NULL);
+	assert(pak != NULL);
+	memset(pak, 0, sizeof(pak_archive));
+
+	if (!get_file_info(path, &pak->info) || !map_file(path, &pak->file))
+		return false;
+
+	pakheader header;
+	if (pak->file.size < sizeof(pakheader))
+		goto error;
+	memcpy(&header, pak->file.data, sizeof(pakheader));
+
+	if (memcmp(header.magic, PAK_MAGIC, 4) != 0 || header.dir_offset < 0 || header.dir_length < 0
+		|| header.dir_length % sizeof(pakentry) != 0
+		|| (uint64_t)header.dir_offset + (uint64_t)header.dir_length > pak->file.size) {
+		goto error;
+	}
+
+	pak->path = strdup(path);
+	pak->dir = (const uint8_t*)pak->file.data + header.dir_offset;
+	pak->count = header.dir_length / sizeof(pakentry);
+	return true;
+error:
+	unmap_file(&pak->file);
+	return false;
+}
+
+// name must hold PAK_NAME_LENGTH + 1 chars, entries that point outside the file are rejected
+bool pak_entry(const pak_archive* pak, size_t index, char* name, uint64_t* offset, uint64_t* length) {
+	assert(pak != NULL);
+	assert(index < pak->count);
+
+	// the directory isn't necessarily aligned
+	pakentry entry;
+	memcpy(&entry, pak->dir + index * sizeof(pakentry), sizeof(pakentry));
+
+	if (entry.offset < 0 || entry.length < 0 || (uint64_t)entry.offset + (uint64_t)entry.length > pak->file.size)
+		return false;
+
+	memcpy(name, entry.name, PAK_NAME_LENGTH);
+	name[PAK_NAME_LENGTH] = 0;
+	*offset = (uint64_t)entry.offset;
+	*length = (uint64_t)entry.length;
+	return name[0] != 0;
+}
+
+const void* pak_data(const pak_archive* pak, uint64_t offset) {
+	assert(pak != NULL);
+	assert(offset <= pak->file.size);
+	return (const uint8_t*)pak->file.data + offset;
+}
+
+void pak_close(pak_archive* pak) {
+	assert(pak != NULL);
+	unmap_file(&pak->file);
+	free(pak->path);
+	memset(pak, 0, sizeof(pak_archive));
+}
\ No newline at end of file
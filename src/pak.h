@@ -0,0 +1,37 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "common.h"
+
+#define PAK_MAGIC "PACK"
+#define PAK_NAME_LENGTH 56
+
+typedef struct pakheader {
+	char magic[4];
+	int32_t dir_offset;
+	int32_t dir_length;
+} pakheader;
+
+typedef struct pakentry {
+	char name[PAK_NAME_LENGTH];
+	int32_t offset;
+	int32_t length;
+} pakentry;
+
+// a pak file mapped for reading, number is the N in pakN.pak
+typedef struct pak_archive {
+	char* path;
+	file_info info;
+	mapped_file file;
+	const uint8_t* dir;
+	size_t count;
+	int number;
+} pak_archive;
+
+bool pak_is_archive_name(const char* name, int* number);
+bool pak_open(const char* path, pak_archive* pak);
+bool pak_entry(const pak_archive* pak, size_t index, char* name, uint64_t* offset, uint64_t* length);
+const void* pak_data(const pak_archive* pak, uint64_t offset);
+void pak_close(pak_archive* pak);
\ No newline at end of file
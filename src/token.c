@@ -5,12 +5,19 @@
 
 #include "token.h"
 
-const char* stream;
-EntityToken token;
+void lexer_init(EntityLexer* lexer, const char* stream) {
+	assert(lexer != NULL);
+	assert(stream != NULL);
 
-bool string_token_end() {
-	const char* s = stream;
+	lexer->start = stream;
+	lexer->stream = stream;
+	lexer->error = NULL;
+	lexer->token.type = TOKEN_NULL;
+	lexer->token.start = NULL;
+	lexer->token.end = NULL;
+}
 
+static bool string_token_end(const char* s) {
 	if (*s != '"')
 		return FALSE;
 
@@ -29,7 +36,9 @@ bool string_token_end() {
 	return FALSE;
 }
 
-void next_token(void) {
+void next_token(EntityLexer* lexer) {
+	const char* stream = lexer->stream;
+	EntityToken* token = &lexer->token;
 repeat:
 	switch (*stream) {
 	case '/':
@@ -48,54 +57,56 @@ repeat:
 		goto repeat;
 		break;
 	case '{': case '(':
-		token.type = TOKEN_BEGIN_ENT;
+		token->type = TOKEN_BEGIN_ENT;
 		stream++;
 		break;
 	case '}': case ')':
-		token.type = TOKEN_END_ENT;
+		token->type = TOKEN_END_ENT;
 		stream++;
 		break;
 	case '"': {
 		const char* start = ++stream;
-		while (!string_token_end()) {
+		while (!string_token_end(stream)) {
 			stream++;
 		}
-		token.start = start;
-		token.end = stream++;
-		token.type = TOKEN_STR;
+		token->start = start;
+		token->end = stream++;
+		token->type = TOKEN_STR;
 		break;
 	}
 	case EOF:
 	case 0:
-		token.type = TOKEN_NULL;
+		token->type = TOKEN_NULL;
 		break;
 	default:
 		stream++;
 		goto repeat;
 		break;
 	}
+	lexer->stream = stream;
 }
 
 void token_test(void) {
 	char* s = "{\n\"origin\" \"490 562 -44\"\n}";
-	stream = s;
+	EntityLexer lexer;
+	lexer_init(&lexer, s);
 
 	char key[32];
 	char value[32];
 
-	next_token();
-	assert(match_token(TOKEN_BEGIN_ENT));
+	next_token(&lexer);
+	assert(match_token(&lexer, TOKEN_BEGIN_ENT));
 
-	assert(is_token(TOKEN_STR));
-	strncpy(key, token.start, token.end - token.start);
-	key[token.end - token.start] = 0;
+	assert(is_token(&lexer, TOKEN_STR));
+	strncpy(key, lexer.token.start, lexer.token.end - lexer.token.start);
+	key[lexer.token.end - lexer.token.start] = 0;
 	assert(strcmp(key, "origin") == 0);
 
-	assert(match_token(TOKEN_STR));
-	strncpy(value, token.start, token.end - token.start);
-	value[token.end - token.start] = 0;
+	assert(match_token(&lexer, TOKEN_STR));
+	strncpy(value, lexer.token.start, lexer.token.end - lexer.token.start);
+	value[lexer.token.end - lexer.token.start] = 0;
 	assert(strcmp(value, "490 562 -44") == 0);
 
-	next_token();
-	assert(match_token(TOKEN_END_ENT));
+	next_token(&lexer);
+	assert(match_token(&lexer, TOKEN_END_ENT));
 }
\ No newline at end of file
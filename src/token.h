@@ -15,30 +15,36 @@ typedef struct Token {
 	const char* end;
 } EntityToken;
 
-const char* stream;
-EntityToken token;
+// error is where parsing failed, NULL until it does
+typedef struct EntityLexer {
+	const char* start;
+	const char* stream;
+	const char* error;
+	EntityToken token;
+} EntityLexer;
 
-void next_token(void);
+void lexer_init(EntityLexer* lexer, const char* stream);
+void next_token(EntityLexer* lexer);
 
-inline bool is_token(EntityTokenType type) {
-	return token.type == type;
+inline bool is_token(EntityLexer* lexer, EntityTokenType type) {
+	return lexer->token.type == type;
 }
 
-inline bool match_token(EntityTokenType type) {
-	if (is_token(type)) {
-		next_token();
+inline bool match_token(EntityLexer* lexer, EntityTokenType type) {
+	if (is_token(lexer, type)) {
+		next_token(lexer);
 		return true;
 	}
 	return false;
 }
 
-inline bool expect_token(EntityTokenType type) {
-	if (is_token(type)) {
-		next_token();
+inline bool expect_token(EntityLexer* lexer, EntityTokenType type) {
+	if (is_token(lexer, type)) {
+		next_token(lexer);
 		return true;
 	}
 	else {
-		printf("Error: failed parsing entity token near:\n\n%.200s\n\n", stream-100);
+		lexer->error = lexer->stream - min(lexer->stream - lexer->start, 100);
 		return false;
 	}
 }
@@ -0,0 +1,62 @@
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "wad.h"
+
+bool wad_read_lumps(const void* data, size_t len, wad_lump_reader reader, void* user) {
+	assert(reader != NULL);
+	const uint8_t* bytes = (const uint8_t*)data;
+
+	wadheader header;
+	if (len < sizeof(header))
+		return false;
+	memcpy(&header, bytes, sizeof(header));
+	if (memcmp(header.magic, WAD_MAGIC, 4) != 0 || header.numlumps < 0 || header.infotableofs < 0 ||
+		(size_t)header.infotableofs > len || (size_t)header.numlumps > (len - header.infotableofs) / sizeof(wadlump)) {
+		return false;
+	}
+
+	char name[WAD_NAME_LENGTH + 1];
+	for (int32_t i = 0; i < header.numlumps; ++i) {
+		wadlump lump;
+		memcpy(&lump, bytes + header.infotableofs + i * sizeof(wadlump), sizeof(lump));
+		if (lump.filepos < 0 || lump.disksize < 0 || (size_t)lump.filepos > len || (size_t)lump.disksize > len - lump.filepos)
+			continue;
+
+		memcpy(name, lump.name, WAD_NAME_LENGTH);
+		name[WAD_NAME_LENGTH] = 0;
+		reader(user, &lump, name);
+	}
+	return true;
+}
+
+void* wad_build(const void* data, const wadlump* lumps, size_t count, size_t* len) {
+	assert(len != NULL);
+	const uint8_t* bytes = (const uint8_t*)data;
+	size_t size = sizeof(wadheader);
+	for (size_t i = 0; i < count; ++i) {
+		size += ((size_t)lumps[i].disksize + WAD_LUMP_ALIGN - 1) & ~(size_t)(WAD_LUMP_ALIGN - 1);
+	}
+	size_t directory = size;
+	size += count * sizeof(wadlump);
+
+	uint8_t* wad = xcalloc(size, 1);
+	wadheader header;
+	memcpy(header.magic, WAD_MAGIC, 4);
+	header.numlumps = (int32_t)count;
+	header.infotableofs = (int32_t)directory;
+	memcpy(wad, &header, sizeof(header));
+
+	size_t offset = sizeof(wadheader);
+	for (size_t i = 0; i < count; ++i) {
+		wadlump lump = lumps[i];
+		memcpy(wad + offset, bytes + lump.filepos, (size_t)lump.disksize);
+		lump.filepos = (int32_t)offset;
+		memcpy(wad + directory + i * sizeof(wadlump), &lump, sizeof(lump));
+		offset += ((size_t)lump.disksize + WAD_LUMP_ALIGN - 1) & ~(size_t)(WAD_LUMP_ALIGN - 1);
+	}
+	*len = size;
+	return wad;
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// WAD3 texture packages: a header, the lumps and then a directory of them.
+
+#define WAD_MAGIC "WAD3"
+#define WAD_NAME_LENGTH 16
+#define WAD_TYPE_MIPTEX 0x43
+#define WAD_LUMP_ALIGN 4
+
+typedef struct wadheader {
+	char magic[4];
+	int32_t numlumps;
+	int32_t infotableofs;
+} wadheader;
+
+typedef struct wadlump {
+	int32_t filepos;
+	int32_t disksize;
+	int32_t size;
+	char type;
+	char compression;
+	int16_t pad;
+	char name[WAD_NAME_LENGTH];
+} wadlump;
+
+typedef void(*wad_lump_reader)(void* user, const wadlump* lump, const char* name);
+
+// calls reader for every lump that lies inside the file, name is the lump's terminated name
+bool wad_read_lumps(const void* data, size_t len, wad_lump_reader reader, void* user);
+// a new wad holding the given lumps of data, copied as they are and 4 byte aligned
+void* wad_build(const void* data, const wadlump* lumps, size_t count, size_t* len);
\ No newline at end of file
@@ -0,0 +1,250 @@
+// Builds res/goldsrc-manifest.h from res/goldsrc-manifest.lst: a minimal perfect
+// hash over the manifest so excluded files are found with one hash, one table
+// index and one compare, without building anything at startup.
+//
+//   mkmanifest <goldsrc-manifest.lst> <goldsrc-manifest.h>
+//
+// Keys are hashed case folded with forward slashes and split into buckets by the
+// top of their hash, then the biggest buckets first each search for a seed that
+// drops all of their keys into free slots. Each slot keeps the bottom of its
+// key's hash as a fingerprint so most misses never touch the string.
+// exclude.c must hash and mix keys exactly the same way.
+//
+// Entries ending in a slash exclude a whole directory, those are listed as is
+// and loaded into the exclusion trie instead. A file entry may be followed by
+// the XXH64 of the stock file in hex, "sound/ambience/thunder.wav", 0x...,
+// which is what `xxhsum -H1` prints, then only a file with those bytes is
+// excluded. Entries without one are excluded by name.
+
+#define _CRT_SECURE_NO_WARNINGS
+#define _CRT_NONSTDC_NO_WARNINGS
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define KEYS_PER_BUCKET 4
+#define MAX_SEED 0xFFFFFF
+#define MAX_LINE 1024
+
+typedef struct key {
+	char* str;
+	uint64_t hash;
+	uint64_t content;
+} key;
+
+static char** dirs;
+static uint32_t ndirs;
+
+typedef struct bucket {
+	uint32_t* keys;
+	uint32_t count;
+	uint32_t index;
+} bucket;
+
+static uint64_t hash_key(const char* str) {
+	uint64_t hash = 0xCBF29CE484222325;
+	for (; *str; ++str) {
+		char c = *str == '\\' ? '/' : (char)tolower((unsigned char)*str);
+		hash = hash ^ (uint8_t)c;
+		hash = hash * 0x100000001B3;
+	}
+	return hash;
+}
+
+static uint64_t mix(uint64_t x) {
+	x ^= x >> 33;
+	x *= 0xFF51AFD7ED558CCD;
+	x ^= x >> 33;
+	x *= 0xC4CEB9FE1A85EC53;
+	x ^= x >> 33;
+	return x;
+}
+
+static uint32_t key_slot(uint64_t hash, uint32_t seed, uint32_t count) {
+	return (uint32_t)(mix(hash ^ seed) % count);
+}
+
+static void* xrealloc(void* ptr, size_t size) {
+	ptr = realloc(ptr, size);
+	if (!ptr) {
+		fprintf(stderr, "mkmanifest: out of memory\n");
+		exit(EXIT_FAILURE);
+	}
+	return ptr;
+}
+
+static int compare_buckets(const void* a, const void* b) {
+	const bucket* x = (const bucket*)a;
+	const bucket* y = (const bucket*)b;
+	if (x->count != y->count)
+		return x->count < y->count ? 1 : -1;
+	return x->index < y->index ? -1 : 1;
+}
+
+// lines look like "sound/ambience/drips.wav", with an optional hash after the comma
+static char* parse_line(char* line, uint64_t* content) {
+	char* start = strchr(line, '"');
+	if (!start)
+		return NULL;
+	char* end = strchr(++start, '"');
+	if (!end || end == start)
+		return NULL;
+	*end = 0;
+
+	char* hex = end + 1;
+	while (isspace((unsigned char)*hex) || *hex == ',') {
+		hex++;
+	}
+	*content = strtoull(hex, NULL, 16);
+	return start;
+}
+
+static key* read_keys(const char* path, uint32_t* count) {
+	FILE* fp = fopen(path, "r");
+	if (!fp) {
+		perror(path);
+		exit(EXIT_FAILURE);
+	}
+
+	key* keys = NULL;
+	uint32_t len = 0, cap = 0;
+	char line[MAX_LINE];
+	while (fgets(line, sizeof(line), fp)) {
+		uint64_t content;
+		char* str = parse_line(line, &content);
+		if (!str)
+			continue;
+		if (str[strlen(str) - 1] == '/') {
+			dirs = xrealloc(dirs, (ndirs + 1) * sizeof(char*));
+			dirs[ndirs++] = strdup(str);
+			continue;
+		}
+		if (len == cap) {
+			cap = cap ? cap * 2 : 1024;
+			keys = xrealloc(keys, cap * sizeof(key));
+		}
+		keys[len].str = strdup(str);
+		keys[len].hash = hash_key(str);
+		keys[len].content = content;
+		len++;
+	}
+	fclose(fp);
+
+	for (uint32_t i = 0; i < len; ++i) {
+		for (uint32_t j = 0; j < i; ++j) {
+			if (keys[i].hash == keys[j].hash) {
+				fprintf(stderr, "mkmanifest: duplicate or colliding entries \"%s\" and \"%s\"\n", keys[j].str, keys[i].str);
+				exit(EXIT_FAILURE);
+			}
+		}
+	}
+	*count = len;
+	return keys;
+}
+
+int main(int argc, char* argv[]) {
+	if (argc != 3) {
+		fprintf(stderr, "usage: mkmanifest <manifest.lst> <manifest.h>\n");
+		return EXIT_FAILURE;
+	}
+
+	uint32_t nkeys;
+	key* keys = read_keys(argv[1], &nkeys);
+	if (nkeys == 0) {
+		fprintf(stderr, "mkmanifest: no entries in %s\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+
+	uint32_t nbuckets = (nkeys + KEYS_PER_BUCKET - 1) / KEYS_PER_BUCKET;
+	bucket* buckets = calloc(nbuckets, sizeof(bucket));
+	uint32_t* seeds = calloc(nbuckets, sizeof(uint32_t));
+	int32_t* slots = malloc(nkeys * sizeof(int32_t));
+	uint32_t* taken = NULL;
+	if (!buckets || !seeds || !slots) {
+		fprintf(stderr, "mkmanifest: out of memory\n");
+		return EXIT_FAILURE;
+	}
+
+	for (uint32_t i = 0; i < nbuckets; ++i) {
+		buckets[i].index = i;
+	}
+	for (uint32_t i = 0; i < nkeys; ++i) {
+		bucket* b = &buckets[(uint32_t)(keys[i].hash >> 32) % nbuckets];
+		b->keys = xrealloc(b->keys, (b->count + 1) * sizeof(uint32_t));
+		b->keys[b->count++] = i;
+	}
+	qsort(buckets, nbuckets, sizeof(bucket), compare_buckets);
+
+	for (uint32_t i = 0; i < nkeys; ++i) {
+		slots[i] = -1;
+	}
+	for (uint32_t i = 0; i < nbuckets && buckets[i].count; ++i) {
+		const bucket* b = &buckets[i];
+		taken = xrealloc(taken, b->count * sizeof(uint32_t));
+
+		uint32_t seed;
+		for (seed = 1; seed <= MAX_SEED; ++seed) {
+			uint32_t placed = 0;
+			for (; placed < b->count; ++placed) {
+				uint32_t slot = key_slot(keys[b->keys[placed]].hash, seed, nkeys);
+				if (slots[slot] >= 0)
+					break;
+				// claim it so keys of the same bucket can't share a slot
+				slots[slot] = (int32_t)b->keys[placed];
+				taken[placed] = slot;
+			}
+			if (placed == b->count)
+				break;
+			while (placed--) {
+				slots[taken[placed]] = -1;
+			}
+		}
+		if (seed > MAX_SEED) {
+			fprintf(stderr, "mkmanifest: no seed found for bucket %u\n", b->index);
+			return EXIT_FAILURE;
+		}
+		seeds[b->index] = seed;
+	}
+
+	FILE* out = fopen(argv[2], "wb");
+	if (!out) {
+		perror(argv[2]);
+		return EXIT_FAILURE;
+	}
+	fprintf(out, "// generated by tools/mkmanifest.c from goldsrc-manifest.lst, do not edit\n");
+	fprintf(out, "#define MANIFEST_COUNT %u\n", nkeys);
+	fprintf(out, "#define MANIFEST_BUCKETS %u\n\n", nbuckets);
+
+	fprintf(out, "static const uint32_t manifest_seeds[MANIFEST_BUCKETS] = {");
+	for (uint32_t i = 0; i < nbuckets; ++i) {
+		fprintf(out, "%s%u,", i % 16 ? " " : "\n\t", seeds[i]);
+	}
+	fprintf(out, "\n};\n\n");
+
+	// one literal per slot, a single packed literal would be over MSVC's string size limit
+	fprintf(out, "static const manifest_slot manifest_slots[MANIFEST_COUNT] = {\n");
+	for (uint32_t i = 0; i < nkeys; ++i) {
+		const key* k = &keys[slots[i]];
+		if (k->content) {
+			fprintf(out, "\t{ 0x%08X, 0x%016llX, \"%s\" },\n", (uint32_t)k->hash, (unsigned long long)k->content, k->str);
+		}
+		else {
+			fprintf(out, "\t{ 0x%08X, 0, \"%s\" },\n", (uint32_t)k->hash, k->str);
+		}
+	}
+	fprintf(out, "};\n\n");
+
+	fprintf(out, "static const char* const manifest_dirs[] = {\n");
+	for (uint32_t i = 0; i < ndirs; ++i) {
+		fprintf(out, "\t\"%s\",\n", dirs[i]);
+	}
+	fprintf(out, "\tNULL,\n};");
+
+	if (fclose(out) != 0) {
+		perror(argv[2]);
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
\ No newline at end of file